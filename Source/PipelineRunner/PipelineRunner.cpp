@@ -55,6 +55,9 @@
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/MemoryResource.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/DataContainers/SharedMemoryDataExchange.h"
 #include "SIMPLib/FilterParameters/H5FilterParametersReader.h"
 #include "SIMPLib/FilterParameters/JsonFilterParametersReader.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
@@ -121,17 +124,36 @@ int main(int argc, char* argv[])
                                      "Pipeline File as a JSON file.", "file");
   parser.addOption(pipelineFileArg);
 
+  QCommandLineOption memoryResourceArg(QStringList() << "m"
+                                                     << "memory-resource",
+                                       QString("How data arrays are allocated: %1. The default is 'default'.").arg(MemoryResource::GetNames().join(", ")), "resource", "default");
+  parser.addOption(memoryResourceArg);
+
+  QCommandLineOption sharedMemoryArg(QStringList() << "s"
+                                                   << "shared-memory",
+                                     "Copy the arrays of the finished pipeline into a POSIX shared memory object with this name for another process to import.", "name");
+  parser.addOption(sharedMemoryArg);
+
   // Process the actual command line arguments given by the user
   parser.process(app);
 
   QString pipelineFile = parser.value(pipelineFileArg);
 
+  bool validResource = false;
+  MemoryResource::Pointer memoryResource = MemoryResource::FromName(parser.value(memoryResourceArg), &validResource);
+  if(!validResource)
+  {
+    std::cout << "Unknown memory resource '" << parser.value(memoryResourceArg).toStdString() << "'. Exiting now." << std::endl;
+    return EXIT_FAILURE;
+  }
+
   std::cout << "PipelineRunner " << SIMPLib::Version::PackageComplete().toStdString() << std::endl;
   std::cout << "Input File: " << pipelineFile.toStdString() << std::endl;
 
-  // Register all the filters including trying to load those from Plugins
+  // Register all the filters. Plugins that are up to date in the plugin manifest are only loaded
+  // once the pipeline asks for one of their filters.
   FilterManager* fm = FilterManager::Instance();
-  SIMPLibPluginLoader::LoadPluginFilters(fm);
+  SIMPLibPluginLoader::LoadPluginManifest(fm);
 
 #ifdef SIMPL_EMBED_PYTHON
   if(hasPythonHome)
@@ -188,6 +210,8 @@ int main(int argc, char* argv[])
     return EXIT_FAILURE;
   }
 
+  pipeline->setMemoryResource(memoryResource);
+
   std::cout << "Pipeline Count: " << pipeline->size() << std::endl;
   Observer obs; // Create an Observer to report errors/progress from the executing pipeline
   pipeline->addMessageReceiver(&obs);
@@ -199,7 +223,7 @@ int main(int argc, char* argv[])
     return EXIT_FAILURE;
   }
   // Now actually execute the pipeline
-  pipeline->execute();
+  DataContainerArray::Pointer dca = pipeline->execute();
   err = pipeline->getErrorCode();
   if(err < 0)
   {
@@ -207,5 +231,17 @@ int main(int argc, char* argv[])
     return EXIT_FAILURE;
   }
 
+  if(parser.isSet(sharedMemoryArg))
+  {
+    QString errorMessage;
+    err = SharedMemoryDataExchange::Export(dca, parser.value(sharedMemoryArg), &errorMessage);
+    if(err < 0)
+    {
+      std::cout << errorMessage.toStdString() << std::endl;
+      return EXIT_FAILURE;
+    }
+    std::cout << "Exported the data to shared memory '" << SharedMemoryDataExchange::NormalizeName(parser.value(sharedMemoryArg)).toStdString() << "'" << std::endl;
+  }
+
   return EXIT_SUCCESS;
 }
@@ -92,6 +92,7 @@ inline constexpr uint32_t UnknownRefFrameZDirection = 2;
 namespace TypeNames
 {
 inline const QString Bool("bool");
+inline const QString Bit("bit");
 inline const QString Float("float");
 inline const QString Double("double");
 inline const QString Int8("int8_t");
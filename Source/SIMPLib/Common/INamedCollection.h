@@ -47,6 +47,8 @@ class INamedObject;
  */
 class SIMPLib_EXPORT INamedCollection
 {
+  friend INamedObject;
+
 public:
   using Self = INamedCollection;
   using Pointer = std::shared_ptr<Self>;
@@ -115,5 +117,12 @@ protected:
    */
   void handleRemovingObject(INamedObject* obj);
 
+  /**
+   * @brief Called by the INamedObject after it was renamed from a name with the hash 'oldNameHash'.
+   * @param obj
+   * @param oldNameHash
+   */
+  virtual void updateObjectName(INamedObject* obj, size_t oldNameHash) = 0;
+
 private:
 };
@@ -83,8 +83,13 @@ bool INamedObject::setName(const QString& name)
     }
   }
 
+  HashType oldNameHash = m_NameHash;
   m_NameHash = CreateHash(name);
   m_Name = name;
+  for(const auto& collection : m_ParentCollctions)
+  {
+    collection->updateObjectName(this, oldNameHash);
+  }
   return true;
 }
 
@@ -35,6 +35,7 @@
 #include <memory>
 #include <set>
 #include <type_traits>
+#include <unordered_map>
 
 #include <QtCore/QString>
 
@@ -48,7 +49,8 @@
  * By deriving from INamedCollection, the items in the collection can keep track
  * of what collections they are in.  This, along with the custom hashing in
  * INamedObject, allows the collection to be treated like a map without separating
- * the key and value.
+ * the key and value. Items are indexed by the hash of their names, so lookups by name
+ * take constant time; renaming an item updates the index of every collection holding it.
  */
 template <class T>
 class NamedCollection : public INamedCollection
@@ -63,6 +65,7 @@ public:
 
 private:
   Collection m_Items;
+  std::unordered_map<INamedObject::HashType, Iterator> m_NameIndex;
 
 public:
   /* --------------- Begin STL iterator support ------------------ */
@@ -113,20 +116,44 @@ public:
       handleRemovingObject(item.get());
     }
     m_Items.clear();
+    m_NameIndex.clear();
   }
 
   /**
    * @brief Default constructor
    */
   NamedCollection() = default;
-  // NamedCollection(const NamedCollection<T>& other)
-  //: m_Items(other.m_Items)
-  //{
-  //  for(const auto& item : *this)
-  //  {
-  //    handleAddingObject(item);
-  //  }
-  //}
+
+  /**
+   * @brief Copy constructor. The copy is registered with its items like the original.
+   * @param other
+   */
+  NamedCollection(const NamedCollection<T>& other)
+  : INamedCollection(other)
+  {
+    for(const auto& item : other)
+    {
+      insert(item);
+    }
+  }
+
+  /**
+   * @brief Copy assignment. The collection is registered with its new items like the original.
+   * @param other
+   * @return
+   */
+  NamedCollection<T>& operator=(const NamedCollection<T>& other)
+  {
+    if(this != &other)
+    {
+      clear();
+      for(const auto& item : other)
+      {
+        insert(item);
+      }
+    }
+    return *this;
+  }
 
   /**
    * @brief Remove all children from the collection before it is destroyed.
@@ -161,17 +188,12 @@ public:
    */
   Iterator find(const QString& name) const
   {
-    // Hash the target name to reduce the time required for each item
-    INamedObject::HashType targetHash = INamedObject::CreateHash(name);
-    auto unaryPredicate = [name, targetHash](const ChildType& obj) {
-      if(obj->getNameHash() == targetHash)
-      {
-        return true;
-      }
-      return false;
-    };
-
-    return std::find_if(begin(), end(), unaryPredicate);
+    auto indexIter = m_NameIndex.find(INamedObject::CreateHash(name));
+    if(indexIter == m_NameIndex.end())
+    {
+      return end();
+    }
+    return indexIter->second;
   }
 
   /**
@@ -187,6 +209,7 @@ public:
     }
 
     handleRemovingObject((*iter).get());
+    m_NameIndex.erase((*iter)->getNameHash());
     m_Items.erase(iter);
   }
 
@@ -201,10 +224,16 @@ public:
     {
       return false;
     }
-    if(!m_Items.insert(newItem).second)
+    if(m_NameIndex.find(newItem->getNameHash()) != m_NameIndex.end())
+    {
+      return false;
+    }
+    auto result = m_Items.insert(newItem);
+    if(!result.second)
     {
       return false;
     }
+    m_NameIndex[newItem->getNameHash()] = result.first;
 
     handleAddingObject(newItem.get());
     return true;
@@ -266,4 +295,22 @@ public:
   {
     return m_Items == other.m_Items;
   }
+
+protected:
+  /**
+   * @brief Moves the index entry of a renamed item to its new name.
+   * @param obj
+   * @param oldNameHash
+   */
+  void updateObjectName(INamedObject* obj, size_t oldNameHash) override
+  {
+    auto indexIter = m_NameIndex.find(oldNameHash);
+    if(indexIter == m_NameIndex.end() || static_cast<INamedObject*>(indexIter->second->get()) != obj)
+    {
+      return;
+    }
+    Iterator item = indexIter->second;
+    m_NameIndex.erase(indexIter);
+    m_NameIndex[obj->getNameHash()] = item;
+  }
 };
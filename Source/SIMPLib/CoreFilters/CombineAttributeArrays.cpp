@@ -45,6 +45,7 @@
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/MultiDataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/Utilities/ArrayKernels.hpp"
 
 enum createdPathID : RenameDataPath::DataID_t
 {
@@ -80,93 +81,39 @@ public:
   {
     typename DataArrayType::Pointer outputDataPtr = std::dynamic_pointer_cast<DataArrayType>(outputIDataArray);
 
-    std::vector<DataType*> inputArrays;
+    std::vector<const DataType*> inputArrays;
+    std::vector<size_t> inputComponents;
     int32_t numArrays = inputIDataArrays.size();
 
     for(int32_t i = 0; i < numArrays; i++)
     {
-      DataType* inputData = (std::dynamic_pointer_cast<DataArrayType>(inputIDataArrays.at(i).lock()))->getPointer(0);
-      inputArrays.push_back(inputData);
+      typename DataArrayType::Pointer inputDataPtr = std::dynamic_pointer_cast<DataArrayType>(inputIDataArrays.at(i).lock());
+      inputArrays.push_back(inputDataPtr->getPointer(0));
+      inputComponents.push_back(static_cast<size_t>(inputDataPtr->getNumberOfComponents()));
     }
-    DataType* outputData = static_cast<DataType*>(outputDataPtr->getPointer(0));
+    DataType* outputData = outputDataPtr->getPointer(0);
 
     size_t numTuples = inputIDataArrays[0].lock()->getNumberOfTuples();
-    int32_t stackedDims = outputIDataArray.get()->getNumberOfComponents();
-    size_t arrayOffset = 0;
-    int32_t numDims = 0;
 
     if(filter->getNormalizeData())
     {
-      std::vector<DataType> maxVals(stackedDims, std::numeric_limits<DataType>::lowest());
-      std::vector<DataType> minVals(stackedDims, std::numeric_limits<DataType>::max());
+      std::vector<DataType> maxVals;
+      std::vector<DataType> minVals;
 
       for(int32_t i = 0; i < numArrays; i++)
       {
-        numDims = inputIDataArrays[i].lock()->getNumberOfComponents();
-        if(i > 0)
-        {
-          arrayOffset += inputIDataArrays[i - 1].lock()->getNumberOfComponents();
-        }
-        for(size_t j = 0; j < numTuples; j++)
-        {
-          for(int32_t k = 0; k < numDims; k++)
-          {
-            if(inputArrays[i][numDims * j + k] > maxVals[arrayOffset + k])
-            {
-              maxVals[arrayOffset + k] = inputArrays[i][numDims * j + k];
-            }
-            if(inputArrays[i][numDims * j + k] < minVals[arrayOffset + k])
-            {
-              minVals[arrayOffset + k] = inputArrays[i][numDims * j + k];
-            }
-          }
-        }
+        std::vector<DataType> arrayMinVals;
+        std::vector<DataType> arrayMaxVals;
+        ArrayKernels::ComputeComponentRanges(inputArrays[i], inputComponents[i], numTuples, arrayMinVals, arrayMaxVals);
+        minVals.insert(minVals.end(), arrayMinVals.begin(), arrayMinVals.end());
+        maxVals.insert(maxVals.end(), arrayMaxVals.begin(), arrayMaxVals.end());
       }
 
-      arrayOffset = 0;
-
-      for(size_t i = 0; i < numTuples; i++)
-      {
-        for(int32_t j = 0; j < numArrays; j++)
-        {
-          numDims = inputIDataArrays[j].lock()->getNumberOfComponents();
-          if(j > 0)
-          {
-            arrayOffset += inputIDataArrays[j - 1].lock()->getNumberOfComponents();
-          }
-          for(int32_t k = 0; k < numDims; k++)
-          {
-            if(maxVals[arrayOffset + k] == minVals[arrayOffset + k])
-            {
-              outputData[stackedDims * i + (arrayOffset) + k] = static_cast<DataType>(0);
-            }
-            else
-            {
-              outputData[stackedDims * i + (arrayOffset) + k] = (inputArrays[j][numDims * i + k] - minVals[arrayOffset + k]) / (maxVals[arrayOffset + k] - minVals[arrayOffset + k]);
-            }
-          }
-        }
-        arrayOffset = 0;
-      }
+      ArrayKernels::InterleaveNormalized(inputArrays, inputComponents, numTuples, minVals, maxVals, outputData);
     }
     else
     {
-      for(size_t i = 0; i < numTuples; i++)
-      {
-        for(int32_t j = 0; j < numArrays; j++)
-        {
-          numDims = inputIDataArrays[j].lock()->getNumberOfComponents();
-          if(j > 0)
-          {
-            arrayOffset += inputIDataArrays[j - 1].lock()->getNumberOfComponents();
-          }
-          for(int32_t k = 0; k < numDims; k++)
-          {
-            outputData[stackedDims * i + (arrayOffset) + k] = inputArrays[j][numDims * i + k];
-          }
-        }
-        arrayOffset = 0;
-      }
+      ArrayKernels::Interleave(inputArrays, inputComponents, numTuples, outputData);
     }
   }
 
@@ -202,6 +149,14 @@ void CombineAttributeArrays::setupFilterParameters()
   setFilterParameters(parameters);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool CombineAttributeArrays::canReadFilterParametersConcurrently() const
+{
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -190,6 +190,11 @@ public:
    */
   void setupFilterParameters() override;
 
+  /**
+   * @brief canReadFilterParametersConcurrently Reimplemented from @see AbstractFilter class
+   */
+  bool canReadFilterParametersConcurrently() const override;
+
   /**
    * @brief execute Reimplemented from @see AbstractFilter class
    */
@@ -34,6 +34,7 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "ConditionalSetValue.h"
 
+#include <algorithm>
 #include <tuple>
 
 #include <QtCore/QTextStream>
@@ -67,6 +68,7 @@ void ConditionalSetValue::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_DOUBLE_FP("New Value", ReplaceValue, FilterParameter::Category::Parameter, ConditionalSetValue));
   {
     DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::TypeNames::Bool, 1, AttributeMatrix::Category::Any);
+    req.daTypes.push_back(SIMPL::TypeNames::Bit);
     parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Conditional Array", ConditionalArrayPath, FilterParameter::Category::RequiredArray, ConditionalSetValue, req));
   }
   {
@@ -88,6 +90,14 @@ void ConditionalSetValue::readFilterParameters(AbstractFilterParametersReader* r
   reader->closeFilterGroup();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ConditionalSetValue::canReadFilterParametersConcurrently() const
+{
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -124,16 +134,37 @@ void checkValuesFloatDouble(AbstractFilter* filter, double replaceValue, QString
 // -----------------------------------------------------------------------------
 
 template <typename T>
-void replaceValue(AbstractFilter* filter, IDataArray::Pointer inDataPtr, BoolArrayType::Pointer condDataPtr, double replaceValue)
+void replaceValue(AbstractFilter* filter, IDataArray::Pointer inDataPtr, IDataArray::Pointer condDataPtr, double replaceValue)
 {
   std::ignore = filter;
   typename DataArray<T>::Pointer inputArrayPtr = std::dynamic_pointer_cast<DataArray<T>>(inDataPtr);
 
   T replaceVal = static_cast<T>(replaceValue);
 
-  bool* condData = condDataPtr->getPointer(0);
   size_t numTuples = inputArrayPtr->getNumberOfTuples();
 
+  BitArray::Pointer bitCondDataPtr = std::dynamic_pointer_cast<BitArray>(condDataPtr);
+  if(nullptr != bitCondDataPtr)
+  {
+    // Words without a set bit skip 64 tuples at once
+    const BitArray::WordType* words = bitCondDataPtr->getWords();
+    size_t numWords = std::min(bitCondDataPtr->getNumberOfWords(), BitArray::NumberOfWords(numTuples));
+    for(size_t w = 0; w < numWords; w++)
+    {
+      BitArray::WordType word = words[w];
+      for(size_t iter = w * BitArray::k_BitsPerWord; word != 0 && iter < numTuples; iter++, word >>= 1)
+      {
+        if((word & 1) != 0)
+        {
+          inputArrayPtr->initializeTuple(iter, &replaceVal);
+        }
+      }
+    }
+    return;
+  }
+
+  bool* condData = std::dynamic_pointer_cast<BoolArrayType>(condDataPtr)->getPointer(0);
+
   for(size_t iter = 0; iter < numTuples; iter++)
   {
     if(condData[iter])
@@ -167,15 +198,25 @@ void ConditionalSetValue::dataCheck()
   }
   dataArrayPaths.push_back(getSelectedArrayPath());
 
-  std::vector<size_t> cDims(1, 1);
-  m_ConditionalArrayPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<bool>>(this, getConditionalArrayPath(), cDims);
+  m_ConditionalArray = nullptr;
+  m_ConditionalArrayPtr.reset();
+  m_BitConditionalArrayPtr = std::dynamic_pointer_cast<BitArray>(getDataContainerArray()->getPrereqIDataArrayFromPath(this, getConditionalArrayPath()));
   if(getErrorCode() < 0)
   {
     return;
   }
-  if(nullptr != m_ConditionalArrayPtr.lock())
+  if(nullptr == m_BitConditionalArrayPtr.lock())
   {
-    m_ConditionalArray = m_ConditionalArrayPtr.lock()->getPointer(0);
+    std::vector<size_t> cDims(1, 1);
+    m_ConditionalArrayPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<bool>>(this, getConditionalArrayPath(), cDims);
+    if(getErrorCode() < 0)
+    {
+      return;
+    }
+    if(nullptr != m_ConditionalArrayPtr.lock())
+    {
+      m_ConditionalArray = m_ConditionalArrayPtr.lock()->getPointer(0);
+    }
   }
   dataArrayPaths.push_back(getConditionalArrayPath());
 
@@ -247,7 +288,13 @@ void ConditionalSetValue::execute()
     return;
   }
 
-  EXECUTE_FUNCTION_TEMPLATE(this, replaceValue, m_ArrayPtr.lock(), this, m_ArrayPtr.lock(), m_ConditionalArrayPtr.lock(), m_ReplaceValue)
+  IDataArray::Pointer conditionalArray = m_ConditionalArrayPtr.lock();
+  if(nullptr != m_BitConditionalArrayPtr.lock())
+  {
+    conditionalArray = m_BitConditionalArrayPtr.lock();
+  }
+
+  EXECUTE_FUNCTION_TEMPLATE(this, replaceValue, m_ArrayPtr.lock(), this, m_ArrayPtr.lock(), conditionalArray, m_ReplaceValue)
 }
 
 // -----------------------------------------------------------------------------
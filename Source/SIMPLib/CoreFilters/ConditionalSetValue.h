@@ -38,6 +38,7 @@
 #include <memory>
 
 #include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/BitArray.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataArrays/IDataArray.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
@@ -172,6 +173,11 @@ public:
    */
   void readFilterParameters(AbstractFilterParametersReader* reader, int index) override;
 
+  /**
+   * @brief canReadFilterParametersConcurrently Reimplemented from @see AbstractFilter class
+   */
+  bool canReadFilterParametersConcurrently() const override;
+
   /**
    * @brief execute Reimplemented from @see AbstractFilter class
    */
@@ -192,6 +198,7 @@ protected:
 private:
   std::weak_ptr<DataArray<bool>> m_ConditionalArrayPtr;
   bool* m_ConditionalArray = nullptr;
+  std::weak_ptr<BitArray> m_BitConditionalArrayPtr;
 
   DataArrayPath m_SelectedArrayPath = {"", "", ""};
   DataArrayPath m_ConditionalArrayPath = {"", "", ""};
@@ -43,25 +43,47 @@
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/NumericTypeFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/Utilities/ArrayKernels.hpp"
 
-#define CHECK_AND_CONVERT(Type, DataContainer, ScalarType, Array, AttributeMatrixName, OutputName)                                                                                                     \
+#define CHECK_AND_CONVERT(Type, DataContainer, ScalarType, Array, AttributeMatrixName, OutputName, ConversionMode)                                                                                     \
   if(false == completed)                                                                                                                                                                               \
   {                                                                                                                                                                                                    \
     Type::Pointer Type##Ptr = std::dynamic_pointer_cast<Type>(Array);                                                                                                                                  \
     if(nullptr != Type##Ptr)                                                                                                                                                                           \
     {                                                                                                                                                                                                  \
       std::vector<size_t> dims = Array->getComponentDimensions();                                                                                                                                      \
-      Detail::ConvertData<Type>(this, Type##Ptr.get(), dims, DataContainer, ScalarType, AttributeMatrixName, OutputName);                                                                              \
+      Detail::ConvertData<Type>(this, Type##Ptr.get(), dims, DataContainer, ScalarType, AttributeMatrixName, OutputName, ConversionMode);                                                                \
       completed = true;                                                                                                                                                                                \
     }                                                                                                                                                                                                  \
   }
 
 namespace Detail
 {
+/**
+ * @brief ConvertInto Creates the converted array of type OutArrayType and fills it from ptr
+ * @param ptr IDataArray instance pointer
+ * @param dims Component dimensions
+ * @param m DataContainer instance pointer
+ * @param attributeMatrixName Name of target AttributeMatrix
+ * @param name Name of converted array
+ * @param mode How values that do not fit the new type are converted
+ */
+template <typename OutArrayType, typename T>
+void ConvertInto(T* ptr, const std::vector<size_t>& dims, const DataContainer::Pointer& m, const QString& attributeMatrixName, const QString& name, ArrayKernels::ConversionMode mode)
+{
+  typename OutArrayType::Pointer p = OutArrayType::CreateArray(ptr->getNumberOfTuples(), dims, name, true);
+  m->getAttributeMatrix(attributeMatrixName)->insertOrAssign(p);
+  if(ptr->getSize() > 0)
+  {
+    ArrayKernels::Convert(ptr->getPointer(0), ptr->getSize(), p->getPointer(0), mode);
+  }
+}
+
 template <typename T>
 /**
  * @brief ConvertData Templated function that converts an IDataArray to a given primitive type
@@ -71,111 +93,54 @@ template <typename T>
  * @param scalarType Primitive type to convert to
  * @param attributeMatrixName Name of target AttributeMatrix
  * @param name Name of converted array
+ * @param mode How values that do not fit the new type are converted
  */
 void ConvertData(AbstractFilter* filter, T* ptr, const std::vector<size_t>& dims, DataContainer::Pointer m, SIMPL::NumericTypes::Type scalarType, const QString attributeMatrixName,
-                 const QString& name)
+                 const QString& name, ArrayKernels::ConversionMode mode)
 {
-  size_t voxels = ptr->getNumberOfTuples();
-  size_t size = ptr->getSize();
-
   if(scalarType == SIMPL::NumericTypes::Type::Int8)
   {
-    Int8ArrayType::Pointer p = Int8ArrayType::CreateArray(voxels, dims, name, true);
-    m->getAttributeMatrix(attributeMatrixName)->insertOrAssign(p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<int8_t>(ptr->getValue(v)));
-    }
+    ConvertInto<Int8ArrayType>(ptr, dims, m, attributeMatrixName, name, mode);
   }
   else if(scalarType == SIMPL::NumericTypes::Type::UInt8)
   {
-    UInt8ArrayType::Pointer p = UInt8ArrayType::CreateArray(voxels, dims, name, true);
-    m->getAttributeMatrix(attributeMatrixName)->insertOrAssign(p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<uint8_t>(ptr->getValue(v)));
-    }
+    ConvertInto<UInt8ArrayType>(ptr, dims, m, attributeMatrixName, name, mode);
   }
   else if(scalarType == SIMPL::NumericTypes::Type::Int16)
   {
-    Int16ArrayType::Pointer p = Int16ArrayType::CreateArray(voxels, dims, name, true);
-    m->getAttributeMatrix(attributeMatrixName)->insertOrAssign(p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<int16_t>(ptr->getValue(v)));
-    }
+    ConvertInto<Int16ArrayType>(ptr, dims, m, attributeMatrixName, name, mode);
   }
   else if(scalarType == SIMPL::NumericTypes::Type::UInt16)
   {
-    UInt16ArrayType::Pointer p = UInt16ArrayType::CreateArray(voxels, dims, name, true);
-    m->getAttributeMatrix(attributeMatrixName)->insertOrAssign(p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<uint16_t>(ptr->getValue(v)));
-    }
+    ConvertInto<UInt16ArrayType>(ptr, dims, m, attributeMatrixName, name, mode);
   }
   else if(scalarType == SIMPL::NumericTypes::Type::Int32)
   {
-    Int32ArrayType::Pointer p = Int32ArrayType::CreateArray(voxels, dims, name, true);
-    m->getAttributeMatrix(attributeMatrixName)->insertOrAssign(p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<int32_t>(ptr->getValue(v)));
-    }
+    ConvertInto<Int32ArrayType>(ptr, dims, m, attributeMatrixName, name, mode);
   }
   else if(scalarType == SIMPL::NumericTypes::Type::UInt32)
   {
-    UInt32ArrayType::Pointer p = UInt32ArrayType::CreateArray(voxels, dims, name, true);
-    m->getAttributeMatrix(attributeMatrixName)->insertOrAssign(p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<uint32_t>(ptr->getValue(v)));
-    }
+    ConvertInto<UInt32ArrayType>(ptr, dims, m, attributeMatrixName, name, mode);
   }
   else if(scalarType == SIMPL::NumericTypes::Type::Int64)
   {
-    Int64ArrayType::Pointer p = Int64ArrayType::CreateArray(voxels, dims, name, true);
-    m->getAttributeMatrix(attributeMatrixName)->insertOrAssign(p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<int64_t>(ptr->getValue(v)));
-    }
+    ConvertInto<Int64ArrayType>(ptr, dims, m, attributeMatrixName, name, mode);
   }
   else if(scalarType == SIMPL::NumericTypes::Type::UInt64)
   {
-    UInt64ArrayType::Pointer p = UInt64ArrayType::CreateArray(voxels, dims, name, true);
-    m->getAttributeMatrix(attributeMatrixName)->insertOrAssign(p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<uint64_t>(ptr->getValue(v)));
-    }
+    ConvertInto<UInt64ArrayType>(ptr, dims, m, attributeMatrixName, name, mode);
   }
   else if(scalarType == SIMPL::NumericTypes::Type::Float)
   {
-    FloatArrayType::Pointer p = FloatArrayType::CreateArray(voxels, dims, name, true);
-    m->getAttributeMatrix(attributeMatrixName)->insertOrAssign(p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<float>(ptr->getValue(v)));
-    }
+    ConvertInto<FloatArrayType>(ptr, dims, m, attributeMatrixName, name, mode);
   }
   else if(scalarType == SIMPL::NumericTypes::Type::Double)
   {
-    DoubleArrayType::Pointer p = DoubleArrayType::CreateArray(voxels, dims, name, true);
-    m->getAttributeMatrix(attributeMatrixName)->insertOrAssign(p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<double>(ptr->getValue(v)));
-    }
+    ConvertInto<DoubleArrayType>(ptr, dims, m, attributeMatrixName, name, mode);
   }
   else if(scalarType == SIMPL::NumericTypes::Type::Bool)
   {
-    BoolArrayType::Pointer p = BoolArrayType::CreateArray(voxels, dims, name, true);
-    m->getAttributeMatrix(attributeMatrixName)->insertOrAssign(p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<bool>(ptr->getValue(v)));
-    }
+    ConvertInto<BoolArrayType>(ptr, dims, m, attributeMatrixName, name, mode);
   }
   else
   {
@@ -204,6 +169,10 @@ void ConvertData::setupFilterParameters()
   FilterParameterVectorType parameters;
 
   parameters.push_back(SIMPL_NEW_NUMERICTYPE_FP("Scalar Type", ScalarType, FilterParameter::Category::Parameter, ConvertData));
+  {
+    std::vector<QString> choices = {"Cast", "Saturate", "Normalize"};
+    parameters.push_back(SIMPL_NEW_CHOICE_FP("Conversion Mode", ConversionMode, FilterParameter::Category::Parameter, ConvertData, choices, false));
+  }
 
   {
     DataArraySelectionFilterParameter::RequirementType req;
@@ -225,9 +194,18 @@ void ConvertData::readFilterParameters(AbstractFilterParametersReader* reader, i
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setScalarType(static_cast<SIMPL::NumericTypes::Type>(reader->readValue("ScalarType", static_cast<int>(getScalarType()))));
   setOutputArrayName(reader->readString("OutputArrayName", getOutputArrayName()));
+  setConversionMode(reader->readValue("ConversionMode", getConversionMode()));
   reader->closeFilterGroup();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ConvertData::canReadFilterParametersConcurrently() const
+{
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -253,6 +231,13 @@ void ConvertData::dataCheck()
     return;
   }
 
+  if(m_ConversionMode < static_cast<int>(ArrayKernels::ConversionMode::Cast) || m_ConversionMode > static_cast<int>(ArrayKernels::ConversionMode::Normalize))
+  {
+    ss = QObject::tr("The conversion mode must be Cast (0), Saturate (1) or Normalize (2)");
+    setErrorCondition(-397, ss);
+    return;
+  }
+
   if(getInPreflight())
   {
     AttributeMatrix::Pointer cellAttrMat = getDataContainerArray()->getPrereqAttributeMatrixFromPath(this, m_SelectedCellArrayPath, -301);
@@ -339,19 +324,20 @@ void ConvertData::execute()
     return;
   }
 
+  ArrayKernels::ConversionMode mode = static_cast<ArrayKernels::ConversionMode>(m_ConversionMode);
   bool completed = false;
-  CHECK_AND_CONVERT(Int8ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
-
-  CHECK_AND_CONVERT(UInt8ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
-  CHECK_AND_CONVERT(UInt16ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
-  CHECK_AND_CONVERT(Int16ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
-  CHECK_AND_CONVERT(UInt32ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
-  CHECK_AND_CONVERT(Int32ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
-  CHECK_AND_CONVERT(UInt64ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
-  CHECK_AND_CONVERT(Int64ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
-  CHECK_AND_CONVERT(FloatArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
-  CHECK_AND_CONVERT(DoubleArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
-  CHECK_AND_CONVERT(BoolArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
+  CHECK_AND_CONVERT(Int8ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName, mode)
+
+  CHECK_AND_CONVERT(UInt8ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName, mode)
+  CHECK_AND_CONVERT(UInt16ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName, mode)
+  CHECK_AND_CONVERT(Int16ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName, mode)
+  CHECK_AND_CONVERT(UInt32ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName, mode)
+  CHECK_AND_CONVERT(Int32ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName, mode)
+  CHECK_AND_CONVERT(UInt64ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName, mode)
+  CHECK_AND_CONVERT(Int64ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName, mode)
+  CHECK_AND_CONVERT(FloatArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName, mode)
+  CHECK_AND_CONVERT(DoubleArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName, mode)
+  CHECK_AND_CONVERT(BoolArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName, mode)
 }
 // -----------------------------------------------------------------------------
 //
@@ -489,3 +475,15 @@ DataArrayPath ConvertData::getSelectedCellArrayPath() const
 {
   return m_SelectedCellArrayPath;
 }
+
+// -----------------------------------------------------------------------------
+void ConvertData::setConversionMode(int value)
+{
+  m_ConversionMode = value;
+}
+
+// -----------------------------------------------------------------------------
+int ConvertData::getConversionMode() const
+{
+  return m_ConversionMode;
+}
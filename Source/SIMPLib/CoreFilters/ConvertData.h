@@ -54,6 +54,7 @@ class SIMPLib_EXPORT ConvertData : public AbstractFilter
   PYB11_SHARED_POINTERS(ConvertData)
   PYB11_FILTER_NEW_MACRO(ConvertData)
   PYB11_PROPERTY(SIMPL::NumericTypes::Type ScalarType READ getScalarType WRITE setScalarType)
+  PYB11_PROPERTY(int ConversionMode READ getConversionMode WRITE setConversionMode)
   PYB11_PROPERTY(QString OutputArrayName READ getOutputArrayName WRITE setOutputArrayName)
   PYB11_PROPERTY(DataArrayPath SelectedCellArrayPath READ getSelectedCellArrayPath WRITE setSelectedCellArrayPath)
   PYB11_END_BINDINGS()
@@ -92,6 +93,19 @@ public:
 
   Q_PROPERTY(SIMPL::NumericTypes::Type ScalarType READ getScalarType WRITE setScalarType)
 
+  /**
+   * @brief Setter property for ConversionMode. 0 casts, 1 saturates to the range of the new type and
+   * 2 normalizes integer ranges, see ArrayKernels::ConversionMode.
+   */
+  void setConversionMode(int value);
+  /**
+   * @brief Getter property for ConversionMode
+   * @return Value of ConversionMode
+   */
+  int getConversionMode() const;
+
+  Q_PROPERTY(int ConversionMode READ getConversionMode WRITE setConversionMode)
+
   /**
    * @brief Setter property for OutputArrayName
    */
@@ -171,6 +185,11 @@ public:
    */
   void readFilterParameters(AbstractFilterParametersReader* reader, int index) override;
 
+  /**
+   * @brief canReadFilterParametersConcurrently Reimplemented from @see AbstractFilter class
+   */
+  bool canReadFilterParametersConcurrently() const override;
+
   /**
    * @brief execute Reimplemented from @see AbstractFilter class
    */
@@ -196,6 +215,7 @@ public:
 
 private:
   SIMPL::NumericTypes::Type m_ScalarType = {SIMPL::NumericTypes::Type::Int8};
+  int m_ConversionMode = {0};
   QString m_OutputArrayName = {""};
   DataArrayPath m_SelectedCellArrayPath = {"", "", ""};
 };
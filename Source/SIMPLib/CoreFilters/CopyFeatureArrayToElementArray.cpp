@@ -45,6 +45,7 @@
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/Utilities/FeatureReduction.hpp"
 
 enum createdPathID : RenameDataPath::DataID_t
 {
@@ -158,24 +159,8 @@ IDataArray::Pointer copyData(IDataArray::Pointer inputData, size_t totalPoints,
   std::vector<size_t> cDims = inputData->getComponentDimensions();
   typename DataArray<T>::Pointer cell = DataArray<T>::CreateArray(totalPoints, cDims, cellArrayName, true);
 
-  T* fPtr = feature->getPointer(0);
-  T* cPtr = cell->getPointer(0);
-
   size_t numComp = static_cast<size_t>(feature->getNumberOfComponents());
-  int32_t featureIdx = 0;
-
-  for(size_t i = 0; i < totalPoints; ++i)
-  {
-    // Get the feature id (or what ever the user has selected as their "Feature" identifier
-    featureIdx = featureIds[i];
-    // Now get the pointer to the start of the tuple for the Feature Array at the given Feature Id Index value
-    T* fSourcePtr = fPtr + (numComp * featureIdx);
-    // Now get the pointer to the start of the tuple for the Cell Array at the proper index
-    T* cDestPtr = cPtr + (numComp * i);
-
-    // Now just raw copy the bytes from the source to the destination
-    ::memcpy(cDestPtr, fSourcePtr, sizeof(T) * numComp);
-  }
+  FeatureReduction::Gather(feature->getPointer(0), numComp, featureIds, totalPoints, feature->getNumberOfTuples(), cell->getPointer(0));
   return cell;
 }
 
@@ -121,6 +121,14 @@ void CopyObject::readFilterParameters(AbstractFilterParametersReader* reader, in
   reader->closeFilterGroup();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool CopyObject::canReadFilterParametersConcurrently() const
+{
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -205,6 +205,11 @@ public:
    */
   void readFilterParameters(AbstractFilterParametersReader* reader, int index) override;
 
+  /**
+   * @brief canReadFilterParametersConcurrently Reimplemented from @see AbstractFilter class
+   */
+  bool canReadFilterParametersConcurrently() const override;
+
   /**
    * @brief execute Reimplemented from @see AbstractFilter class
    */
@@ -108,6 +108,14 @@ void CreateAttributeMatrix::readFilterParameters(AbstractFilterParametersReader*
   reader->closeFilterGroup();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool CreateAttributeMatrix::canReadFilterParametersConcurrently() const
+{
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -77,6 +77,14 @@ void CreateDataContainer::readFilterParameters(AbstractFilterParametersReader* r
   reader->closeFilterGroup();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool CreateDataContainer::canReadFilterParametersConcurrently() const
+{
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
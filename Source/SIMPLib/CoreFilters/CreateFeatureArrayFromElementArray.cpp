@@ -46,6 +46,7 @@
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/Utilities/FeatureReduction.hpp"
 
 enum createdPathID : RenameDataPath::DataID_t
 {
@@ -159,49 +160,20 @@ IDataArray::Pointer copyCellData(AbstractFilter* filter, IDataArray::Pointer inp
   std::vector<size_t> dims = inputData->getComponentDimensions();
   typename DataArray<T>::Pointer feature = DataArray<T>::CreateArray(features, dims, createdArrayName, true);
 
-  T* fPtr = feature->getPointer(0);
-  T* cPtr = cell->getPointer(0);
-
   size_t numComp = static_cast<size_t>(cell->getNumberOfComponents());
-  int32_t featureIdx = 0;
-
   size_t cells = inputData->getNumberOfTuples();
 
-  QMap<int32_t, T*> featureMap;
-  bool warningThrown = false;
+  // Feature Ids index the Feature array directly; the last value of each Feature wins
+  FeatureReduction::FeatureReducer<T> reducer(cell->getPointer(0), numComp, featureIds, cells, static_cast<size_t>(features));
+  reducer.setCheckUniform(true);
+  reducer.reduce(FeatureReduction::Operation::Last, feature->getPointer(0));
 
-  for(size_t i = 0; i < cells; ++i)
+  int32_t featureIdx = reducer.getFirstNonUniformFeature();
+  if(featureIdx >= 0)
   {
-    // Get the feature id (or what ever the user has selected as their "Feature" identifier
-    featureIdx = featureIds[i];
-
-    // Now get the pointer to the start of the tuple for the Cell Array at the given Feature Id Index value
-    T* cSourcePtr = cPtr + (numComp * i);
-
-    // Store the first value(s) with this feature id in the map
-    if(featureMap.contains(featureIdx) == false)
-    {
-      featureMap.insert(featureIdx, cSourcePtr);
-    }
-
-    // Check that the values that are currently being pointed to by the source pointer match the first values
-    T* currentDataPtr = featureMap.value(featureIdx);
-    for(int j = 0; j < numComp; j++)
-    {
-      if(currentDataPtr[j] != cSourcePtr[j] && !warningThrown)
-      {
-        // The values are inconsistent with the first values for this feature id, so throw a warning
-        QString ss = QObject::tr("Elements from Feature %1 do not all have the same value. The last value copied into Feature %1 will be used").arg(featureIdx);
-        filter->setWarningCondition(-1000, ss);
-        warningThrown = true;
-      }
-    }
-
-    // Now get the pointer to the start of the tuple for the Feature Array at the proper index
-    T* fDestPtr = fPtr + (numComp * featureIdx);
-
-    // Now just raw copy the bytes from the source to the destination
-    ::memcpy(fDestPtr, cSourcePtr, sizeof(T) * numComp);
+    // The values are inconsistent with the first values for this feature id, so throw a warning
+    QString ss = QObject::tr("Elements from Feature %1 do not all have the same value. The last value copied into Feature %1 will be used").arg(featureIdx);
+    filter->setWarningCondition(-1000, ss);
   }
   return feature;
 }
@@ -34,6 +34,7 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "CropVertexGeometry.h"
 
+#include <algorithm>
 #include <cassert>
 
 #include <QtCore/QTextStream>
@@ -49,12 +50,45 @@
 #include "SIMPLib/FilterParameters/FloatFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/Geometry/VertexGeom.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 enum createdPathID : RenameDataPath::DataID_t
 {
   DataContainerID = 1
 };
 
+/**
+ * @brief The CropVertexGeometryImpl class implements a threaded algorithm that flags the vertices inside the crop box
+ */
+class CropVertexGeometryImpl
+{
+public:
+  CropVertexGeometryImpl(const float* vertices, const float* lowerLeft, const float* upperRight, uint8_t* inside)
+  : m_Vertices(vertices)
+  , m_LowerLeft(lowerLeft)
+  , m_UpperRight(upperRight)
+  , m_Inside(inside)
+  {
+  }
+  virtual ~CropVertexGeometryImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      const float* p = m_Vertices + 3 * i;
+      m_Inside[i] = static_cast<uint8_t>(p[0] >= m_LowerLeft[0] && p[0] <= m_UpperRight[0] && p[1] >= m_LowerLeft[1] && p[1] <= m_UpperRight[1] && p[2] >= m_LowerLeft[2] &&
+                                         p[2] <= m_UpperRight[2]);
+    }
+  }
+
+private:
+  const float* m_Vertices;
+  const float* m_LowerLeft;
+  const float* m_UpperRight;
+  uint8_t* m_Inside;
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -196,7 +230,7 @@ void CropVertexGeometry::dataCheck()
 //
 // -----------------------------------------------------------------------------
 template <typename T>
-void copyDataToCroppedGeometry(IDataArray::Pointer inDataPtr, IDataArray::Pointer outDataPtr, std::vector<int64_t>& croppedPoints)
+void copyDataToCroppedGeometry(IDataArray::Pointer inDataPtr, IDataArray::Pointer outDataPtr, const std::vector<size_t>& croppedPoints)
 {
   typename DataArray<T>::Pointer inputDataPtr = std::dynamic_pointer_cast<DataArray<T>>(inDataPtr);
   T* inputData = static_cast<T*>(inputDataPtr->getPointer(0));
@@ -207,7 +241,7 @@ void copyDataToCroppedGeometry(IDataArray::Pointer inDataPtr, IDataArray::Pointe
   size_t tmpIndex = 0;
   size_t ptrIndex = 0;
 
-  for(std::vector<int64_t>::size_type i = 0; i < croppedPoints.size(); i++)
+  for(size_t i = 0; i < croppedPoints.size(); i++)
   {
     for(size_t d = 0; d < nComps; d++)
     {
@@ -232,31 +266,37 @@ void CropVertexGeometry::execute()
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
   DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(getCroppedDataContainerName());
   VertexGeom::Pointer vertices = getDataContainerArray()->getDataContainer(getDataContainerName())->getGeometryAs<VertexGeom>();
-  int64_t numVerts = vertices->getNumberOfVertices();
-  float* allVerts = vertices->getVertexPointer(0);
-  std::vector<int64_t> croppedPoints;
-  croppedPoints.reserve(numVerts);
-
-  for(int64_t i = 0; i < numVerts; i++)
+  size_t numVerts = vertices->getNumberOfVertices();
+  const float lowerLeft[3] = {m_XMin, m_YMin, m_ZMin};
+  const float upperRight[3] = {m_XMax, m_YMax, m_ZMax};
+  std::vector<size_t> croppedPoints;
+
+  // A cached k-d tree is not used: earlier filters may have edited the coordinates in place, which the
+  // tree cannot detect, and building one for a single box costs more than the parallel scan
+  std::vector<uint8_t> inside(numVerts, 0);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numVerts);
+  dataAlg.execute(CropVertexGeometryImpl(vertices->getVertexPointer(0), lowerLeft, upperRight, inside.data()));
+
+  croppedPoints.reserve(std::count(inside.begin(), inside.end(), 1));
+  for(size_t i = 0; i < numVerts; i++)
   {
-    if(getCancel())
-    {
-      return;
-    }
-    if(allVerts[3 * i + 0] >= m_XMin && allVerts[3 * i + 0] <= m_XMax && allVerts[3 * i + 1] >= m_YMin && allVerts[3 * i + 1] <= m_YMax && allVerts[3 * i + 2] >= m_ZMin &&
-       allVerts[3 * i + 2] <= m_ZMax)
+    if(inside[i] != 0)
     {
       croppedPoints.push_back(i);
     }
   }
 
-  croppedPoints.shrink_to_fit();
+  if(getCancel())
+  {
+    return;
+  }
 
   VertexGeom::Pointer crop = dc->getGeometryAs<VertexGeom>();
   crop->resizeVertexList(croppedPoints.size());
   float coords[3] = {0.0f, 0.0f, 0.0f};
 
-  for(std::list<int64_t>::size_type i = 0; i < croppedPoints.size(); i++)
+  for(size_t i = 0; i < croppedPoints.size(); i++)
   {
     if(getCancel())
     {
@@ -51,7 +51,10 @@
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataContainerReaderFilterParameter.h"
 #include "SIMPLib/FilterParameters/H5FilterParametersReader.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/Montages/MontageSupport.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReader.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
@@ -88,6 +91,11 @@ void DataContainerReader::setupFilterParameters()
     parameters.push_back(parameter);
   }
 
+  std::vector<QString> linkedProps = {"SubvolumeMinIndex", "SubvolumeMaxIndex"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Read Subvolume", ReadSubvolume, FilterParameter::Category::Parameter, DataContainerReader, linkedProps));
+  parameters.push_back(SIMPL_NEW_INT_VEC3_FP("Subvolume Minimum Index (X, Y, Z)", SubvolumeMinIndex, FilterParameter::Category::Parameter, DataContainerReader));
+  parameters.push_back(SIMPL_NEW_INT_VEC3_FP("Subvolume Maximum Index (X, Y, Z)", SubvolumeMaxIndex, FilterParameter::Category::Parameter, DataContainerReader));
+
   setFilterParameters(parameters);
 }
 
@@ -101,6 +109,9 @@ void DataContainerReader::readFilterParameters(AbstractFilterParametersReader* r
   setInputFileDataContainerArrayProxy(reader->readDataContainerArrayProxy("InputFileDataContainerArrayProxy", getInputFileDataContainerArrayProxy()));
   syncProxies(); // Sync the file proxy and currently cached proxy together into one proxy
   setOverwriteExistingDataContainers(reader->readValue("OverwriteExistingDataContainers", getOverwriteExistingDataContainers()));
+  setReadSubvolume(reader->readValue("ReadSubvolume", getReadSubvolume()));
+  setSubvolumeMinIndex(reader->readIntVec3("SubvolumeMinIndex", getSubvolumeMinIndex()));
+  setSubvolumeMaxIndex(reader->readIntVec3("SubvolumeMaxIndex", getSubvolumeMaxIndex()));
   reader->closeFilterGroup();
 }
 
@@ -113,6 +124,12 @@ void DataContainerReader::readFilterParameters(QJsonObject& obj)
   syncProxies();
 }
 
+// -----------------------------------------------------------------------------
+bool DataContainerReader::canReadFilterParametersConcurrently() const
+{
+  return false;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -253,7 +270,15 @@ DataContainerArray::Pointer DataContainerReader::readData(DataContainerArrayProx
     return DataContainerArray::New();
   }
 
-  DataContainerArray::Pointer dca = simplReader->readSIMPLDataUsingProxy(proxy, getInPreflight());
+  // Arrays that may be cropped are read separately so that only the subvolume is read from the file
+  DataContainerArrayProxy readProxy = proxy;
+  QVector<DataArrayPath> deferredArrays;
+  if(m_ReadSubvolume)
+  {
+    deferredArrays = deferSubvolumeArrays(readProxy);
+  }
+
+  DataContainerArray::Pointer dca = simplReader->readSIMPLDataUsingProxy(readProxy, getInPreflight());
   if(dca == DataContainerArray::NullPointer())
   {
     return DataContainerArray::New();
@@ -268,6 +293,11 @@ DataContainerArray::Pointer DataContainerReader::readData(DataContainerArrayProx
   }
   H5ScopedFileSentinel sentinel(fileId, true);
 
+  if(m_ReadSubvolume && readSubvolume(fileId, dca, deferredArrays) < 0)
+  {
+    return DataContainerArray::New();
+  }
+
   if(!getInPreflight())
   {
     int32_t err = readExistingPipelineFromFile(fileId);
@@ -282,6 +312,162 @@ DataContainerArray::Pointer DataContainerReader::readData(DataContainerArrayProx
   return dca;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<DataArrayPath> DataContainerReader::deferSubvolumeArrays(DataContainerArrayProxy& proxy) const
+{
+  QVector<DataArrayPath> deferredArrays;
+  for(auto& dcProxy : proxy.getDataContainers())
+  {
+    if(dcProxy.getFlag() == Qt::Unchecked)
+    {
+      continue;
+    }
+    if(dcProxy.getDCType() != static_cast<uint32_t>(IGeometry::Type::Image) && dcProxy.getDCType() != static_cast<uint32_t>(IGeometry::Type::Any))
+    {
+      continue;
+    }
+    for(auto& amProxy : dcProxy.getAttributeMatricies())
+    {
+      if(amProxy.getFlag() == Qt::Unchecked || (amProxy.getAMType() != AttributeMatrix::Type::Cell && amProxy.getAMType() != AttributeMatrix::Type::Unknown))
+      {
+        continue;
+      }
+      // NeighborLists and StringDataArrays cannot be read partially, so those matrices are left to the regular reader
+      bool allDataArrays = true;
+      for(const auto& daProxy : amProxy.getDataArrays())
+      {
+        if(daProxy.getFlag() != Qt::Unchecked && !daProxy.getObjectType().startsWith("DataArray<"))
+        {
+          allDataArrays = false;
+        }
+      }
+      if(!allDataArrays)
+      {
+        continue;
+      }
+      for(auto& daProxy : amProxy.getDataArrays())
+      {
+        if(daProxy.getFlag() != Qt::Unchecked)
+        {
+          deferredArrays.push_back(DataArrayPath(dcProxy.getName(), amProxy.getName(), daProxy.getName()));
+          daProxy.setFlag(Qt::Unchecked);
+        }
+      }
+    }
+  }
+  return deferredArrays;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t DataContainerReader::readSubvolume(hid_t fileId, const DataContainerArray::Pointer& dca, const QVector<DataArrayPath>& deferredArrays)
+{
+  std::vector<size_t> tupleOffset(3, 0);
+  std::vector<size_t> tupleCount(3, 1);
+  for(size_t i = 0; i < 3; i++)
+  {
+    if(m_SubvolumeMinIndex[i] < 0 || m_SubvolumeMinIndex[i] > m_SubvolumeMaxIndex[i])
+    {
+      QString ss = QObject::tr("The subvolume minimum index must be at least 0 and not larger than the maximum index along each axis");
+      setErrorCondition(-391, ss);
+      return -391;
+    }
+    tupleOffset[i] = static_cast<size_t>(m_SubvolumeMinIndex[i]);
+    tupleCount[i] = static_cast<size_t>(m_SubvolumeMaxIndex[i] - m_SubvolumeMinIndex[i] + 1);
+  }
+
+  // Crop every Image Geometry. Its Cell Attribute Matrices are empty at this point unless they hold arrays
+  // that cannot be read partially.
+  for(const auto& dc : dca->getDataContainers())
+  {
+    ImageGeom::Pointer image = dc->getGeometryAs<ImageGeom>();
+    if(nullptr == image)
+    {
+      continue;
+    }
+
+    SizeVec3Type dims = image->getDimensions();
+    for(size_t i = 0; i < 3; i++)
+    {
+      if(tupleOffset[i] + tupleCount[i] > dims[i])
+      {
+        QString ss = QObject::tr("The subvolume does not fit inside the Image Geometry of Data Container '%1', which has dimensions %2 x %3 x %4")
+                         .arg(dc->getName())
+                         .arg(dims[0])
+                         .arg(dims[1])
+                         .arg(dims[2]);
+        setErrorCondition(-392, ss);
+        return -392;
+      }
+    }
+
+    for(const auto& am : dc->getAttributeMatrices())
+    {
+      if(am->getType() != AttributeMatrix::Type::Cell)
+      {
+        continue;
+      }
+      if(am->getNumAttributeArrays() > 0)
+      {
+        QString ss = QObject::tr("The Cell Attribute Matrix '%1' in Data Container '%2' holds arrays that cannot be read as a subvolume").arg(am->getName()).arg(dc->getName());
+        setErrorCondition(-393, ss);
+        return -393;
+      }
+      am->setTupleDimensions(tupleCount);
+    }
+
+    FloatVec3Type origin = image->getOrigin();
+    FloatVec3Type spacing = image->getSpacing();
+    for(size_t i = 0; i < 3; i++)
+    {
+      origin[i] += static_cast<float>(tupleOffset[i]) * spacing[i];
+    }
+    image->setOrigin(origin);
+    image->setDimensions(SizeVec3Type(tupleCount[0], tupleCount[1], tupleCount[2]));
+  }
+
+  for(const auto& path : deferredArrays)
+  {
+    DataContainer::Pointer dc = dca->getDataContainer(path.getDataContainerName());
+    AttributeMatrix::Pointer am = (nullptr != dc) ? dc->getAttributeMatrix(path.getAttributeMatrixName()) : AttributeMatrix::NullPointer();
+    if(nullptr == am)
+    {
+      continue;
+    }
+
+    QString amGroupPath = SIMPL::StringConstants::DataContainerGroupName + "/" + dc->getName() + "/" + am->getName();
+    hid_t amGid = QH5Utilities::openHDF5Object(fileId, amGroupPath);
+    H5ScopedGroupSentinel sentinel(amGid, false);
+    if(amGid < 0)
+    {
+      QString ss = QObject::tr("Error opening the group '%1'").arg(amGroupPath);
+      setErrorCondition(-394, ss);
+      return -394;
+    }
+
+    IDataArray::Pointer array;
+    if(nullptr != dc->getGeometryAs<ImageGeom>() && am->getType() == AttributeMatrix::Type::Cell)
+    {
+      array = H5DataArrayReader::ReadIDataArraySubset(amGid, path.getDataArrayName(), tupleOffset, tupleCount, getInPreflight());
+    }
+    else
+    {
+      array = H5DataArrayReader::ReadIDataArray(amGid, path.getDataArrayName(), getInPreflight());
+    }
+    if(nullptr == array)
+    {
+      QString ss = QObject::tr("Error reading the array '%1'").arg(path.serialize("/"));
+      setErrorCondition(-395, ss);
+      return -395;
+    }
+    am->insertOrAssign(array);
+  }
+  return 0;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -644,3 +830,39 @@ DataContainerArrayProxy DataContainerReader::getInputFileDataContainerArrayProxy
 {
   return m_InputFileDataContainerArrayProxy;
 }
+
+// -----------------------------------------------------------------------------
+void DataContainerReader::setReadSubvolume(bool value)
+{
+  m_ReadSubvolume = value;
+}
+
+// -----------------------------------------------------------------------------
+bool DataContainerReader::getReadSubvolume() const
+{
+  return m_ReadSubvolume;
+}
+
+// -----------------------------------------------------------------------------
+void DataContainerReader::setSubvolumeMinIndex(const IntVec3Type& value)
+{
+  m_SubvolumeMinIndex = value;
+}
+
+// -----------------------------------------------------------------------------
+IntVec3Type DataContainerReader::getSubvolumeMinIndex() const
+{
+  return m_SubvolumeMinIndex;
+}
+
+// -----------------------------------------------------------------------------
+void DataContainerReader::setSubvolumeMaxIndex(const IntVec3Type& value)
+{
+  m_SubvolumeMaxIndex = value;
+}
+
+// -----------------------------------------------------------------------------
+IntVec3Type DataContainerReader::getSubvolumeMaxIndex() const
+{
+  return m_SubvolumeMaxIndex;
+}
@@ -42,6 +42,7 @@
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/DataContainers/DataContainerArrayProxy.h"
+#include "SIMPLib/FilterParameters/IntVec3FilterParameter.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReader.h"
@@ -67,6 +68,9 @@ class SIMPLib_EXPORT DataContainerReader : public AbstractFilter
   PYB11_PROPERTY(QString InputFile READ getInputFile WRITE setInputFile)
   PYB11_PROPERTY(bool OverwriteExistingDataContainers READ getOverwriteExistingDataContainers WRITE setOverwriteExistingDataContainers)
   PYB11_PROPERTY(DataContainerArrayProxy InputFileDataContainerArrayProxy READ getInputFileDataContainerArrayProxy WRITE setInputFileDataContainerArrayProxy)
+  PYB11_PROPERTY(bool ReadSubvolume READ getReadSubvolume WRITE setReadSubvolume)
+  PYB11_PROPERTY(IntVec3Type SubvolumeMinIndex READ getSubvolumeMinIndex WRITE setSubvolumeMinIndex)
+  PYB11_PROPERTY(IntVec3Type SubvolumeMaxIndex READ getSubvolumeMaxIndex WRITE setSubvolumeMaxIndex)
   PYB11_METHOD(DataContainerArrayProxy readDataContainerArrayStructure ARGS path)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
@@ -152,6 +156,42 @@ public:
 
   Q_PROPERTY(DataContainerArrayProxy InputFileDataContainerArrayProxy READ getInputFileDataContainerArrayProxy WRITE setInputFileDataContainerArrayProxy)
 
+  /**
+   * @brief Setter property for ReadSubvolume
+   */
+  void setReadSubvolume(bool value);
+  /**
+   * @brief Getter property for ReadSubvolume
+   * @return Value of ReadSubvolume
+   */
+  bool getReadSubvolume() const;
+
+  Q_PROPERTY(bool ReadSubvolume READ getReadSubvolume WRITE setReadSubvolume)
+
+  /**
+   * @brief Setter property for SubvolumeMinIndex
+   */
+  void setSubvolumeMinIndex(const IntVec3Type& value);
+  /**
+   * @brief Getter property for SubvolumeMinIndex
+   * @return Value of SubvolumeMinIndex
+   */
+  IntVec3Type getSubvolumeMinIndex() const;
+
+  Q_PROPERTY(IntVec3Type SubvolumeMinIndex READ getSubvolumeMinIndex WRITE setSubvolumeMinIndex)
+
+  /**
+   * @brief Setter property for SubvolumeMaxIndex
+   */
+  void setSubvolumeMaxIndex(const IntVec3Type& value);
+  /**
+   * @brief Getter property for SubvolumeMaxIndex
+   * @return Value of SubvolumeMaxIndex
+   */
+  IntVec3Type getSubvolumeMaxIndex() const;
+
+  Q_PROPERTY(IntVec3Type SubvolumeMaxIndex READ getSubvolumeMaxIndex WRITE setSubvolumeMaxIndex)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -224,6 +264,11 @@ public:
    */
   void readFilterParameters(QJsonObject& obj) override;
 
+  /**
+   * @brief Returns false; reading the parameters opens the input file to synchronize the proxies.
+   */
+  bool canReadFilterParametersConcurrently() const override;
+
   /**
    * @brief execute Reimplemented from @see AbstractFilter class
    */
@@ -286,6 +331,24 @@ protected:
    */
   DataContainerArray::MontageCollection readMontageGroup(const DataContainerArray::Pointer& dca);
 
+  /**
+   * @brief deferSubvolumeArrays Unchecks the arrays that will be read by readSubvolume() instead of
+   * the regular reader and returns their paths
+   * @param proxy
+   * @return
+   */
+  QVector<DataArrayPath> deferSubvolumeArrays(DataContainerArrayProxy& proxy) const;
+
+  /**
+   * @brief readSubvolume Crops the Image Geometries in 'dca' to the subvolume and reads the deferred arrays,
+   * using hyperslab reads for the Cell Attribute Matrices of those geometries
+   * @param fileId
+   * @param dca
+   * @param deferredArrays
+   * @return Negative value on error
+   */
+  int32_t readSubvolume(hid_t fileId, const DataContainerArray::Pointer& dca, const QVector<DataArrayPath>& deferredArrays);
+
 protected Q_SLOTS:
   /**
    * @brief Cleans up the filter after execution
@@ -298,6 +361,9 @@ private:
   QString m_LastFileRead = {""};
   QDateTime m_LastRead = {QDateTime::currentDateTime()};
   DataContainerArrayProxy m_InputFileDataContainerArrayProxy = {};
+  bool m_ReadSubvolume = {false};
+  IntVec3Type m_SubvolumeMinIndex = {0, 0, 0};
+  IntVec3Type m_SubvolumeMaxIndex = {0, 0, 0};
 
   FilterPipeline::Pointer m_PipelineFromFile;
 
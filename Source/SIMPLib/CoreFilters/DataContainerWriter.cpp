@@ -50,13 +50,79 @@
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/H5FilterParametersWriter.h"
+#include "SIMPLib/FilterParameters/JsonFilterParametersWriter.h"
 #include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
+#include "SIMPLib/HDF5/H5AsyncWriteQueue.h"
 #include "SIMPLib/Utilities/FileSystemPathHelper.h"
 
 #ifdef _WIN32
 extern Q_CORE_EXPORT int qt_ntfs_permission_lookup;
 #endif
 
+namespace
+{
+/**
+ * @brief Returns the DataContainer, AttributeMatrix and DataArray paths that the enabled filters after 'filter'
+ * hold in their filter parameters, i.e. the data they may modify in place
+ */
+std::vector<DataArrayPath> GetDownstreamSelections(const AbstractFilter& filter)
+{
+  std::vector<DataArrayPath> paths;
+  for(AbstractFilter::Pointer next = filter.getNextFilter().lock(); nullptr != next; next = next->getNextFilter().lock())
+  {
+    if(!next->getEnabled())
+    {
+      continue;
+    }
+    for(const auto& filterParam : next->getFilterParameters())
+    {
+      QVariant var = next->property(qPrintable(filterParam->getPropertyName()));
+      if(!var.isValid())
+      {
+        continue;
+      }
+      if(var.canConvert<DataArrayPath>())
+      {
+        paths.push_back(var.value<DataArrayPath>());
+      }
+      else if(var.canConvert<DataArrayPathVec>())
+      {
+        DataArrayPathVec selection = var.value<DataArrayPathVec>();
+        paths.insert(paths.end(), selection.begin(), selection.end());
+      }
+    }
+  }
+  return paths;
+}
+
+/**
+ * @brief Returns whether 'arrayPath' is one of 'paths' or lies inside one of them
+ */
+bool IsSelected(const std::vector<DataArrayPath>& paths, const DataArrayPath& arrayPath)
+{
+  for(const auto& path : paths)
+  {
+    if(path.getDataContainerName().isEmpty() || path.getDataContainerName() != arrayPath.getDataContainerName())
+    {
+      continue;
+    }
+    if(path.getAttributeMatrixName().isEmpty())
+    {
+      return true;
+    }
+    if(path.getAttributeMatrixName() != arrayPath.getAttributeMatrixName())
+    {
+      continue;
+    }
+    if(path.getDataArrayName().isEmpty() || path.getDataArrayName() == arrayPath.getDataArrayName())
+    {
+      return true;
+    }
+  }
+  return false;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -65,7 +131,14 @@ DataContainerWriter::DataContainerWriter() = default;
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-DataContainerWriter::~DataContainerWriter() = default;
+DataContainerWriter::~DataContainerWriter()
+{
+  // A background write still uses this filter to write the file
+  if(m_PendingWrite.valid())
+  {
+    m_PendingWrite.wait();
+  }
+}
 
 // -----------------------------------------------------------------------------
 //
@@ -77,6 +150,8 @@ void DataContainerWriter::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_OUTPUT_FILE_FP("Output File", OutputFile, FilterParameter::Category::Parameter, DataContainerWriter, "*.dream3d", ""));
   parameters.push_back(SIMPL_NEW_BOOL_FP("Write Xdmf File", WriteXdmfFile, FilterParameter::Category::Parameter, DataContainerWriter));
   parameters.push_back(SIMPL_NEW_BOOL_FP("Include Xdmf Time Markers", WriteTimeSeries, FilterParameter::Category::Parameter, DataContainerWriter));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Append Slices Across Executions", AppendSlices, FilterParameter::Category::Parameter, DataContainerWriter));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Write in Background Thread", WriteAsynchronously, FilterParameter::Category::Parameter, DataContainerWriter));
 
   setFilterParameters(parameters);
 }
@@ -89,6 +164,8 @@ void DataContainerWriter::readFilterParameters(AbstractFilterParametersReader* r
   reader->openFilterGroup(this, index);
   setOutputFile(reader->readString("OutputFile", getOutputFile()));
   setWriteXdmfFile(reader->readValue("WriteXdmfFile", getWriteXdmfFile()));
+  setAppendSlices(reader->readValue("AppendSlices", getAppendSlices()));
+  setWriteAsynchronously(reader->readValue("WriteAsynchronously", getWriteAsynchronously()));
   reader->closeFilterGroup();
 }
 
@@ -114,6 +191,12 @@ void DataContainerWriter::dataCheck()
     m_OutputFile.append(".dream3d");
   }
   FileSystemPathHelper::CheckOutputFile(this, "Output File Path", getOutputFile(), true);
+
+  if(!m_AppendSlices)
+  {
+    // Streaming was switched off, let go of the file that earlier executions kept open
+    m_StreamWriter.reset();
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -139,26 +222,169 @@ void DataContainerWriter::execute()
     return;
   }
 
+  // At most one write per filter is in flight, which also bounds the memory held by snapshots. A failed background
+  // write that no pipeline collected fails this execution.
+  if(waitForPendingWrite() < 0)
+  {
+    return;
+  }
+
+  if(m_AppendSlices)
+  {
+    appendSlices();
+    return;
+  }
+
+  WriteRequest request;
+  request.outputFile = m_OutputFile;
+  request.pipelineJson = JsonFilterParametersWriter::New()->writePipelineToString(assemblePipeline(), SIMPL::StringConstants::PipelineGroupName, true);
+  request.appendToExisting = m_AppendToExisting;
+  request.writeXdmfFile = m_WriteXdmfFile;
+  request.writeTimeSeries = m_WriteTimeSeries;
+
+  if(m_WriteAsynchronously)
+  {
+    if(H5AsyncWriteQueue::IsSupported())
+    {
+      request.dataContainerArray = snapshotDataContainerArray();
+      writeInBackground(request);
+      return;
+    }
+    QString ss = QObject::tr("The HDF5 library was built without thread safety. The file is written synchronously.");
+    setWarningCondition(-11115, ss);
+  }
+
+  request.dataContainerArray = getDataContainerArray();
+  QString errorMessage;
+  int32_t err = writeFile(request, errorMessage);
+  if(err < 0)
+  {
+    setErrorCondition(err, errorMessage);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataContainerWriter::writeInBackground(const WriteRequest& request)
+{
+  auto promise = std::make_shared<std::promise<WriteResult>>();
+  m_PendingWrite = promise->get_future().share();
+
+  // The I/O thread must not touch the filter's error state, the result is reported by waitForPendingWrite()
+  H5AsyncWriteQueue::Instance().enqueue([this, request, promise]() {
+    WriteResult result;
+    result.outputFile = request.outputFile;
+    result.errorCode = writeFile(request, result.errorMessage);
+    promise->set_value(result);
+  });
+
+  QString ss = QObject::tr("Writing '%1' in the background").arg(request.outputFile);
+  notifyStatusMessage(ss);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t DataContainerWriter::waitForPendingWrite()
+{
+  if(!m_PendingWrite.valid())
+  {
+    return 0;
+  }
+  WriteResult result = m_PendingWrite.get();
+  m_PendingWrite = std::shared_future<WriteResult>();
+  if(result.errorCode < 0)
+  {
+    setErrorCondition(result.errorCode, result.errorMessage);
+    return result.errorCode;
+  }
+  QString ss = QObject::tr("Finished writing '%1' in the background").arg(result.outputFile);
+  notifyStatusMessage(ss);
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataContainerWriter::finishBackgroundWork()
+{
+  waitForPendingWrite();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer DataContainerWriter::snapshotDataContainerArray() const
+{
+  DataContainerArray::Pointer dca = getDataContainerArray();
+
+  // Holding references to the arrays keeps them alive and unchanged without a copy, even when later filters
+  // remove or replace them. Only the arrays that later filters may modify in place are copied.
+  std::vector<DataArrayPath> modifiablePaths = GetDownstreamSelections(*this);
+
+  DataContainerArray::Pointer snapshot = DataContainerArray::New();
+  for(const auto& dc : dca->getDataContainers())
+  {
+    DataContainer::Pointer dcCopy = DataContainer::New(dc->getName());
+    IGeometry::Pointer geometry = dc->getGeometry();
+    if(nullptr != geometry)
+    {
+      // The time series flags are set on the geometry while writing, so it is not shared
+      dcCopy->setGeometry(geometry->deepCopy(false));
+    }
+    for(const auto& am : *dc)
+    {
+      AttributeMatrix::Pointer amCopy = AttributeMatrix::New(am->getTupleDimensions(), am->getName(), am->getType());
+      for(const auto& array : *am)
+      {
+        if(IsSelected(modifiablePaths, DataArrayPath(dc->getName(), am->getName(), array->getName())))
+        {
+          amCopy->insertOrAssign(array->deepCopy(false));
+        }
+        else
+        {
+          amCopy->insertOrAssign(array);
+        }
+      }
+      dcCopy->addOrReplaceAttributeMatrix(amCopy);
+    }
+    snapshot->addOrReplaceDataContainer(dcCopy);
+  }
+  snapshot->setDataContainerBundles(dca->getDataContainerBundles());
+  for(const auto& montage : dca->getMontageCollection())
+  {
+    snapshot->addMontage(montage->propagate(snapshot));
+  }
+  return snapshot;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t DataContainerWriter::writeFile(const WriteRequest& request, QString& errorMessage) const
+{
+  QFileInfo fi(request.outputFile);
+  QString parentPath = fi.path();
   hid_t fileId = -1;
 
   // Try to open a file to append data into
-  if(m_AppendToExisting)
+  if(request.appendToExisting)
   {
-    fileId = QH5Utilities::openFile(m_OutputFile, false);
+    fileId = QH5Utilities::openFile(request.outputFile, false);
   }
   // No file was found or we are writing new data only to a clean file
-  if(!m_AppendToExisting || fileId < 0)
+  if(!request.appendToExisting || fileId < 0)
   {
-    fileId = QH5Utilities::createFile(m_OutputFile);
+    fileId = QH5Utilities::createFile(request.outputFile);
   }
 
   if(fileId < 0)
   {
-    QString ss = QObject::tr("The HDF5 file could not be opened or created.\n The given filename was:\n\t[%1]").arg(m_OutputFile);
-    setErrorCondition(-11112, ss);
-    return;
+    errorMessage = QObject::tr("The HDF5 file could not be opened or created.\n The given filename was:\n\t[%1]").arg(request.outputFile);
+    return -11112;
   }
-  // qDebug() << "DREAM3D File: " << m_OutputFile;
+  // qDebug() << "DREAM3D File: " << request.outputFile;
 
   // This will make sure if we return early from this method that the HDF5 File is properly closed.
   H5ScopedFileSentinel scopedFileSentinel(fileId, true);
@@ -168,10 +394,9 @@ void DataContainerWriter::execute()
   QH5Lite::writeStringAttribute(fileId, "/", SIMPL::HDF5::DREAM3DVersion, SIMPLib::Version::Complete());
   QFile xdmfFile;
   QTextStream xdmfOut(&xdmfFile);
-  if(m_WriteXdmfFile)
+  if(request.writeXdmfFile)
   {
-    QFileInfo ofFi(m_OutputFile);
-    QString name = ofFi.completeBaseName();
+    QString name = fi.completeBaseName();
     if(parentPath.isEmpty())
     {
       name = name + ".xdmf";
@@ -183,34 +408,33 @@ void DataContainerWriter::execute()
     xdmfFile.setFileName(name);
     if(xdmfFile.open(QIODevice::WriteOnly | QIODevice::Text))
     {
-      writeXdmfHeader(xdmfOut);
+      writeXdmfHeader(xdmfOut, request.writeTimeSeries);
     }
   }
 
   // Write the Pipeline to the File
-  int err = writePipeline();
+  int err = H5FilterParametersWriter::WritePipelineString(fileId, SIMPL::StringConstants::PipelineGroupName, request.pipelineJson);
 
   err = H5Utilities::createGroupsFromPath(SIMPL::StringConstants::DataContainerGroupName.toLatin1().data(), fileId);
   if(err < 0)
   {
-    QString ss = QObject::tr("Error creating HDF5 Group '%1'").arg(SIMPL::StringConstants::DataContainerGroupName);
-    setErrorCondition(-60, ss);
-    return;
+    errorMessage = QObject::tr("Error creating HDF5 Group '%1'").arg(SIMPL::StringConstants::DataContainerGroupName);
+    return -60;
   }
   hid_t dcaGid = H5Gopen(fileId, SIMPL::StringConstants::DataContainerGroupName.toLatin1().data(), H5P_DEFAULT);
   scopedFileSentinel.addGroupId(dcaGid);
 
-  QList<QString> dcNames = getDataContainerArray()->getDataContainerNames();
-  for(int iter = 0; iter < getDataContainerArray()->getNumDataContainers(); iter++)
+  const DataContainerArray::Pointer& dca = request.dataContainerArray;
+  QList<QString> dcNames = dca->getDataContainerNames();
+  for(int iter = 0; iter < dca->getNumDataContainers(); iter++)
   {
-    DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(dcNames[iter]);
+    DataContainer::Pointer dc = dca->getDataContainer(dcNames[iter]);
     IGeometry::Pointer geometry = dc->getGeometry();
     err = H5Utilities::createGroupsFromPath(dcNames[iter].toLatin1().data(), dcaGid);
     if(err < 0)
     {
-      QString ss = QObject::tr("Error creating HDF5 Group '%1'").arg(dcNames[iter]);
-      setErrorCondition(-60, ss);
-      return;
+      errorMessage = QObject::tr("Error creating HDF5 Group '%1'").arg(dcNames[iter]);
+      return -60;
     }
 
     hid_t dcGid = H5Gopen(dcaGid, dcNames[iter].toLatin1().data(), H5P_DEFAULT);
@@ -221,19 +445,19 @@ void DataContainerWriter::execute()
     err = dc->writeAttributeMatricesToHDF5(dcGid);
     if(err < 0)
     {
-      setErrorCondition(err, "Error writing DataContainer AttributeMatrices");
-      return;
+      errorMessage = QObject::tr("Error writing DataContainer AttributeMatrices");
+      return err;
     }
-    err = dc->writeMeshToHDF5(dcGid, m_WriteXdmfFile);
+    err = dc->writeMeshToHDF5(dcGid, request.writeXdmfFile);
     if(err < 0)
     {
-      setErrorCondition(err, "Error writing DataContainer Geometry");
-      return;
+      errorMessage = QObject::tr("Error writing DataContainer Geometry");
+      return err;
     }
-    if(m_WriteXdmfFile && geometry.get() != nullptr)
+    if(request.writeXdmfFile && geometry.get() != nullptr)
     {
 
-      if(getWriteTimeSeries())
+      if(request.writeTimeSeries)
       {
         dc->getGeometry()->setEnableTimeSeries(true);
         dc->getGeometry()->setTimeValue(static_cast<float>(iter));
@@ -247,54 +471,92 @@ void DataContainerWriter::execute()
       err = dc->writeXdmf(xdmfOut, hdfFileName);
       if(err < 0)
       {
-        setErrorCondition(err, "Error writing Xdmf File");
-        return;
+        errorMessage = QObject::tr("Error writing Xdmf File");
+        return err;
       }
     }
   }
 
   // Write the Data ContainerBundles
-  err = writeDataContainerBundles(fileId);
+  err = writeDataContainerBundles(fileId, dca);
   if(err < 0)
   {
-    QString ss = QObject::tr("Error writing DataContainerBundles");
-    setErrorCondition(-11113, ss);
-    return;
+    errorMessage = QObject::tr("Error writing DataContainerBundles");
+    return -11113;
   }
 
   // Write Montages
-  err = writeMontages(fileId);
+  err = writeMontages(fileId, dca);
   if(err < 0)
   {
-    QString ss = QObject::tr("Error writing montages");
-    setErrorCondition(-11113, ss);
-    return;
+    errorMessage = QObject::tr("Error writing montages");
+    return -11113;
   }
 
   // Write the XDMF File
-  if(m_WriteXdmfFile)
+  if(request.writeXdmfFile)
   {
-    writeXdmfFooter(xdmfOut);
+    writeXdmfFooter(xdmfOut, request.writeTimeSeries);
   }
+  return 0;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int DataContainerWriter::writeDataContainerBundles(hid_t fileId)
+void DataContainerWriter::appendSlices()
+{
+  // The writer outlives a single execution so every run of the pipeline extends the same file
+  if(nullptr == m_StreamWriter || !m_StreamWriter->isOpen() || m_StreamWriter->getFilePath() != m_OutputFile || m_StreamWriter->getWriteXdmf() != m_WriteXdmfFile ||
+     m_StreamWriter->getWriteTimeSeries() != m_WriteTimeSeries)
+  {
+    m_StreamWriter = H5DataContainerStreamWriter::New();
+    int32_t err = m_StreamWriter->open(m_OutputFile, m_WriteXdmfFile, m_WriteTimeSeries);
+    if(err < 0)
+    {
+      setErrorCondition(err, m_StreamWriter->getErrorMessage());
+      m_StreamWriter.reset();
+      return;
+    }
+    if(m_WritePipeline)
+    {
+      // The stream writer holds the file open, so the pipeline is written through its file id
+      QString pipelineJson = JsonFilterParametersWriter::New()->writePipelineToString(assemblePipeline(), SIMPL::StringConstants::PipelineGroupName, true);
+      err = m_StreamWriter->writePipeline(SIMPL::StringConstants::PipelineGroupName, pipelineJson);
+      if(err < 0)
+      {
+        setErrorCondition(err, m_StreamWriter->getErrorMessage());
+        m_StreamWriter.reset();
+        return;
+      }
+    }
+  }
+
+  int32_t err = m_StreamWriter->append(getDataContainerArray());
+  if(err < 0)
+  {
+    setErrorCondition(err, m_StreamWriter->getErrorMessage());
+    return;
+  }
+  QString ss = QObject::tr("Appended step %1 to '%2'").arg(m_StreamWriter->getNumberOfSteps()).arg(m_OutputFile);
+  notifyStatusMessage(ss);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int DataContainerWriter::writeDataContainerBundles(hid_t fileId, const DataContainerArray::Pointer& dca) const
 {
   int err = QH5Utilities::createGroupsFromPath(SIMPL::StringConstants::DataContainerBundleGroupName, fileId);
   if(err < 0)
   {
-    QString ss = QObject::tr("Error creating HDF5 Group '%1'").arg(SIMPL::StringConstants::DataContainerBundleGroupName);
-    setErrorCondition(-61, ss);
-    return -1;
+    return -61;
   }
   hid_t dcbGid = H5Gopen(fileId, SIMPL::StringConstants::DataContainerBundleGroupName.toLatin1().data(), H5P_DEFAULT);
 
   H5GroupAutoCloser groupCloser(dcbGid);
 
-  QMap<QString, IDataContainerBundle::Pointer>& bundles = getDataContainerArray()->getDataContainerBundles();
+  QMap<QString, IDataContainerBundle::Pointer>& bundles = dca->getDataContainerBundles();
   QMapIterator<QString, IDataContainerBundle::Pointer> iter(bundles);
   while(iter.hasNext())
   {
@@ -312,20 +574,18 @@ int DataContainerWriter::writeDataContainerBundles(hid_t fileId)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int DataContainerWriter::writeMontages(hid_t fileId)
+int DataContainerWriter::writeMontages(hid_t fileId, const DataContainerArray::Pointer& dca) const
 {
   int err = QH5Utilities::createGroupsFromPath(SIMPL::StringConstants::MontageGroupName, fileId);
   if(err < 0)
   {
-    QString ss = QObject::tr("Error creating HDF5 Group '%1'").arg(SIMPL::StringConstants::MontageGroupName);
-    setErrorCondition(-62, ss);
-    return -1;
+    return -62;
   }
   hid_t dcbGid = H5Gopen(fileId, SIMPL::StringConstants::MontageGroupName.toLatin1().data(), H5P_DEFAULT);
 
   H5GroupAutoCloser groupCloser(dcbGid);
 
-  DataContainerArray::MontageCollection montages = getDataContainerArray()->getMontageCollection();
+  DataContainerArray::MontageCollection montages = dca->getMontageCollection();
   for(const auto& montage : montages)
   {
     err = montage->writeH5Data(dcbGid);
@@ -341,7 +601,7 @@ int DataContainerWriter::writeMontages(hid_t fileId)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void DataContainerWriter::writeXdmfHeader(QTextStream& xdmf)
+void DataContainerWriter::writeXdmfHeader(QTextStream& xdmf, bool writeTimeSeries) const
 {
   xdmf << "<?xml version=\"1.0\"?>"
        << "\n";
@@ -351,7 +611,7 @@ void DataContainerWriter::writeXdmfHeader(QTextStream& xdmf)
        << "\n";
   xdmf << " <Domain>"
        << "\n";
-  if(getWriteTimeSeries())
+  if(writeTimeSeries)
   {
     xdmf << "<Grid Name=\"CellTime\" GridType=\"Collection\" CollectionType=\"Temporal\">"
          << "\n";
@@ -361,9 +621,9 @@ void DataContainerWriter::writeXdmfHeader(QTextStream& xdmf)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void DataContainerWriter::writeXdmfFooter(QTextStream& xdmf)
+void DataContainerWriter::writeXdmfFooter(QTextStream& xdmf, bool writeTimeSeries) const
 {
-  if(getWriteTimeSeries())
+  if(writeTimeSeries)
   {
     xdmf << " </Grid>"
          << "\n";
@@ -377,11 +637,8 @@ void DataContainerWriter::writeXdmfFooter(QTextStream& xdmf)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int DataContainerWriter::writePipeline()
+FilterPipeline::Pointer DataContainerWriter::assemblePipeline() const
 {
-  // WRITE THE PIPELINE TO THE HDF5 FILE
-  H5FilterParametersWriter::Pointer writer = H5FilterParametersWriter::New();
-
   // Now start walking BACKWARDS through the pipeline to find the first filter.
   AbstractFilter::Pointer previousFilter = getPreviousFilter().lock();
   while(previousFilter.get() != nullptr)
@@ -404,8 +661,17 @@ int DataContainerWriter::writePipeline()
     pipeline->pushBack(currentFilter);
     currentFilter = nextFilter;
   }
+  return pipeline;
+}
 
-  return writer->writePipelineToFile(pipeline, m_OutputFile, SIMPL::StringConstants::PipelineGroupName, true);
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int DataContainerWriter::writePipeline()
+{
+  // WRITE THE PIPELINE TO THE HDF5 FILE
+  H5FilterParametersWriter::Pointer writer = H5FilterParametersWriter::New();
+  return writer->writePipelineToFile(assemblePipeline(), m_OutputFile, SIMPL::StringConstants::PipelineGroupName, true);
 }
 
 // -----------------------------------------------------------------------------
@@ -557,6 +823,30 @@ bool DataContainerWriter::getWriteTimeSeries() const
   return m_WriteTimeSeries;
 }
 
+// -----------------------------------------------------------------------------
+void DataContainerWriter::setAppendSlices(bool value)
+{
+  m_AppendSlices = value;
+}
+
+// -----------------------------------------------------------------------------
+bool DataContainerWriter::getAppendSlices() const
+{
+  return m_AppendSlices;
+}
+
+// -----------------------------------------------------------------------------
+void DataContainerWriter::setWriteAsynchronously(bool value)
+{
+  m_WriteAsynchronously = value;
+}
+
+// -----------------------------------------------------------------------------
+bool DataContainerWriter::getWriteAsynchronously() const
+{
+  return m_WriteAsynchronously;
+}
+
 // -----------------------------------------------------------------------------
 void DataContainerWriter::setAppendToExisting(bool value)
 {
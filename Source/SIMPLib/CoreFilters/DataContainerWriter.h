@@ -35,6 +35,7 @@
 
 #pragma once
 
+#include <future>
 #include <memory>
 
 #include <hdf5.h>
@@ -42,7 +43,10 @@
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/HDF5/H5DataContainerStreamWriter.h"
 
 /**
  * @brief The DataContainerWriter class. See [Filter documentation](@ref datacontainerwriter) for details.
@@ -61,6 +65,9 @@ class SIMPLib_EXPORT DataContainerWriter : public AbstractFilter
   PYB11_PROPERTY(QString OutputFile READ getOutputFile WRITE setOutputFile)
   PYB11_PROPERTY(bool WriteXdmfFile READ getWriteXdmfFile WRITE setWriteXdmfFile)
   PYB11_PROPERTY(bool WriteTimeSeries READ getWriteTimeSeries WRITE setWriteTimeSeries)
+  PYB11_PROPERTY(bool AppendSlices READ getAppendSlices WRITE setAppendSlices)
+  PYB11_PROPERTY(bool WriteAsynchronously READ getWriteAsynchronously WRITE setWriteAsynchronously)
+  PYB11_METHOD(int32_t waitForPendingWrite)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -131,6 +138,30 @@ public:
 
   Q_PROPERTY(bool WriteTimeSeries READ getWriteTimeSeries WRITE setWriteTimeSeries)
 
+  /**
+   * @brief Setter property for AppendSlices
+   */
+  void setAppendSlices(bool value);
+  /**
+   * @brief Getter property for AppendSlices
+   * @return Value of AppendSlices
+   */
+  bool getAppendSlices() const;
+
+  Q_PROPERTY(bool AppendSlices READ getAppendSlices WRITE setAppendSlices)
+
+  /**
+   * @brief Setter property for WriteAsynchronously
+   */
+  void setWriteAsynchronously(bool value);
+  /**
+   * @brief Getter property for WriteAsynchronously
+   * @return Value of WriteAsynchronously
+   */
+  bool getWriteAsynchronously() const;
+
+  Q_PROPERTY(bool WriteAsynchronously READ getWriteAsynchronously WRITE setWriteAsynchronously)
+
   /**
    * @brief Setter property for AppendToExisting
    */
@@ -201,6 +232,19 @@ public:
    */
   void execute() override;
 
+  /**
+   * @brief finishBackgroundWork Reimplemented from @see AbstractFilter class
+   */
+  void finishBackgroundWork() override;
+
+  /**
+   * @brief waitForPendingWrite Blocks until the background write started by the last execute() has
+   * finished and reports a failure through setErrorCondition(), so it must be called on the thread that
+   * executes the filter. Returns immediately if there is none.
+   * @return The error code of the background write, 0 on success
+   */
+  int32_t waitForPendingWrite();
+
 protected:
   DataContainerWriter();
   /**
@@ -213,6 +257,12 @@ protected:
    */
   void initialize();
 
+  /**
+   * @brief assemblePipeline Collects the filters of the pipeline this filter is part of
+   * @return
+   */
+  FilterPipeline::Pointer assemblePipeline() const;
+
   /**
    * @brief writePipeline Writes the existing pipeline to the HDF5 file
    * @return
@@ -222,35 +272,94 @@ protected:
   /**
    * @brief writeDataContainerBundles Writes any existing DataContainerBundles to the HDF5 file
    * @param fileId Group Id for the DataContainerBundles
+   * @param dca DataContainerArray that holds the bundles
    * @return
    */
-  int writeDataContainerBundles(hid_t fileId);
+  int writeDataContainerBundles(hid_t fileId, const DataContainerArray::Pointer& dca) const;
 
   /**
    * @brief writeMontages Writes any existing Montages to the HDF5 file
    * @param fileId Group Id for the Montages
+   * @param dca DataContainerArray that holds the montages
    * @return
    */
-  int writeMontages(hid_t fileId);
+  int writeMontages(hid_t fileId, const DataContainerArray::Pointer& dca) const;
 
   /**
    * @brief writeXdmfHeader Writes the Xdmf header
    * @param out QTextStream for output
+   * @param writeTimeSeries Wrap the grids in a temporal collection
    */
-  void writeXdmfHeader(QTextStream& out);
+  void writeXdmfHeader(QTextStream& out, bool writeTimeSeries) const;
 
   /**
    * @brief writeXdmfFooter Writes the Xdmf footer
    * @param out QTextStream for output
+   * @param writeTimeSeries Close the temporal collection
    */
-  void writeXdmfFooter(QTextStream& out);
+  void writeXdmfFooter(QTextStream& out, bool writeTimeSeries) const;
+
+  /**
+   * @brief appendSlices Appends the Image Geometry cell data of this execution to the file that
+   * was opened by the first execution, see H5DataContainerStreamWriter
+   */
+  void appendSlices();
 
 private:
+  /**
+   * @brief Everything a write needs, captured when the filter executes so the write does not
+   * depend on filter state that may change while it runs on the I/O thread.
+   */
+  struct WriteRequest
+  {
+    DataContainerArray::Pointer dataContainerArray;
+    QString outputFile;
+    QString pipelineJson;
+    bool appendToExisting = false;
+    bool writeXdmfFile = true;
+    bool writeTimeSeries = false;
+  };
+
+  /**
+   * @brief writeFile Writes the request to its .dream3d (and .xdmf) file
+   * @param request The data and settings to write
+   * @param errorMessage Set to a description of the failure
+   * @return Negative value on error
+   */
+  int32_t writeFile(const WriteRequest& request, QString& errorMessage) const;
+
+  /**
+   * @brief The outcome of a background write, handed back to the filter's thread
+   */
+  struct WriteResult
+  {
+    int32_t errorCode = 0;
+    QString errorMessage;
+    QString outputFile;
+  };
+
+  /**
+   * @brief writeInBackground Queues the request on the HDF5 I/O thread
+   */
+  void writeInBackground(const WriteRequest& request);
+
+  /**
+   * @brief snapshotDataContainerArray Returns a DataContainerArray that stays unchanged while it is
+   * written in the background. The arrays are shared with the filter's DataContainerArray, except the ones
+   * that enabled filters after this one select as input and may therefore modify in place; those are copied.
+   */
+  DataContainerArray::Pointer snapshotDataContainerArray() const;
+
   QString m_OutputFile = {};
   bool m_WritePipeline = {true};
   bool m_WriteXdmfFile = {true};
   bool m_WriteTimeSeries = {false};
   bool m_AppendToExisting = {false};
+  bool m_AppendSlices = {false};
+  bool m_WriteAsynchronously = {false};
+
+  H5DataContainerStreamWriter::Pointer m_StreamWriter;
+  std::shared_future<WriteResult> m_PendingWrite;
 
 public:
   DataContainerWriter(const DataContainerWriter&) = delete;            // Copy Constructor Not Implemented
@@ -39,8 +39,10 @@
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/TemplateHelpers.h"
+#include "SIMPLib/DataArrays/ComponentViewArray.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/IntFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
@@ -70,6 +72,7 @@ void ExtractComponentAsArray::setupFilterParameters()
   FilterParameterVectorType parameters;
 
   parameters.push_back(SIMPL_NEW_INTEGER_FP("Component Number to Extract", CompNumber, FilterParameter::Category::Parameter, ExtractComponentAsArray));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Reference Component Without Copying", CreateView, FilterParameter::Category::Parameter, ExtractComponentAsArray));
 
   {
     DataArraySelectionFilterParameter::RequirementType req;
@@ -91,9 +94,18 @@ void ExtractComponentAsArray::readFilterParameters(AbstractFilterParametersReade
   setNewArrayArrayName(reader->readString("NewArrayArrayName", getNewArrayArrayName()));
   setCompNumber(reader->readValue("CompNumber", getCompNumber()));
   setSelectedArrayPath(reader->readDataArrayPath("SelectedArrayPath", getSelectedArrayPath()));
+  setCreateView(reader->readValue("CreateView", getCreateView()));
   reader->closeFilterGroup();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ExtractComponentAsArray::canReadFilterParametersConcurrently() const
+{
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -150,7 +162,32 @@ void ExtractComponentAsArray::dataCheck()
 
   std::vector<size_t> cDims(1, 1);
   DataArrayPath tempPath(getSelectedArrayPath().getDataContainerName(), getSelectedArrayPath().getAttributeMatrixName(), getNewArrayArrayName());
-  m_NewArrayPtr = TemplateHelpers::CreateNonPrereqArrayFromArrayType()(this, tempPath, cDims, m_InArrayPtr.lock(), DataArrayID);
+  if(!getCreateView())
+  {
+    m_NewArrayPtr = TemplateHelpers::CreateNonPrereqArrayFromArrayType()(this, tempPath, cDims, m_InArrayPtr.lock(), DataArrayID);
+    return;
+  }
+
+  // The view reads the component in place, so it is created during preflight as well
+  m_NewArrayPtr.reset();
+  AttributeMatrix::Pointer attrMat = getDataContainerArray()->getAttributeMatrix(tempPath);
+  if(nullptr != attrMat->getAttributeArray(getNewArrayArrayName()))
+  {
+    QString ss = QObject::tr("AttributeMatrix:'%1' An Attribute Array already exists with the name %2.").arg(attrMat->getName()).arg(getNewArrayArrayName());
+    setErrorCondition(-11006, ss);
+    return;
+  }
+
+  ComponentViewArray::Pointer view = ComponentViewArray::New(m_InArrayPtr.lock(), m_CompNumber, getNewArrayArrayName());
+  if(nullptr == view)
+  {
+    QString ss = QObject::tr("A component of the %1 array '%2' cannot be referenced without copying it").arg(m_InArrayPtr.lock()->getTypeAsString()).arg(getSelectedArrayPath().getDataArrayName());
+    setErrorCondition(-11007, ss);
+    return;
+  }
+  attrMat->insertOrAssign(view);
+  m_NewArrayPtr = view;
+  RenameDataPath::AlertFilterCreatedPath(this, DataArrayID, tempPath);
 }
 
 // -----------------------------------------------------------------------------
@@ -189,6 +226,12 @@ void ExtractComponentAsArray::execute()
     return;
   }
 
+  if(getCreateView())
+  {
+    // The view was already added by the dataCheck() and reads the selected array directly
+    return;
+  }
+
   EXECUTE_FUNCTION_TEMPLATE(this, extractComponent, m_InArrayPtr.lock(), m_InArrayPtr.lock(), m_NewArrayPtr.lock(), m_CompNumber)
 }
 
@@ -328,3 +371,15 @@ QString ExtractComponentAsArray::getNewArrayArrayName() const
 {
   return m_NewArrayArrayName;
 }
+
+// -----------------------------------------------------------------------------
+void ExtractComponentAsArray::setCreateView(bool value)
+{
+  m_CreateView = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ExtractComponentAsArray::getCreateView() const
+{
+  return m_CreateView;
+}
@@ -60,6 +60,7 @@ class SIMPLib_EXPORT ExtractComponentAsArray : public AbstractFilter
   PYB11_PROPERTY(DataArrayPath SelectedArrayPath READ getSelectedArrayPath WRITE setSelectedArrayPath)
   PYB11_PROPERTY(int CompNumber READ getCompNumber WRITE setCompNumber)
   PYB11_PROPERTY(QString NewArrayArrayName READ getNewArrayArrayName WRITE setNewArrayArrayName)
+  PYB11_PROPERTY(bool CreateView READ getCreateView WRITE setCreateView)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -120,6 +121,18 @@ public:
 
   Q_PROPERTY(QString NewArrayArrayName READ getNewArrayArrayName WRITE setNewArrayArrayName)
 
+  /**
+   * @brief Setter property for CreateView
+   */
+  void setCreateView(bool value);
+  /**
+   * @brief Getter property for CreateView
+   * @return Value of CreateView
+   */
+  bool getCreateView() const;
+
+  Q_PROPERTY(bool CreateView READ getCreateView WRITE setCreateView)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -175,6 +188,11 @@ public:
    */
   void readFilterParameters(AbstractFilterParametersReader* reader, int index) override;
 
+  /**
+   * @brief canReadFilterParametersConcurrently Reimplemented from @see AbstractFilter class
+   */
+  bool canReadFilterParametersConcurrently() const override;
+
   /**
    * @brief execute Reimplemented from @see AbstractFilter class
    */
@@ -199,6 +217,7 @@ private:
   DataArrayPath m_SelectedArrayPath = {"", "", ""};
   int m_CompNumber = {0};
   QString m_NewArrayArrayName = {""};
+  bool m_CreateView = {false};
 
 public:
   ExtractComponentAsArray(const ExtractComponentAsArray&) = delete;            // Copy Constructor Not Implemented
@@ -34,7 +34,6 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "ExtractVertexGeometry.h"
 
-#include <numeric>
 
 #include <QtCore/QTextStream>
 
@@ -262,20 +261,15 @@ void ExtractVertexGeometry::execute()
 
   IGeometryGrid::Pointer sourceGeometry = getDataContainerArray()->getDataContainer(getSelectedDataContainerName())->getGeometryAs<IGeometryGrid>();
 
-  float coords[3] = {0.0f, 0.0f, 0.0f};
-
-  SizeVec3Type dims = sourceGeometry->getDimensions();
-  size_t cellCount = std::accumulate(dims.begin(), dims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
-
   VertexGeom::Pointer vertexGeom = getDataContainerArray()->getDataContainer(getVertexDataContainerName())->getGeometryAs<VertexGeom>();
   SharedVertexList::Pointer vertices = vertexGeom->getVertices();
 
-  // Use the APIs from the IGeometryGrid to get the XYZ coord for the center of each cell and then set that into the
-  // the new VertexGeometry
-  for(size_t idx = 0; idx < cellCount; idx++)
+  // The cell centers of the IGeometryGrid are generated row by row from the per axis coordinates and written
+  // straight into the vertex list of the new VertexGeometry
+  if(!sourceGeometry->copyCellCenters(*vertices))
   {
-    sourceGeometry->getCoords(idx, coords);
-    vertices->setTuple(idx, coords);
+    QString ss = QObject::tr("The number of cells in the input Geometry (%1) does not match the number of vertices (%2)").arg(sourceGeometry->getNumberOfElements()).arg(vertices->getNumberOfTuples());
+    setErrorCondition(-2012, ss);
   }
 }
 
@@ -164,6 +164,14 @@ void FindDerivatives::readFilterParameters(AbstractFilterParametersReader* reade
   reader->closeFilterGroup();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FindDerivatives::canReadFilterParametersConcurrently() const
+{
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -34,9 +34,6 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "GenerateVertexCoordinates.h"
 
-#include <array>
-#include <numeric>
-
 #include <QtCore/QTextStream>
 
 #include "SIMPLib/SIMPLibVersion.h"
@@ -122,16 +119,14 @@ void GenerateVertexCoordinates::dataCheck()
     return;
   }
   IGeometry::Type geomType = fromGeometry->getGeometryType();
-  if(IGeometry::Type::Image == geomType || IGeometry::Type::RectGrid == geomType)
-  {
-    m_CoordinatesPtr = getDataContainerArray()->createNonPrereqArrayFromPath<FloatArrayType>(this, getCoordinateArrayPath(), 0, {3}, "", DataArrayID31);
-  }
-  else
+  if(IGeometry::Type::Image != geomType && IGeometry::Type::RectGrid != geomType)
   {
     QString ss = QObject::tr("Data Container's Geometry type must be either an Image Geometry or RectLinearGrid Geometry. The Geomerty is of type %1").arg(fromGeometry->getGeometryTypeAsString());
     setErrorCondition(-2010, ss);
     return;
   }
+
+  m_CoordinatesPtr = getDataContainerArray()->createNonPrereqArrayFromPath<FloatArrayType>(this, getCoordinateArrayPath(), 0, {3}, "", DataArrayID31);
 }
 
 // -----------------------------------------------------------------------------
@@ -148,17 +143,13 @@ void GenerateVertexCoordinates::execute()
 
   IGeometryGrid::Pointer sourceGeometry = getDataContainerArray()->getDataContainer(getSelectedDataContainerName())->getGeometryAs<IGeometryGrid>();
 
-  std::array<float, 3> coords = {0.0f, 0.0f, 0.0f};
-
-  SizeVec3Type dims = sourceGeometry->getDimensions();
-  size_t cellCount = std::accumulate(dims.begin(), dims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
-
-  // Use the APIs from the IGeometryGrid to get the XYZ coord for the center of each cell and then set that into the
-  // the new VertexGeometry
-  for(size_t idx = 0; idx < cellCount; idx++)
+  // Fill the array row by row from the per axis cell center coordinates instead of calling getCoords() for every cell
+  if(!sourceGeometry->copyCellCenters(*m_CoordinatesPtr))
   {
-    sourceGeometry->getCoords(idx, coords.data());
-    m_CoordinatesPtr->setTuple(idx, coords.data());
+    QString ss = QObject::tr("The number of cells in the Geometry (%1) does not match the number of tuples in the created array (%2)")
+                     .arg(sourceGeometry->getNumberOfElements())
+                     .arg(m_CoordinatesPtr->getNumberOfTuples());
+    setErrorCondition(-2012, ss);
   }
 }
 
@@ -31,6 +31,9 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "ImportHDF5Dataset.h"
 
+#include <functional>
+#include <numeric>
+
 #include <QtCore/QDebug>
 #include <QtCore/QFileInfo>
 #include <QtCore/QTextStream>
@@ -47,7 +50,10 @@
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AttributeMatrixSelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/ImportHDF5DatasetFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/HDF5/H5DataArrayReader.h"
 
 namespace Detail
 {
@@ -55,7 +61,8 @@ namespace Detail
 //
 // -----------------------------------------------------------------------------
 template <typename T>
-IDataArray::Pointer readH5Dataset(hid_t locId, const QString& datasetPath, const size_t& numOfTuples, const std::vector<size_t>& cDims)
+IDataArray::Pointer readH5Dataset(hid_t locId, const QString& datasetPath, const size_t& numOfTuples, const std::vector<size_t>& cDims, const std::vector<hsize_t>& offset,
+                                  const std::vector<hsize_t>& count)
 {
   herr_t err = -1;
   IDataArray::Pointer ptr;
@@ -63,7 +70,14 @@ IDataArray::Pointer readH5Dataset(hid_t locId, const QString& datasetPath, const
   ptr = DataArray<T>::CreateArray(numOfTuples, cDims, datasetPath, true);
 
   T* data = (T*)(ptr->getVoidPointer(0));
-  err = QH5Lite::readPointerDataset(locId, datasetPath, data);
+  if(offset.empty())
+  {
+    err = QH5Lite::readPointerDataset(locId, datasetPath, data);
+  }
+  else
+  {
+    err = H5DataArrayReader::ReadHyperslab(locId, datasetPath, H5DataArrayReader::NativeTypeForPrimitive<T>(), offset, count, data);
+  }
   if(err < 0)
   {
     qDebug() << "readH5Data read error: " << __FILE__ << "(" << __LINE__ << ")";
@@ -115,6 +129,11 @@ void ImportHDF5Dataset::setupFilterParameters()
     parameters.push_back(SIMPL_NEW_AM_SELECTION_FP("Attribute Matrix", SelectedAttributeMatrix, FilterParameter::Category::RequiredArray, ImportHDF5Dataset, req));
   }
 
+  std::vector<QString> linkedProps = {"SubvolumeMinIndex", "SubvolumeMaxIndex"};
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Read Subvolume", ReadSubvolume, FilterParameter::Category::Parameter, ImportHDF5Dataset, linkedProps));
+  parameters.push_back(SIMPL_NEW_INT_VEC3_FP("Subvolume Minimum Index (X, Y, Z)", SubvolumeMinIndex, FilterParameter::Category::Parameter, ImportHDF5Dataset));
+  parameters.push_back(SIMPL_NEW_INT_VEC3_FP("Subvolume Maximum Index (X, Y, Z)", SubvolumeMaxIndex, FilterParameter::Category::Parameter, ImportHDF5Dataset));
+
   setFilterParameters(parameters);
 }
 
@@ -302,7 +321,17 @@ void ImportHDF5Dataset::dataCheck()
 
     stream << "\n";
 
-    if(hdf5TotalElements != userEnteredTotalElements)
+    std::vector<hsize_t> hyperslabOffset;
+    std::vector<hsize_t> hyperslabCount;
+    if(m_ReadSubvolume)
+    {
+      if(!computeSubvolumeHyperslab(am, datasetPath, dims, static_cast<size_t>(totalComponents), hyperslabOffset, hyperslabCount))
+      {
+        m_DatasetPathsWithErrors.push_back(datasetPath);
+        return;
+      }
+    }
+    else if(hdf5TotalElements != userEnteredTotalElements)
     {
       stream << tr("The dataset with path '%1' cannot be read into attribute matrix '%2' because %3 "
                    "attribute matrix tuples and %4 components per tuple equals %5 total elements, and"
@@ -334,7 +363,7 @@ void ImportHDF5Dataset::dataCheck()
     }
     else
     {
-      IDataArray::Pointer dPtr = readIDataArray(parentId, objectName, am->getNumberOfTuples(), cDims, getInPreflight());
+      IDataArray::Pointer dPtr = readIDataArray(parentId, objectName, am->getNumberOfTuples(), cDims, getInPreflight(), hyperslabOffset, hyperslabCount);
       if(nullptr != dPtr)
       {
         am->insertOrAssign(dPtr);
@@ -351,6 +380,126 @@ void ImportHDF5Dataset::dataCheck()
   // The sentinel will close the HDF5 File and any groups that were open.
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ImportHDF5Dataset::computeSubvolumeHyperslab(const AttributeMatrix::Pointer& am, const QString& datasetPath, const QVector<hsize_t>& dims, size_t numComponents, std::vector<hsize_t>& offset,
+                                                  std::vector<hsize_t>& count)
+{
+  // The trailing (fastest) dataset dimensions hold the components, the leading ones are the tuple dimensions
+  // stored slowest to fastest (Z, Y, X). Trailing dimensions of 1 are folded into the components when the
+  // dataset would otherwise have more than 3 tuple dimensions.
+  int32_t numTupleAxes = dims.size();
+  size_t trailingElements = 1;
+  while(numTupleAxes > 0 && (trailingElements < numComponents || (numTupleAxes > 3 && dims[numTupleAxes - 1] == 1)))
+  {
+    trailingElements *= dims[numTupleAxes - 1];
+    numTupleAxes--;
+  }
+  if(numTupleAxes == 0 || numTupleAxes > 3 || trailingElements != numComponents)
+  {
+    QString ss = tr("The dimensions of the dataset with path '%1' cannot be split into at most 3 tuple dimensions followed by the entered component dimensions, so a subvolume cannot be read.")
+                     .arg(datasetPath);
+    setErrorCondition(-20011, ss);
+    return false;
+  }
+
+  // Tuple dimensions of the dataset in X, Y, Z order, padded with 1 for the unused axes
+  SizeVec3Type datasetDims(1, 1, 1);
+  for(int32_t i = 0; i < numTupleAxes; i++)
+  {
+    datasetDims[i] = dims[numTupleAxes - 1 - i];
+  }
+
+  std::vector<size_t> subvolumeDims(numTupleAxes);
+  for(size_t i = 0; i < 3; i++)
+  {
+    if(m_SubvolumeMinIndex[i] < 0 || m_SubvolumeMinIndex[i] > m_SubvolumeMaxIndex[i] || static_cast<size_t>(m_SubvolumeMaxIndex[i]) >= datasetDims[i])
+    {
+      QString ss = tr("The subvolume [%1-%2, %3-%4, %5-%6] does not fit inside the dataset with path '%7', which has tuple dimensions %8 x %9 x %10.")
+                       .arg(m_SubvolumeMinIndex[0])
+                       .arg(m_SubvolumeMaxIndex[0])
+                       .arg(m_SubvolumeMinIndex[1])
+                       .arg(m_SubvolumeMaxIndex[1])
+                       .arg(m_SubvolumeMinIndex[2])
+                       .arg(m_SubvolumeMaxIndex[2])
+                       .arg(datasetPath)
+                       .arg(datasetDims[0])
+                       .arg(datasetDims[1])
+                       .arg(datasetDims[2]);
+      setErrorCondition(-20012, ss);
+      return false;
+    }
+    if(i < subvolumeDims.size())
+    {
+      subvolumeDims[i] = static_cast<size_t>(m_SubvolumeMaxIndex[i] - m_SubvolumeMinIndex[i] + 1);
+    }
+  }
+
+  offset.clear();
+  count.clear();
+  for(int32_t i = numTupleAxes - 1; i >= 0; i--)
+  {
+    offset.push_back(static_cast<hsize_t>(m_SubvolumeMinIndex[i]));
+    count.push_back(static_cast<hsize_t>(subvolumeDims[i]));
+  }
+  for(int32_t i = numTupleAxes; i < dims.size(); i++)
+  {
+    offset.push_back(0);
+    count.push_back(dims[i]);
+  }
+
+  size_t numSubvolumeTuples = std::accumulate(subvolumeDims.begin(), subvolumeDims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
+  if(am->getNumberOfTuples() == numSubvolumeTuples)
+  {
+    return true;
+  }
+  if(am->getNumAttributeArrays() > 0)
+  {
+    QString ss = tr("The subvolume has %1 tuples but the Attribute Matrix '%2' already holds arrays with %3 tuples.")
+                     .arg(numSubvolumeTuples)
+                     .arg(m_SelectedAttributeMatrix.serialize("/"))
+                     .arg(am->getNumberOfTuples());
+    setErrorCondition(-20013, ss);
+    return false;
+  }
+
+  // The Attribute Matrix is still empty, so reshape it to the subvolume and crop the geometry it belongs to
+  am->setTupleDimensions(subvolumeDims);
+
+  DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(m_SelectedAttributeMatrix.getDataContainerName());
+  ImageGeom::Pointer image = std::dynamic_pointer_cast<ImageGeom>(dc->getGeometry());
+  if(nullptr == image || am->getType() != AttributeMatrix::Type::Cell)
+  {
+    return true;
+  }
+
+  SizeVec3Type croppedDims(1, 1, 1);
+  for(size_t i = 0; i < subvolumeDims.size(); i++)
+  {
+    croppedDims[i] = subvolumeDims[i];
+  }
+  if(image->getDimensions() == datasetDims)
+  {
+    FloatVec3Type origin = image->getOrigin();
+    FloatVec3Type spacing = image->getSpacing();
+    for(size_t i = 0; i < 3; i++)
+    {
+      origin[i] += static_cast<float>(m_SubvolumeMinIndex[i]) * spacing[i];
+    }
+    image->setOrigin(origin);
+  }
+  else
+  {
+    QString ss = tr("The Image Geometry of '%1' does not match the dimensions of the dataset with path '%2', so only its dimensions were changed to the subvolume and its origin was left as is.")
+                     .arg(dc->getName())
+                     .arg(datasetPath);
+    setWarningCondition(-20014, ss);
+  }
+  image->setDimensions(croppedDims);
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -392,7 +541,8 @@ std::vector<size_t> ImportHDF5Dataset::createComponentDimensions(const QString&
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-IDataArrayShPtrType ImportHDF5Dataset::readIDataArray(hid_t gid, const QString& name, size_t numOfTuples, const std::vector<size_t>& cDims, bool metaDataOnly)
+IDataArrayShPtrType ImportHDF5Dataset::readIDataArray(hid_t gid, const QString& name, size_t numOfTuples, const std::vector<size_t>& cDims, bool metaDataOnly, const std::vector<hsize_t>& offset,
+                                                      const std::vector<hsize_t>& count)
 {
   herr_t err = -1;
   // herr_t retErr = 1;
@@ -428,7 +578,7 @@ IDataArrayShPtrType ImportHDF5Dataset::readIDataArray(hid_t gid, const QString&
     {
       if(!metaDataOnly)
       {
-        ptr = Detail::readH5Dataset<uint8_t>(gid, name, numOfTuples, cDims);
+        ptr = Detail::readH5Dataset<uint8_t>(gid, name, numOfTuples, cDims, offset, count);
       }
       else
       {
@@ -439,7 +589,7 @@ IDataArrayShPtrType ImportHDF5Dataset::readIDataArray(hid_t gid, const QString&
     {
       if(!metaDataOnly)
       {
-        ptr = Detail::readH5Dataset<uint16_t>(gid, name, numOfTuples, cDims);
+        ptr = Detail::readH5Dataset<uint16_t>(gid, name, numOfTuples, cDims, offset, count);
       }
       else
       {
@@ -450,7 +600,7 @@ IDataArrayShPtrType ImportHDF5Dataset::readIDataArray(hid_t gid, const QString&
     {
       if(!metaDataOnly)
       {
-        ptr = Detail::readH5Dataset<uint32_t>(gid, name, numOfTuples, cDims);
+        ptr = Detail::readH5Dataset<uint32_t>(gid, name, numOfTuples, cDims, offset, count);
       }
       else
       {
@@ -461,7 +611,7 @@ IDataArrayShPtrType ImportHDF5Dataset::readIDataArray(hid_t gid, const QString&
     {
       if(!metaDataOnly)
       {
-        ptr = Detail::readH5Dataset<uint64_t>(gid, name, numOfTuples, cDims);
+        ptr = Detail::readH5Dataset<uint64_t>(gid, name, numOfTuples, cDims, offset, count);
       }
       else
       {
@@ -472,7 +622,7 @@ IDataArrayShPtrType ImportHDF5Dataset::readIDataArray(hid_t gid, const QString&
     {
       if(!metaDataOnly)
       {
-        ptr = Detail::readH5Dataset<int8_t>(gid, name, numOfTuples, cDims);
+        ptr = Detail::readH5Dataset<int8_t>(gid, name, numOfTuples, cDims, offset, count);
       }
       else
       {
@@ -483,7 +633,7 @@ IDataArrayShPtrType ImportHDF5Dataset::readIDataArray(hid_t gid, const QString&
     {
       if(!metaDataOnly)
       {
-        ptr = Detail::readH5Dataset<int16_t>(gid, name, numOfTuples, cDims);
+        ptr = Detail::readH5Dataset<int16_t>(gid, name, numOfTuples, cDims, offset, count);
       }
       else
       {
@@ -494,7 +644,7 @@ IDataArrayShPtrType ImportHDF5Dataset::readIDataArray(hid_t gid, const QString&
     {
       if(!metaDataOnly)
       {
-        ptr = Detail::readH5Dataset<int32_t>(gid, name, numOfTuples, cDims);
+        ptr = Detail::readH5Dataset<int32_t>(gid, name, numOfTuples, cDims, offset, count);
       }
       else
       {
@@ -505,7 +655,7 @@ IDataArrayShPtrType ImportHDF5Dataset::readIDataArray(hid_t gid, const QString&
     {
       if(!metaDataOnly)
       {
-        ptr = Detail::readH5Dataset<int64_t>(gid, name, numOfTuples, cDims);
+        ptr = Detail::readH5Dataset<int64_t>(gid, name, numOfTuples, cDims, offset, count);
       }
       else
       {
@@ -523,7 +673,7 @@ IDataArrayShPtrType ImportHDF5Dataset::readIDataArray(hid_t gid, const QString&
     {
       if(!metaDataOnly)
       {
-        ptr = Detail::readH5Dataset<float>(gid, name, numOfTuples, cDims);
+        ptr = Detail::readH5Dataset<float>(gid, name, numOfTuples, cDims, offset, count);
       }
       else
       {
@@ -534,7 +684,7 @@ IDataArrayShPtrType ImportHDF5Dataset::readIDataArray(hid_t gid, const QString&
     {
       if(!metaDataOnly)
       {
-        ptr = Detail::readH5Dataset<double>(gid, name, numOfTuples, cDims);
+        ptr = Detail::readH5Dataset<double>(gid, name, numOfTuples, cDims, offset, count);
       }
       else
       {
@@ -569,6 +719,9 @@ AbstractFilter::Pointer ImportHDF5Dataset::newFilterInstance(bool copyFilterPara
     filter->setHDF5FilePath(getHDF5FilePath());
     filter->setDatasetImportInfoList(getDatasetImportInfoList());
     filter->setSelectedAttributeMatrix(getSelectedAttributeMatrix());
+    filter->setReadSubvolume(getReadSubvolume());
+    filter->setSubvolumeMinIndex(getSubvolumeMinIndex());
+    filter->setSubvolumeMaxIndex(getSubvolumeMaxIndex());
   }
   return filter;
 }
@@ -708,3 +861,39 @@ QStringList ImportHDF5Dataset::getDatasetPathsWithErrors() const
 {
   return m_DatasetPathsWithErrors;
 }
+
+// -----------------------------------------------------------------------------
+void ImportHDF5Dataset::setReadSubvolume(bool value)
+{
+  m_ReadSubvolume = value;
+}
+
+// -----------------------------------------------------------------------------
+bool ImportHDF5Dataset::getReadSubvolume() const
+{
+  return m_ReadSubvolume;
+}
+
+// -----------------------------------------------------------------------------
+void ImportHDF5Dataset::setSubvolumeMinIndex(const IntVec3Type& value)
+{
+  m_SubvolumeMinIndex = value;
+}
+
+// -----------------------------------------------------------------------------
+IntVec3Type ImportHDF5Dataset::getSubvolumeMinIndex() const
+{
+  return m_SubvolumeMinIndex;
+}
+
+// -----------------------------------------------------------------------------
+void ImportHDF5Dataset::setSubvolumeMaxIndex(const IntVec3Type& value)
+{
+  m_SubvolumeMaxIndex = value;
+}
+
+// -----------------------------------------------------------------------------
+IntVec3Type ImportHDF5Dataset::getSubvolumeMaxIndex() const
+{
+  return m_SubvolumeMaxIndex;
+}
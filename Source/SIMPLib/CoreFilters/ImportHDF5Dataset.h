@@ -37,12 +37,16 @@
 #include <hdf5.h>
 
 #include <QtCore/QJsonObject>
+#include <QtCore/QVector>
 
 #include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/FilterParameters/IntVec3FilterParameter.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 
 class IDataArray;
 using IDataArrayShPtrType = std::shared_ptr<IDataArray>;
+class AttributeMatrix;
+using AttributeMatrixShPtrType = std::shared_ptr<AttributeMatrix>;
 
 /**
  * @brief The ImportHDF5Dataset class. See [Filter documentation](@ref readhdf5file) for details.
@@ -59,6 +63,9 @@ class SIMPLib_EXPORT ImportHDF5Dataset : public AbstractFilter
   PYB11_PROPERTY(QString HDF5FilePath READ getHDF5FilePath WRITE setHDF5FilePath)
   PYB11_PROPERTY(QList<ImportHDF5Dataset::DatasetImportInfo> DatasetImportInfoList READ getDatasetImportInfoList WRITE setDatasetImportInfoList)
   PYB11_PROPERTY(DataArrayPath SelectedAttributeMatrix READ getSelectedAttributeMatrix WRITE setSelectedAttributeMatrix)
+  PYB11_PROPERTY(bool ReadSubvolume READ getReadSubvolume WRITE setReadSubvolume)
+  PYB11_PROPERTY(IntVec3Type SubvolumeMinIndex READ getSubvolumeMinIndex WRITE setSubvolumeMinIndex)
+  PYB11_PROPERTY(IntVec3Type SubvolumeMaxIndex READ getSubvolumeMaxIndex WRITE setSubvolumeMaxIndex)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -146,6 +153,42 @@ public:
 
   Q_PROPERTY(DataArrayPath SelectedAttributeMatrix READ getSelectedAttributeMatrix WRITE setSelectedAttributeMatrix)
 
+  /**
+   * @brief Setter property for ReadSubvolume
+   */
+  void setReadSubvolume(bool value);
+  /**
+   * @brief Getter property for ReadSubvolume
+   * @return Value of ReadSubvolume
+   */
+  bool getReadSubvolume() const;
+
+  Q_PROPERTY(bool ReadSubvolume READ getReadSubvolume WRITE setReadSubvolume)
+
+  /**
+   * @brief Setter property for SubvolumeMinIndex
+   */
+  void setSubvolumeMinIndex(const IntVec3Type& value);
+  /**
+   * @brief Getter property for SubvolumeMinIndex
+   * @return Value of SubvolumeMinIndex
+   */
+  IntVec3Type getSubvolumeMinIndex() const;
+
+  Q_PROPERTY(IntVec3Type SubvolumeMinIndex READ getSubvolumeMinIndex WRITE setSubvolumeMinIndex)
+
+  /**
+   * @brief Setter property for SubvolumeMaxIndex
+   */
+  void setSubvolumeMaxIndex(const IntVec3Type& value);
+  /**
+   * @brief Getter property for SubvolumeMaxIndex
+   * @return Value of SubvolumeMaxIndex
+   */
+  IntVec3Type getSubvolumeMaxIndex() const;
+
+  Q_PROPERTY(IntVec3Type SubvolumeMaxIndex READ getSubvolumeMaxIndex WRITE setSubvolumeMaxIndex)
+
   /**
    * @brief Setter property for DatasetPathsWithErrors
    */
@@ -229,8 +272,30 @@ private:
   QList<ImportHDF5Dataset::DatasetImportInfo> m_DatasetImportInfoList = {};
   DataArrayPath m_SelectedAttributeMatrix = {};
   QStringList m_DatasetPathsWithErrors = {};
+  bool m_ReadSubvolume = {false};
+  IntVec3Type m_SubvolumeMinIndex = {0, 0, 0};
+  IntVec3Type m_SubvolumeMaxIndex = {0, 0, 0};
 
-  IDataArrayShPtrType readIDataArray(hid_t gid, const QString& name, size_t numOfTuples, const std::vector<size_t>& cDims, bool metaDataOnly);
+  /**
+   * @brief readIDataArray Reads the dataset into a new DataArray. If 'offset' is empty the whole dataset
+   * is read, otherwise only the hyperslab given by 'offset' and 'count' (HDF5 dimension order).
+   */
+  IDataArrayShPtrType readIDataArray(hid_t gid, const QString& name, size_t numOfTuples, const std::vector<size_t>& cDims, bool metaDataOnly, const std::vector<hsize_t>& offset,
+                                     const std::vector<hsize_t>& count);
+
+  /**
+   * @brief computeSubvolumeHyperslab Validates the subvolume against the dataset dimensions, computes the
+   * hyperslab to read and reshapes the selected Attribute Matrix (and crops its Image Geometry) to the subvolume.
+   * @param am The selected Attribute Matrix
+   * @param datasetPath Path of the dataset, used in error messages
+   * @param dims The HDF5 dimensions of the dataset
+   * @param numComponents The total number of components entered for the dataset
+   * @param offset Output hyperslab start
+   * @param count Output hyperslab size
+   * @return false if an error condition was set
+   */
+  bool computeSubvolumeHyperslab(const AttributeMatrixShPtrType& am, const QString& datasetPath, const QVector<hsize_t>& dims, size_t numComponents, std::vector<hsize_t>& offset,
+                                 std::vector<hsize_t>& count);
 
   /**
    * @brief createComponentDimensions
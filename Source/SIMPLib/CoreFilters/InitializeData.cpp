@@ -122,6 +122,14 @@ void InitializeData::setupFilterParameters()
   setFilterParameters(parameters);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool InitializeData::canReadFilterParametersConcurrently() const
+{
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
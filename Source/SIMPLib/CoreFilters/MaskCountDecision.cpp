@@ -60,7 +60,8 @@ MaskCountDecision::~MaskCountDecision() = default;
 void MaskCountDecision::setupFilterParameters()
 {
   FilterParameterVectorType parameters = getFilterParameters();
-  DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateRequirement(SIMPL::TypeNames::Bool, 1, AttributeMatrix::Type::Any, IGeometry::Type::Any);
+  DataArraySelectionFilterParameter::RequirementType req =
+      DataArraySelectionFilterParameter::CreateRequirement(QVector<QString>{SIMPL::TypeNames::Bool, SIMPL::TypeNames::Bit}, 1, AttributeMatrix::Type::Any, IGeometry::Type::Any);
   parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Mask", MaskArrayPath, FilterParameter::Category::RequiredArray, MaskCountDecision, req));
   parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of True Instances", NumberOfTrues, FilterParameter::Category::Parameter, MaskCountDecision, 0));
   setFilterParameters(parameters);
@@ -93,6 +94,16 @@ void MaskCountDecision::dataCheck()
   clearErrorCode();
   clearWarningCode();
 
+  m_Mask = nullptr;
+  m_MaskPtr.reset();
+
+  // A packed BitArray mask is counted directly, anything else has to be a DataArray<bool>
+  m_BitMaskPtr = std::dynamic_pointer_cast<BitArray>(getDataContainerArray()->getPrereqIDataArrayFromPath(this, getMaskArrayPath()));
+  if(getErrorCode() < 0 || nullptr != m_BitMaskPtr.lock())
+  {
+    return;
+  }
+
   std::vector<size_t> cDims(1, 1);
 
   m_MaskPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<bool>>(this, getMaskArrayPath(), cDims);
@@ -113,37 +124,61 @@ void MaskCountDecision::execute()
     return;
   }
 
-  size_t numTuples = m_MaskPtr.lock()->getNumberOfTuples();
+  BitArray::Pointer bitMask = m_BitMaskPtr.lock();
+  size_t numTuples = (nullptr != bitMask) ? bitMask->getNumberOfTuples() : m_MaskPtr.lock()->getNumberOfTuples();
 
-  int32_t trueCount = 0;
   bool dm = true;
 
   qDebug() << "NumberOfTrues: " << m_NumberOfTrues;
 
-  for(size_t i = 0; i < numTuples; i++)
+  if(numTuples == 0)
+  {
+    Q_EMIT decisionMade(dm);
+    return;
+  }
+
+  // Without a positive target the decision only depends on the first value
+  bool firstValue = (nullptr != bitMask) ? bitMask->getValue(0) : m_Mask[0];
+  if(m_NumberOfTrues <= 0)
   {
-    if(m_NumberOfTrues < 0 && !m_Mask[i])
+    if(m_NumberOfTrues < 0 && !firstValue)
     {
-      qDebug() << "First if check: " << dm;
       Q_EMIT decisionMade(dm);
       return;
     }
-    if(m_Mask[i])
-    {
-      trueCount++;
-    }
-    if(trueCount >= m_NumberOfTrues)
-    {
-      dm = false;
-      qDebug() << "Second if check: " << dm;
+    dm = false;
+    int32_t trueCount = firstValue ? 1 : 0;
+    Q_EMIT decisionMade(dm);
+    Q_EMIT targetValue(trueCount);
+    return;
+  }
 
-      Q_EMIT decisionMade(dm);
-      Q_EMIT targetValue(trueCount);
-      return;
+  // The packed mask is counted a word at a time, the bool mask stops as soon as the target is reached
+  const auto numberOfTrues = static_cast<size_t>(m_NumberOfTrues);
+  size_t trueCount = 0;
+  if(nullptr != bitMask)
+  {
+    trueCount = bitMask->count();
+  }
+  else
+  {
+    for(size_t i = 0; i < numTuples && trueCount < numberOfTrues; i++)
+    {
+      if(m_Mask[i])
+      {
+        trueCount++;
+      }
     }
   }
 
-  qDebug() << "Fell through: " << dm;
+  if(trueCount >= numberOfTrues)
+  {
+    dm = false;
+    int32_t target = m_NumberOfTrues;
+    Q_EMIT decisionMade(dm);
+    Q_EMIT targetValue(target);
+    return;
+  }
 
   Q_EMIT decisionMade(dm);
 }
@@ -38,6 +38,7 @@
 #include <memory>
 
 #include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/BitArray.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/Filtering/AbstractDecisionFilter.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
@@ -171,6 +172,7 @@ protected:
 private:
   std::weak_ptr<DataArray<bool>> m_MaskPtr;
   bool* m_Mask = nullptr;
+  std::weak_ptr<BitArray> m_BitMaskPtr;
 
   DataArrayPath m_MaskArrayPath = {"", "", ""};
   int m_NumberOfTrues = {0};
@@ -41,10 +41,11 @@
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/ComparisonSelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
-#include "SIMPLib/Filtering/ThresholdFilterHelper.h"
+#include "SIMPLib/Filtering/ThresholdEvaluator.h"
 
 enum createdPathID : RenameDataPath::DataID_t
 {
@@ -79,6 +80,7 @@ void MultiThresholdObjects::setupFilterParameters()
     parameters.push_back(parameter);
   }
   parameters.push_back(SIMPL_NEW_STRING_FP("Output Attribute Array", DestinationArrayName, FilterParameter::Category::CreatedArray, MultiThresholdObjects));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Store Output as Packed Bit Array", PackOutput, FilterParameter::Category::Parameter, MultiThresholdObjects));
   setFilterParameters(parameters);
 }
 
@@ -89,6 +91,7 @@ void MultiThresholdObjects::readFilterParameters(AbstractFilterParametersReader*
 {
   reader->openFilterGroup(this, index);
   setDestinationArrayName(reader->readString("DestinationArrayName", getDestinationArrayName()));
+  setPackOutput(reader->readValue("PackOutput", getPackOutput()));
   setSelectedThresholds(reader->readComparisonInputs("SelectedThresholds", getSelectedThresholds()));
   reader->closeFilterGroup();
 }
@@ -141,11 +144,18 @@ void MultiThresholdObjects::dataCheck()
     ComparisonInput_t comp = m_SelectedThresholds[0];
     std::vector<size_t> cDims(1, 1);
     DataArrayPath tempPath(comp.dataContainerName, comp.attributeMatrixName, getDestinationArrayName());
-    m_DestinationPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<bool>>(this, tempPath, true, cDims, "", ThresholdArrayID);
-    if(nullptr != m_DestinationPtr.lock())
+    if(m_PackOutput)
     {
-      m_Destination = m_DestinationPtr.lock()->getPointer(0);
-    } /* Now assign the raw pointer to data from the DataArray<T> object */
+      m_PackedDestinationPtr = getDataContainerArray()->createNonPrereqArrayFromPath<BitArray>(this, tempPath, true, cDims, "", ThresholdArrayID);
+    }
+    else
+    {
+      m_DestinationPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<bool>>(this, tempPath, true, cDims, "", ThresholdArrayID);
+      if(nullptr != m_DestinationPtr.lock())
+      {
+        m_Destination = m_DestinationPtr.lock()->getPointer(0);
+      } /* Now assign the raw pointer to data from the DataArray<T> object */
+    }
 
     // Do not allow non-scalar arrays
     for(size_t i = 0; i < m_SelectedThresholds.size(); ++i)
@@ -191,54 +201,29 @@ void MultiThresholdObjects::execute()
   DataContainerArray::Pointer dca = getDataContainerArray();
   DataContainer::Pointer m = dca->getDataContainer(dcName);
 
-  // Prime our output array with the result of the first comparison
+  // Compile every comparison into one evaluator so the destination is written in a single fused pass
+  ThresholdEvaluator::Pointer evaluator = ThresholdEvaluator::New();
+  AttributeMatrix::Pointer attrMat = m->getAttributeMatrix(amName);
+  for(int32_t i = 0; i < m_SelectedThresholds.size(); ++i)
   {
-    ThresholdFilterHelper filter(static_cast<SIMPL::Comparison::Enumeration>(comp_0.compOperator), comp_0.compValue, m_DestinationPtr.lock().get());
-    // Run the first threshold and store the results in our output array
-    int32_t err = filter.execute(m->getAttributeMatrix(amName)->getAttributeArray(comp_0.attributeArrayName), m_DestinationPtr.lock().get());
+    ComparisonInput_t& compRef = m_SelectedThresholds[i];
+    int32_t err = evaluator->addComparison(attrMat->getAttributeArray(compRef.attributeArrayName), static_cast<SIMPL::Comparison::Enumeration>(compRef.compOperator), compRef.compValue);
     if(err < 0)
     {
-      DataArrayPath tempPath(comp_0.dataContainerName, comp_0.attributeMatrixName, comp_0.attributeArrayName);
-      QString ss = QObject::tr("Error Executing threshold filter on first array. The path is %1").arg(tempPath.serialize());
-      setErrorCondition(-13001, ss);
+      DataArrayPath tempPath(compRef.dataContainerName, compRef.attributeMatrixName, compRef.attributeArrayName);
+      QString ss = (i == 0) ? QObject::tr("Error Executing threshold filter on first array. The path is %1").arg(tempPath.serialize())
+                            : QObject::tr("Error Executing threshold filter on array. The path is %1").arg(tempPath.serialize());
+      setErrorCondition((i == 0) ? -13001 : -13002, ss);
       return;
     }
   }
 
-  if(m_SelectedThresholds.size() > 1)
+  size_t totalTuples = attrMat->getNumberOfTuples();
+  int32_t err = m_PackOutput ? evaluator->execute(*m_PackedDestinationPtr.lock()) : evaluator->execute(m_Destination, totalTuples);
+  if(err < 0)
   {
-    // Get the total number of tuples, create and initialize an array to use for these results
-    int64_t totalTuples = static_cast<int64_t>(m->getAttributeMatrix(amName)->getNumberOfTuples());
-    BoolArrayType::Pointer currentArrayPtr = BoolArrayType::CreateArray(totalTuples, std::string("_INTERNAL_USE_ONLY_TEMP"), true);
-
-    // Loop on the remaining Comparison objects updating our final result array as we go
-    for(int32_t i = 1; i < m_SelectedThresholds.size(); ++i)
-    {
-      // Initialize the array to false
-      currentArrayPtr->initializeWithZeros();
-      // Get the pointer to the front of the array. Raw Pointers = fast access = NO Bounds Checking!!!
-      bool* currentArray = currentArrayPtr->getPointer(0);
-
-      ComparisonInput_t& compRef = m_SelectedThresholds[i];
-
-      ThresholdFilterHelper filter(static_cast<SIMPL::Comparison::Enumeration>(compRef.compOperator), compRef.compValue, currentArrayPtr.get());
-
-      int32_t err = filter.execute(m->getAttributeMatrix(amName)->getAttributeArray(compRef.attributeArrayName), currentArrayPtr.get());
-      if(err < 0)
-      {
-        DataArrayPath tempPath(compRef.dataContainerName, compRef.attributeMatrixName, compRef.attributeArrayName);
-        QString ss = QObject::tr("Error Executing threshold filter on array. The path is %1").arg(tempPath.serialize());
-        setErrorCondition(-13002, ss);
-        return;
-      }
-      for(int64_t p = 0; p < totalTuples; ++p)
-      {
-        if(!m_Destination[p] || !currentArray[p])
-        {
-          m_Destination[p] = false;
-        }
-      }
-    }
+    QString ss = QObject::tr("The selected arrays do not all hold %1 tuples").arg(totalTuples);
+    setErrorCondition(-13003, ss);
   }
 }
 
@@ -365,3 +350,15 @@ ComparisonInputs MultiThresholdObjects::getSelectedThresholds() const
 {
   return m_SelectedThresholds;
 }
+
+// -----------------------------------------------------------------------------
+void MultiThresholdObjects::setPackOutput(bool value)
+{
+  m_PackOutput = value;
+}
+
+// -----------------------------------------------------------------------------
+bool MultiThresholdObjects::getPackOutput() const
+{
+  return m_PackOutput;
+}
@@ -38,6 +38,7 @@
 #include <memory>
 
 #include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/BitArray.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/Filtering/ComparisonInputs.h"
@@ -55,6 +56,7 @@ class SIMPLib_EXPORT MultiThresholdObjects : public AbstractFilter
   PYB11_SHARED_POINTERS(MultiThresholdObjects)
   PYB11_FILTER_NEW_MACRO(MultiThresholdObjects)
   PYB11_PROPERTY(QString DestinationArrayName READ getDestinationArrayName WRITE setDestinationArrayName)
+  PYB11_PROPERTY(bool PackOutput READ getPackOutput WRITE setPackOutput)
   PYB11_PROPERTY(ComparisonInputs SelectedThresholds READ getSelectedThresholds WRITE setSelectedThresholds)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
@@ -92,6 +94,19 @@ public:
 
   Q_PROPERTY(QString DestinationArrayName READ getDestinationArrayName WRITE setDestinationArrayName)
 
+  /**
+   * @brief Setter property for PackOutput. When set the output is a BitArray holding one bit per tuple
+   * instead of a DataArray<bool>.
+   */
+  void setPackOutput(bool value);
+  /**
+   * @brief Getter property for PackOutput
+   * @return Value of PackOutput
+   */
+  bool getPackOutput() const;
+
+  Q_PROPERTY(bool PackOutput READ getPackOutput WRITE setPackOutput)
+
   /**
    * @brief Setter property for SelectedThresholds
    */
@@ -179,8 +194,10 @@ protected:
 private:
   std::weak_ptr<DataArray<bool>> m_DestinationPtr;
   bool* m_Destination = nullptr;
+  std::weak_ptr<BitArray> m_PackedDestinationPtr;
 
   QString m_DestinationArrayName = {SIMPL::GeneralData::Mask};
+  bool m_PackOutput = {false};
   ComparisonInputs m_SelectedThresholds = {};
 
 public:
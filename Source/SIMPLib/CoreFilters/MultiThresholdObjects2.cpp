@@ -41,11 +41,12 @@
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/ComparisonSelectionAdvancedFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
-#include "SIMPLib/Filtering/ThresholdFilterHelper.h"
+#include "SIMPLib/Filtering/ThresholdEvaluator.h"
 
 enum createdPathID : RenameDataPath::DataID_t
 {
@@ -80,6 +81,7 @@ void MultiThresholdObjects2::setupFilterParameters()
     parameters.push_back(parameter);
   }
   parameters.push_back(SIMPL_NEW_DA_FROM_ADV_COMPARISON_FP("Output Attribute Array", DestinationArrayName, SelectedThresholds, FilterParameter::Category::CreatedArray, MultiThresholdObjects2));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Store Output as Packed Bit Array", PackOutput, FilterParameter::Category::Parameter, MultiThresholdObjects2));
   setFilterParameters(parameters);
 }
 
@@ -90,6 +92,7 @@ void MultiThresholdObjects2::readFilterParameters(AbstractFilterParametersReader
 {
   reader->openFilterGroup(this, index);
   setDestinationArrayName(reader->readString("DestinationArrayName", getDestinationArrayName()));
+  setPackOutput(reader->readValue("PackOutput", getPackOutput()));
   setSelectedThresholds(reader->readComparisonInputsAdvanced("SelectedThresholds", getSelectedThresholds()));
   reader->closeFilterGroup();
 }
@@ -136,11 +139,18 @@ void MultiThresholdObjects2::dataCheck()
     // AbstractComparison::Pointer comp = m_SelectedThresholds[0];
     std::vector<size_t> cDims(1, 1);
     DataArrayPath tempPath(dcName, amName, getDestinationArrayName());
-    m_DestinationPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<bool>>(this, tempPath, true, cDims, "", ThresholdArrayID);
-    if(nullptr != m_DestinationPtr.lock())
+    if(m_PackOutput)
     {
-      m_Destination = m_DestinationPtr.lock()->getPointer(0);
-    } /* Now assign the raw pointer to data from the DataArray<T> object */
+      m_PackedDestinationPtr = getDataContainerArray()->createNonPrereqArrayFromPath<BitArray>(this, tempPath, true, cDims, "", ThresholdArrayID);
+    }
+    else
+    {
+      m_DestinationPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<bool>>(this, tempPath, true, cDims, "", ThresholdArrayID);
+      if(nullptr != m_DestinationPtr.lock())
+      {
+        m_Destination = m_DestinationPtr.lock()->getPointer(0);
+      } /* Now assign the raw pointer to data from the DataArray<T> object */
+    }
 
     // Do not allow non-scalar arrays
     for(size_t i = 0; i < comparisonValues.size(); ++i)
@@ -198,221 +208,58 @@ void MultiThresholdObjects2::execute()
     return;
   }
 
-  bool invert = m_SelectedThresholds.shouldInvert();
-
-  int64_t thresholdSize;
-  BoolArrayType::Pointer thresholdArray;
-
-  createBoolArray(thresholdSize, thresholdArray);
-  bool firstValueFound = false;
-
-  int32_t err = 0;
-
-  // Loop on the remaining Comparison objects updating our final result array as we go
-  for(int32_t i = 0; i < m_SelectedThresholds.size() && err >= 0; ++i)
+  // Compile the comparison tree into one evaluator so the destination is written in a single fused pass
+  ThresholdEvaluator::Pointer evaluator = ThresholdEvaluator::New();
+  evaluator->setInvert(m_SelectedThresholds.shouldInvert());
+  for(int32_t i = 0; i < m_SelectedThresholds.size(); ++i)
   {
-    if(std::dynamic_pointer_cast<ComparisonSet>(m_SelectedThresholds[i]))
+    if(compileComparison(m_SelectedThresholds[i], m->getAttributeMatrix(amName), evaluator.get()) < 0)
     {
-      ComparisonSet::Pointer comparisonSet = std::dynamic_pointer_cast<ComparisonSet>(m_SelectedThresholds[i]);
-      thresholdSet(comparisonSet, thresholdArray, err, !firstValueFound, false);
-      firstValueFound = true;
-    }
-    else if(std::dynamic_pointer_cast<ComparisonValue>(m_SelectedThresholds[i]))
-    {
-      ComparisonValue::Pointer comparisonValue = std::dynamic_pointer_cast<ComparisonValue>(m_SelectedThresholds[i]);
-      thresholdValue(comparisonValue, thresholdArray, err, !firstValueFound, false);
-      firstValueFound = true;
+      return;
     }
   }
 
-  if(invert)
-  {
-    invertThreshold(thresholdSize, thresholdArray);
-  }
-
-  bool* threshold = thresholdArray->getPointer(0);
-  for(int64_t p = 0; p < thresholdSize; p++)
+  size_t totalTuples = m->getAttributeMatrix(amName)->getNumberOfTuples();
+  int32_t err = m_PackOutput ? evaluator->execute(*m_PackedDestinationPtr.lock()) : evaluator->execute(m_Destination, totalTuples);
+  if(err < 0)
   {
-    m_Destination[p] = threshold[p];
+    QString ss = QObject::tr("The selected arrays do not all hold %1 tuples").arg(totalTuples);
+    setErrorCondition(-13003, ss);
   }
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void MultiThresholdObjects2::createBoolArray(int64_t& totalTuples, BoolArrayType::Pointer& thresholdArrayPtr)
+int32_t MultiThresholdObjects2::compileComparison(const AbstractComparison::Pointer& comparison, const AttributeMatrix::Pointer& attrMat, ThresholdEvaluator* evaluator)
 {
-  // Get the names of the Data Container and AttributeMatrix for later
-  QString dcName = m_SelectedThresholds.getDataContainerName();
-  QString amName = m_SelectedThresholds.getAttributeMatrixName();
-
-  DataContainerArray::Pointer dca = getDataContainerArray();
-  DataContainer::Pointer m = dca->getDataContainer(dcName);
-
-  // Get the total number of tuples, create and initialize an array to use for these results
-  totalTuples = static_cast<int64_t>(m->getAttributeMatrix(amName)->getNumberOfTuples());
-  thresholdArrayPtr = BoolArrayType::CreateArray(totalTuples, std::string("_INTERNAL_USE_ONLY_TEMP"), true);
-
-  // Initialize the array to false
-  thresholdArrayPtr->initializeWithZeros();
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::insertThreshold(int64_t numItems, BoolArrayType::Pointer currentArrayPtr, int unionOperator, const BoolArrayType::Pointer newArrayPtr, bool inverse)
-{
-  bool* newArray = newArrayPtr->getPointer(0);
-  bool* currentArray = currentArrayPtr->getPointer(0);
-
-  for(int64_t i = 0; i < numItems; i++)
+  if(ComparisonSet::Pointer comparisonSet = std::dynamic_pointer_cast<ComparisonSet>(comparison))
   {
-    // invert the current comparison if necessary
-    if(inverse)
+    evaluator->beginSet(static_cast<SIMPL::Union::Enumeration>(comparisonSet->getUnionOperator()), comparisonSet->getInvertComparison());
+    QVector<AbstractComparison::Pointer> comparisons = comparisonSet->getComparisons();
+    for(const AbstractComparison::Pointer& child : comparisons)
     {
-      newArray[i] = !newArray[i];
-    }
-
-    if(SIMPL::Union::Operator_Or == unionOperator)
-    {
-      currentArray[i] = currentArray[i] || newArray[i];
-    }
-    else if(!currentArray[i] || !newArray[i])
-    {
-      currentArray[i] = false;
+      if(compileComparison(child, attrMat, evaluator) < 0)
+      {
+        return -1;
+      }
     }
+    evaluator->endSet();
   }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::invertThreshold(int64_t numItems, BoolArrayType::Pointer thresholdArray)
-{
-  bool* threshold = thresholdArray->getPointer(0);
-
-  for(int64_t i = 0; i < numItems; i++)
-  {
-    threshold[i] = !threshold[i];
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::thresholdSet(ComparisonSet::Pointer comparisonSet, BoolArrayType::Pointer& currentThreshold, int32_t& err, bool replaceInput, bool inverse)
-{
-  if(nullptr == comparisonSet)
+  else if(ComparisonValue::Pointer comparisonValue = std::dynamic_pointer_cast<ComparisonValue>(comparison))
   {
-    return;
-  }
-
-  if(inverse)
-  {
-    inverse = !comparisonSet->getInvertComparison();
-  }
-  else
-  {
-    inverse = comparisonSet->getInvertComparison();
-  }
-
-  int64_t setArraySize;
-  BoolArrayType::Pointer setThresholdArray;
-
-  createBoolArray(setArraySize, setThresholdArray);
-  bool firstValueFound = false;
-
-  QVector<AbstractComparison::Pointer> comparisons = comparisonSet->getComparisons();
-  for(int i = 0; i < comparisons.size(); i++)
-  {
-    // Check all contents of child Comparison Sets
-    if(std::dynamic_pointer_cast<ComparisonSet>(comparisons.at(i)))
-    {
-      ComparisonSet::Pointer childSet = std::dynamic_pointer_cast<ComparisonSet>(comparisons.at(i));
-      thresholdSet(childSet, setThresholdArray, err, !firstValueFound, false);
-      firstValueFound = true;
-    }
-    // Check Comparison Values
-    if(std::dynamic_pointer_cast<ComparisonValue>(comparisons.at(i)))
-    {
-      ComparisonValue::Pointer childValue = std::dynamic_pointer_cast<ComparisonValue>(comparisons.at(i));
-      thresholdValue(childValue, setThresholdArray, err, !firstValueFound, false);
-      firstValueFound = true;
-    }
-
+    IDataArray::Pointer inputArray = attrMat->getAttributeArray(comparisonValue->getAttributeArrayName());
+    int32_t err = evaluator->addComparison(inputArray, static_cast<SIMPL::Comparison::Enumeration>(comparisonValue->getCompOperator()), comparisonValue->getCompValue(),
+                                           static_cast<SIMPL::Union::Enumeration>(comparisonValue->getUnionOperator()));
     if(err < 0)
     {
-      return;
-    }
-  }
-
-  if(replaceInput)
-  {
-    if(inverse)
-    {
-      invertThreshold(setArraySize, setThresholdArray);
+      DataArrayPath tempPath(m_SelectedThresholds.getDataContainerName(), m_SelectedThresholds.getAttributeMatrixName(), comparisonValue->getAttributeArrayName());
+      QString ss = QObject::tr("Error Executing threshold filter on array. The path is %1").arg(tempPath.serialize());
+      setErrorCondition(-13002, ss);
+      return -1;
     }
-    currentThreshold.swap(setThresholdArray);
-  }
-  else
-  {
-    // insert into current threshold
-    insertThreshold(setArraySize, currentThreshold, comparisonSet->getUnionOperator(), setThresholdArray, inverse);
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::thresholdValue(ComparisonValue::Pointer comparisonValue, BoolArrayType::Pointer& inputThreshold, int32_t& err, bool replaceInput, bool inverse)
-{
-  if(nullptr == comparisonValue)
-  {
-    return;
-  }
-
-  // Get the names of the Data Container and AttributeMatrix for later
-  QString dcName = m_SelectedThresholds.getDataContainerName();
-  QString amName = m_SelectedThresholds.getAttributeMatrixName();
-
-  DataContainerArray::Pointer dca = getDataContainerArray();
-  DataContainer::Pointer m = dca->getDataContainer(dcName);
-
-  // Get the total number of tuples, create and initialize an array to use for these results
-  int64_t totalTuples = static_cast<int64_t>(m->getAttributeMatrix(amName)->getNumberOfTuples());
-  BoolArrayType::Pointer currentArrayPtr = BoolArrayType::CreateArray(totalTuples, std::string("_INTERNAL_USE_ONLY_TEMP"), true);
-
-  // Initialize the array to false
-  currentArrayPtr->initializeWithZeros();
-
-  // bool* currentArray = currentArrayPtr->getPointer(0);
-  int compOperator = comparisonValue->getCompOperator();
-  double compValue = comparisonValue->getCompValue();
-
-  ThresholdFilterHelper filter(static_cast<SIMPL::Comparison::Enumeration>(compOperator), compValue, currentArrayPtr.get());
-
-  err = filter.execute(m->getAttributeMatrix(amName)->getAttributeArray(comparisonValue->getAttributeArrayName()), currentArrayPtr.get());
-  if(err < 0)
-  {
-    DataArrayPath tempPath(m_SelectedThresholds.getDataContainerName(), m_SelectedThresholds.getAttributeMatrixName(), comparisonValue->getAttributeArrayName());
-    QString ss = QObject::tr("Error Executing threshold filter on array. The path is %1").arg(tempPath.serialize());
-    setErrorCondition(-13002, ss);
-    return;
-  }
-
-  if(replaceInput)
-  {
-    if(inverse)
-    {
-      invertThreshold(totalTuples, currentArrayPtr);
-    }
-    inputThreshold.swap(currentArrayPtr);
-  }
-  else
-  {
-    // insert into current threshold
-    insertThreshold(totalTuples, inputThreshold, comparisonValue->getUnionOperator(), currentArrayPtr, inverse);
   }
+  return 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -538,3 +385,15 @@ ComparisonInputsAdvanced MultiThresholdObjects2::getSelectedThresholds() const
 {
   return m_SelectedThresholds;
 }
+
+// -----------------------------------------------------------------------------
+void MultiThresholdObjects2::setPackOutput(bool value)
+{
+  m_PackOutput = value;
+}
+
+// -----------------------------------------------------------------------------
+bool MultiThresholdObjects2::getPackOutput() const
+{
+  return m_PackOutput;
+}
@@ -38,11 +38,14 @@
 #include <memory>
 
 #include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/BitArray.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/Filtering/ComparisonInputsAdvanced.h"
 #include "SIMPLib/Filtering/ComparisonSet.h"
 #include "SIMPLib/Filtering/ComparisonValue.h"
+#include "SIMPLib/Filtering/ThresholdEvaluator.h"
 
 /**
  * @brief The MultiThresholdObjects2 class. See [Filter documentation](@ref multithresholdobjects2) for details.
@@ -57,6 +60,7 @@ class SIMPLib_EXPORT MultiThresholdObjects2 : public AbstractFilter
   PYB11_SHARED_POINTERS(MultiThresholdObjects2)
   PYB11_FILTER_NEW_MACRO(MultiThresholdObjects2)
   PYB11_PROPERTY(QString DestinationArrayName READ getDestinationArrayName WRITE setDestinationArrayName)
+  PYB11_PROPERTY(bool PackOutput READ getPackOutput WRITE setPackOutput)
   PYB11_PROPERTY(ComparisonInputsAdvanced SelectedThresholds READ getSelectedThresholds WRITE setSelectedThresholds)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
@@ -94,6 +98,19 @@ public:
 
   Q_PROPERTY(QString DestinationArrayName READ getDestinationArrayName WRITE setDestinationArrayName)
 
+  /**
+   * @brief Setter property for PackOutput. When set the output is a BitArray holding one bit per tuple
+   * instead of a DataArray<bool>.
+   */
+  void setPackOutput(bool value);
+  /**
+   * @brief Getter property for PackOutput
+   * @return Value of PackOutput
+   */
+  bool getPackOutput() const;
+
+  Q_PROPERTY(bool PackOutput READ getPackOutput WRITE setPackOutput)
+
   /**
    * @brief Setter property for SelectedThresholds
    */
@@ -179,52 +196,21 @@ protected:
   void initialize();
 
   /**
-   * @brief Creates and returns a DataArray<bool> for the given AttributeMatrix and the number of tuples
-   */
-  void createBoolArray(int64_t& numItems, BoolArrayType::Pointer& thresholdArrayPtr);
-
-  /**
-   * @brief Merges two DataArray<bool>s of a given size using a union operator AND / OR and inverts the second DataArray if requested
-   * @param numItems Number of values in both DataArrays
-   * @param currentArray DataArray<bool> to merge values into
-   * @param unionOperator Union operator used to merge into currentArray
-   * @param newArray DataArray<bool> of values to merge into the currentArray
-   * @param inverse Should newArray have its boolean values flipped before being merged in
-   */
-  void insertThreshold(int64_t numItems, BoolArrayType::Pointer currentArray, int unionOperator, const BoolArrayType::Pointer newArray, bool inverse);
-
-  /**
-   * @brief Flips the boolean values for a DataArray<bool>
-   * @param numItems Number of tuples in the DataArray
-   * @param thresholdArray DataArray to invert
-   */
-  void invertThreshold(int64_t numItems, BoolArrayType::Pointer thresholdArray);
-
-  /**
-   * @brief Performs a check on a ComparisonSet and either merges the result into the DataArray passed in or replaces the DataArray
-   * @param comparisonSet The set of comparisons used for setting the threshold
-   * @param inputThreshold DataArray<bool> merged into or replaced after finding the ComparisonSet's threshould output
-   * @param err Return any error code given
-   * @param replaceInput Specifies whether or not the result gets merged into inputThreshold or replaces it
-   * @param inverse Specifies whether or not the results need to be flipped before merging or replacing inputThreshold
-   */
-  void thresholdSet(ComparisonSet::Pointer comparisonSet, BoolArrayType::Pointer& inputThreshold, int32_t& err, bool replaceInput = false, bool inverse = false);
-
-  /**
-   * @brief Performs a check on a single ComparisonValue and either merges the result into the DataArray passed in or replaces the DataArray
-   * @param comparisonValue The comparison operator and value used for caluculating the threshold
-   * @param inputThreshold DataArray<bool> merged into or replaced after finding the ComparisonSet's threshould output
-   * @param err Return any error code given
-   * @param replaceInput Specifies whether or not the result gets merged into inputThreshold or replaces it
-   * @param inverse Specifies whether or not the results need to be flipped before merging or replacing inputThreshold
+   * @brief Appends a comparison, recursing into ComparisonSets, to the evaluator
+   * @param comparison The ComparisonSet or ComparisonValue to compile
+   * @param attrMat AttributeMatrix holding the arrays being compared
+   * @param evaluator Evaluator receiving the comparisons
+   * @return 0 on success, negative if an input array could not be compared
    */
-  void thresholdValue(ComparisonValue::Pointer comparisonValue, BoolArrayType::Pointer& inputThreshold, int32_t& err, bool replaceInput = false, bool inverse = false);
+  int32_t compileComparison(const AbstractComparison::Pointer& comparison, const AttributeMatrix::Pointer& attrMat, ThresholdEvaluator* evaluator);
 
 private:
   std::weak_ptr<DataArray<bool>> m_DestinationPtr;
   bool* m_Destination = nullptr;
+  std::weak_ptr<BitArray> m_PackedDestinationPtr;
 
   QString m_DestinationArrayName = {SIMPL::GeneralData::Mask};
+  bool m_PackOutput = {false};
   ComparisonInputsAdvanced m_SelectedThresholds = {};
 
 public:
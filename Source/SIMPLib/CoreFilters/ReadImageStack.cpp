@@ -0,0 +1,516 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ReadImageStack.h"
+
+#include <array>
+
+#include <QtCore/QFileInfo>
+#include <QtCore/QTextStream>
+
+#include "itkImageIOBase.h"
+#include "itkImageIOFactory.h"
+#include "itkRGBAPixel.h"
+#include "itkRGBPixel.h"
+
+#include "SIMPLib/SIMPLibVersion.h"
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/DataContainerCreationFilterParameter.h"
+#include "SIMPLib/FilterParameters/FileListInfoFilterParameter.h"
+#include "SIMPLib/FilterParameters/FloatVec3FilterParameter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedPathCreationFilterParameter.h"
+#include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/ITK/itkParallelImageStackReader.hpp"
+#include "SIMPLib/Utilities/FilePathGenerator.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+// Creates the array during the data check, otherwise decodes every slice straight into it
+// -----------------------------------------------------------------------------
+template <typename TPixel>
+void ReadStackPixels(ReadImageStack* filter, const QVector<QString>& fileList, const std::array<size_t, 2>& sliceDims, bool dataCheck)
+{
+  using ValueType = typename itk::NumericTraits<TPixel>::ValueType;
+  using DataArrayType = DataArray<ValueType>;
+
+  DataArrayPath arrayPath(filter->getDataContainerName().getDataContainerName(), filter->getCellAttributeMatrixName(), filter->getImageDataArrayName());
+  std::vector<size_t> cDims = ITKDream3DHelper::GetComponentsDimensions<TPixel>();
+  if(dataCheck)
+  {
+    filter->getDataContainerArray()->createNonPrereqArrayFromPath<DataArrayType>(filter, arrayPath, 0, cDims);
+    return;
+  }
+
+  typename DataArrayType::Pointer destination = filter->getDataContainerArray()->getPrereqArrayFromPath<DataArrayType>(filter, arrayPath, cDims);
+  if(nullptr == destination.get())
+  {
+    return;
+  }
+
+  ParallelImageStackReader<TPixel> reader;
+  reader.setFileList(fileList);
+  reader.setFilter(filter);
+  reader.setMaxConcurrentReads(static_cast<uint32_t>(filter->getMaxConcurrentReads()));
+  reader.execute(*destination, sliceDims);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename TComponent>
+void ReadStackComponents(ReadImageStack* filter, itk::ImageIOBase::IOPixelType pixelType, const QVector<QString>& fileList, const std::array<size_t, 2>& sliceDims, bool dataCheck)
+{
+  switch(pixelType)
+  {
+  case itk::ImageIOBase::SCALAR:
+    ReadStackPixels<TComponent>(filter, fileList, sliceDims, dataCheck);
+    break;
+  case itk::ImageIOBase::RGB:
+    ReadStackPixels<itk::RGBPixel<TComponent>>(filter, fileList, sliceDims, dataCheck);
+    break;
+  case itk::ImageIOBase::RGBA:
+    ReadStackPixels<itk::RGBAPixel<TComponent>>(filter, fileList, sliceDims, dataCheck);
+    break;
+  default:
+    QString ss = QObject::tr("Unsupported pixel type: %1").arg(itk::ImageIOBase::GetPixelTypeAsString(pixelType).c_str());
+    filter->setErrorCondition(-23506, ss);
+    break;
+  }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ReadImageStack::ReadImageStack()
+{
+  m_Origin[0] = 0.0f;
+  m_Origin[1] = 0.0f;
+  m_Origin[2] = 0.0f;
+
+  m_Spacing[0] = 1.0f;
+  m_Spacing[1] = 1.0f;
+  m_Spacing[2] = 1.0f;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ReadImageStack::~ReadImageStack() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReadImageStack::setupFilterParameters()
+{
+  FilterParameterVectorType parameters;
+  parameters.push_back(SIMPL_NEW_FILELISTINFO_FP("Input File List", InputFileListInfo, FilterParameter::Category::Parameter, ReadImageStack));
+  parameters.push_back(SIMPL_NEW_FLOAT_VEC3_FP("Origin", Origin, FilterParameter::Category::Parameter, ReadImageStack));
+  parameters.push_back(SIMPL_NEW_FLOAT_VEC3_FP("Spacing", Spacing, FilterParameter::Category::Parameter, ReadImageStack));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Maximum Concurrent Reads (0 = All Threads)", MaxConcurrentReads, FilterParameter::Category::Parameter, ReadImageStack));
+  parameters.push_back(SIMPL_NEW_DC_CREATION_FP("Data Container", DataContainerName, FilterParameter::Category::CreatedArray, ReadImageStack));
+  parameters.push_back(SIMPL_NEW_AM_WITH_LINKED_DC_FP("Cell Attribute Matrix", CellAttributeMatrixName, DataContainerName, FilterParameter::Category::CreatedArray, ReadImageStack));
+  parameters.push_back(SIMPL_NEW_DA_WITH_LINKED_AM_FP("Image Data", ImageDataArrayName, DataContainerName, CellAttributeMatrixName, FilterParameter::Category::CreatedArray, ReadImageStack));
+  setFilterParameters(parameters);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReadImageStack::readFilterParameters(AbstractFilterParametersReader* reader, int index)
+{
+  reader->openFilterGroup(this, index);
+  setInputFileListInfo(reader->readFileListInfo("InputFileListInfo", getInputFileListInfo()));
+  setOrigin(reader->readFloatVec3("Origin", getOrigin()));
+  setSpacing(reader->readFloatVec3("Spacing", getSpacing()));
+  setMaxConcurrentReads(reader->readValue("MaxConcurrentReads", getMaxConcurrentReads()));
+  setDataContainerName(reader->readDataArrayPath("DataContainerName", getDataContainerName()));
+  setCellAttributeMatrixName(reader->readString("CellAttributeMatrixName", getCellAttributeMatrixName()));
+  setImageDataArrayName(reader->readString("ImageDataArrayName", getImageDataArrayName()));
+  reader->closeFilterGroup();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReadImageStack::dataCheck()
+{
+  clearErrorCode();
+  clearWarningCode();
+  m_FileList.clear();
+
+  if(m_InputFileListInfo.InputPath.isEmpty())
+  {
+    QString ss = QObject::tr("The input directory must be set");
+    setErrorCondition(-23500, ss);
+    return;
+  }
+  if(m_InputFileListInfo.EndIndex < m_InputFileListInfo.StartIndex)
+  {
+    QString ss = QObject::tr("The start index (%1) is larger than the end index (%2)").arg(m_InputFileListInfo.StartIndex).arg(m_InputFileListInfo.EndIndex);
+    setErrorCondition(-23501, ss);
+    return;
+  }
+  if(m_MaxConcurrentReads < 0)
+  {
+    QString ss = QObject::tr("The maximum number of concurrent reads must be 0 or larger");
+    setErrorCondition(-23502, ss);
+    return;
+  }
+
+  bool hasMissingFiles = false;
+  m_FileList = FilePathGenerator::GenerateFileList(m_InputFileListInfo.StartIndex, m_InputFileListInfo.EndIndex, m_InputFileListInfo.IncrementIndex, hasMissingFiles, m_InputFileListInfo.Ordering == 0,
+                                                   m_InputFileListInfo.InputPath, m_InputFileListInfo.FilePrefix, m_InputFileListInfo.FileSuffix, m_InputFileListInfo.FileExtension,
+                                                   m_InputFileListInfo.PaddingDigits);
+  if(m_FileList.isEmpty())
+  {
+    QString ss = QObject::tr("No files were generated from the input file list. Check that the input directory '%1' exists").arg(m_InputFileListInfo.InputPath);
+    setErrorCondition(-23503, ss);
+    return;
+  }
+  if(hasMissingFiles)
+  {
+    for(const QString& filePath : m_FileList)
+    {
+      if(!QFileInfo::exists(filePath))
+      {
+        QString ss = QObject::tr("The image file '%1' does not exist").arg(filePath);
+        setErrorCondition(-23504, ss);
+        return;
+      }
+    }
+  }
+
+  readImageStack(true);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReadImageStack::readImageStack(bool dataCheck)
+{
+  try
+  {
+    const QString& firstFile = m_FileList.front();
+    itk::ImageIOBase::Pointer imageIO = itk::ImageIOFactory::CreateImageIO(firstFile.toLatin1(), itk::ImageIOFactory::ReadMode);
+    if(nullptr == imageIO)
+    {
+      QString ss = QObject::tr("ITK could not read the given file '%1'. Format is likely unsupported.").arg(firstFile);
+      setErrorCondition(-23505, ss);
+      return;
+    }
+    imageIO->SetFileName(firstFile.toLatin1());
+    imageIO->ReadImageInformation();
+
+    // Every slice is checked against the size of the first one while it is decoded
+    std::array<size_t, 2> sliceDims = {imageIO->GetDimensions(0), 1};
+    if(imageIO->GetNumberOfDimensions() > 1)
+    {
+      sliceDims[1] = imageIO->GetDimensions(1);
+    }
+    for(uint32_t d = 2; d < imageIO->GetNumberOfDimensions(); d++)
+    {
+      if(imageIO->GetDimensions(d) != 1)
+      {
+        QString ss = QObject::tr("The image file '%1' is not a 2D image").arg(firstFile);
+        setErrorCondition(-23507, ss);
+        return;
+      }
+    }
+
+    if(dataCheck)
+    {
+      DataContainer::Pointer m = getDataContainerArray()->createNonPrereqDataContainer(this, getDataContainerName());
+      if(getErrorCode() < 0)
+      {
+        return;
+      }
+      const size_t numSlices = static_cast<size_t>(m_FileList.size());
+      ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+      image->setDimensions(sliceDims[0], sliceDims[1], numSlices);
+      image->setOrigin(m_Origin);
+      image->setSpacing(m_Spacing);
+      m->setGeometry(image);
+
+      std::vector<size_t> tDims = {sliceDims[0], sliceDims[1], numSlices};
+      m->createNonPrereqAttributeMatrix(this, getCellAttributeMatrixName(), tDims, AttributeMatrix::Type::Cell);
+      if(getErrorCode() < 0)
+      {
+        return;
+      }
+    }
+
+    const itk::ImageIOBase::IOPixelType pixelType = imageIO->GetPixelType();
+    const itk::ImageIOBase::IOComponentType component = imageIO->GetComponentType();
+    switch(component)
+    {
+    case itk::ImageIOBase::UCHAR:
+      ReadStackComponents<uint8_t>(this, pixelType, m_FileList, sliceDims, dataCheck);
+      break;
+    case itk::ImageIOBase::CHAR:
+      ReadStackComponents<int8_t>(this, pixelType, m_FileList, sliceDims, dataCheck);
+      break;
+    case itk::ImageIOBase::USHORT:
+      ReadStackComponents<uint16_t>(this, pixelType, m_FileList, sliceDims, dataCheck);
+      break;
+    case itk::ImageIOBase::SHORT:
+      ReadStackComponents<int16_t>(this, pixelType, m_FileList, sliceDims, dataCheck);
+      break;
+    case itk::ImageIOBase::UINT:
+      ReadStackComponents<uint32_t>(this, pixelType, m_FileList, sliceDims, dataCheck);
+      break;
+    case itk::ImageIOBase::INT:
+      ReadStackComponents<int32_t>(this, pixelType, m_FileList, sliceDims, dataCheck);
+      break;
+    case itk::ImageIOBase::FLOAT:
+      ReadStackComponents<float>(this, pixelType, m_FileList, sliceDims, dataCheck);
+      break;
+    case itk::ImageIOBase::DOUBLE:
+      ReadStackComponents<double>(this, pixelType, m_FileList, sliceDims, dataCheck);
+      break;
+    default:
+      QString ss = QObject::tr("Unsupported pixel component: %1").arg(imageIO->GetComponentTypeAsString(component).c_str());
+      setErrorCondition(-23509, ss);
+      break;
+    }
+  } catch(itk::ExceptionObject& err)
+  {
+    QString ss = QObject::tr("ITK exception was thrown while reading the image information: %1").arg(err.GetDescription());
+    setErrorCondition(-23508, ss);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReadImageStack::execute()
+{
+  dataCheck();
+  if(getErrorCode() < 0)
+  {
+    return;
+  }
+
+  readImageStack(false);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AbstractFilter::Pointer ReadImageStack::newFilterInstance(bool copyFilterParameters) const
+{
+  ReadImageStack::Pointer filter = ReadImageStack::New();
+  if(copyFilterParameters)
+  {
+    copyFilterParameterInstanceVariables(filter.get());
+  }
+  return filter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ReadImageStack::getCompiledLibraryName() const
+{
+  return Core::CoreBaseName;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ReadImageStack::getBrandingString() const
+{
+  return "SIMPLib Core Filter";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ReadImageStack::getFilterVersion() const
+{
+  QString version;
+  QTextStream vStream(&version);
+  vStream << SIMPLib::Version::Major() << "." << SIMPLib::Version::Minor() << "." << SIMPLib::Version::Patch();
+  return version;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ReadImageStack::getGroupName() const
+{
+  return SIMPL::FilterGroups::IOFilters;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QUuid ReadImageStack::getUuid() const
+{
+  return QUuid("{3d1e7a52-8c0f-4b69-9e25-a7f4c6b01d38}");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ReadImageStack::getSubGroupName() const
+{
+  return SIMPL::FilterSubGroups::InputFilters;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ReadImageStack::getHumanLabel() const
+{
+  return "Read Image Stack (Parallel)";
+}
+
+// -----------------------------------------------------------------------------
+ReadImageStack::Pointer ReadImageStack::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
+
+// -----------------------------------------------------------------------------
+std::shared_ptr<ReadImageStack> ReadImageStack::New()
+{
+  struct make_shared_enabler : public ReadImageStack
+  {
+  };
+  std::shared_ptr<make_shared_enabler> val = std::make_shared<make_shared_enabler>();
+  val->setupFilterParameters();
+  return val;
+}
+
+// -----------------------------------------------------------------------------
+QString ReadImageStack::getNameOfClass() const
+{
+  return QString("ReadImageStack");
+}
+
+// -----------------------------------------------------------------------------
+QString ReadImageStack::ClassName()
+{
+  return QString("ReadImageStack");
+}
+
+// -----------------------------------------------------------------------------
+void ReadImageStack::setInputFileListInfo(const StackFileListInfo& value)
+{
+  m_InputFileListInfo = value;
+}
+
+// -----------------------------------------------------------------------------
+StackFileListInfo ReadImageStack::getInputFileListInfo() const
+{
+  return m_InputFileListInfo;
+}
+
+// -----------------------------------------------------------------------------
+void ReadImageStack::setOrigin(const FloatVec3Type& value)
+{
+  m_Origin = value;
+}
+
+// -----------------------------------------------------------------------------
+FloatVec3Type ReadImageStack::getOrigin() const
+{
+  return m_Origin;
+}
+
+// -----------------------------------------------------------------------------
+void ReadImageStack::setSpacing(const FloatVec3Type& value)
+{
+  m_Spacing = value;
+}
+
+// -----------------------------------------------------------------------------
+FloatVec3Type ReadImageStack::getSpacing() const
+{
+  return m_Spacing;
+}
+
+// -----------------------------------------------------------------------------
+void ReadImageStack::setMaxConcurrentReads(int value)
+{
+  m_MaxConcurrentReads = value;
+}
+
+// -----------------------------------------------------------------------------
+int ReadImageStack::getMaxConcurrentReads() const
+{
+  return m_MaxConcurrentReads;
+}
+
+// -----------------------------------------------------------------------------
+void ReadImageStack::setDataContainerName(const DataArrayPath& value)
+{
+  m_DataContainerName = value;
+}
+
+// -----------------------------------------------------------------------------
+DataArrayPath ReadImageStack::getDataContainerName() const
+{
+  return m_DataContainerName;
+}
+
+// -----------------------------------------------------------------------------
+void ReadImageStack::setCellAttributeMatrixName(const QString& value)
+{
+  m_CellAttributeMatrixName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString ReadImageStack::getCellAttributeMatrixName() const
+{
+  return m_CellAttributeMatrixName;
+}
+
+// -----------------------------------------------------------------------------
+void ReadImageStack::setImageDataArrayName(const QString& value)
+{
+  m_ImageDataArrayName = value;
+}
+
+// -----------------------------------------------------------------------------
+QString ReadImageStack::getImageDataArrayName() const
+{
+  return m_ImageDataArrayName;
+}
@@ -105,6 +105,14 @@ void RemoveComponentFromArray::readFilterParameters(AbstractFilterParametersRead
   reader->closeFilterGroup();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool RemoveComponentFromArray::canReadFilterParametersConcurrently() const
+{
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -79,6 +79,14 @@ void RenameAttributeArray::readFilterParameters(AbstractFilterParametersReader*
   reader->closeFilterGroup();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool RenameAttributeArray::canReadFilterParametersConcurrently() const
+{
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -82,6 +82,14 @@ void RenameAttributeMatrix::readFilterParameters(AbstractFilterParametersReader*
   reader->closeFilterGroup();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool RenameAttributeMatrix::canReadFilterParametersConcurrently() const
+{
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
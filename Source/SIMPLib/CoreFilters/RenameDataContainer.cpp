@@ -71,6 +71,14 @@ void RenameDataContainer::setupFilterParameters()
   setFilterParameters(parameters);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool RenameDataContainer::canReadFilterParametersConcurrently() const
+{
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
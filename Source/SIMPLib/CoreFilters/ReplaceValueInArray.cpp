@@ -83,6 +83,14 @@ void ReplaceValueInArray::readFilterParameters(AbstractFilterParametersReader* r
   reader->closeFilterGroup();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ReplaceValueInArray::canReadFilterParametersConcurrently() const
+{
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -36,13 +36,11 @@
 
 #include "RotateSampleRefFrame.h"
 
+#include <algorithm>
 #include <cmath>
-
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-#include <tbb/blocked_range3d.h>
-#include <tbb/parallel_for.h>
-#include <tbb/partitioner.h>
-#endif
+#include <memory>
+#include <type_traits>
+#include <vector>
 
 #include <QtCore/QTextStream>
 
@@ -54,6 +52,7 @@
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/AttributeMatrixSelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DynamicTableFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatVec3FilterParameter.h"
@@ -61,6 +60,7 @@
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Math/MatrixMath.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 namespace
 {
@@ -226,20 +226,18 @@ void updateGeometry(ImageGeom& imageGeom, const RotateArgs& params)
 }
 
 /**
- * @brief The RotateSampleRefFrameImpl class implements a threaded algorithm to do the
- * actual computation of the rotation by applying the rotation to each Euler angle
+ * @brief The SampleRefFrameRotator class maps each Cell of the rotated geometry back into the
+ * original geometry by applying the inverse rotation to the Cell's coordinates
  */
 class SampleRefFrameRotator
 {
-  DataArray<int64_t>::Pointer m_NewIndicesPtr;
   float m_RotMatrixInv[3][3] = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
   bool m_SliceBySlice = false;
   RotateArgs m_Params;
 
 public:
-  SampleRefFrameRotator(DataArray<int64_t>::Pointer newindices, const RotateArgs& args, const Matrix3fR& rotationMatrix, bool sliceBySlice)
-  : m_NewIndicesPtr(newindices)
-  , m_SliceBySlice(sliceBySlice)
+  SampleRefFrameRotator(const RotateArgs& args, const Matrix3fR& rotationMatrix, bool sliceBySlice)
+  : m_SliceBySlice(sliceBySlice)
   , m_Params(args)
   {
     // We have to inline the 3x3 Maxtrix transpose here because of the "const" nature of the 'convert' function
@@ -251,54 +249,307 @@ public:
 
   ~SampleRefFrameRotator() = default;
 
-  void convert(int64_t zStart, int64_t zEnd, int64_t yStart, int64_t yEnd, int64_t xStart, int64_t xEnd) const
+  const RotateArgs& getParams() const
   {
-    int64_t* newindicies = m_NewIndicesPtr->getPointer(0);
+    return m_Params;
+  }
+
+  /**
+   * @brief Finds the nearest original Cell for each rotated Cell in [start, end) and stores it
+   * in 'oldIndices' (-1 if the Cell falls outside the original geometry). If 'oldPositions' is not
+   * null, the fractional (column, row, plane) position in the original geometry is stored as well.
+   * @param start
+   * @param end
+   * @param oldIndices Must hold end - start values
+   * @param oldPositions Must hold 3 * (end - start) values or be nullptr
+   */
+  void convert(int64_t start, int64_t end, int64_t* oldIndices, float* oldPositions) const
+  {
+    int64_t i = start % m_Params.xpNew;
+    int64_t j = (start / m_Params.xpNew) % m_Params.ypNew;
+    int64_t k = start / (m_Params.xpNew * m_Params.ypNew);
+
+    float coords[3] = {0.0f, 0.0f, 0.0f};
+    float coordsNew[3] = {0.0f, 0.0f, 0.0f};
 
-    for(int64_t k = zStart; k < zEnd; k++)
+    for(int64_t index = start; index < end; index++)
     {
-      int64_t ktot = (m_Params.xpNew * m_Params.ypNew) * k;
-      for(int64_t j = yStart; j < yEnd; j++)
+      coords[0] = (static_cast<float>(i) * m_Params.xResNew) + m_Params.xMinNew;
+      coords[1] = (static_cast<float>(j) * m_Params.yResNew) + m_Params.yMinNew;
+      coords[2] = (static_cast<float>(k) * m_Params.zResNew) + m_Params.zMinNew;
+
+      MatrixMath::Multiply3x3with3x1(m_RotMatrixInv, coords, coordsNew);
+
+      float col = coordsNew[0] / m_Params.xRes;
+      float row = coordsNew[1] / m_Params.yRes;
+      float plane = coordsNew[2] / m_Params.zRes;
+
+      int64_t colOld = static_cast<int64_t>(std::nearbyint(col));
+      int64_t rowOld = static_cast<int64_t>(std::nearbyint(row));
+      int64_t planeOld = static_cast<int64_t>(std::nearbyint(plane));
+
+      if(m_SliceBySlice)
       {
-        int64_t jtot = (m_Params.xpNew) * j;
-        for(int64_t i = xStart; i < xEnd; i++)
+        planeOld = k;
+        plane = static_cast<float>(k);
+      }
+
+      int64_t offset = index - start;
+      oldIndices[offset] = -1;
+      if(colOld >= 0 && colOld < m_Params.xp && rowOld >= 0 && rowOld < m_Params.yp && planeOld >= 0 && planeOld < m_Params.zp)
+      {
+        oldIndices[offset] = (m_Params.xp * m_Params.yp * planeOld) + (m_Params.xp * rowOld) + colOld;
+      }
+      if(oldPositions != nullptr)
+      {
+        oldPositions[3 * offset] = col;
+        oldPositions[3 * offset + 1] = row;
+        oldPositions[3 * offset + 2] = plane;
+      }
+
+      i++;
+      if(i == m_Params.xpNew)
+      {
+        i = 0;
+        j++;
+        if(j == m_Params.ypNew)
         {
-          int64_t index = ktot + jtot + i;
-          newindicies[index] = -1;
+          j = 0;
+          k++;
+        }
+      }
+    }
+  }
+};
+
+/**
+ * @brief The RotateGatherKernel class fills a range of tuples of one rotated array from its original array
+ */
+class RotateGatherKernel
+{
+public:
+  RotateGatherKernel() = default;
+  virtual ~RotateGatherKernel() = default;
+
+  RotateGatherKernel(const RotateGatherKernel&) = delete;            // Copy Constructor Not Implemented
+  RotateGatherKernel(RotateGatherKernel&&) = delete;                 // Move Constructor Not Implemented
+  RotateGatherKernel& operator=(const RotateGatherKernel&) = delete; // Copy Assignment Not Implemented
+  RotateGatherKernel& operator=(RotateGatherKernel&&) = delete;      // Move Assignment Not Implemented
+
+  /**
+   * @brief Fills the tuples [start, end) of the rotated array
+   * @param start
+   * @param end
+   * @param oldIndices Nearest original tuple for each rotated tuple, relative to 'start'
+   * @param oldPositions Fractional original positions, relative to 'start' (may be nullptr if not needed)
+   */
+  virtual void gather(size_t start, size_t end, const int64_t* oldIndices, const float* oldPositions) const = 0;
+
+  /**
+   * @brief Returns true if the kernel needs the fractional original positions
+   */
+  virtual bool needsPositions() const
+  {
+    return false;
+  }
+};
+
+/**
+ * @brief The NearestGatherKernel class copies each rotated tuple from its nearest original tuple
+ */
+template <typename T>
+class NearestGatherKernel : public RotateGatherKernel
+{
+  const T* m_Source = nullptr;
+  T* m_Destination = nullptr;
+  size_t m_NumComps = 0;
+
+public:
+  NearestGatherKernel(const DataArray<T>& source, DataArray<T>& destination)
+  : m_Source(source.getPointer(0))
+  , m_Destination(destination.getPointer(0))
+  , m_NumComps(source.getNumberOfComponents())
+  {
+  }
+  ~NearestGatherKernel() override = default;
+
+  void gather(size_t start, size_t end, const int64_t* oldIndices, const float* /* oldPositions */) const override
+  {
+    if(m_NumComps == 1)
+    {
+      for(size_t i = start; i < end; i++)
+      {
+        int64_t oldIndex = oldIndices[i - start];
+        m_Destination[i] = oldIndex >= 0 ? m_Source[oldIndex] : static_cast<T>(0);
+      }
+      return;
+    }
 
-          float coords[3] = {0.0f, 0.0f, 0.0f};
-          float coordsNew[3] = {0.0f, 0.0f, 0.0f};
+    for(size_t i = start; i < end; i++)
+    {
+      int64_t oldIndex = oldIndices[i - start];
+      T* destination = m_Destination + i * m_NumComps;
+      if(oldIndex >= 0)
+      {
+        std::copy_n(m_Source + oldIndex * m_NumComps, m_NumComps, destination);
+      }
+      else
+      {
+        std::fill_n(destination, m_NumComps, static_cast<T>(0));
+      }
+    }
+  }
+};
 
-          coords[0] = (static_cast<float>(i) * m_Params.xResNew) + m_Params.xMinNew;
-          coords[1] = (static_cast<float>(j) * m_Params.yResNew) + m_Params.yMinNew;
-          coords[2] = (static_cast<float>(k) * m_Params.zResNew) + m_Params.zMinNew;
+/**
+ * @brief The TrilinearGatherKernel class blends the 8 original tuples surrounding each rotated
+ * tuple's position. Cells that map outside the original geometry are set to zero, exactly as with
+ * the nearest neighbor copy, and neighbors past the edge of the original geometry are clamped.
+ */
+template <typename T>
+class TrilinearGatherKernel : public RotateGatherKernel
+{
+  const T* m_Source = nullptr;
+  T* m_Destination = nullptr;
+  size_t m_NumComps = 0;
+  int64_t m_Dims[3] = {0, 0, 0};
 
-          MatrixMath::Multiply3x3with3x1(m_RotMatrixInv, coords, coordsNew);
+public:
+  TrilinearGatherKernel(const DataArray<T>& source, DataArray<T>& destination, const RotateArgs& params)
+  : m_Source(source.getPointer(0))
+  , m_Destination(destination.getPointer(0))
+  , m_NumComps(source.getNumberOfComponents())
+  , m_Dims{params.xp, params.yp, params.zp}
+  {
+  }
+  ~TrilinearGatherKernel() override = default;
 
-          int64_t colOld = static_cast<int64_t>(std::nearbyint(coordsNew[0] / m_Params.xRes));
-          int64_t rowOld = static_cast<int64_t>(std::nearbyint(coordsNew[1] / m_Params.yRes));
-          int64_t planeOld = static_cast<int64_t>(std::nearbyint(coordsNew[2] / m_Params.zRes));
+  bool needsPositions() const override
+  {
+    return true;
+  }
 
-          if(m_SliceBySlice)
-          {
-            planeOld = k;
-          }
+  void gather(size_t start, size_t end, const int64_t* oldIndices, const float* oldPositions) const override
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      size_t offset = i - start;
+      T* destination = m_Destination + i * m_NumComps;
+      if(oldIndices[offset] < 0)
+      {
+        std::fill_n(destination, m_NumComps, static_cast<T>(0));
+        continue;
+      }
 
-          if(colOld >= 0 && colOld < m_Params.xp && rowOld >= 0 && rowOld < m_Params.yp && planeOld >= 0 && planeOld < m_Params.zp)
-          {
-            newindicies[index] = (m_Params.xp * m_Params.yp * planeOld) + (m_Params.xp * rowOld) + colOld;
-          }
+      int64_t lower[3] = {0, 0, 0};
+      int64_t upper[3] = {0, 0, 0};
+      T weight[3] = {0, 0, 0};
+      for(size_t d = 0; d < 3; d++)
+      {
+        T position = static_cast<T>(oldPositions[3 * offset + d]);
+        T base = std::floor(position);
+        weight[d] = position - base;
+        lower[d] = std::min(std::max(static_cast<int64_t>(base), int64_t(0)), m_Dims[d] - 1);
+        upper[d] = std::min(std::max(static_cast<int64_t>(base) + 1, int64_t(0)), m_Dims[d] - 1);
+      }
+
+      const int64_t rowStride = m_Dims[0];
+      const int64_t planeStride = m_Dims[0] * m_Dims[1];
+      const int64_t corners[8] = {lower[2] * planeStride + lower[1] * rowStride + lower[0], lower[2] * planeStride + lower[1] * rowStride + upper[0],
+                                  lower[2] * planeStride + upper[1] * rowStride + lower[0], lower[2] * planeStride + upper[1] * rowStride + upper[0],
+                                  upper[2] * planeStride + lower[1] * rowStride + lower[0], upper[2] * planeStride + lower[1] * rowStride + upper[0],
+                                  upper[2] * planeStride + upper[1] * rowStride + lower[0], upper[2] * planeStride + upper[1] * rowStride + upper[0]};
+      const T wx[2] = {static_cast<T>(1) - weight[0], weight[0]};
+      const T wy[2] = {static_cast<T>(1) - weight[1], weight[1]};
+      const T wz[2] = {static_cast<T>(1) - weight[2], weight[2]};
+
+      for(size_t c = 0; c < m_NumComps; c++)
+      {
+        T value = static_cast<T>(0);
+        for(size_t n = 0; n < 8; n++)
+        {
+          value += wz[n >> 2] * wy[(n >> 1) & 1] * wx[n & 1] * m_Source[corners[n] * m_NumComps + c];
         }
+        destination[c] = value;
+      }
+    }
+  }
+};
+
+/**
+ * @brief Adds a gather kernel for 'source' to 'kernels' if 'source' is a DataArray<T>. Floating point
+ * arrays are interpolated if requested; everything else uses the nearest neighbor copy.
+ * @return True if a kernel was added
+ */
+template <typename T>
+bool addGatherKernel(const IDataArray::Pointer& source, const IDataArray::Pointer& destination, const RotateArgs& params, bool interpolate,
+                     std::vector<std::unique_ptr<RotateGatherKernel>>& kernels)
+{
+  auto typedSource = std::dynamic_pointer_cast<DataArray<T>>(source);
+  auto typedDestination = std::dynamic_pointer_cast<DataArray<T>>(destination);
+  if(typedSource == nullptr || typedDestination == nullptr)
+  {
+    return false;
+  }
+
+  if constexpr(std::is_floating_point_v<T>)
+  {
+    if(interpolate)
+    {
+      kernels.push_back(std::make_unique<TrilinearGatherKernel<T>>(*typedSource, *typedDestination, params));
+      return true;
+    }
+  }
+  kernels.push_back(std::make_unique<NearestGatherKernel<T>>(*typedSource, *typedDestination));
+  return true;
+}
+
+/**
+ * @brief The RotateSampleRefFrameImpl class resamples every array of the Cell Attribute Matrix in one pass:
+ * each thread maps a chunk of rotated Cells back into the original geometry and then runs every array's
+ * gather kernel over that chunk. The index map is never stored for the whole volume.
+ */
+class RotateSampleRefFrameImpl
+{
+  const SampleRefFrameRotator& m_Rotator;
+  const std::vector<std::unique_ptr<RotateGatherKernel>>& m_Kernels;
+  bool m_NeedsPositions = false;
+
+public:
+  static constexpr size_t k_ChunkSize = 4096;
+
+  RotateSampleRefFrameImpl(const SampleRefFrameRotator& rotator, const std::vector<std::unique_ptr<RotateGatherKernel>>& kernels)
+  : m_Rotator(rotator)
+  , m_Kernels(kernels)
+  {
+    for(const auto& kernel : m_Kernels)
+    {
+      m_NeedsPositions = m_NeedsPositions || kernel->needsPositions();
+    }
+  }
+  ~RotateSampleRefFrameImpl() = default;
+
+  void generate(size_t start, size_t end) const
+  {
+    std::vector<int64_t> oldIndices(std::min(k_ChunkSize, end - start));
+    std::vector<float> oldPositions(m_NeedsPositions ? 3 * oldIndices.size() : 0);
+    float* positions = m_NeedsPositions ? oldPositions.data() : nullptr;
+
+    for(size_t chunkStart = start; chunkStart < end; chunkStart += k_ChunkSize)
+    {
+      size_t chunkEnd = std::min(chunkStart + k_ChunkSize, end);
+      m_Rotator.convert(static_cast<int64_t>(chunkStart), static_cast<int64_t>(chunkEnd), oldIndices.data(), positions);
+      for(const auto& kernel : m_Kernels)
+      {
+        kernel->gather(chunkStart, chunkEnd, oldIndices.data(), positions);
       }
     }
   }
 
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  void operator()(const tbb::blocked_range3d<int64_t, int64_t, int64_t>& r) const
+  void operator()(const SIMPLRange& range) const
   {
-    convert(r.pages().begin(), r.pages().end(), r.rows().begin(), r.rows().end(), r.cols().begin(), r.cols().end());
+    generate(range.min(), range.max());
   }
-#endif
 };
 
 } // namespace
@@ -369,6 +620,8 @@ void RotateSampleRefFrame::setupFilterParameters()
 
   parameters.push_back(SIMPL_NEW_DYN_TABLE_FP("Rotation Matrix", RotationTable, FilterParameter::Category::Parameter, RotateSampleRefFrame, 1));
 
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Interpolate Floating Point Arrays (Trilinear)", UseTrilinearInterpolation, FilterParameter::Category::Parameter, RotateSampleRefFrame));
+
   // Required Arrays
 
   parameters.push_back(SeparatorFilterParameter::Create("Cell Data", FilterParameter::Category::RequiredArray));
@@ -389,6 +642,7 @@ void RotateSampleRefFrame::readFilterParameters(AbstractFilterParametersReader*
   setCellAttributeMatrixPath(reader->readDataArrayPath("CellAttributeMatrixPath", getCellAttributeMatrixPath()));
   setRotationAxis(reader->readFloatVec3("RotationAxis", getRotationAxis()));
   setRotationAngle(reader->readValue("RotationAngle", getRotationAngle()));
+  setUseTrilinearInterpolation(reader->readValue("UseTrilinearInterpolation", getUseTrilinearInterpolation()));
   reader->closeFilterGroup();
 }
 
@@ -521,14 +775,17 @@ void RotateSampleRefFrame::dataCheck()
 
   updateGeometry(*imageGeom, p_Impl->m_Params);
 
-  // Resize attribute matrix
-
-  std::vector<size_t> tDims(3);
-  tDims[0] = p_Impl->m_Params.xpNew;
-  tDims[1] = p_Impl->m_Params.ypNew;
-  tDims[2] = p_Impl->m_Params.zpNew;
-  QString attrMatName = getCellAttributeMatrixPath().getAttributeMatrixName();
-  m->getAttributeMatrix(attrMatName)->resizeAttributeArrays(tDims);
+  // Resize attribute matrix. During execute the arrays are resampled into new arrays instead, so
+  // resizing them here would only copy the original data (and truncate it if the volume shrinks).
+  if(getInPreflight())
+  {
+    std::vector<size_t> tDims(3);
+    tDims[0] = p_Impl->m_Params.xpNew;
+    tDims[1] = p_Impl->m_Params.ypNew;
+    tDims[2] = p_Impl->m_Params.zpNew;
+    QString attrMatName = getCellAttributeMatrixPath().getAttributeMatrixName();
+    m->getAttributeMatrix(attrMatName)->resizeAttributeArrays(tDims);
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -551,60 +808,92 @@ void RotateSampleRefFrame::execute()
     return;
   }
 
-  int64_t newNumCellTuples = p_Impl->m_Params.xpNew * p_Impl->m_Params.ypNew * p_Impl->m_Params.zpNew;
+  const size_t newNumCellTuples = static_cast<size_t>(p_Impl->m_Params.xpNew * p_Impl->m_Params.ypNew * p_Impl->m_Params.zpNew);
 
-  DataArray<int64_t>::Pointer newIndiciesPtr = DataArray<int64_t>::CreateArray(newNumCellTuples, std::string("_INTERNAL_USE_ONLY_RotateSampleRef_NewIndicies"), true);
-  newIndiciesPtr->initializeWithValue(-1);
-  int64_t* newindicies = newIndiciesPtr->getPointer(0);
+  // Gather every array without touching the DataContainer, which is NOT thread safe or re-entrant.
+  // The new arrays are only placed into the Attribute Matrix once all of them have been filled.
+  AttributeMatrix::Pointer attrMat = m->getAttributeMatrix(getCellAttributeMatrixPath().getAttributeMatrixName());
+  QList<QString> voxelArrayNames = attrMat->getAttributeArrayNames();
 
-#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
-  tbb::parallel_for(tbb::blocked_range3d<int64_t, int64_t, int64_t>(0, p_Impl->m_Params.zpNew, 0, p_Impl->m_Params.ypNew, 0, p_Impl->m_Params.xpNew),
-                    SampleRefFrameRotator(newIndiciesPtr, p_Impl->m_Params, p_Impl->m_RotationMatrix, m_SliceBySlice), tbb::auto_partitioner());
-#else
-  {
-    SampleRefFrameRotator serial(newIndiciesPtr, p_Impl->m_Params, p_Impl->m_RotationMatrix, m_SliceBySlice);
-    serial.convert(0, p_Impl->m_Params.zpNew, 0, p_Impl->m_Params.ypNew, 0, p_Impl->m_Params.xpNew);
-  }
-#endif
-
-  // This could technically be parallelized also where each thread takes an array to adjust. Except
-  // that the DataContainer is NOT thread safe or re-entrant so that would actually be a BAD idea.
-
-  QString attrMatName = getCellAttributeMatrixPath().getAttributeMatrixName();
-  QList<QString> voxelArrayNames = m->getAttributeMatrix(attrMatName)->getAttributeArrayNames();
+  std::vector<IDataArray::Pointer> sourceArrays;
+  std::vector<IDataArray::Pointer> newArrays;
+  std::vector<std::unique_ptr<RotateGatherKernel>> kernels;
+  std::vector<size_t> untypedArrays;
 
   for(const auto& attrArrayName : voxelArrayNames)
   {
-    IDataArray::Pointer p = m->getAttributeMatrix(attrMatName)->getAttributeArray(attrArrayName);
+    IDataArray::Pointer p = attrMat->getAttributeArray(attrArrayName);
 
     // Make a copy of the 'p' array that has the same name. When placed into
     // the data container this will over write the current array with
     // the same name.
-
     IDataArray::Pointer data = p->createNewArray(newNumCellTuples, p->getComponentDimensions(), p->getName());
-    int64_t newIndicies_I = 0;
-    for(size_t i = 0; i < static_cast<size_t>(newNumCellTuples); i++)
+
+    const RotateArgs& params = p_Impl->m_Params;
+    bool interpolate = m_UseTrilinearInterpolation;
+    bool added = addGatherKernel<float>(p, data, params, interpolate, kernels) || addGatherKernel<double>(p, data, params, interpolate, kernels) ||
+                 addGatherKernel<int8_t>(p, data, params, interpolate, kernels) || addGatherKernel<uint8_t>(p, data, params, interpolate, kernels) ||
+                 addGatherKernel<int16_t>(p, data, params, interpolate, kernels) || addGatherKernel<uint16_t>(p, data, params, interpolate, kernels) ||
+                 addGatherKernel<int32_t>(p, data, params, interpolate, kernels) || addGatherKernel<uint32_t>(p, data, params, interpolate, kernels) ||
+                 addGatherKernel<int64_t>(p, data, params, interpolate, kernels) || addGatherKernel<uint64_t>(p, data, params, interpolate, kernels) ||
+                 addGatherKernel<bool>(p, data, params, interpolate, kernels) || addGatherKernel<size_t>(p, data, params, interpolate, kernels);
+    if(!added)
     {
-      newIndicies_I = newindicies[i];
-      if(newIndicies_I >= 0)
+      untypedArrays.push_back(sourceArrays.size());
+    }
+
+    sourceArrays.push_back(p);
+    newArrays.push_back(data);
+  }
+
+  SampleRefFrameRotator rotator(p_Impl->m_Params, p_Impl->m_RotationMatrix, m_SliceBySlice);
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, newNumCellTuples);
+  dataAlg.execute(RotateSampleRefFrameImpl(rotator, kernels));
+
+  // Arrays that are not a plain DataArray (strings, neighbor lists, ...) go through the generic tuple copy
+  if(!untypedArrays.empty())
+  {
+    std::vector<int64_t> oldIndices(RotateSampleRefFrameImpl::k_ChunkSize);
+    for(size_t chunkStart = 0; chunkStart < newNumCellTuples; chunkStart += RotateSampleRefFrameImpl::k_ChunkSize)
+    {
+      size_t chunkEnd = std::min(chunkStart + RotateSampleRefFrameImpl::k_ChunkSize, newNumCellTuples);
+      rotator.convert(static_cast<int64_t>(chunkStart), static_cast<int64_t>(chunkEnd), oldIndices.data(), nullptr);
+      for(size_t arrayIndex : untypedArrays)
       {
-        if(!data->copyFromArray(i, p, newIndicies_I, 1))
+        const IDataArray::Pointer& p = sourceArrays[arrayIndex];
+        const IDataArray::Pointer& data = newArrays[arrayIndex];
+        for(size_t i = chunkStart; i < chunkEnd; i++)
         {
-          QString ss = QObject::tr("copyFromArray Failed: ");
-          QTextStream out(&ss);
-          out << "Source Array Name: " << p->getName() << " Source Tuple Index: " << newIndicies_I << "\n";
-          out << "Dest Array Name: " << data->getName() << "  Dest. Tuple Index: " << i << "\n";
-          setErrorCondition(-45102, ss);
-          return;
+          int64_t newIndicies_I = oldIndices[i - chunkStart];
+          if(newIndicies_I >= 0)
+          {
+            if(!data->copyFromArray(i, p, newIndicies_I, 1))
+            {
+              QString ss = QObject::tr("copyFromArray Failed: ");
+              QTextStream out(&ss);
+              out << "Source Array Name: " << p->getName() << " Source Tuple Index: " << newIndicies_I << "\n";
+              out << "Dest Array Name: " << data->getName() << "  Dest. Tuple Index: " << i << "\n";
+              setErrorCondition(-45102, ss);
+              return;
+            }
+          }
+          else
+          {
+            int var = 0;
+            data->initializeTuple(i, &var);
+          }
         }
       }
-      else
-      {
-        int var = 0;
-        data->initializeTuple(i, &var);
-      }
     }
-    m->getAttributeMatrix(attrMatName)->insertOrAssign(data);
+  }
+
+  std::vector<size_t> tDims = {static_cast<size_t>(p_Impl->m_Params.xpNew), static_cast<size_t>(p_Impl->m_Params.ypNew), static_cast<size_t>(p_Impl->m_Params.zpNew)};
+  attrMat->setTupleDimensions(tDims);
+  for(const auto& data : newArrays)
+  {
+    attrMat->insertOrAssign(data);
   }
 }
 
@@ -780,6 +1069,18 @@ int RotateSampleRefFrame::getRotationRepresentationChoice() const
   return m_RotationRepresentationChoice;
 }
 
+// -----------------------------------------------------------------------------
+void RotateSampleRefFrame::setUseTrilinearInterpolation(bool value)
+{
+  m_UseTrilinearInterpolation = value;
+}
+
+// -----------------------------------------------------------------------------
+bool RotateSampleRefFrame::getUseTrilinearInterpolation() const
+{
+  return m_UseTrilinearInterpolation;
+}
+
 // -----------------------------------------------------------------------------
 RotateSampleRefFrame::RotationRepresentation RotateSampleRefFrame::getRotationRepresentation() const
 {
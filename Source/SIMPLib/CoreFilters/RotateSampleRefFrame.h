@@ -63,6 +63,7 @@ class SIMPLib_EXPORT RotateSampleRefFrame : public AbstractFilter
   PYB11_PROPERTY(bool SliceBySlice READ getSliceBySlice WRITE setSliceBySlice)
   PYB11_PROPERTY(DynamicTableData RotationTable READ getRotationTable WRITE setRotationTable)
   PYB11_PROPERTY(int RotationRepresentationChoice READ getRotationRepresentationChoice WRITE setRotationRepresentationChoice)
+  PYB11_PROPERTY(bool UseTrilinearInterpolation READ getUseTrilinearInterpolation WRITE setUseTrilinearInterpolation)
   PYB11_METHOD(RotationRepresentation getRotationRepresentation)
   PYB11_METHOD(void setRotationRepresentation ARGS value)
   PYB11_METHOD(bool isRotationRepresentationValid ARGS value)
@@ -206,6 +207,20 @@ public:
 
   Q_PROPERTY(DynamicTableData RotationTable READ getRotationTable WRITE setRotationTable)
 
+  /**
+   * @brief Setter property for UseTrilinearInterpolation. When true, float and double arrays are
+   * interpolated from the 8 surrounding Cells instead of copied from the nearest Cell.
+   */
+  void setUseTrilinearInterpolation(bool value);
+
+  /**
+   * @brief Getter property for UseTrilinearInterpolation
+   * @return Value of UseTrilinearInterpolation
+   */
+  bool getUseTrilinearInterpolation() const;
+
+  Q_PROPERTY(bool UseTrilinearInterpolation READ getUseTrilinearInterpolation WRITE setUseTrilinearInterpolation)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -295,4 +310,5 @@ private:
   bool m_SliceBySlice = false;
   DynamicTableData m_RotationTable;
   int m_RotationRepresentationChoice = 0;
+  bool m_UseTrilinearInterpolation = false;
 };
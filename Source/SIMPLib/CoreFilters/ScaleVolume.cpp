@@ -143,6 +143,14 @@ void ScaleVolume::readFilterParameters(AbstractFilterParametersReader* reader, i
   reader->closeFilterGroup();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ScaleVolume::canReadFilterParametersConcurrently() const
+{
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -139,6 +139,14 @@ void SetOriginResolutionImageGeom::readFilterParameters(AbstractFilterParameters
   reader->closeFilterGroup();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SetOriginResolutionImageGeom::canReadFilterParametersConcurrently() const
+{
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
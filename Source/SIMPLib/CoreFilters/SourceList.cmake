@@ -83,7 +83,7 @@ set(_PublicFilters
 
 if( SIMPL_USE_ITK )
   set(_PublicFilters ${_PublicFilters}
-    
+    ReadImageStack
   )
 endif()
 
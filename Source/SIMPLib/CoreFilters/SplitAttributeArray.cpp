@@ -39,11 +39,14 @@
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/TemplateHelpers.h"
+#include "SIMPLib/DataArrays/ComponentViewArray.h"
 #include "SIMPLib/DataArrays/IDataArray.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/Utilities/ArrayKernels.hpp"
 
 enum createdPathID : RenameDataPath::DataID_t
 {
@@ -73,6 +76,7 @@ void SplitAttributeArray::setupFilterParameters()
       DataArraySelectionFilterParameter::CreateRequirement(SIMPL::Defaults::AnyPrimitive, SIMPL::Defaults::AnyComponentSize, AttributeMatrix::Type::Any, IGeometry::Type::Any);
   parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Multicomponent Attribute Array", InputArrayPath, FilterParameter::Category::RequiredArray, SplitAttributeArray, dasReq));
   parameters.push_back(SIMPL_NEW_STRING_FP("Postfix", SplitArraysSuffix, FilterParameter::Category::Parameter, SplitAttributeArray));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Reference Components Without Copying", CreateViews, FilterParameter::Category::Parameter, SplitAttributeArray));
   setFilterParameters(parameters);
 }
 
@@ -84,6 +88,7 @@ void SplitAttributeArray::readFilterParameters(AbstractFilterParametersReader* r
   reader->openFilterGroup(this, index);
   setInputArrayPath(reader->readDataArrayPath("InputArrayPath", getInputArrayPath()));
   setSplitArraysSuffix(reader->readString("SplitArraysSuffix", getSplitArraysSuffix()));
+  setCreateViews(reader->readValue("CreateViews", getCreateViews()));
   reader->closeFilterGroup();
 }
 
@@ -127,6 +132,11 @@ void SplitAttributeArray::dataCheck()
     {
       QString arrayName = getInputArrayPath().getDataArrayName() + getSplitArraysSuffix() + QString::number(i);
       DataArrayPath path(getInputArrayPath().getDataContainerName(), getInputArrayPath().getAttributeMatrixName(), arrayName);
+      if(getCreateViews())
+      {
+        createComponentView(path, i);
+        continue;
+      }
       IDataArray::WeakPointer ptr = TemplateHelpers::CreateNonPrereqArrayFromArrayType()(this, path, cDims, m_InputArrayPtr.lock(), SplitArrayID + i);
       if(getErrorCode() >= 0)
       {
@@ -147,6 +157,32 @@ void SplitAttributeArray::dataCheck()
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SplitAttributeArray::createComponentView(const DataArrayPath& path, int32_t component)
+{
+  // The views read the components in place, so they are created during preflight as well
+  AttributeMatrix::Pointer attrMat = getDataContainerArray()->getAttributeMatrix(path);
+  if(nullptr != attrMat->getAttributeArray(path.getDataArrayName()))
+  {
+    QString ss = QObject::tr("AttributeMatrix:'%1' An Attribute Array already exists with the name %2.").arg(attrMat->getName()).arg(path.getDataArrayName());
+    setErrorCondition(-11052, ss);
+    return;
+  }
+
+  ComponentViewArray::Pointer view = ComponentViewArray::New(m_InputArrayPtr.lock(), component, path.getDataArrayName());
+  if(nullptr == view)
+  {
+    QString ss = QObject::tr("The components of the %1 array '%2' cannot be referenced without copying them").arg(m_InputArrayPtr.lock()->getTypeAsString()).arg(getInputArrayPath().getDataArrayName());
+    setErrorCondition(-11053, ss);
+    return;
+  }
+  attrMat->insertOrAssign(view);
+  m_SplitArraysPtrVector.push_back(view);
+  RenameDataPath::AlertFilterCreatedPath(this, SplitArrayID + component, path);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -167,13 +203,7 @@ void splitMulticomponentArray(IDataArray::Pointer inputArray, std::vector<IDataA
   size_t numTuples = inputPtr->getNumberOfTuples();
   int32_t numComps = inputPtr->getNumberOfComponents();
 
-  for(size_t i = 0; i < numTuples; i++)
-  {
-    for(int32_t j = 0; j < numComps; j++)
-    {
-      downcastPtrs[j][i] = iPtr[numComps * i + j];
-    }
-  }
+  ArrayKernels::Deinterleave(iPtr, static_cast<size_t>(numComps), numTuples, downcastPtrs);
 }
 
 // -----------------------------------------------------------------------------
@@ -187,6 +217,12 @@ void SplitAttributeArray::execute()
     return;
   }
 
+  if(getCreateViews())
+  {
+    // The views were already added by the dataCheck() and read the selected array directly
+    return;
+  }
+
   EXECUTE_FUNCTION_TEMPLATE(this, splitMulticomponentArray, m_InputArrayPtr.lock(), m_InputArrayPtr.lock(), m_SplitArraysPtrVector)
 }
 
@@ -314,3 +350,15 @@ QString SplitAttributeArray::getSplitArraysSuffix() const
 {
   return m_SplitArraysSuffix;
 }
+
+// -----------------------------------------------------------------------------
+void SplitAttributeArray::setCreateViews(bool value)
+{
+  m_CreateViews = value;
+}
+
+// -----------------------------------------------------------------------------
+bool SplitAttributeArray::getCreateViews() const
+{
+  return m_CreateViews;
+}
@@ -60,6 +60,7 @@ class SIMPLib_EXPORT SplitAttributeArray : public AbstractFilter
   PYB11_FILTER_NEW_MACRO(SplitAttributeArray)
   PYB11_PROPERTY(DataArrayPath InputArrayPath READ getInputArrayPath WRITE setInputArrayPath)
   PYB11_PROPERTY(QString SplitArraysSuffix READ getSplitArraysSuffix WRITE setSplitArraysSuffix)
+  PYB11_PROPERTY(bool CreateViews READ getCreateViews WRITE setCreateViews)
   PYB11_END_BINDINGS()
   // End Python bindings declarations
 
@@ -117,6 +118,18 @@ public:
 
   Q_PROPERTY(QString SplitArraysSuffix READ getSplitArraysSuffix WRITE setSplitArraysSuffix)
 
+  /**
+   * @brief Setter property for CreateViews
+   */
+  void setCreateViews(bool value);
+  /**
+   * @brief Getter property for CreateViews
+   * @return Value of CreateViews
+   */
+  bool getCreateViews() const;
+
+  Q_PROPERTY(bool CreateViews READ getCreateViews WRITE setCreateViews)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -190,12 +203,20 @@ protected:
    */
   void initialize();
 
+  /**
+   * @brief Adds a view of one component of the input array at 'path'
+   * @param path
+   * @param component
+   */
+  void createComponentView(const DataArrayPath& path, int32_t component);
+
 private:
   IDataArrayWkPtrType m_InputArrayPtr;
   void* m_InputArray = nullptr;
 
   DataArrayPath m_InputArrayPath = {"", "", ""};
   QString m_SplitArraysSuffix = {"Component"};
+  bool m_CreateViews = {false};
 
   std::vector<IDataArrayShPtrType> m_SplitArraysPtrVector;
 
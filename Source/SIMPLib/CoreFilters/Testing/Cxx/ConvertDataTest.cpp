@@ -35,6 +35,7 @@
 
 #include <memory>
 
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
 #include <vector>
@@ -52,6 +53,7 @@
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
 #include "SIMPLib/Testing/SIMPLTestFileLocations.h"
 #include "SIMPLib/Testing/UnitTestSupport.hpp"
+#include "SIMPLib/Utilities/ArrayKernels.hpp"
 
 class ConvertDataTest
 {
@@ -571,6 +573,39 @@ public:
     TestConversion<double, bool>(filter, "DataArray", SIMPL::NumericTypes::Type::Bool, "NewArrayBool", 0);
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestConversionModes()
+  {
+    ConvertData::Pointer filter = createFilter();
+    filter->setDataContainerArray(createDataContainerArray(SIMPL::NumericTypes::Type::Float));
+    AttributeMatrix::Pointer am = filter->getDataContainerArray()->getDataContainer("DataContainer")->getAttributeMatrix("AttributeMatrix");
+    FloatArrayType::Pointer input = getDataArray<float>(am, "DataArray");
+    const std::vector<float> values = {-5.0f, 300.0f, 0.5f, 1.0f};
+    std::copy(values.begin(), values.end(), input->begin());
+
+    setValues(filter, "DataArray", SIMPL::NumericTypes::Type::UInt8, "Saturated");
+    filter->setConversionMode(static_cast<int>(ArrayKernels::ConversionMode::Saturate));
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), 0);
+    UInt8ArrayType::Pointer saturated = getDataArray<uint8_t>(am, "Saturated");
+    DREAM3D_REQUIRE_VALID_POINTER(saturated.get());
+    DREAM3D_REQUIRE(std::vector<uint8_t>(saturated->begin(), saturated->end()) == std::vector<uint8_t>({0, 255, 0, 1}));
+
+    setValues(filter, "DataArray", SIMPL::NumericTypes::Type::UInt8, "Normalized");
+    filter->setConversionMode(static_cast<int>(ArrayKernels::ConversionMode::Normalize));
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), 0);
+    UInt8ArrayType::Pointer normalized = getDataArray<uint8_t>(am, "Normalized");
+    DREAM3D_REQUIRE_VALID_POINTER(normalized.get());
+    DREAM3D_REQUIRE(std::vector<uint8_t>(normalized->begin(), normalized->end()) == std::vector<uint8_t>({0, 255, 128, 255}));
+
+    filter->setConversionMode(3);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -397);
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -641,6 +676,7 @@ public:
     DREAM3D_REGISTER_TEST(TestFloat());
     DREAM3D_REGISTER_TEST(TestDouble());
 
+    DREAM3D_REGISTER_TEST(TestConversionModes());
     DREAM3D_REGISTER_TEST(TestInvalidDataArray());
     DREAM3D_REGISTER_TEST(TestOverwriteArray());
   }
@@ -46,6 +46,7 @@
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/CoreFilters/DataContainerReader.h"
 #include "SIMPLib/CoreFilters/DataContainerWriter.h"
+#include "SIMPLib/CoreFilters/ReplaceValueInArray.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataArrays/IDataArray.h"
 #include "SIMPLib/DataArrays/StringDataArray.h"
@@ -58,6 +59,7 @@
 #include "SIMPLib/FilterParameters/JsonFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/JsonFilterParametersWriter.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
 #include "SIMPLib/Filtering/QMetaObjectUtilities.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Testing/SIMPLTestFileLocations.h"
@@ -109,6 +111,16 @@ QString TestFile3()
   return TestDir() + QString::fromLatin1("/DataContainerIOTest_Subset.h5");
 }
 
+QString SubvolumeFile()
+{
+  return TestDir() + QString::fromLatin1("/DataContainerIOTest_Subvolume.dream3d");
+}
+
+QString BackgroundFile()
+{
+  return TestDir() + QString::fromLatin1("/DataContainerIOTest_Background.dream3d");
+}
+
 QString JsonFile()
 {
   return TestDir() + QString::fromLatin1("/DataContainerProxyTest.json");
@@ -143,6 +155,8 @@ public:
     QFile::remove(DataContainerIOTest::TestFile());
     QFile::remove(DataContainerIOTest::TestFile2());
     QFile::remove(DataContainerIOTest::TestFile3());
+    QFile::remove(DataContainerIOTest::SubvolumeFile());
+    QFile::remove(DataContainerIOTest::BackgroundFile());
     QFile::remove(DataContainerIOTest::JsonFile());
     QFile::remove(DataContainerIOTest::H5File());
 
@@ -376,6 +390,204 @@ public:
     DREAM3D_REQUIRE_EQUAL(err, 0)
   }
 
+  // -----------------------------------------------------------------------------
+  // A background write keeps the values the arrays had when the writer executed, even when a later filter
+  // modifies them in place
+  // -----------------------------------------------------------------------------
+  void TestDataContainerWriterBackground()
+  {
+    const size_t numTuples = 10;
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("BackgroundData");
+    dca->addOrReplaceDataContainer(dc);
+    AttributeMatrix::Pointer am = AttributeMatrix::New(std::vector<size_t>(1, numTuples), "Data", AttributeMatrix::Type::Generic);
+    dc->addOrReplaceAttributeMatrix(am);
+    Int32ArrayType::Pointer modified = Int32ArrayType::CreateArray(numTuples, "Modified", true);
+    modified->initializeWithZeros();
+    am->insertOrAssign(modified);
+    Int32ArrayType::Pointer untouched = Int32ArrayType::CreateArray(numTuples, "Untouched", true);
+    untouched->initializeWithValue(7);
+    am->insertOrAssign(untouched);
+
+    DataContainerWriter::Pointer writer = DataContainerWriter::New();
+    writer->setOutputFile(DataContainerIOTest::BackgroundFile());
+    writer->setWriteXdmfFile(false);
+    writer->setWriteAsynchronously(true);
+
+    ReplaceValueInArray::Pointer replace = ReplaceValueInArray::New();
+    replace->setSelectedArray(DataArrayPath("BackgroundData", "Data", "Modified"));
+    replace->setRemoveValue(0.0);
+    replace->setReplaceValue(5.0);
+
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    pipeline->pushBack(writer);
+    pipeline->pushBack(replace);
+    pipeline->execute(dca);
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCode(), 0)
+    DREAM3D_REQUIRE_EQUAL(modified->getValue(0), 5)
+
+    // The pipeline waited for the write before it finished
+    DREAM3D_REQUIRE_EQUAL(writer->waitForPendingWrite(), 0)
+    DREAM3D_REQUIRE_EQUAL(writer->getErrorCode(), 0)
+
+    DataContainerReader::Pointer reader = DataContainerReader::New();
+    reader->setInputFile(DataContainerIOTest::BackgroundFile());
+    reader->setDataContainerArray(DataContainerArray::New());
+    reader->setInputFileDataContainerArrayProxy(reader->readDataContainerArrayStructure(DataContainerIOTest::BackgroundFile()));
+    reader->execute();
+    DREAM3D_REQUIRE_EQUAL(reader->getErrorCode(), 0)
+
+    AttributeMatrix::Pointer writtenAm = reader->getDataContainerArray()->getDataContainer("BackgroundData")->getAttributeMatrix("Data");
+    DREAM3D_REQUIRE_VALID_POINTER(writtenAm.get())
+    Int32ArrayType::Pointer writtenModified = writtenAm->getAttributeArrayAs<Int32ArrayType>("Modified");
+    Int32ArrayType::Pointer writtenUntouched = writtenAm->getAttributeArrayAs<Int32ArrayType>("Untouched");
+    DREAM3D_REQUIRE_VALID_POINTER(writtenModified.get())
+    DREAM3D_REQUIRE_VALID_POINTER(writtenUntouched.get())
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(writtenModified->getValue(i), 0)
+      DREAM3D_REQUIRE_EQUAL(writtenUntouched->getValue(i), 7)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  // Runs a DataContainerReader on the subvolume file with the 'StringData' container switched on or off
+  // -----------------------------------------------------------------------------
+  DataContainerReader::Pointer readSubvolume(const IntVec3Type& minIndex, const IntVec3Type& maxIndex, bool readStrings)
+  {
+    DataContainerReader::Pointer reader = DataContainerReader::New();
+    reader->setInputFile(DataContainerIOTest::SubvolumeFile());
+    reader->setDataContainerArray(DataContainerArray::New());
+    DataContainerArrayProxy proxy = reader->readDataContainerArrayStructure(DataContainerIOTest::SubvolumeFile());
+    if(!readStrings)
+    {
+      proxy.getDataContainers()["StringData"].setFlag(Qt::Unchecked);
+    }
+    reader->setInputFileDataContainerArrayProxy(proxy);
+    reader->setReadSubvolume(true);
+    reader->setSubvolumeMinIndex(minIndex);
+    reader->setSubvolumeMaxIndex(maxIndex);
+    reader->execute();
+    return reader;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestDataContainerReaderSubvolume()
+  {
+    const std::vector<size_t> dims = {6, 5, 4};
+    const size_t numCells = dims[0] * dims[1] * dims[2];
+    {
+      DataContainerArray::Pointer dca = DataContainerArray::New();
+      DataContainer::Pointer dc = DataContainer::New("ImageData");
+      ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+      image->setDimensions(dims[0], dims[1], dims[2]);
+      image->setOrigin(FloatVec3Type(1.0f, 2.0f, 3.0f));
+      image->setSpacing(FloatVec3Type(0.5f, 1.0f, 2.0f));
+      dc->setGeometry(image);
+      dca->addOrReplaceDataContainer(dc);
+
+      AttributeMatrix::Pointer cellAm = AttributeMatrix::New(dims, "CellData", AttributeMatrix::Type::Cell);
+      Int32ArrayType::Pointer index = Int32ArrayType::CreateArray(numCells, std::vector<size_t>(1, 1), "Index", true);
+      FloatArrayType::Pointer euler = FloatArrayType::CreateArray(numCells, std::vector<size_t>(1, 3), "Euler", true);
+      for(size_t i = 0; i < numCells; i++)
+      {
+        index->setValue(i, static_cast<int32_t>(i));
+        for(size_t c = 0; c < 3; c++)
+        {
+          euler->setComponent(i, static_cast<int32_t>(c), static_cast<float>(i * 3 + c));
+        }
+      }
+      cellAm->insertOrAssign(index);
+      cellAm->insertOrAssign(euler);
+      dc->addOrReplaceAttributeMatrix(cellAm);
+
+      // Feature data is read whole
+      AttributeMatrix::Pointer featureAm = AttributeMatrix::New(std::vector<size_t>(1, 3), "FeatureData", AttributeMatrix::Type::CellFeature);
+      featureAm->insertOrAssign(Int32ArrayType::CreateArray(3, std::vector<size_t>(1, 1), "Phases", true));
+      dc->addOrReplaceAttributeMatrix(featureAm);
+
+      // A Cell Attribute Matrix holding a StringDataArray cannot be read as a subvolume
+      DataContainer::Pointer stringDc = DataContainer::New("StringData");
+      ImageGeom::Pointer stringImage = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+      stringImage->setDimensions(dims[0], dims[1], dims[2]);
+      stringDc->setGeometry(stringImage);
+      AttributeMatrix::Pointer stringAm = AttributeMatrix::New(dims, "CellData", AttributeMatrix::Type::Cell);
+      stringAm->insertOrAssign(StringDataArray::CreateArray(numCells, "Names", true));
+      stringDc->addOrReplaceAttributeMatrix(stringAm);
+      dca->addOrReplaceDataContainer(stringDc);
+
+      DataContainerWriter::Pointer writer = DataContainerWriter::New();
+      writer->setDataContainerArray(dca);
+      writer->setOutputFile(DataContainerIOTest::SubvolumeFile());
+      writer->setWriteXdmfFile(false);
+      writer->execute();
+      DREAM3D_REQUIRE_EQUAL(writer->getErrorCode(), 0)
+    }
+
+    // In range: X 1..4, Y 2..3, Z 1..2
+    const IntVec3Type minIndex = {1, 2, 1};
+    const IntVec3Type maxIndex = {4, 3, 2};
+    DataContainerReader::Pointer reader = readSubvolume(minIndex, maxIndex, false);
+    DREAM3D_REQUIRE_EQUAL(reader->getErrorCode(), 0)
+
+    DataContainer::Pointer dc = reader->getDataContainerArray()->getDataContainer("ImageData");
+    DREAM3D_REQUIRE_VALID_POINTER(dc.get())
+    ImageGeom::Pointer image = dc->getGeometryAs<ImageGeom>();
+    DREAM3D_REQUIRE_VALID_POINTER(image.get())
+    SizeVec3Type subDims = image->getDimensions();
+    DREAM3D_REQUIRE_EQUAL(subDims[0], 4)
+    DREAM3D_REQUIRE_EQUAL(subDims[1], 2)
+    DREAM3D_REQUIRE_EQUAL(subDims[2], 2)
+    FloatVec3Type origin = image->getOrigin();
+    DREAM3D_REQUIRE_EQUAL(origin[0], 1.5f)
+    DREAM3D_REQUIRE_EQUAL(origin[1], 4.0f)
+    DREAM3D_REQUIRE_EQUAL(origin[2], 5.0f)
+    DREAM3D_REQUIRE_EQUAL(dc->getAttributeMatrix("FeatureData")->getNumberOfTuples(), 3)
+
+    AttributeMatrix::Pointer cellAm = dc->getAttributeMatrix("CellData");
+    DREAM3D_REQUIRE_VALID_POINTER(cellAm.get())
+    DREAM3D_REQUIRE_EQUAL(cellAm->getNumberOfTuples(), 16)
+    Int32ArrayType::Pointer index = cellAm->getAttributeArrayAs<Int32ArrayType>("Index");
+    FloatArrayType::Pointer euler = cellAm->getAttributeArrayAs<FloatArrayType>("Euler");
+    DREAM3D_REQUIRE_VALID_POINTER(index.get())
+    DREAM3D_REQUIRE_VALID_POINTER(euler.get())
+    DREAM3D_REQUIRE_EQUAL(index->getNumberOfTuples(), 16)
+    DREAM3D_REQUIRE_EQUAL(euler->getNumberOfTuples(), 16)
+    DREAM3D_REQUIRE_EQUAL(euler->getNumberOfComponents(), 3)
+    size_t t = 0;
+    for(size_t z = 1; z <= 2; z++)
+    {
+      for(size_t y = 2; y <= 3; y++)
+      {
+        for(size_t x = 1; x <= 4; x++, t++)
+        {
+          size_t fileIndex = (z * dims[1] + y) * dims[0] + x;
+          DREAM3D_REQUIRE_EQUAL(index->getValue(t), static_cast<int32_t>(fileIndex))
+          for(size_t c = 0; c < 3; c++)
+          {
+            DREAM3D_REQUIRE_EQUAL(euler->getComponent(t, static_cast<int32_t>(c)), static_cast<float>(fileIndex * 3 + c))
+          }
+        }
+      }
+    }
+
+    // Out of range along X
+    reader = readSubvolume(minIndex, IntVec3Type(6, 3, 2), false);
+    DREAM3D_REQUIRE_EQUAL(reader->getErrorCode(), -392)
+
+    // Minimum larger than the maximum, and a negative minimum
+    reader = readSubvolume(IntVec3Type(2, 2, 1), IntVec3Type(1, 3, 2), false);
+    DREAM3D_REQUIRE_EQUAL(reader->getErrorCode(), -391)
+    reader = readSubvolume(IntVec3Type(0, -1, 0), maxIndex, false);
+    DREAM3D_REQUIRE_EQUAL(reader->getErrorCode(), -391)
+
+    // Arrays that can only be read whole
+    reader = readSubvolume(minIndex, maxIndex, true);
+    DREAM3D_REQUIRE_EQUAL(reader->getErrorCode(), -393)
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -1193,9 +1405,11 @@ public:
     DREAM3D_REGISTER_TEST(TestInsertDelete())
 
     DREAM3D_REGISTER_TEST(TestDataContainerWriter())
+    DREAM3D_REGISTER_TEST(TestDataContainerWriterBackground())
     DREAM3D_REGISTER_TEST(TestDataContainerArrayProxy())
 
     DREAM3D_REGISTER_TEST(TestDataContainerReader())
+    DREAM3D_REGISTER_TEST(TestDataContainerReaderSubvolume())
     DREAM3D_REGISTER_TEST(TestDataArrayPath())
 
 #if REMOVE_TEST_FILES
@@ -718,6 +718,68 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RunSubvolumeTest()
+  {
+    writeHDF5File();
+
+    // The 3D dataset is stored as 10 x 8 x 36 (Z, Y, X) scalars
+    DataContainerArray::Pointer dca = createDataContainerArray(std::vector<size_t>{36, 8, 10});
+    DataContainer::Pointer dc = dca->getDataContainer("DataContainer");
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    image->setDimensions(SizeVec3Type(36, 8, 10));
+    image->setSpacing(FloatVec3Type(0.5f, 1.0f, 2.0f));
+    image->setOrigin(FloatVec3Type(0.0f, 0.0f, 0.0f));
+    dc->setGeometry(image);
+    dc->getAttributeMatrix("AttributeMatrix")->setType(AttributeMatrix::Type::Cell);
+
+    ImportHDF5Dataset::Pointer filter = ImportHDF5Dataset::New();
+    filter->setDataContainerArray(dca);
+    filter->setHDF5FilePath(m_FilePath);
+    filter->setSelectedAttributeMatrix(DataArrayPath("DataContainer", "AttributeMatrix", ""));
+
+    QList<ImportHDF5Dataset::DatasetImportInfo> importInfoList;
+    ImportHDF5Dataset::DatasetImportInfo info;
+    info.dataSetPath = "/Pointer/Pointer3DArrayDataset<" + QH5Lite::HDFTypeForPrimitiveAsStr<int32_t>() + ">";
+    info.componentDimensions = "1";
+    importInfoList.push_back(info);
+    filter->setDatasetImportInfoList(importInfoList);
+
+    filter->setReadSubvolume(true);
+    filter->setSubvolumeMinIndex(IntVec3Type(4, 2, 3));
+    filter->setSubvolumeMaxIndex(IntVec3Type(36, 5, 3));
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -20012);
+
+    filter->setSubvolumeMaxIndex(IntVec3Type(9, 5, 3));
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), 0);
+
+    AttributeMatrix::Pointer am = dc->getAttributeMatrix("AttributeMatrix");
+    DREAM3D_REQUIRE(am->getTupleDimensions() == std::vector<size_t>({6, 4, 1}));
+    DREAM3D_REQUIRE(image->getDimensions() == SizeVec3Type(6, 4, 1));
+    FloatVec3Type origin = image->getOrigin();
+    DREAM3D_REQUIRE_EQUAL(origin[0], 2.0f);
+    DREAM3D_REQUIRE_EQUAL(origin[1], 2.0f);
+    DREAM3D_REQUIRE_EQUAL(origin[2], 6.0f);
+
+    Int32ArrayType::Pointer da = am->getAttributeArrayAs<Int32ArrayType>(QString("Pointer3DArrayDataset<") + QH5Lite::HDFTypeForPrimitiveAsStr<int32_t>() + ">");
+    DREAM3D_REQUIRE_VALID_POINTER(da.get());
+    DREAM3D_REQUIRE_EQUAL(da->getNumberOfTuples(), 24);
+    for(size_t y = 0; y < 4; y++)
+    {
+      for(size_t x = 0; x < 6; x++)
+      {
+        size_t fileIndex = 3 * 36 * 8 + (y + 2) * 36 + (x + 4);
+        DREAM3D_REQUIRE_EQUAL(da->getValue(y * 6 + x), static_cast<int32_t>(fileIndex * 5));
+      }
+    }
+
+    QFile::remove(m_FilePath);
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -732,6 +794,7 @@ public:
     //#endif
 
     DREAM3D_REGISTER_TEST(RunImportHDF5DatasetTest())
+    DREAM3D_REGISTER_TEST(RunSubvolumeTest())
 
     //#if REMOVE_TEST_FILES
     //    DREAM3D_REGISTER_TEST(RemoveTestFiles())
@@ -36,6 +36,7 @@
 #include <QtCore/QString>
 
 #include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/BitArray.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
@@ -209,6 +210,24 @@ public:
           DREAM3D_REQUIRE_EQUAL(0, 1)
         }
       }
+
+      // The same threshold stored as a packed BitArray
+      propWasSet = filter->setProperty("PackOutput", true);
+      DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+      propWasSet = filter->setProperty("DestinationArrayName", QString("PackedThresholdArray"));
+      DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+      filter->execute();
+      DREAM3D_REQUIRED(filter->getErrorCode(), >=, 0);
+
+      BitArray::Pointer packedArray = std::dynamic_pointer_cast<BitArray>(vdc->getAttributeMatrix(path1.getAttributeMatrixName())->getAttributeArray("PackedThresholdArray"));
+      DREAM3D_REQUIRE_VALID_POINTER(packedArray.get())
+      DREAM3D_REQUIRE_EQUAL(packedArray->getNumberOfTuples(), 20)
+      DREAM3D_REQUIRE_EQUAL(packedArray->count(), 4)
+      for(size_t i = 0; i < 20; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(packedArray->getValue(i), inputArrayPtr1[i])
+      }
     }
     else
     {
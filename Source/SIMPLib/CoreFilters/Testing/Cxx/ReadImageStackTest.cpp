@@ -0,0 +1,271 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+
+#include "itkImage.h"
+#include "itkImageFileWriter.h"
+#include "itkRGBPixel.h"
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/CoreFilters/ReadImageStack.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/ITK/itkGetComponentsDimensions.h"
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class ReadImageStackTest
+{
+public:
+  ReadImageStackTest() = default;
+  ~ReadImageStackTest() = default;
+  ReadImageStackTest(const ReadImageStackTest&) = delete;            // Copy Constructor
+  ReadImageStackTest(ReadImageStackTest&&) = delete;                 // Move Constructor
+  ReadImageStackTest& operator=(const ReadImageStackTest&) = delete; // Copy Assignment
+  ReadImageStackTest& operator=(ReadImageStackTest&&) = delete;      // Move Assignment
+
+  const size_t k_Width = 7;
+  const size_t k_Height = 5;
+  const int32_t k_NumSlices = 4;
+
+  // -----------------------------------------------------------------------------
+  QString TestDir() const
+  {
+    return UnitTest::TestTempDir + QString::fromLatin1("/ReadImageStackTest");
+  }
+
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QDir(TestDir()).removeRecursively();
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  // The value of every pixel encodes its position so misplaced slices or rows are detected
+  // -----------------------------------------------------------------------------
+  uint8_t pixelValue(size_t x, size_t y, size_t z, size_t comp) const
+  {
+    return static_cast<uint8_t>(z * 50 + y * k_Width + x + comp * 10);
+  }
+
+  // -----------------------------------------------------------------------------
+  template <typename TPixel>
+  void writeSlice(const QString& filePath, size_t z, size_t width, size_t height)
+  {
+    using ImageType = itk::Image<TPixel, 2>;
+    typename ImageType::Pointer image = ImageType::New();
+    typename ImageType::SizeType size;
+    size[0] = width;
+    size[1] = height;
+    image->SetRegions(typename ImageType::RegionType(size));
+    image->Allocate();
+
+    const size_t numComps = ITKDream3DHelper::GetComponentsDimensions<TPixel>()[0];
+    uint8_t* pixels = reinterpret_cast<uint8_t*>(image->GetBufferPointer());
+    for(size_t y = 0; y < height; y++)
+    {
+      for(size_t x = 0; x < width; x++)
+      {
+        for(size_t c = 0; c < numComps; c++)
+        {
+          pixels[(y * width + x) * numComps + c] = pixelValue(x, y, z, c);
+        }
+      }
+    }
+
+    using WriterType = itk::ImageFileWriter<ImageType>;
+    typename WriterType::Pointer writer = WriterType::New();
+    writer->SetFileName(filePath.toStdString());
+    writer->SetInput(image);
+    writer->Update();
+  }
+
+  // -----------------------------------------------------------------------------
+  QString slicePath(const QString& prefix, int32_t z) const
+  {
+    return TestDir() + QString("/%1%2.png").arg(prefix).arg(z, 3, 10, QChar('0'));
+  }
+
+  // -----------------------------------------------------------------------------
+  template <typename TPixel>
+  void writeStack(const QString& prefix)
+  {
+    QDir().mkpath(TestDir());
+    for(int32_t z = 0; z < k_NumSlices; z++)
+    {
+      writeSlice<TPixel>(slicePath(prefix, z), static_cast<size_t>(z), k_Width, k_Height);
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  ReadImageStack::Pointer createFilter(const QString& prefix, uint32_t ordering = 0)
+  {
+    StackFileListInfo info(3, ordering, 0, k_NumSlices - 1, 1, TestDir(), prefix, "", "png");
+    ReadImageStack::Pointer filter = ReadImageStack::New();
+    filter->setInputFileListInfo(info);
+    filter->setOrigin({1.0f, 2.0f, 3.0f});
+    filter->setSpacing({0.5f, 0.5f, 2.0f});
+    filter->setDataContainerArray(DataContainerArray::New());
+    return filter;
+  }
+
+  // -----------------------------------------------------------------------------
+  template <typename TPixel>
+  int checkStack(const QString& prefix, int32_t maxReads, uint32_t ordering)
+  {
+    ReadImageStack::Pointer filter = createFilter(prefix, ordering);
+    filter->setMaxConcurrentReads(maxReads);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), 0)
+
+    DataContainer::Pointer dc = filter->getDataContainerArray()->getDataContainer(filter->getDataContainerName());
+    DREAM3D_REQUIRE_VALID_POINTER(dc.get())
+    ImageGeom::Pointer image = dc->getGeometryAs<ImageGeom>();
+    DREAM3D_REQUIRE_VALID_POINTER(image.get())
+    SizeVec3Type dims = image->getDimensions();
+    DREAM3D_REQUIRE_EQUAL(dims[0], k_Width)
+    DREAM3D_REQUIRE_EQUAL(dims[1], k_Height)
+    DREAM3D_REQUIRE_EQUAL(dims[2], static_cast<size_t>(k_NumSlices))
+    DREAM3D_REQUIRE_EQUAL(image->getSpacing()[2], 2.0f)
+    DREAM3D_REQUIRE_EQUAL(image->getOrigin()[1], 2.0f)
+
+    const size_t numComps = ITKDream3DHelper::GetComponentsDimensions<TPixel>()[0];
+    DataArrayPath arrayPath(filter->getDataContainerName().getDataContainerName(), filter->getCellAttributeMatrixName(), filter->getImageDataArrayName());
+    UInt8ArrayType::Pointer data = filter->getDataContainerArray()->getPrereqArrayFromPath<UInt8ArrayType>(nullptr, arrayPath, {numComps});
+    DREAM3D_REQUIRE_VALID_POINTER(data.get())
+    DREAM3D_REQUIRE_EQUAL(data->getNumberOfTuples(), k_Width * k_Height * k_NumSlices)
+
+    for(size_t z = 0; z < static_cast<size_t>(k_NumSlices); z++)
+    {
+      const size_t fileZ = ordering == 0 ? z : static_cast<size_t>(k_NumSlices) - 1 - z;
+      for(size_t y = 0; y < k_Height; y++)
+      {
+        for(size_t x = 0; x < k_Width; x++)
+        {
+          const uint8_t* tuple = data->getTuplePointer((z * k_Height + y) * k_Width + x);
+          for(size_t c = 0; c < numComps; c++)
+          {
+            DREAM3D_REQUIRE_EQUAL(tuple[c], pixelValue(x, y, fileZ, c))
+          }
+        }
+      }
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestScalarStack()
+  {
+    writeStack<uint8_t>("gray_");
+    for(int32_t maxReads : {1, 3, 0})
+    {
+      DREAM3D_REQUIRE_EQUAL(checkStack<uint8_t>("gray_", maxReads, 0), EXIT_SUCCESS)
+    }
+    DREAM3D_REQUIRE_EQUAL(checkStack<uint8_t>("gray_", 2, 1), EXIT_SUCCESS)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestRgbStack()
+  {
+    writeStack<itk::RGBPixel<uint8_t>>("rgb_");
+    DREAM3D_REQUIRE_EQUAL(checkStack<itk::RGBPixel<uint8_t>>("rgb_", 2, 0), EXIT_SUCCESS)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  int TestErrors()
+  {
+    ReadImageStack::Pointer filter = createFilter("gray_");
+    StackFileListInfo info = filter->getInputFileListInfo();
+    info.InputPath.clear();
+    filter->setInputFileListInfo(info);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -23500)
+
+    filter = createFilter("missing_");
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -23504)
+
+    filter = createFilter("gray_");
+    filter->setMaxConcurrentReads(-1);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -23502)
+
+    // A slice with a different size is only found while the stack is decoded
+    writeStack<uint8_t>("size_");
+    writeSlice<uint8_t>(slicePath("size_", 2), 2, k_Width + 1, k_Height);
+    filter = createFilter("size_");
+    filter->setMaxConcurrentReads(2);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), 0)
+    filter->setDataContainerArray(DataContainerArray::New());
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -3002)
+
+    // A slice that cannot be decoded is reported instead of escaping the decoder thread
+    writeStack<uint8_t>("corrupt_");
+    {
+      QFile file(slicePath("corrupt_", 1));
+      DREAM3D_REQUIRE(file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+      file.write("This is not a PNG file");
+    }
+    filter = createFilter("corrupt_");
+    filter->setMaxConcurrentReads(2);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -3003)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### ReadImageStackTest Starting ####" << std::endl;
+    int32_t err = EXIT_SUCCESS; // needed inside the next macro.
+    DREAM3D_REGISTER_TEST(TestScalarStack())
+    DREAM3D_REGISTER_TEST(TestRgbStack())
+    DREAM3D_REGISTER_TEST(TestErrors())
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+  }
+};
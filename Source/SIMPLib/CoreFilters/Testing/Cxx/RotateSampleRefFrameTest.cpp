@@ -31,6 +31,8 @@
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <cmath>
+
 #include <QtCore/QFile>
 
 #include <Eigen/Dense>
@@ -61,6 +63,7 @@ private:
   const QString k_RotationTableName = "RotationTable";
   const QString k_RotationRepresentationChoiceName = "RotationRepresentationChoice";
   const QString k_CellAttributeMatrixPathName = "CellAttributeMatrixPath";
+  const QString k_UseTrilinearInterpolationName = "UseTrilinearInterpolation";
   const int k_AxisAngle = 0;
   const int k_RotationMatrix = 1;
 
@@ -458,6 +461,90 @@ public:
     DREAM3D_REQUIRE(foundRotated)
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainer::Pointer createInterpolationDataContainer(const QString& name, float value) const
+  {
+    const std::vector<size_t> tDims{12, 10, 8};
+
+    DataContainer::Pointer dc = DataContainer::New(name);
+    ImageGeom::Pointer imageGeom = ImageGeom::New();
+    imageGeom->setDimensions(tDims);
+    dc->setGeometry(imageGeom);
+
+    AttributeMatrix::Pointer matrix = dc->createNonPrereqAttributeMatrix(nullptr, "CellData", tDims, AttributeMatrix::Type::Cell);
+    FloatArrayType::Pointer floats = FloatArrayType::CreateArray(tDims, std::vector<size_t>(1, 2), "Floats", true);
+    UInt8ArrayType::Pointer ids = UInt8ArrayType::CreateArray(tDims, std::vector<size_t>(1, 1), "Ids", true);
+    for(size_t i = 0; i < floats->getNumberOfTuples(); i++)
+    {
+      floats->setComponent(i, 0, value);
+      floats->setComponent(i, 1, static_cast<float>(i % tDims[0]));
+      ids->setValue(i, static_cast<uint8_t>(1 + i % 200));
+    }
+    matrix->insertOrAssign(floats);
+    matrix->insertOrAssign(ids);
+    return dc;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestTrilinearInterpolation()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    AbstractFilter::Pointer rotateFilter = createFilter();
+    rotateFilter->setDataContainerArray(dca);
+    setProperty(rotateFilter, k_RotationRepresentationChoiceName, k_AxisAngle);
+    setProperty(rotateFilter, k_RotationAxisName, FloatVec3Type(0.0f, 0.0f, 1.0f));
+
+    // A 90 degree rotation maps Cells exactly onto Cells, so interpolating must match the nearest neighbor copy
+    for(float angle : {90.0f, 45.0f})
+    {
+      std::vector<DataContainer::Pointer> dcs;
+      for(bool interpolate : {false, true})
+      {
+        DataContainer::Pointer dc = createInterpolationDataContainer(QString("Interpolate_%1_%2").arg(angle).arg(interpolate), 5.0f);
+        dca->addOrReplaceDataContainer(dc);
+        dcs.push_back(dc);
+
+        setProperty(rotateFilter, k_CellAttributeMatrixPathName, DataArrayPath(dc->getName(), "CellData", ""));
+        setProperty(rotateFilter, k_RotationAngleName, angle);
+        setProperty(rotateFilter, k_UseTrilinearInterpolationName, interpolate);
+        rotateFilter->execute();
+        int error = rotateFilter->getErrorCode();
+        DREAM3D_REQUIRED(error, >=, 0)
+      }
+
+      AttributeMatrix::Pointer nearestMatrix = dcs[0]->getAttributeMatrix("CellData");
+      AttributeMatrix::Pointer interpMatrix = dcs[1]->getAttributeMatrix("CellData");
+      FloatArrayType::Pointer nearestFloats = nearestMatrix->getAttributeArrayAs<FloatArrayType>("Floats");
+      FloatArrayType::Pointer interpFloats = interpMatrix->getAttributeArrayAs<FloatArrayType>("Floats");
+      UInt8ArrayType::Pointer nearestIds = nearestMatrix->getAttributeArrayAs<UInt8ArrayType>("Ids");
+      UInt8ArrayType::Pointer interpIds = interpMatrix->getAttributeArrayAs<UInt8ArrayType>("Ids");
+      DREAM3D_REQUIRE_VALID_POINTER(interpFloats)
+      DREAM3D_REQUIRE_VALID_POINTER(interpIds)
+
+      // Integer arrays are never interpolated
+      bool idsEqual = dataArrayEqual(*nearestIds, *interpIds);
+      DREAM3D_REQUIRE(idsEqual)
+
+      size_t numTuples = interpFloats->getNumberOfTuples();
+      DREAM3D_REQUIRE_EQUAL(numTuples, nearestFloats->getNumberOfTuples())
+      for(size_t i = 0; i < numTuples; i++)
+      {
+        // Cells outside the original volume are zero for both methods and a constant field stays constant
+        bool inside = nearestIds->getValue(i) != 0;
+        float expected = inside ? 5.0f : 0.0f;
+        DREAM3D_REQUIRE(std::fabs(interpFloats->getComponent(i, 0) - expected) < 1.0E-4f)
+        if(angle == 90.0f)
+        {
+          DREAM3D_REQUIRE(std::fabs(interpFloats->getComponent(i, 1) - nearestFloats->getComponent(i, 1)) < 1.0E-4f)
+        }
+      }
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -470,6 +557,7 @@ public:
 
     DREAM3D_REGISTER_TEST(TestFilterParameters())
     DREAM3D_REGISTER_TEST(TestRotateSampleRefFrameTest())
+    DREAM3D_REGISTER_TEST(TestTrilinearInterpolation())
 
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
 
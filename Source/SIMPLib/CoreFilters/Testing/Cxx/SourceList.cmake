@@ -58,7 +58,9 @@ set(TEST_${SUBDIR_NAME}_NAMES
 
 if( SIMPL_USE_ITK )
   set(TEST_${SUBDIR_NAME}_NAMES ${TEST_${SUBDIR_NAME}_NAMES}
+  ReadImageStackTest
   )
+  include( ${CMP_SOURCE_DIR}/ITKSupport/IncludeITK.cmake)
 endif()
 
 
@@ -0,0 +1,980 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "BitArray.h"
+
+#include <algorithm>
+#include <bitset>
+#include <functional>
+#include <numeric>
+
+#include <QtCore/QLocale>
+
+#include "H5Support/QH5Lite.h"
+
+#include "SIMPLib/HDF5/H5DataArrayWriter.hpp"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+namespace
+{
+// Number of words each task of a parallel count handles
+constexpr size_t k_CountBlockWords = 4096;
+
+// -----------------------------------------------------------------------------
+inline size_t PopCount(BitArray::WordType word)
+{
+  return std::bitset<BitArray::k_BitsPerWord>(word).count();
+}
+
+// -----------------------------------------------------------------------------
+inline BitArray::WordType BitMask(size_t bit)
+{
+  return static_cast<BitArray::WordType>(1) << (bit % BitArray::k_BitsPerWord);
+}
+} // namespace
+
+/**
+ * @brief The BitArrayWordOpImpl class implements a threaded algorithm that combines the words of two
+ * BitArrays
+ */
+class BitArrayWordOpImpl
+{
+public:
+  enum class Operation
+  {
+    And,
+    Or,
+    Xor,
+    AndNot
+  };
+
+  BitArrayWordOpImpl(BitArray::WordType* destination, const BitArray::WordType* source, Operation operation)
+  : m_Destination(destination)
+  , m_Source(source)
+  , m_Operation(operation)
+  {
+  }
+  virtual ~BitArrayWordOpImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    BitArray::WordType* destination = m_Destination;
+    const BitArray::WordType* source = m_Source;
+    // One plain loop per operation so the compiler can vectorize each of them
+    switch(m_Operation)
+    {
+    case Operation::And:
+      for(size_t i = range.min(); i < range.max(); i++)
+      {
+        destination[i] &= source[i];
+      }
+      break;
+    case Operation::Or:
+      for(size_t i = range.min(); i < range.max(); i++)
+      {
+        destination[i] |= source[i];
+      }
+      break;
+    case Operation::Xor:
+      for(size_t i = range.min(); i < range.max(); i++)
+      {
+        destination[i] ^= source[i];
+      }
+      break;
+    case Operation::AndNot:
+      for(size_t i = range.min(); i < range.max(); i++)
+      {
+        destination[i] &= ~source[i];
+      }
+      break;
+    }
+  }
+
+private:
+  BitArray::WordType* m_Destination = nullptr;
+  const BitArray::WordType* m_Source = nullptr;
+  Operation m_Operation = Operation::And;
+};
+
+/**
+ * @brief The BitArrayCountImpl class implements a threaded algorithm that counts the set bits of
+ * blocks of k_CountBlockWords words
+ */
+class BitArrayCountImpl
+{
+public:
+  BitArrayCountImpl(const BitArray::WordType* words, size_t numWords, size_t* blockCounts)
+  : m_Words(words)
+  , m_NumWords(numWords)
+  , m_BlockCounts(blockCounts)
+  {
+  }
+  virtual ~BitArrayCountImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t block = range.min(); block < range.max(); block++)
+    {
+      size_t start = block * k_CountBlockWords;
+      size_t end = std::min(start + k_CountBlockWords, m_NumWords);
+      size_t total = 0;
+      for(size_t i = start; i < end; i++)
+      {
+        total += PopCount(m_Words[i]);
+      }
+      m_BlockCounts[block] = total;
+    }
+  }
+
+private:
+  const BitArray::WordType* m_Words = nullptr;
+  size_t m_NumWords = 0;
+  size_t* m_BlockCounts = nullptr;
+};
+
+/**
+ * @brief The BitArrayPackImpl class implements a threaded algorithm that packs a bool buffer into a
+ * BitArray. Every range covers whole words so no word is written by two threads.
+ */
+class BitArrayPackImpl
+{
+public:
+  BitArrayPackImpl(BitArray* array, const bool* values)
+  : m_Array(array)
+  , m_Values(values)
+  {
+  }
+  virtual ~BitArrayPackImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    size_t start = range.min() * BitArray::k_BitsPerWord;
+    size_t end = std::min(range.max() * BitArray::k_BitsPerWord, m_Array->getNumberOfTuples());
+    m_Array->setValues(start, end - start, m_Values + start);
+  }
+
+private:
+  BitArray* m_Array = nullptr;
+  const bool* m_Values = nullptr;
+};
+
+/**
+ * @brief The BitArrayUnpackImpl class implements a threaded algorithm that unpacks a BitArray into a
+ * bool buffer
+ */
+class BitArrayUnpackImpl
+{
+public:
+  BitArrayUnpackImpl(const BitArray* array, bool* values)
+  : m_Array(array)
+  , m_Values(values)
+  {
+  }
+  virtual ~BitArrayUnpackImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    size_t start = range.min() * BitArray::k_BitsPerWord;
+    size_t end = std::min(range.max() * BitArray::k_BitsPerWord, m_Array->getNumberOfTuples());
+    m_Array->getValues(start, end - start, m_Values + start);
+  }
+
+private:
+  const BitArray* m_Array = nullptr;
+  bool* m_Values = nullptr;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitArray::BitArray(size_t numTuples, const QString& name, bool allocate)
+: IDataArray(name)
+, m_NumTuples(numTuples)
+{
+  if(allocate)
+  {
+    m_Words.resize(NumberOfWords(numTuples), 0);
+    m_IsAllocated = true;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitArray::~BitArray() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitArray::Pointer BitArray::CreateArray(size_t numTuples, const QString& name, bool allocate)
+{
+  Pointer sharedPtr(new(BitArray)(numTuples, name, allocate));
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitArray::Pointer BitArray::CreateArray(size_t numTuples, const std::vector<size_t>& compDims, const QString& name, bool allocate)
+{
+  size_t numComponents = std::accumulate(compDims.begin(), compDims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
+  if(numComponents != 1)
+  {
+    return NullPointer();
+  }
+  return CreateArray(numTuples, name, allocate);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitArray::Pointer BitArray::FromBoolArray(const BoolArrayType& source)
+{
+  if(source.getNumberOfComponents() != 1)
+  {
+    return NullPointer();
+  }
+  Pointer array = CreateArray(source.getNumberOfTuples(), source.getName(), source.isAllocated());
+  if(source.isAllocated())
+  {
+    array->copyFromBoolArray(source);
+  }
+  return array;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitArray::NumberOfWords(size_t numBits)
+{
+  return (numBits + k_BitsPerWord - 1) / k_BitsPerWord;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitArray::getValue(size_t i) const
+{
+  return (m_Words[i / k_BitsPerWord] & BitMask(i)) != 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitArray::setValue(size_t i, bool value)
+{
+  if(value)
+  {
+    m_Words[i / k_BitsPerWord] |= BitMask(i);
+  }
+  else
+  {
+    m_Words[i / k_BitsPerWord] &= ~BitMask(i);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitArray::setValues(size_t start, size_t count, const bool* values)
+{
+  size_t i = 0;
+  for(; i < count && (start + i) % k_BitsPerWord != 0; i++)
+  {
+    setValue(start + i, values[i]);
+  }
+  for(; count - i >= k_BitsPerWord; i += k_BitsPerWord)
+  {
+    WordType word = 0;
+    for(size_t bit = 0; bit < k_BitsPerWord; bit++)
+    {
+      word |= static_cast<WordType>(values[i + bit]) << bit;
+    }
+    m_Words[(start + i) / k_BitsPerWord] = word;
+  }
+  for(; i < count; i++)
+  {
+    setValue(start + i, values[i]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitArray::getValues(size_t start, size_t count, bool* values) const
+{
+  for(size_t i = 0; i < count; i++)
+  {
+    size_t index = start + i;
+    values[i] = ((m_Words[index / k_BitsPerWord] >> (index % k_BitsPerWord)) & 1) != 0;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitArray::setAll(bool value)
+{
+  std::fill(m_Words.begin(), m_Words.end(), value ? ~static_cast<WordType>(0) : static_cast<WordType>(0));
+  clearTrailingBits();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitArray::initializeWithValue(bool value)
+{
+  setAll(value);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitArray::setInitValue(bool value)
+{
+  m_InitValue = value;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BitArray::WordType* BitArray::getWords()
+{
+  return m_Words.data();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const BitArray::WordType* BitArray::getWords() const
+{
+  return m_Words.data();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitArray::getNumberOfWords() const
+{
+  return m_Words.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitArray::andWith(const BitArray& other)
+{
+  if(other.m_NumTuples != m_NumTuples || other.m_Words.size() != m_Words.size())
+  {
+    return false;
+  }
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, m_Words.size());
+  dataAlg.execute(BitArrayWordOpImpl(m_Words.data(), other.m_Words.data(), BitArrayWordOpImpl::Operation::And));
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitArray::orWith(const BitArray& other)
+{
+  if(other.m_NumTuples != m_NumTuples || other.m_Words.size() != m_Words.size())
+  {
+    return false;
+  }
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, m_Words.size());
+  dataAlg.execute(BitArrayWordOpImpl(m_Words.data(), other.m_Words.data(), BitArrayWordOpImpl::Operation::Or));
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitArray::xorWith(const BitArray& other)
+{
+  if(other.m_NumTuples != m_NumTuples || other.m_Words.size() != m_Words.size())
+  {
+    return false;
+  }
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, m_Words.size());
+  dataAlg.execute(BitArrayWordOpImpl(m_Words.data(), other.m_Words.data(), BitArrayWordOpImpl::Operation::Xor));
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitArray::andNotWith(const BitArray& other)
+{
+  if(other.m_NumTuples != m_NumTuples || other.m_Words.size() != m_Words.size())
+  {
+    return false;
+  }
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, m_Words.size());
+  dataAlg.execute(BitArrayWordOpImpl(m_Words.data(), other.m_Words.data(), BitArrayWordOpImpl::Operation::AndNot));
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitArray::invert()
+{
+  for(WordType& word : m_Words)
+  {
+    word = ~word;
+  }
+  clearTrailingBits();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitArray::count() const
+{
+  const size_t numWords = m_Words.size();
+  const size_t numBlocks = (numWords + k_CountBlockWords - 1) / k_CountBlockWords;
+  if(numBlocks <= 1)
+  {
+    size_t total = 0;
+    for(WordType word : m_Words)
+    {
+      total += PopCount(word);
+    }
+    return total;
+  }
+
+  std::vector<size_t> blockCounts(numBlocks, 0);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numBlocks);
+  dataAlg.execute(BitArrayCountImpl(m_Words.data(), numWords, blockCounts.data()));
+
+  size_t total = 0;
+  for(size_t blockCount : blockCounts)
+  {
+    total += blockCount;
+  }
+  return total;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitArray::copyFromBoolArray(const BoolArrayType& source)
+{
+  if(!m_IsAllocated || source.getNumberOfTuples() != m_NumTuples || source.getNumberOfComponents() != 1 || (m_NumTuples > 0 && !source.isAllocated()))
+  {
+    return false;
+  }
+  if(m_NumTuples == 0)
+  {
+    return true;
+  }
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, m_Words.size());
+  dataAlg.execute(BitArrayPackImpl(this, source.getPointer(0)));
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitArray::copyInto(BoolArrayType& destination) const
+{
+  if(!m_IsAllocated || destination.getNumberOfTuples() != m_NumTuples || destination.getNumberOfComponents() != 1 || (m_NumTuples > 0 && !destination.isAllocated()))
+  {
+    return false;
+  }
+  if(m_NumTuples == 0)
+  {
+    return true;
+  }
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, m_Words.size());
+  dataAlg.execute(BitArrayUnpackImpl(this, destination.getPointer(0)));
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BoolArrayType::Pointer BitArray::toBoolArray() const
+{
+  BoolArrayType::Pointer array = BoolArrayType::CreateArray(m_NumTuples, std::vector<size_t>(1, 1), getName(), m_IsAllocated);
+  if(m_IsAllocated)
+  {
+    copyInto(*array);
+  }
+  return array;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitArray::clearTrailingBits()
+{
+  size_t usedBits = m_NumTuples % k_BitsPerWord;
+  if(usedBits != 0 && !m_Words.empty())
+  {
+    m_Words.back() &= (static_cast<WordType>(1) << usedBits) - 1;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString BitArray::getFullNameOfClass() const
+{
+  return QString("BitArray");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer BitArray::createNewArray(size_t numElements, int32_t rank, const size_t* dims, const QString& name, bool allocate) const
+{
+  return createNewArray(numElements, std::vector<size_t>(dims, dims + rank), name, allocate);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer BitArray::createNewArray(size_t numElements, const std::vector<size_t>& dims, const QString& name, bool allocate) const
+{
+  size_t numComponents = std::accumulate(dims.begin(), dims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
+  if(numComponents != 1)
+  {
+    return BoolArrayType::CreateArray(numElements, dims, name, allocate);
+  }
+  return CreateArray(numElements, name, allocate);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t BitArray::getClassVersion() const
+{
+  return 2;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitArray::isAllocated() const
+{
+  return m_IsAllocated;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitArray::takeOwnership()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitArray::releaseOwnership()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* BitArray::getVoidPointer(size_t i)
+{
+  Q_UNUSED(i)
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitArray::getNumberOfTuples() const
+{
+  return m_NumTuples;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitArray::getSize() const
+{
+  return m_NumTuples;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t BitArray::getNumberOfComponents() const
+{
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<size_t> BitArray::getComponentDimensions() const
+{
+  return {1};
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t BitArray::getTypeSize() const
+{
+  return sizeof(bool);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitArray::getXdmfTypeAndSize(QString& xdmfTypeName, int32_t& precision) const
+{
+  xdmfTypeName = "UNKNOWN";
+  precision = 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t BitArray::eraseTuples(const std::vector<size_t>& idxs)
+{
+  if(idxs.empty())
+  {
+    return 0;
+  }
+
+  std::vector<size_t> sortedIdxs(idxs);
+  std::sort(sortedIdxs.begin(), sortedIdxs.end());
+  sortedIdxs.erase(std::unique(sortedIdxs.begin(), sortedIdxs.end()), sortedIdxs.end());
+  if(sortedIdxs.back() >= m_NumTuples)
+  {
+    return -100;
+  }
+  if(sortedIdxs.size() == m_NumTuples)
+  {
+    resizeTuples(0);
+    return 0;
+  }
+
+  std::vector<WordType> newWords(m_Words.size(), 0);
+  size_t newNumTuples = 0;
+  size_t k = 0;
+  for(size_t i = 0; i < m_NumTuples; i++)
+  {
+    if(k < sortedIdxs.size() && sortedIdxs[k] == i)
+    {
+      k++;
+      continue;
+    }
+    if(getValue(i))
+    {
+      newWords[newNumTuples / k_BitsPerWord] |= BitMask(newNumTuples);
+    }
+    newNumTuples++;
+  }
+  newWords.resize(NumberOfWords(newNumTuples));
+  m_Words.swap(newWords);
+  m_NumTuples = newNumTuples;
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t BitArray::copyTuple(size_t currentPos, size_t newPos)
+{
+  if(!m_IsAllocated || currentPos >= m_NumTuples || newPos >= m_NumTuples)
+  {
+    return -1;
+  }
+  setValue(newPos, getValue(currentPos));
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BitArray::copyFromArray(size_t destTupleOffset, IDataArray::ConstPointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples)
+{
+  if(!m_IsAllocated || nullptr == sourceArray || !sourceArray->isAllocated())
+  {
+    return false;
+  }
+  if(sourceArray->getNumberOfComponents() != 1)
+  {
+    return false;
+  }
+  if(srcTupleOffset + totalSrcTuples > sourceArray->getNumberOfTuples() || destTupleOffset + totalSrcTuples > m_NumTuples)
+  {
+    return false;
+  }
+
+  if(const auto* bitSource = dynamic_cast<const BitArray*>(sourceArray.get()))
+  {
+    for(size_t i = 0; i < totalSrcTuples; i++)
+    {
+      setValue(destTupleOffset + i, bitSource->getValue(srcTupleOffset + i));
+    }
+    return true;
+  }
+  if(const auto* boolSource = dynamic_cast<const BoolArrayType*>(sourceArray.get()))
+  {
+    setValues(destTupleOffset, totalSrcTuples, boolSource->getPointer(srcTupleOffset));
+    return true;
+  }
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitArray::initializeTuple(size_t pos, const void* value)
+{
+  if(!m_IsAllocated || value == nullptr || pos >= m_NumTuples)
+  {
+    return;
+  }
+  setValue(pos, *reinterpret_cast<const bool*>(value));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitArray::initializeWithZeros()
+{
+  std::fill(m_Words.begin(), m_Words.end(), static_cast<WordType>(0));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t BitArray::resizeTotalElements(size_t size)
+{
+  resizeTuples(size);
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitArray::resizeTuples(size_t count)
+{
+  size_t oldNumTuples = m_IsAllocated ? m_NumTuples : 0;
+  m_Words.resize(NumberOfWords(count), 0);
+  m_NumTuples = count;
+  m_IsAllocated = true;
+  clearTrailingBits();
+  if(m_InitValue)
+  {
+    for(size_t i = oldNumTuples; i < count; i++)
+    {
+      setValue(i, true);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitArray::printTuple(QTextStream& out, size_t i, char delimiter) const
+{
+  out << getValue(i);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BitArray::printComponent(QTextStream& out, size_t i, int32_t j) const
+{
+  out << getValue(i);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer BitArray::deepCopy(bool forceNoAllocate) const
+{
+  bool allocate = m_IsAllocated && !forceNoAllocate;
+  Pointer copy = CreateArray(m_NumTuples, getName(), allocate);
+  if(allocate)
+  {
+    copy->m_Words = m_Words;
+  }
+  return copy;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t BitArray::writeH5Data(hid_t parentId, const std::vector<size_t>& tDims) const
+{
+  size_t totalTuples = std::accumulate(tDims.begin(), tDims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
+  if(tDims.empty() || totalTuples != m_NumTuples)
+  {
+    return -85648;
+  }
+
+  // Bytes are taken from each word lowest first so the file layout does not depend on the host byte order
+  const size_t numBytes = (m_NumTuples + 7) / 8;
+  std::vector<uint8_t> bytes(numBytes, 0);
+  if(m_IsAllocated)
+  {
+    for(size_t i = 0; i < numBytes; i++)
+    {
+      bytes[i] = static_cast<uint8_t>(m_Words[i / sizeof(WordType)] >> (8 * (i % sizeof(WordType))));
+    }
+  }
+
+  std::vector<hsize_t> dims(1, static_cast<hsize_t>(numBytes));
+  int32_t err = QH5Lite::writeVectorDataset(parentId, getName(), dims, bytes);
+  if(err < 0)
+  {
+    return err;
+  }
+
+  return H5DataArrayWriter::writeDataArrayAttributes<Self>(parentId, this, tDims, getComponentDimensions());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t BitArray::readH5Data(hid_t parentId)
+{
+  std::vector<uint8_t> bytes;
+  int32_t err = QH5Lite::readVectorDataset(parentId, getName(), bytes);
+  if(err < 0)
+  {
+    return err;
+  }
+  if(bytes.size() != (m_NumTuples + 7) / 8)
+  {
+    return -85649;
+  }
+
+  std::vector<WordType> words(NumberOfWords(m_NumTuples), 0);
+  for(size_t i = 0; i < bytes.size(); i++)
+  {
+    words[i / sizeof(WordType)] |= static_cast<WordType>(bytes[i]) << (8 * (i % sizeof(WordType)));
+  }
+  m_Words.swap(words);
+  m_IsAllocated = true;
+  clearTrailingBits();
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t BitArray::writeXdmfAttribute(QTextStream& out, const int64_t* volDims, const QString& hdfFileName, const QString& groupPath, const QString& label) const
+{
+  out << "<!-- Xdmf is not supported for " << getNameOfClass() << " with type " << getTypeAsString() << " --> ";
+  return -1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString BitArray::getTypeAsString() const
+{
+  return SIMPL::TypeNames::Bit;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString BitArray::getInfoString(SIMPL::InfoStringFormat format) const
+{
+  if(format == SIMPL::HtmlFormat)
+  {
+    return getToolTipGenerator().generateHTML();
+  }
+
+  QString info;
+  QTextStream ss(&info);
+  if(format == SIMPL::MarkDown)
+  {
+    ss << "+ Name: " << getName() << "\n";
+    ss << "+ Type: " << getTypeAsString() << "\n";
+    ss << "+ Num. Tuple: " << getNumberOfTuples() << "\n";
+    ss << "+ Comp. Dims: (1)\n";
+    ss << "+ Total Elements:  " << getSize() << "\n";
+    ss << "+ Total Memory: " << (m_Words.size() * sizeof(WordType)) << "\n";
+  }
+  return info;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ToolTipGenerator BitArray::getToolTipGenerator() const
+{
+  ToolTipGenerator toolTipGen;
+  QLocale usa(QLocale::English, QLocale::UnitedStates);
+
+  toolTipGen.addTitle("Attribute Array Info");
+  toolTipGen.addValue("Name", getName());
+  toolTipGen.addValue("Type", "Packed Bits (bool)");
+  toolTipGen.addValue("Number of Tuples", usa.toString(static_cast<qlonglong>(getNumberOfTuples())));
+  toolTipGen.addValue("Component Dimensions", "(1)");
+  toolTipGen.addValue("Total Elements", usa.toString(static_cast<qlonglong>(getSize())));
+  toolTipGen.addValue("Total Memory Required", usa.toString(static_cast<qlonglong>(m_Words.size() * sizeof(WordType))));
+
+  return toolTipGen;
+}
+
+// -----------------------------------------------------------------------------
+BitArray::Pointer BitArray::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
+
+// -----------------------------------------------------------------------------
+QString BitArray::getNameOfClass() const
+{
+  return QString("BitArray");
+}
+
+// -----------------------------------------------------------------------------
+QString BitArray::ClassName()
+{
+  return QString("BitArray");
+}
@@ -0,0 +1,374 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <QtCore/QString>
+#include <QtCore/QTextStream>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/IDataArray.h"
+
+/**
+ * @class BitArray BitArray.h SIMPLib/DataArrays/BitArray.h
+ * @brief Single component boolean array that stores one bit per tuple, packed into 64 bit words. It is
+ * meant for masks: the logical operations and count() work on whole words, so combining two masks or
+ * counting the true values touches 64 tuples per operation. Bits past the last tuple are always zero.
+ *
+ * The array is written to HDF5 as a one dimensional uint8_t dataset of packed bytes (tuple 0 is the lowest
+ * bit of byte 0) with an ObjectType of "BitArray", and reads back as a BitArray. Single bits are not
+ * addressable, so getVoidPointer() returns nullptr; generic code that needs a pointer to the values works on
+ * toBoolArray() and copies the result back with copyFromBoolArray().
+ */
+class SIMPLib_EXPORT BitArray : public IDataArray
+{
+  // clang-format off
+  PYB11_BEGIN_BINDINGS(BitArray SUPERCLASS IDataArray)
+  PYB11_SHARED_POINTERS(BitArray)
+  PYB11_STATIC_CREATION(CreateArray OVERLOAD size_t QString bool)
+  PYB11_STATIC_CREATION(CreateArray OVERLOAD size_t std::vector<size_t> QString bool)
+  PYB11_METHOD(bool getValue ARGS size_t,i)
+  PYB11_METHOD(void setValue ARGS size_t,i bool,value)
+  PYB11_METHOD(size_t count)
+  PYB11_METHOD(BoolArrayType::Pointer toBoolArray)
+  PYB11_METHOD(size_t getNumberOfTuples)
+  PYB11_END_BINDINGS()
+  // clang-format on
+
+public:
+  using Self = BitArray;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+  static Pointer NullPointer();
+
+  using value_type = bool;
+  using WordType = uint64_t;
+  static constexpr size_t k_BitsPerWord = 64;
+
+  /**
+   * @brief Creates an array of 'numTuples' bits. Allocated arrays start out all false.
+   * @param numTuples
+   * @param name
+   * @param allocate
+   * @return
+   */
+  static Pointer CreateArray(size_t numTuples, const QString& name, bool allocate = true);
+
+  /**
+   * @brief Creates an array of 'numTuples' bits, so filters can create a BitArray through
+   * createNonPrereqArrayFromPath<BitArray>(). Returns a null pointer unless 'compDims' describes a single component.
+   * @param numTuples
+   * @param compDims
+   * @param name
+   * @param allocate
+   * @return
+   */
+  static Pointer CreateArray(size_t numTuples, const std::vector<size_t>& compDims, const QString& name, bool allocate = true);
+
+  /**
+   * @brief Creates a packed copy of a single component bool array. Returns a null pointer if 'source'
+   * has more than one component.
+   * @param source
+   * @return
+   */
+  static Pointer FromBoolArray(const BoolArrayType& source);
+
+  /**
+   * @brief Returns the number of words needed to hold 'numBits' bits
+   * @param numBits
+   * @return
+   */
+  static size_t NumberOfWords(size_t numBits);
+
+  /**
+   * @brief Returns the name of the class for BitArray
+   */
+  QString getNameOfClass() const override;
+  /**
+   * @brief Returns the name of the class for BitArray
+   */
+  static QString ClassName();
+
+  ~BitArray() override;
+
+  /**
+   * @brief Returns the value of tuple i. No bounds checking is done.
+   * @param i
+   * @return
+   */
+  bool getValue(size_t i) const;
+
+  /**
+   * @brief Sets the value of tuple i. No bounds checking is done.
+   * @param i
+   * @param value
+   */
+  void setValue(size_t i, bool value);
+
+  /**
+   * @brief Packs 'count' values into the tuples starting at 'start'. Only the words covering that range are
+   * written, so ranges that start on a multiple of k_BitsPerWord may be filled concurrently.
+   * @param start
+   * @param count
+   * @param values
+   */
+  void setValues(size_t start, size_t count, const bool* values);
+
+  /**
+   * @brief Unpacks 'count' tuples starting at 'start' into 'values'
+   * @param start
+   * @param count
+   * @param values
+   */
+  void getValues(size_t start, size_t count, bool* values) const;
+
+  /**
+   * @brief Sets every tuple to 'value'
+   * @param value
+   */
+  void setAll(bool value);
+
+  /**
+   * @brief Sets every tuple to 'value'. Does nothing if the array is not allocated.
+   * @param value
+   */
+  void initializeWithValue(bool value);
+
+  /**
+   * @brief Sets the value given to the tuples that resizeTuples() adds
+   * @param value
+   */
+  void setInitValue(bool value);
+
+  /**
+   * @brief Returns the packed words. Bit (i % 64) of word (i / 64) holds tuple i.
+   * @return
+   */
+  WordType* getWords();
+
+  /**
+   * @brief Returns the packed words
+   * @return
+   */
+  const WordType* getWords() const;
+
+  /**
+   * @brief Returns the number of packed words
+   * @return
+   */
+  size_t getNumberOfWords() const;
+
+  /**
+   * @brief Replaces this array with (this AND other)
+   * @param other
+   * @return false if the number of tuples differ
+   */
+  bool andWith(const BitArray& other);
+
+  /**
+   * @brief Replaces this array with (this OR other)
+   * @param other
+   * @return false if the number of tuples differ
+   */
+  bool orWith(const BitArray& other);
+
+  /**
+   * @brief Replaces this array with (this XOR other)
+   * @param other
+   * @return false if the number of tuples differ
+   */
+  bool xorWith(const BitArray& other);
+
+  /**
+   * @brief Replaces this array with (this AND NOT other)
+   * @param other
+   * @return false if the number of tuples differ
+   */
+  bool andNotWith(const BitArray& other);
+
+  /**
+   * @brief Flips every tuple
+   */
+  void invert();
+
+  /**
+   * @brief Returns the number of true tuples. Large arrays are counted in parallel.
+   * @return
+   */
+  size_t count() const;
+
+  /**
+   * @brief Packs 'source', which must have the same number of tuples and a single component
+   * @param source
+   * @return false if the source does not match
+   */
+  bool copyFromBoolArray(const BoolArrayType& source);
+
+  /**
+   * @brief Unpacks into 'destination', which must have the same number of tuples and a single component
+   * @param destination
+   * @return false if the destination does not match
+   */
+  bool copyInto(BoolArrayType& destination) const;
+
+  /**
+   * @brief Creates a BoolArrayType with the same name and values
+   * @return
+   */
+  BoolArrayType::Pointer toBoolArray() const;
+
+  /**
+   * @brief Returns the type tag written to HDF5, "BitArray"
+   * @return
+   */
+  QString getFullNameOfClass() const;
+
+  IDataArray::Pointer createNewArray(size_t numElements, int32_t rank, const size_t* dims, const QString& name, bool allocate = true) const override;
+  IDataArray::Pointer createNewArray(size_t numElements, const std::vector<size_t>& dims, const QString& name, bool allocate = true) const override;
+
+  int32_t getClassVersion() const override;
+  bool isAllocated() const override;
+
+  /**
+   * @brief Does Nothing. The words are always owned by the array.
+   */
+  void takeOwnership() override;
+
+  /**
+   * @brief Does Nothing. The words are always owned by the array.
+   */
+  void releaseOwnership() override;
+
+  /**
+   * @brief Single bits are not addressable. Always returns nullptr.
+   * @param i
+   * @return
+   */
+  void* getVoidPointer(size_t i) override;
+
+  size_t getNumberOfTuples() const override;
+  size_t getSize() const override;
+  int32_t getNumberOfComponents() const override;
+  std::vector<size_t> getComponentDimensions() const override;
+
+  /**
+   * @brief Returns sizeof(bool), the size of one value as seen by generic code
+   */
+  size_t getTypeSize() const override;
+  void getXdmfTypeAndSize(QString& xdmfTypeName, int32_t& precision) const override;
+
+  /**
+   * @brief Removes the tuples in 'idxs'. The list may be unsorted and contain duplicates.
+   * @param idxs
+   * @return 0 on success, -100 if an index is out of range
+   */
+  int32_t eraseTuples(const std::vector<size_t>& idxs) override;
+  int32_t copyTuple(size_t currentPos, size_t newPos) override;
+
+  using IDataArray::copyFromArray;
+
+  /**
+   * @brief Copies from either a BitArray or a single component BoolArrayType
+   */
+  bool copyFromArray(size_t destTupleOffset, IDataArray::ConstPointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples) override;
+
+  /**
+   * @brief Sets tuple 'pos' from the bool pointed to by 'value'
+   */
+  void initializeTuple(size_t pos, const void* value) override;
+  void initializeWithZeros() override;
+  int32_t resizeTotalElements(size_t size) override;
+  void resizeTuples(size_t count) override;
+  void printTuple(QTextStream& out, size_t i, char delimiter = ',') const override;
+  void printComponent(QTextStream& out, size_t i, int32_t j) const override;
+  IDataArray::Pointer deepCopy(bool forceNoAllocate = false) const override;
+
+  /**
+   * @brief Writes the packed bytes as a one dimensional uint8_t dataset along with the usual DataArray
+   * attributes. 'tDims' is stored in the TupleDimensions attribute.
+   * @param parentId
+   * @param tDims
+   * @return
+   */
+  int32_t writeH5Data(hid_t parentId, const std::vector<size_t>& tDims) const override;
+
+  /**
+   * @brief Reads the packed bytes written by writeH5Data(). The number of tuples must already be set.
+   * @param parentId
+   * @return
+   */
+  int32_t readH5Data(hid_t parentId) override;
+
+  /**
+   * @brief Packed bits cannot be described in Xdmf. Returns -1.
+   */
+  int32_t writeXdmfAttribute(QTextStream& out, const int64_t* volDims, const QString& hdfFileName, const QString& groupPath, const QString& label) const override;
+
+  /**
+   * @brief Returns SIMPL::TypeNames::Bit
+   */
+  QString getTypeAsString() const override;
+  QString getInfoString(SIMPL::InfoStringFormat format) const override;
+  ToolTipGenerator getToolTipGenerator() const override;
+
+protected:
+  BitArray(size_t numTuples, const QString& name, bool allocate);
+
+private:
+  std::vector<WordType> m_Words;
+  size_t m_NumTuples = 0;
+  bool m_IsAllocated = false;
+  bool m_InitValue = false;
+
+  /**
+   * @brief Zeroes the unused bits of the last word
+   */
+  void clearTrailingBits();
+
+public:
+  BitArray(const BitArray&) = delete;            // Copy Constructor Not Implemented
+  BitArray(BitArray&&) = delete;                 // Move Constructor Not Implemented
+  BitArray& operator=(const BitArray&) = delete; // Copy Assignment Not Implemented
+  BitArray& operator=(BitArray&&) = delete;      // Move Assignment Not Implemented
+};
+
+using BitArrayType = BitArray;
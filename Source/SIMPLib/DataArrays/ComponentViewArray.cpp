@@ -0,0 +1,614 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ComponentViewArray.h"
+
+#include <QtCore/QLocale>
+
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename... Types>
+inline bool IsPrimitiveDataArray(const IDataArray* array)
+{
+  return (... || (dynamic_cast<const DataArray<Types>*>(array) != nullptr));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T, typename... Rest>
+inline const void* ConstDataPointer(const IDataArray* array)
+{
+  if(const auto* typedArray = dynamic_cast<const DataArray<T>*>(array))
+  {
+    return typedArray->data();
+  }
+  if constexpr(sizeof...(Rest) > 0)
+  {
+    return ConstDataPointer<Rest...>(array);
+  }
+  return nullptr;
+}
+} // namespace
+
+/**
+ * @brief The ComponentViewGatherImpl class implements a threaded algorithm that copies a range of strided
+ * values into a contiguous buffer. WordType only needs to match the size of the element type.
+ */
+template <typename WordType>
+class ComponentViewGatherImpl
+{
+public:
+  ComponentViewGatherImpl(const WordType* source, size_t stride, WordType* destination)
+  : m_Source(source)
+  , m_Stride(stride)
+  , m_Destination(destination)
+  {
+  }
+  virtual ~ComponentViewGatherImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      m_Destination[i] = m_Source[i * m_Stride];
+    }
+  }
+
+private:
+  const WordType* m_Source;
+  size_t m_Stride;
+  WordType* m_Destination;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename WordType>
+void gatherComponent(const void* source, size_t stride, void* destination, size_t numValues)
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numValues);
+  dataAlg.execute(ComponentViewGatherImpl<WordType>(static_cast<const WordType*>(source), stride, static_cast<WordType*>(destination)));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ComponentViewArray::ComponentViewArray(const IDataArray::Pointer& viewedArray, int32_t component, const QString& name)
+: IDataArray(name)
+, m_ViewedArray(viewedArray)
+, m_Component(component)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ComponentViewArray::~ComponentViewArray() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ComponentViewArray::Pointer ComponentViewArray::New(const IDataArray::Pointer& viewedArray, int32_t component, const QString& name)
+{
+  if(nullptr == viewedArray || component < 0 || component >= viewedArray->getNumberOfComponents())
+  {
+    return NullPointer();
+  }
+  if(!IsPrimitiveDataArray<int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t, int64_t, uint64_t, float, double, bool>(viewedArray.get()))
+  {
+    return NullPointer();
+  }
+  Pointer sharedPtr(new(ComponentViewArray)(viewedArray, component, name));
+  viewedArray->addDependentView(sharedPtr);
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer ComponentViewArray::getViewedArray() const
+{
+  return m_ViewedArray;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t ComponentViewArray::getComponent() const
+{
+  return m_Component;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ComponentViewArray::isMaterialized() const
+{
+  return nullptr != m_Materialized;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer ComponentViewArray::getSourceArray() const
+{
+  return (nullptr != m_Materialized) ? m_Materialized : m_ViewedArray;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ComponentViewArray::getComponentOffset() const
+{
+  return (nullptr != m_Materialized) ? 0 : static_cast<size_t>(m_Component);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ComponentViewArray::getStride() const
+{
+  return (nullptr != m_Materialized) ? 1 : static_cast<size_t>(m_ViewedArray->getNumberOfComponents());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer ComponentViewArray::materialize() const
+{
+  if(nullptr != m_Materialized)
+  {
+    IDataArray::Pointer copy = m_Materialized->deepCopy(false);
+    copy->setName(getName());
+    return copy;
+  }
+
+  size_t numTuples = getNumberOfTuples();
+  IDataArray::Pointer array = m_ViewedArray->createNewArray(numTuples, std::vector<size_t>(1, 1), getName(), m_ViewedArray->isAllocated());
+  if(numTuples == 0 || !m_ViewedArray->isAllocated())
+  {
+    return array;
+  }
+
+  const void* source = static_cast<const uint8_t*>(viewedData()) + m_Component * m_ViewedArray->getTypeSize();
+  void* destination = array->getVoidPointer(0);
+  size_t stride = getStride();
+  switch(m_ViewedArray->getTypeSize())
+  {
+  case 1:
+    gatherComponent<uint8_t>(source, stride, destination, numTuples);
+    break;
+  case 2:
+    gatherComponent<uint16_t>(source, stride, destination, numTuples);
+    break;
+  case 4:
+    gatherComponent<uint32_t>(source, stride, destination, numTuples);
+    break;
+  case 8:
+    gatherComponent<uint64_t>(source, stride, destination, numTuples);
+    break;
+  default:
+    break;
+  }
+  return array;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ComponentViewArray::detach()
+{
+  std::lock_guard<std::mutex> lock(m_DetachMutex);
+  if(nullptr != m_Materialized)
+  {
+    return;
+  }
+  m_Materialized = materialize();
+  m_ViewedArray.reset();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const void* ComponentViewArray::viewedData() const
+{
+  return ConstDataPointer<int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t, int64_t, uint64_t, float, double, bool>(m_ViewedArray.get());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ComponentViewArray::getFullNameOfClass() const
+{
+  return "ComponentViewArray<" + getTypeAsString() + ">";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer ComponentViewArray::createNewArray(size_t numElements, int32_t rank, const size_t* dims, const QString& name, bool allocate) const
+{
+  return getSourceArray()->createNewArray(numElements, rank, dims, name, allocate);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer ComponentViewArray::createNewArray(size_t numElements, const std::vector<size_t>& dims, const QString& name, bool allocate) const
+{
+  return getSourceArray()->createNewArray(numElements, dims, name, allocate);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t ComponentViewArray::getClassVersion() const
+{
+  return 2;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ComponentViewArray::isAllocated() const
+{
+  return getSourceArray()->isAllocated();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ComponentViewArray::takeOwnership()
+{
+  if(nullptr != m_Materialized)
+  {
+    m_Materialized->takeOwnership();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ComponentViewArray::releaseOwnership()
+{
+  if(nullptr != m_Materialized)
+  {
+    m_Materialized->releaseOwnership();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* ComponentViewArray::getVoidPointer(size_t i)
+{
+  detach();
+  return m_Materialized->getVoidPointer(i);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ComponentViewArray::getNumberOfTuples() const
+{
+  return getSourceArray()->getNumberOfTuples();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ComponentViewArray::getSize() const
+{
+  return getNumberOfTuples();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t ComponentViewArray::getNumberOfComponents() const
+{
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<size_t> ComponentViewArray::getComponentDimensions() const
+{
+  return {1};
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ComponentViewArray::getTypeSize() const
+{
+  return getSourceArray()->getTypeSize();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ComponentViewArray::getXdmfTypeAndSize(QString& xdmfTypeName, int32_t& precision) const
+{
+  getSourceArray()->getXdmfTypeAndSize(xdmfTypeName, precision);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t ComponentViewArray::eraseTuples(const std::vector<size_t>& idxs)
+{
+  detach();
+  return m_Materialized->eraseTuples(idxs);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t ComponentViewArray::copyTuple(size_t currentPos, size_t newPos)
+{
+  detach();
+  return m_Materialized->copyTuple(currentPos, newPos);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ComponentViewArray::copyFromArray(size_t destTupleOffset, IDataArray::ConstPointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples)
+{
+  detach();
+  return m_Materialized->copyFromArray(destTupleOffset, sourceArray, srcTupleOffset, totalSrcTuples);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ComponentViewArray::initializeTuple(size_t pos, const void* value)
+{
+  detach();
+  m_Materialized->initializeTuple(pos, value);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ComponentViewArray::initializeWithZeros()
+{
+  detach();
+  m_Materialized->initializeWithZeros();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t ComponentViewArray::resizeTotalElements(size_t size)
+{
+  detach();
+  return m_Materialized->resizeTotalElements(size);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ComponentViewArray::resizeTuples(size_t count)
+{
+  detach();
+  m_Materialized->resizeTuples(count);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ComponentViewArray::printTuple(QTextStream& out, size_t i, char delimiter) const
+{
+  int32_t precision = out.realNumberPrecision();
+  QString type = getTypeAsString();
+  if(type == SIMPL::TypeNames::Float)
+  {
+    out.setRealNumberPrecision(8);
+  }
+  else if(type == SIMPL::TypeNames::Double)
+  {
+    out.setRealNumberPrecision(16);
+  }
+  printComponent(out, i, 0);
+  out.setRealNumberPrecision(precision);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ComponentViewArray::printComponent(QTextStream& out, size_t i, int32_t j) const
+{
+  if(nullptr != m_Materialized)
+  {
+    m_Materialized->printComponent(out, i, j);
+    return;
+  }
+  m_ViewedArray->printComponent(out, i, m_Component);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer ComponentViewArray::deepCopy(bool forceNoAllocate) const
+{
+  if(forceNoAllocate)
+  {
+    return createNewArray(getNumberOfTuples(), std::vector<size_t>(1, 1), getName(), false);
+  }
+  return materialize();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t ComponentViewArray::writeH5Data(hid_t parentId, const std::vector<size_t>& tDims) const
+{
+  return materialize()->writeH5Data(parentId, tDims);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t ComponentViewArray::readH5Data(hid_t parentId)
+{
+  detach();
+  m_Materialized->setName(getName());
+  return m_Materialized->readH5Data(parentId);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t ComponentViewArray::writeXdmfAttribute(QTextStream& out, const int64_t* volDims, const QString& hdfFileName, const QString& groupPath, const QString& label) const
+{
+  int32_t precision = 0;
+  QString xdmfTypeName;
+  getXdmfTypeAndSize(xdmfTypeName, precision);
+  if(0 == precision)
+  {
+    out << "<!-- " << getName() << " has unknown type or unsupported type or precision for XDMF to understand"
+        << " -->"
+        << "\n";
+    return -100;
+  }
+
+  QString dimStr = QString("%1 %2 %3 ").arg(volDims[2]).arg(volDims[1]).arg(volDims[0]);
+  out << "    <Attribute Name=\"" << getName() << label << "\" ";
+  out << "AttributeType=\"Scalar\" ";
+  out << "Center=\"Cell\">\n";
+  // Open the <DataItem> Tag
+  out << R"(      <DataItem Format="HDF" Dimensions=")" << dimStr << R"(" )";
+  out << "NumberType=\"" << xdmfTypeName << "\" "
+      << "Precision=\"" << precision << "\" >\n";
+
+  out << "        " << hdfFileName << groupPath << "/" << getName() << "\n";
+  out << "      </DataItem>"
+      << "\n";
+  out << "    </Attribute>"
+      << "\n";
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ComponentViewArray::getTypeAsString() const
+{
+  return getSourceArray()->getTypeAsString();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ComponentViewArray::getInfoString(SIMPL::InfoStringFormat format) const
+{
+  if(format == SIMPL::HtmlFormat)
+  {
+    return getToolTipGenerator().generateHTML();
+  }
+
+  QString info;
+  QTextStream ss(&info);
+  if(format == SIMPL::MarkDown)
+  {
+    ss << "+ Name: " << getName() << "\n";
+    if(nullptr != m_Materialized)
+    {
+      ss << "+ Type: " << getTypeAsString() << "\n";
+    }
+    else
+    {
+      ss << "+ Type: " << getTypeAsString() << " (view of component " << m_Component << " of " << m_ViewedArray->getName() << ")\n";
+    }
+    ss << "+ Num. Tuple: " << getNumberOfTuples() << "\n";
+    ss << "+ Comp. Dims: (1)\n";
+    ss << "+ Total Elements:  " << getSize() << "\n";
+    ss << "+ Total Memory: " << ((nullptr != m_Materialized) ? getSize() * getTypeSize() : 0) << "\n";
+  }
+  return info;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ToolTipGenerator ComponentViewArray::getToolTipGenerator() const
+{
+  ToolTipGenerator toolTipGen;
+  QLocale usa(QLocale::English, QLocale::UnitedStates);
+
+  toolTipGen.addTitle("Attribute Array Info");
+  toolTipGen.addValue("Name", getName());
+  if(nullptr != m_Materialized)
+  {
+    toolTipGen.addValue("Type", getTypeAsString());
+  }
+  else
+  {
+    toolTipGen.addValue("Type", QString("Component %1 of %2 (%3)").arg(m_Component).arg(m_ViewedArray->getName()).arg(getTypeAsString()));
+  }
+  toolTipGen.addValue("Number of Tuples", usa.toString(static_cast<qlonglong>(getNumberOfTuples())));
+  toolTipGen.addValue("Component Dimensions", "(1)");
+  toolTipGen.addValue("Total Elements", usa.toString(static_cast<qlonglong>(getSize())));
+  size_t memory = (nullptr != m_Materialized) ? getSize() * getTypeSize() : 0;
+  toolTipGen.addValue("Total Memory Required", usa.toString(static_cast<qlonglong>(memory)));
+
+  return toolTipGen;
+}
+
+// -----------------------------------------------------------------------------
+ComponentViewArray::Pointer ComponentViewArray::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
+
+// -----------------------------------------------------------------------------
+QString ComponentViewArray::getNameOfClass() const
+{
+  return QString("ComponentViewArray");
+}
+
+// -----------------------------------------------------------------------------
+QString ComponentViewArray::ClassName()
+{
+  return QString("ComponentViewArray");
+}
@@ -0,0 +1,299 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <QtCore/QString>
+#include <QtCore/QTextStream>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/IDataArray.h"
+
+/**
+ * @class ComponentViewArray ComponentViewArray.h SIMPLib/DataArrays/ComponentViewArray.h
+ * @brief Single component array that reads one component of a multi-component DataArray<T> in place. The view
+ * shares ownership of the viewed array and addresses value i at viewed[i * stride + component], where the stride
+ * is the viewed array's number of components. The viewed buffer is looked up on every access.
+ *
+ * Reading code that understands views (getSourceArray(), getComponentPointer(), getStride()) never copies. Any
+ * call that can modify the data, including getVoidPointer(), first materializes the view into its own contiguous
+ * DataArray<T> and releases the viewed array; from then on the view forwards every call to that array. Writing
+ * to HDF5 uses a temporary contiguous copy, so files read back as a regular DataArray<T>.
+ *
+ * The view registers itself with the viewed array (IDataArray::addDependentView()). Element access on the viewed
+ * array never copies: values written in place, through getPointer(), setValue() or operator[], are visible
+ * through the view. Before the viewed array replaces or reshapes its buffer (resizeTuples(), eraseTuples(),
+ * readH5Data(), ...) or is removed from or replaced in its AttributeMatrix, the view materializes and keeps the
+ * values it had at that point. Code that changes all arrays of an AttributeMatrix at once materializes the views of
+ * that matrix first (see AttributeMatrix::removeInactiveObjects()).
+ *
+ * A view is not a DataArray<T>: std::dynamic_pointer_cast<DataArray<T>>() fails on it. AttributeMatrix::getPrereqArray()
+ * (and so DataContainerArray::getPrereqArrayFromPath()) materializes a view that is asked for as DataArray<T> and
+ * returns the array the view forwards to; other code calls materialize() or getSourceArray().
+ */
+class SIMPLib_EXPORT ComponentViewArray : public IDataArray
+{
+  // clang-format off
+  PYB11_BEGIN_BINDINGS(ComponentViewArray SUPERCLASS IDataArray)
+  PYB11_SHARED_POINTERS(ComponentViewArray)
+  PYB11_METHOD(IDataArray::Pointer materialize)
+  PYB11_METHOD(bool isMaterialized)
+  PYB11_METHOD(size_t getNumberOfTuples)
+  PYB11_END_BINDINGS()
+  // clang-format on
+
+public:
+  using Self = ComponentViewArray;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+  static Pointer NullPointer();
+
+  /**
+   * @brief Creates a view of one component of 'viewedArray'.
+   * @param viewedArray A primitive DataArray<T> with at least one component
+   * @param component The component to expose
+   * @param name
+   * @return NullPointer() if the viewed array is not a primitive DataArray<T> or the component is out of range
+   */
+  static Pointer New(const IDataArray::Pointer& viewedArray, int32_t component, const QString& name);
+
+  /**
+   * @brief Returns the name of the class for ComponentViewArray
+   */
+  QString getNameOfClass() const override;
+  /**
+   * @brief Returns the name of the class for ComponentViewArray
+   */
+  static QString ClassName();
+
+  ~ComponentViewArray() override;
+
+  /**
+   * @brief Returns the viewed array, or nullptr once the view has been materialized
+   * @return
+   */
+  IDataArray::Pointer getViewedArray() const;
+
+  /**
+   * @brief Returns the component of the viewed array that is exposed
+   * @return
+   */
+  int32_t getComponent() const;
+
+  /**
+   * @brief Returns true once a write has replaced the view by its own contiguous array
+   * @return
+   */
+  bool isMaterialized() const;
+
+  /**
+   * @brief Returns the array holding the values: the viewed array while viewing, the owned array once materialized.
+   * Use together with getComponentOffset() and getStride().
+   * @return
+   */
+  IDataArray::Pointer getSourceArray() const;
+
+  /**
+   * @brief Returns the offset of the first value inside getSourceArray()
+   * @return
+   */
+  size_t getComponentOffset() const;
+
+  /**
+   * @brief Returns the distance between consecutive values inside getSourceArray()
+   * @return
+   */
+  size_t getStride() const;
+
+  /**
+   * @brief Returns a pointer to the first value; value i is at pointer[i * getStride()]. Returns nullptr if
+   * T is not the type of the viewed array or the array is empty.
+   * @return
+   */
+  template <typename T>
+  const T* getComponentPointer() const
+  {
+    typename DataArray<T>::ConstPointer source = std::dynamic_pointer_cast<const DataArray<T>>(getSourceArray());
+    if(nullptr == source || source->getSize() == 0)
+    {
+      return nullptr;
+    }
+    return source->data() + getComponentOffset();
+  }
+
+  /**
+   * @brief Returns value i. T must be the type of the viewed array.
+   * @param i
+   * @return
+   */
+  template <typename T>
+  T getValue(size_t i) const
+  {
+    return getComponentPointer<T>()[i * getStride()];
+  }
+
+  /**
+   * @brief Creates a contiguous single component DataArray<T> with the same name that holds a copy of the values.
+   * The view itself is not changed.
+   * @return
+   */
+  IDataArray::Pointer materialize() const;
+
+  /**
+   * @brief Returns "ComponentViewArray<T>". The HDF5 dataset is written as DataArray<T> by a contiguous copy.
+   * @return
+   */
+  QString getFullNameOfClass() const;
+
+  /**
+   * @brief Replaces the view by its own contiguous array and releases the viewed array. Does nothing once the
+   * view is materialized. Safe to call while another thread materializes the same view.
+   */
+  void detach();
+
+  IDataArray::Pointer createNewArray(size_t numElements, int32_t rank, const size_t* dims, const QString& name, bool allocate = true) const override;
+  IDataArray::Pointer createNewArray(size_t numElements, const std::vector<size_t>& dims, const QString& name, bool allocate = true) const override;
+
+  int32_t getClassVersion() const override;
+  bool isAllocated() const override;
+
+  void takeOwnership() override;
+  void releaseOwnership() override;
+
+  /**
+   * @brief Returns a pointer into a contiguous buffer. The first call materializes the view.
+   * @param i
+   * @return
+   */
+  void* getVoidPointer(size_t i) override;
+
+  size_t getNumberOfTuples() const override;
+  size_t getSize() const override;
+  int32_t getNumberOfComponents() const override;
+  std::vector<size_t> getComponentDimensions() const override;
+  size_t getTypeSize() const override;
+  void getXdmfTypeAndSize(QString& xdmfTypeName, int32_t& precision) const override;
+
+  /**
+   * @brief Materializes the view, then erases the tuples.
+   */
+  int32_t eraseTuples(const std::vector<size_t>& idxs) override;
+
+  /**
+   * @brief Materializes the view, then copies the tuple.
+   */
+  int32_t copyTuple(size_t currentPos, size_t newPos) override;
+
+  using IDataArray::copyFromArray;
+
+  /**
+   * @brief Materializes the view, then copies the values.
+   */
+  bool copyFromArray(size_t destTupleOffset, IDataArray::ConstPointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples) override;
+
+  /**
+   * @brief Materializes the view, then initializes the tuple.
+   */
+  void initializeTuple(size_t pos, const void* value) override;
+
+  /**
+   * @brief Materializes the view, then sets all values to zero.
+   */
+  void initializeWithZeros() override;
+
+  /**
+   * @brief Materializes the view, then resizes it.
+   */
+  int32_t resizeTotalElements(size_t size) override;
+
+  /**
+   * @brief Materializes the view, then resizes it.
+   */
+  void resizeTuples(size_t count) override;
+
+  void printTuple(QTextStream& out, size_t i, char delimiter = ',') const override;
+  void printComponent(QTextStream& out, size_t i, int32_t j) const override;
+
+  /**
+   * @brief Returns a contiguous copy. With forceNoAllocate an unallocated DataArray<T> is returned instead.
+   * @param forceNoAllocate
+   * @return
+   */
+  IDataArray::Pointer deepCopy(bool forceNoAllocate = false) const override;
+
+  /**
+   * @brief Writes the values as a DataArray<T> dataset through a temporary contiguous copy.
+   * @param parentId
+   * @param tDims
+   * @return
+   */
+  int32_t writeH5Data(hid_t parentId, const std::vector<size_t>& tDims) const override;
+
+  /**
+   * @brief Materializes the view, then reads the dataset into it.
+   */
+  int32_t readH5Data(hid_t parentId) override;
+
+  int32_t writeXdmfAttribute(QTextStream& out, const int64_t* volDims, const QString& hdfFileName, const QString& groupPath, const QString& label) const override;
+  QString getTypeAsString() const override;
+  QString getInfoString(SIMPL::InfoStringFormat format) const override;
+  ToolTipGenerator getToolTipGenerator() const override;
+
+protected:
+  ComponentViewArray(const IDataArray::Pointer& viewedArray, int32_t component, const QString& name);
+
+private:
+  IDataArray::Pointer m_ViewedArray;
+  int32_t m_Component = 0;
+  IDataArray::Pointer m_Materialized;
+  std::mutex m_DetachMutex;
+
+  /**
+   * @brief Returns a read only pointer to the first value of the viewed array without detaching any view
+   * @return
+   */
+  const void* viewedData() const;
+
+public:
+  ComponentViewArray(const ComponentViewArray&) = delete;            // Copy Constructor Not Implemented
+  ComponentViewArray(ComponentViewArray&&) = delete;                 // Move Constructor Not Implemented
+  ComponentViewArray& operator=(const ComponentViewArray&) = delete; // Copy Assignment Not Implemented
+  ComponentViewArray& operator=(ComponentViewArray&&) = delete;      // Move Assignment Not Implemented
+};
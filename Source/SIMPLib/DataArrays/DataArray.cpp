@@ -228,7 +228,8 @@ typename DataArray<T>::Pointer DataArray<T>::CreateArray(size_t numTuples, const
   }
   comp_dims_type cDims = {1};
   auto d = std::make_shared<DataArray<T>>(numTuples, name, cDims, static_cast<T>(0), allocate);
-  if(allocate)
+  // The constructor already allocated and zeroed the buffer unless that failed
+  if(allocate && !d->isAllocated())
   {
     if(d->allocate() < 0)
     {
@@ -248,7 +249,8 @@ typename DataArray<T>::Pointer DataArray<T>::CreateArray(size_t numTuples, const
   }
   comp_dims_type cDims = {1};
   auto d = std::make_shared<DataArray<T>>(numTuples, QString::fromStdString(name), cDims, static_cast<T>(0), allocate);
-  if(allocate)
+  // The constructor already allocated and zeroed the buffer unless that failed
+  if(allocate && !d->isAllocated())
   {
     if(d->allocate() < 0)
     {
@@ -270,7 +272,8 @@ typename DataArray<T>::Pointer DataArray<T>::CreateArray(size_t numTuples, int32
   comp_dims_type cDims(static_cast<size_t>(rank));
   std::copy(dims, dims + rank, cDims.begin());
   auto d = std::make_shared<DataArray<T>>(numTuples, name, cDims, static_cast<T>(0), allocate);
-  if(allocate)
+  // The constructor already allocated and zeroed the buffer unless that failed
+  if(allocate && !d->isAllocated())
   {
     if(d->allocate() < 0)
     {
@@ -290,7 +293,8 @@ typename DataArray<T>::Pointer DataArray<T>::CreateArray(size_t numTuples, const
     return nullptr;
   }
   auto d = std::make_shared<DataArray<T>>(numTuples, name, compDims, static_cast<T>(0), allocate);
-  if(allocate)
+  // The constructor already allocated and zeroed the buffer unless that failed
+  if(allocate && !d->isAllocated())
   {
     if(d->allocate() < 0)
     {
@@ -313,7 +317,8 @@ typename DataArray<T>::Pointer DataArray<T>::CreateArray(const comp_dims_type& t
   size_t numTuples = std::accumulate(tupleDims.cbegin(), tupleDims.cend(), static_cast<size_t>(1), std::multiplies<>());
 
   auto d = std::make_shared<DataArray<T>>(numTuples, name, compDims, static_cast<T>(0), allocate);
-  if(allocate)
+  // The constructor already allocated and zeroed the buffer unless that failed
+  if(allocate && !d->isAllocated())
   {
     if(d->allocate() < 0)
     {
@@ -385,7 +390,7 @@ typename DataArray<T>::Pointer DataArray<T>::CopyFromPointer(const T* data, size
  * @return
  */
 template <typename T>
-typename DataArray<T>::Pointer DataArray<T>::WrapPointer(T* data, size_t numTuples, const comp_dims_type& compDims, const QString& name, bool ownsData)
+typename DataArray<T>::Pointer DataArray<T>::WrapPointer(T* data, size_t numTuples, const comp_dims_type& compDims, const QString& name, bool ownsData, const MemoryResource::Pointer& resource)
 {
   // Allocate on the heap
   auto d = std::make_shared<DataArray<T>>(numTuples, name, compDims, static_cast<T>(0), false);
@@ -394,6 +399,7 @@ typename DataArray<T>::Pointer DataArray<T>::WrapPointer(T* data, size_t numTupl
   d->m_Array = data;
   // Set who owns the data, i.e., who is going to "free" the memory
   d->m_OwnsData = ownsData;
+  d->m_Resource = resource;
   if(nullptr != data)
   {
     d->m_IsAllocated = true;
@@ -411,9 +417,17 @@ IDataArray::Pointer DataArray<T>::deepCopy(bool forceNoAllocate) const
   {
     allocate = false;
   }
-  auto daCopy = CreateArray(getNumberOfTuples(), getComponentDimensions(), getName(), allocate);
-  if(m_IsAllocated && !forceNoAllocate)
+  auto daCopy = CreateArray(getNumberOfTuples(), getComponentDimensions(), getName(), false);
+  if(allocate && m_Size > 0)
   {
+    // Every value is overwritten by the copy so the new buffer is not zeroed first
+    daCopy->m_Array = daCopy->allocateBuffer(m_Size);
+    if(nullptr == daCopy->m_Array)
+    {
+      return nullptr;
+    }
+    daCopy->m_OwnsData = true;
+    daCopy->m_IsAllocated = true;
     std::copy(begin(), end(), daCopy->begin());
   }
   return daCopy;
@@ -564,7 +578,7 @@ bool DataArray<T>::copyFromArray(size_t destTupleOffset, IDataArray::ConstPointe
   {
     return false;
   }
-  if(nullptr == source->getPointer(0))
+  if(nullptr == source->data())
   {
     return false;
   }
@@ -635,6 +649,7 @@ void DataArray<T>::releaseOwnership()
 template <typename T>
 int32_t DataArray<T>::allocate()
 {
+  detachDependentViews();
   if((nullptr != m_Array) && m_OwnsData)
   {
     deallocate();
@@ -649,12 +664,13 @@ int32_t DataArray<T>::allocate()
   }
 
   size_t newSize = m_Size;
-  m_Array = new(std::nothrow) T[newSize]();
+  m_Array = allocateBuffer(newSize);
   if(!m_Array)
   {
     qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. ";
     return -1;
   }
+  initializeBuffer(m_Array, newSize);
   m_Size = newSize;
   m_IsAllocated = true;
 
@@ -687,6 +703,7 @@ void DataArray<T>::initializeWithValue(T initValue, size_t offset)
 template <typename T>
 int32_t DataArray<T>::eraseTuples(const comp_dims_type& idxs)
 {
+  detachDependentViews();
   int32_t err = 0;
 
   // If nothing is to be erased just return
@@ -714,8 +731,13 @@ int32_t DataArray<T>::eraseTuples(const comp_dims_type& idxs)
   // Calculate the new size of the array to copy into
   size_t newSize = (getNumberOfTuples() - idxs.size()) * m_NumComponents;
 
-  // Create a new m_Array to copy into
-  T* newArray = new T[newSize]();
+  // Create a new m_Array to copy into. Every value is overwritten below so the
+  // storage is left uninitialized.
+  T* newArray = allocateBuffer(newSize);
+  if(nullptr == newArray)
+  {
+    return -101;
+  }
 
 #ifndef NDEBUG
   // Splat AB across the array so we know if we are copying the values or not
@@ -1001,6 +1023,7 @@ T* DataArray<T>::getTuplePointer(size_t tupleIndex) const
 template <typename T>
 void DataArray<T>::resizeTuples(size_t numTuples)
 {
+  detachDependentViews();
   T* ptr = resizeAndExtend(numTuples * m_NumComponents);
   if(nullptr != ptr)
   {
@@ -1237,6 +1260,7 @@ QString DataArray<T>::getInfoString(SIMPL::InfoStringFormat format) const
 template <typename T>
 int32_t DataArray<T>::readH5Data(hid_t parentId)
 {
+  detachDependentViews();
   int32_t err = 0;
 
   resizeTuples(0);
@@ -1248,6 +1272,9 @@ int32_t DataArray<T>::readH5Data(hid_t parentId)
   m_Array = reinterpret_cast<T*>(p->getVoidPointer(0));
   m_Size = p->getSize();
   m_OwnsData = true;
+  // The buffer is released by the resource that allocated it
+  Pointer source = std::dynamic_pointer_cast<DataArray<T>>(p);
+  m_Resource = (nullptr != source) ? source->m_Resource : MemoryResource::NullPointer();
   m_MaxId = (m_Size == 0) ? 0 : m_Size - 1;
   m_IsAllocated = true;
   setName(p->getName());
@@ -1405,6 +1432,7 @@ bool DataArray<T>::empty() const noexcept
 template <typename T>
 void DataArray<T>::assign(size_type n, const value_type& val) // fill (2)
 {
+  detachDependentViews();
   resizeAndExtend(n);
   std::fill(begin(), end(), val);
 }
@@ -1413,6 +1441,7 @@ void DataArray<T>::assign(size_type n, const value_type& val) // fill (2)
 template <typename T>
 void DataArray<T>::assign(std::initializer_list<value_type> il) //  initializer list (3)
 {
+  detachDependentViews();
   assign(il.begin(), il.end());
 }
 
@@ -1420,6 +1449,7 @@ void DataArray<T>::assign(std::initializer_list<value_type> il) //  initializer
 template <typename T>
 void DataArray<T>::push_back(const value_type& val)
 {
+  detachDependentViews();
   resizeAndExtend(m_Size + 1);
   m_Array[m_MaxId] = val;
 }
@@ -1428,6 +1458,7 @@ void DataArray<T>::push_back(const value_type& val)
 template <typename T>
 void DataArray<T>::push_back(value_type&& val)
 {
+  detachDependentViews();
   resizeAndExtend(m_Size + 1);
   m_Array[m_MaxId] = val;
 }
@@ -1436,6 +1467,7 @@ void DataArray<T>::push_back(value_type&& val)
 template <typename T>
 void DataArray<T>::pop_back()
 {
+  detachDependentViews();
   resizeAndExtend(m_Size - 1);
 }
 
@@ -1443,6 +1475,7 @@ void DataArray<T>::pop_back()
 template <typename T>
 void DataArray<T>::clear()
 {
+  detachDependentViews();
   if(nullptr != m_Array && m_OwnsData)
   {
     deallocate();
@@ -1461,6 +1494,7 @@ void DataArray<T>::clear()
 template <typename T>
 void DataArray<T>::deallocate()
 {
+  detachDependentViews();
 #ifndef NDEBUG
   // We are going to splat 0xABABAB across the first value of the array as a debugging aid
   auto cptr = reinterpret_cast<unsigned char*>(m_Array);
@@ -1503,16 +1537,59 @@ void DataArray<T>::deallocate()
       }
 #endif
 
-  delete[](m_Array);
+  releaseBuffer(m_Array, m_Size);
 
   m_Array = nullptr;
   m_IsAllocated = false;
 }
 
+// -----------------------------------------------------------------------------
+template <typename T>
+T* DataArray<T>::allocateBuffer(size_t numElements) const
+{
+  if(nullptr == m_Resource)
+  {
+    return new(std::nothrow) T[numElements];
+  }
+  return static_cast<T*>(m_Resource->allocate(numElements * sizeof(T), alignof(T)));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void DataArray<T>::releaseBuffer(T* buffer, size_t numElements) const
+{
+  if(nullptr == m_Resource)
+  {
+    delete[](buffer);
+    return;
+  }
+  m_Resource->deallocate(buffer, numElements * sizeof(T), alignof(T));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void DataArray<T>::initializeBuffer(T* buffer, size_t numElements) const
+{
+  if(nullptr == m_Resource)
+  {
+    std::fill_n(buffer, numElements, static_cast<T>(0));
+    return;
+  }
+  m_Resource->initialize(buffer, numElements * sizeof(T));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+MemoryResource::Pointer DataArray<T>::getMemoryResource() const
+{
+  return m_Resource;
+}
+
 // -----------------------------------------------------------------------------
 template <typename T>
 int32_t DataArray<T>::resizeTotalElements(size_t size)
 {
+  detachDependentViews();
   // std::cout << "DataArray::resizeTotalElements(" << size << ")" << std::endl;
   if(size == 0)
   {
@@ -1531,6 +1608,7 @@ int32_t DataArray<T>::resizeTotalElements(size_t size)
 template <typename T>
 T* DataArray<T>::resizeAndExtend(size_t size)
 {
+  detachDependentViews();
   T* newArray = nullptr;
   size_t newSize = 0;
   size_t oldSize = 0;
@@ -1541,7 +1619,8 @@ T* DataArray<T>::resizeAndExtend(size_t size)
     return m_Array;
   }
   newSize = size;
-  oldSize = m_Size;
+  // An array created without allocating reports its size but holds no values to keep
+  oldSize = (nullptr != m_Array) ? m_Size : 0;
 
   // Wipe out the array completely if new size is zero.
   if(newSize == 0)
@@ -1550,7 +1629,8 @@ T* DataArray<T>::resizeAndExtend(size_t size)
     return m_Array;
   }
 
-  newArray = new(std::nothrow) T[newSize]();
+  // Every value is either copied from the old array or initialized below
+  newArray = allocateBuffer(newSize);
   if(!newArray)
   {
     qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. ";
@@ -1582,10 +1662,18 @@ T* DataArray<T>::resizeAndExtend(size_t size)
   m_MaxId = newSize - 1;
   m_IsAllocated = true;
 
-  // Initialize the new tuples if newSize is larger than old size
+  // Initialize the new tuples if newSize is larger than old size. A new array of zeros is
+  // left to the memory resource, which decides how (and whether) its pages are touched.
   if(newSize > oldSize)
   {
-    initializeWithValue(m_InitValue, oldSize);
+    if(oldSize == 0 && m_InitValue == static_cast<T>(0))
+    {
+      initializeBuffer(m_Array, newSize);
+    }
+    else
+    {
+      initializeWithValue(m_InitValue, oldSize);
+    }
   }
 
   return m_Array;
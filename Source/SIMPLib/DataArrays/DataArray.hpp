@@ -49,10 +49,12 @@
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataArrays/IDataArray.h"
+#include "SIMPLib/DataArrays/MemoryResource.h"
 
 /**
  * @class DataArray
  * @brief Template class for wrapping raw arrays of data and is the basis for storing data within the SIMPL data structure.
+ * The buffer comes from the MemoryResource that was current on the constructing thread.
  */
 template <typename T>
 class DataArray : public IDataArray
@@ -232,9 +234,12 @@ public:
    * @param cDims
    * @param name
    * @param ownsData
+   * @param resource The resource that allocated 'data' and releases it when ownsData is set. The default null
+   * resource releases it with delete[].
    * @return
    */
-  static Pointer WrapPointer(T* data, size_t numTuples, const comp_dims_type& compDims, const QString& name, bool ownsData);
+  static Pointer WrapPointer(T* data, size_t numTuples, const comp_dims_type& compDims, const QString& name, bool ownsData,
+                             const MemoryResource::Pointer& resource = MemoryResource::NullPointer());
 
   //========================================= Begin API =================================
 
@@ -310,6 +315,12 @@ public:
     return m_InitValue;
   }
 
+  /**
+   * @brief Returns the resource that allocates and releases the buffer. A null resource means new[]/delete[].
+   * @return
+   */
+  MemoryResource::Pointer getMemoryResource() const;
+
   /**
    * @brief Makes this class responsible for freeing the memory
    */
@@ -1232,6 +1243,27 @@ protected:
    */
   T* resizeAndExtend(size_t size);
 
+  /**
+   * @brief Allocates uninitialized storage for 'numElements' values from the memory resource
+   * @param numElements
+   * @return nullptr if the memory could not be allocated
+   */
+  T* allocateBuffer(size_t numElements) const;
+
+  /**
+   * @brief Releases storage returned by allocateBuffer()
+   * @param buffer
+   * @param numElements
+   */
+  void releaseBuffer(T* buffer, size_t numElements) const;
+
+  /**
+   * @brief Zeroes freshly allocated storage the way the memory resource places its pages
+   * @param buffer
+   * @param numElements
+   */
+  void initializeBuffer(T* buffer, size_t numElements) const;
+
 private:
   T* m_Array = nullptr;
   size_t m_Size = 0;
@@ -1242,6 +1274,7 @@ private:
   comp_dims_type m_CompDims = {1};
   bool m_IsAllocated = false;
   bool m_OwnsData = true;
+  MemoryResource::Pointer m_Resource = MemoryResource::GetCurrent();
 };
 
 // -----------------------------------------------------------------------------
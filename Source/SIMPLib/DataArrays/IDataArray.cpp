@@ -13,6 +13,8 @@
 
 #include <hdf5.h>
 
+#include "SIMPLib/DataArrays/ComponentViewArray.h"
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -26,6 +28,34 @@ IDataArray::IDataArray(const QString& name)
 // -----------------------------------------------------------------------------
 IDataArray::~IDataArray() = default;
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IDataArray::addDependentView(const std::shared_ptr<ComponentViewArray>& view)
+{
+  std::lock_guard<std::mutex> lock(m_DependentViewsMutex);
+  m_DependentViews.push_back(view);
+  m_DependentViewCount.store(m_DependentViews.size(), std::memory_order_release);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IDataArray::detachDependentViewsImpl() const
+{
+  // Writers that arrive while the views are copied wait here until the copies are complete
+  std::lock_guard<std::mutex> lock(m_DependentViewsMutex);
+  for(const auto& weakView : m_DependentViews)
+  {
+    if(std::shared_ptr<ComponentViewArray> view = weakView.lock())
+    {
+      view->detach();
+    }
+  }
+  m_DependentViews.clear();
+  m_DependentViewCount.store(0, std::memory_order_release);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
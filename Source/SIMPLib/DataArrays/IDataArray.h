@@ -11,7 +11,9 @@
 #pragma once
 
 //-- C++
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "H5Support/H5SupportTypeDefs.h"
@@ -26,6 +28,7 @@
 #include "SIMPLib/Utilities/ToolTipGenerator.h"
 
 class IDataArray;
+class ComponentViewArray;
 using IDataArrayShPtrType = std::shared_ptr<IDataArray>;
 
 /**
@@ -294,8 +297,35 @@ public:
    */
   virtual ToolTipGenerator getToolTipGenerator() const = 0;
 
-protected:
+  /**
+   * @brief Registers a view that reads the values of this array in place. Values written in place, for example
+   * through getPointer() or setValue(), are visible through the view. Before this array replaces or reshapes its
+   * buffer (resize, erase, allocate, read from HDF5) the registered views copy their values into arrays of their
+   * own, so a view never reads a buffer that was freed or has a different layout.
+   * @param view
+   */
+  void addDependentView(const std::shared_ptr<ComponentViewArray>& view);
+
+  /**
+   * @brief Detaches the registered views. Subclasses call this before they replace or reshape their buffer;
+   * containers call it before they remove or replace this array. Element access never calls it. Only an atomic
+   * load when no view is registered.
+   */
+  void detachDependentViews() const
+  {
+    if(m_DependentViewCount.load(std::memory_order_acquire) != 0)
+    {
+      detachDependentViewsImpl();
+    }
+  }
+
 private:
+  mutable std::mutex m_DependentViewsMutex;
+  mutable std::vector<std::weak_ptr<ComponentViewArray>> m_DependentViews;
+  mutable std::atomic<size_t> m_DependentViewCount = {0};
+
+  void detachDependentViewsImpl() const;
+
   IDataArray(const IDataArray&);     // Not Implemented
   void operator=(const IDataArray&); // Not Implemented
 };
@@ -0,0 +1,405 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "MemoryResource.h"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#include "SIMPLib/Common/SIMPLRange.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+namespace
+{
+const size_t k_PageSize = 4096;
+
+thread_local MemoryResource::Pointer s_Current;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* AlignedNew(size_t bytes, size_t alignment)
+{
+  return ::operator new(bytes, std::align_val_t(alignment), std::nothrow);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AlignedDelete(void* p, size_t alignment)
+{
+  ::operator delete(p, std::align_val_t(alignment));
+}
+
+/**
+ * @brief Zeroes whole pages of a buffer; each worker writes the pages of its own sub range
+ */
+class FirstTouchImpl
+{
+public:
+  FirstTouchImpl(uint8_t* buffer, size_t bytes)
+  : m_Buffer(buffer)
+  , m_Bytes(bytes)
+  {
+  }
+  virtual ~FirstTouchImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    size_t start = range.min() * k_PageSize;
+    size_t end = std::min(range.max() * k_PageSize, m_Bytes);
+    std::memset(m_Buffer + start, 0, end - start);
+  }
+
+private:
+  uint8_t* m_Buffer = nullptr;
+  size_t m_Bytes = 0;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MemoryResource::MemoryResource() = default;
+
+// -----------------------------------------------------------------------------
+MemoryResource::~MemoryResource() = default;
+
+// -----------------------------------------------------------------------------
+MemoryResource::Pointer MemoryResource::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* MemoryResource::allocate(size_t bytes, size_t alignment)
+{
+  return doAllocate(bytes, std::max(alignment, alignof(std::max_align_t)));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MemoryResource::deallocate(void* p, size_t bytes, size_t alignment)
+{
+  if(nullptr != p)
+  {
+    doDeallocate(p, bytes, std::max(alignment, alignof(std::max_align_t)));
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MemoryResource::initialize(void* p, size_t bytes) const
+{
+  std::memset(p, 0, bytes);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MemoryResource::Pointer MemoryResource::Create(Type type)
+{
+  switch(type)
+  {
+  case Type::Uninitialized:
+    return UninitializedMemoryResource::New();
+  case Type::FirstTouch:
+    return FirstTouchMemoryResource::New();
+  case Type::HugePages:
+    return HugePageMemoryResource::New();
+  case Type::Default:
+    break;
+  }
+  return NullPointer();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList MemoryResource::GetNames()
+{
+  return {"default", "uninitialized", "first-touch", "huge-pages"};
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MemoryResource::Pointer MemoryResource::FromName(const QString& name, bool* ok)
+{
+  int32_t index = GetNames().indexOf(name.toLower());
+  if(nullptr != ok)
+  {
+    *ok = (index >= 0);
+  }
+  if(index < 0)
+  {
+    return NullPointer();
+  }
+  return Create(static_cast<Type>(index));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MemoryResource::Pointer MemoryResource::GetCurrent()
+{
+  return s_Current;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MemoryResource::ScopedCurrent::ScopedCurrent(const Pointer& resource)
+{
+  if(nullptr != resource)
+  {
+    m_Previous = s_Current;
+    s_Current = resource;
+    m_Installed = true;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MemoryResource::ScopedCurrent::~ScopedCurrent()
+{
+  if(m_Installed)
+  {
+    s_Current = m_Previous;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+UninitializedMemoryResource::UninitializedMemoryResource() = default;
+
+// -----------------------------------------------------------------------------
+UninitializedMemoryResource::~UninitializedMemoryResource() = default;
+
+// -----------------------------------------------------------------------------
+UninitializedMemoryResource::Pointer UninitializedMemoryResource::New()
+{
+  return Pointer(new UninitializedMemoryResource());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString UninitializedMemoryResource::getName() const
+{
+  return GetNames()[static_cast<int32_t>(Type::Uninitialized)];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void UninitializedMemoryResource::initialize(void* p, size_t bytes) const
+{
+  Q_UNUSED(p)
+  Q_UNUSED(bytes)
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* UninitializedMemoryResource::doAllocate(size_t bytes, size_t alignment)
+{
+  return AlignedNew(bytes, alignment);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void UninitializedMemoryResource::doDeallocate(void* p, size_t bytes, size_t alignment)
+{
+  Q_UNUSED(bytes)
+  AlignedDelete(p, alignment);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FirstTouchMemoryResource::FirstTouchMemoryResource() = default;
+
+// -----------------------------------------------------------------------------
+FirstTouchMemoryResource::~FirstTouchMemoryResource() = default;
+
+// -----------------------------------------------------------------------------
+FirstTouchMemoryResource::Pointer FirstTouchMemoryResource::New()
+{
+  return Pointer(new FirstTouchMemoryResource());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString FirstTouchMemoryResource::getName() const
+{
+  return GetNames()[static_cast<int32_t>(Type::FirstTouch)];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FirstTouchMemoryResource::initialize(void* p, size_t bytes) const
+{
+  size_t numPages = (bytes + k_PageSize - 1) / k_PageSize;
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numPages);
+  dataAlg.execute(FirstTouchImpl(static_cast<uint8_t*>(p), bytes));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* FirstTouchMemoryResource::doAllocate(size_t bytes, size_t alignment)
+{
+  // Page alignment keeps every page owned by a single worker in initialize()
+  return AlignedNew(bytes, std::max(alignment, k_PageSize));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FirstTouchMemoryResource::doDeallocate(void* p, size_t bytes, size_t alignment)
+{
+  Q_UNUSED(bytes)
+  AlignedDelete(p, std::max(alignment, k_PageSize));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+HugePageMemoryResource::HugePageMemoryResource() = default;
+
+// -----------------------------------------------------------------------------
+HugePageMemoryResource::~HugePageMemoryResource() = default;
+
+// -----------------------------------------------------------------------------
+HugePageMemoryResource::Pointer HugePageMemoryResource::New()
+{
+  return Pointer(new HugePageMemoryResource());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString HugePageMemoryResource::getName() const
+{
+  return GetNames()[static_cast<int32_t>(Type::HugePages)];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool HugePageMemoryResource::IsMapped(size_t bytes)
+{
+#if defined(__linux__)
+  return bytes >= k_HugePageSize;
+#else
+  Q_UNUSED(bytes)
+  return false;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void HugePageMemoryResource::initialize(void* p, size_t bytes) const
+{
+  if(!IsMapped(bytes))
+  {
+    std::memset(p, 0, bytes);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* HugePageMemoryResource::doAllocate(size_t bytes, size_t alignment)
+{
+  if(!IsMapped(bytes))
+  {
+    return AlignedNew(bytes, alignment);
+  }
+#if defined(__linux__)
+  size_t mappedBytes = (bytes + k_HugePageSize - 1) / k_HugePageSize * k_HugePageSize;
+  void* p = MAP_FAILED;
+#ifdef MAP_HUGETLB
+  p = mmap(nullptr, mappedBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#endif
+  if(MAP_FAILED == p)
+  {
+    // No huge pages reserved; fall back to normal pages and let transparent huge pages merge them
+    p = mmap(nullptr, mappedBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(MAP_FAILED == p)
+    {
+      return nullptr;
+    }
+#ifdef MADV_HUGEPAGE
+    madvise(p, mappedBytes, MADV_HUGEPAGE);
+#endif
+  }
+  return p;
+#else
+  return AlignedNew(bytes, alignment);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void HugePageMemoryResource::doDeallocate(void* p, size_t bytes, size_t alignment)
+{
+  if(!IsMapped(bytes))
+  {
+    AlignedDelete(p, alignment);
+    return;
+  }
+#if defined(__linux__)
+  size_t mappedBytes = (bytes + k_HugePageSize - 1) / k_HugePageSize * k_HugePageSize;
+  munmap(p, mappedBytes);
+#endif
+}
@@ -0,0 +1,252 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @class MemoryResource MemoryResource.h SIMPLib/DataArrays/MemoryResource.h
+ * @brief Allocation interface for the buffers of DataArray<T>, shaped after std::pmr::memory_resource (which
+ * is not available on every supported standard library). A DataArray<T> picks up the current resource of the
+ * constructing thread and keeps it for all of its later allocations. A null resource, which is the initial state
+ * of every thread, keeps the plain new[]/delete[] allocation.
+ *
+ * Besides allocating, a resource decides how a freshly allocated array is zeroed (initialize()), which is where
+ * the resources differ: zeroing serially, zeroing from the worker threads, or not at all.
+ *
+ * The current resource is per thread, like ScratchArena::GetCurrent(). FilterPipeline::setMemoryResource()
+ * installs a resource on the executing thread for the duration of one execute() through ScopedCurrent, so
+ * pipelines running at the same time on different threads keep their own resources. ParallelDataAlgorithm and
+ * ParallelTaskAlgorithm install the resource of the calling thread on their workers.
+ */
+class SIMPLib_EXPORT MemoryResource
+{
+public:
+  using Self = MemoryResource;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+  static Pointer NullPointer();
+
+  enum class Type : int32_t
+  {
+    Default = 0,   //!< Plain new[]/delete[]; represented by a null resource
+    Uninitialized, //!< Aligned operator new; new arrays are not zeroed
+    FirstTouch,    //!< Aligned operator new; new arrays are zeroed page by page from the worker threads
+    HugePages      //!< Anonymous mappings backed by huge pages where the system provides them
+  };
+
+  virtual ~MemoryResource();
+
+  /**
+   * @brief Returns the name used by FromName() and on the command line
+   * @return
+   */
+  virtual QString getName() const = 0;
+
+  /**
+   * @brief Allocates 'bytes' bytes aligned to 'alignment'
+   * @param bytes
+   * @param alignment A power of two
+   * @return nullptr if the memory could not be allocated
+   */
+  void* allocate(size_t bytes, size_t alignment);
+
+  /**
+   * @brief Releases memory returned by allocate() with the same size and alignment
+   * @param p
+   * @param bytes
+   * @param alignment
+   */
+  void deallocate(void* p, size_t bytes, size_t alignment);
+
+  /**
+   * @brief Makes freshly allocated memory read as zeros. The default implementation uses memset.
+   * @param p
+   * @param bytes
+   */
+  virtual void initialize(void* p, size_t bytes) const;
+
+  /**
+   * @brief Creates a resource of the given type. Type::Default returns NullPointer().
+   * @param type
+   * @return
+   */
+  static Pointer Create(Type type);
+
+  /**
+   * @brief Creates a resource from one of the names returned by GetNames()
+   * @param name
+   * @param ok Set to false if the name is unknown
+   * @return
+   */
+  static Pointer FromName(const QString& name, bool* ok = nullptr);
+
+  /**
+   * @brief Returns the names accepted by FromName(), in the order of Type
+   * @return
+   */
+  static QStringList GetNames();
+
+  /**
+   * @brief Returns the resource arrays constructed on the calling thread use, or NullPointer() for new[]/delete[]
+   * @return
+   */
+  static Pointer GetCurrent();
+
+  /**
+   * @brief The ScopedCurrent class installs a resource as the current resource of the calling thread and restores
+   * the previous one when it goes out of scope. A null resource leaves the current resource unchanged.
+   */
+  class SIMPLib_EXPORT ScopedCurrent
+  {
+  public:
+    explicit ScopedCurrent(const Pointer& resource);
+    ~ScopedCurrent();
+
+  private:
+    bool m_Installed = false;
+    Pointer m_Previous;
+
+  public:
+    ScopedCurrent(const ScopedCurrent&) = delete;            // Copy Constructor Not Implemented
+    ScopedCurrent(ScopedCurrent&&) = delete;                 // Move Constructor Not Implemented
+    ScopedCurrent& operator=(const ScopedCurrent&) = delete; // Copy Assignment Not Implemented
+    ScopedCurrent& operator=(ScopedCurrent&&) = delete;      // Move Assignment Not Implemented
+  };
+
+protected:
+  MemoryResource();
+
+  virtual void* doAllocate(size_t bytes, size_t alignment) = 0;
+  virtual void doDeallocate(void* p, size_t bytes, size_t alignment) = 0;
+
+public:
+  MemoryResource(const MemoryResource&) = delete;            // Copy Constructor Not Implemented
+  MemoryResource(MemoryResource&&) = delete;                 // Move Constructor Not Implemented
+  MemoryResource& operator=(const MemoryResource&) = delete; // Copy Assignment Not Implemented
+  MemoryResource& operator=(MemoryResource&&) = delete;      // Move Assignment Not Implemented
+};
+
+/**
+ * @brief Aligned operator new/delete that leaves new arrays uninitialized. Arrays created through
+ * AttributeMatrix::createNonPrereqArray() are still filled with their initial value; only the extra zeroing pass
+ * is skipped. Arrays that grow keep filling their new tuples. Code that reads a freshly created array before
+ * writing it will see garbage, so only use this for pipelines whose filters write what they create.
+ */
+class SIMPLib_EXPORT UninitializedMemoryResource : public MemoryResource
+{
+public:
+  using Self = UninitializedMemoryResource;
+  using Pointer = std::shared_ptr<Self>;
+  static Pointer New();
+
+  ~UninitializedMemoryResource() override;
+
+  QString getName() const override;
+  void initialize(void* p, size_t bytes) const override;
+
+protected:
+  UninitializedMemoryResource();
+
+  void* doAllocate(size_t bytes, size_t alignment) override;
+  void doDeallocate(void* p, size_t bytes, size_t alignment) override;
+};
+
+/**
+ * @brief Aligned operator new/delete that zeroes new arrays page by page with ParallelDataAlgorithm. Operating
+ * systems with a first touch policy place each page on the NUMA node of the thread that writes it first, so
+ * the pages end up spread over the nodes the TBB workers run on instead of all on the node of the allocating
+ * thread. Without TBB this behaves like new[] with zeroing.
+ */
+class SIMPLib_EXPORT FirstTouchMemoryResource : public MemoryResource
+{
+public:
+  using Self = FirstTouchMemoryResource;
+  using Pointer = std::shared_ptr<Self>;
+  static Pointer New();
+
+  ~FirstTouchMemoryResource() override;
+
+  QString getName() const override;
+  void initialize(void* p, size_t bytes) const override;
+
+protected:
+  FirstTouchMemoryResource();
+
+  void* doAllocate(size_t bytes, size_t alignment) override;
+  void doDeallocate(void* p, size_t bytes, size_t alignment) override;
+};
+
+/**
+ * @brief Anonymous memory mappings for large arrays. On Linux an allocation of at least k_HugePageSize first
+ * asks for explicit huge pages (MAP_HUGETLB) and otherwise maps normal pages and advises transparent huge
+ * pages. Mapped pages are zero and untouched, so initialize() does nothing and the first writer places each page.
+ * Small allocations and other platforms use aligned operator new.
+ */
+class SIMPLib_EXPORT HugePageMemoryResource : public MemoryResource
+{
+public:
+  using Self = HugePageMemoryResource;
+  using Pointer = std::shared_ptr<Self>;
+  static Pointer New();
+
+  static constexpr size_t k_HugePageSize = 2 * 1024 * 1024;
+
+  ~HugePageMemoryResource() override;
+
+  QString getName() const override;
+  void initialize(void* p, size_t bytes) const override;
+
+protected:
+  HugePageMemoryResource();
+
+  void* doAllocate(size_t bytes, size_t alignment) override;
+  void doDeallocate(void* p, size_t bytes, size_t alignment) override;
+
+  /**
+   * @brief Returns true if an allocation of 'bytes' bytes is mapped rather than taken from operator new
+   * @param bytes
+   * @return
+   */
+  static bool IsMapped(size_t bytes);
+};
@@ -1,5 +1,7 @@
 #include "NeighborList.hpp"
 
+#include <utility>
+
 #include <QtCore/QMap>
 #include <QtCore/QTextStream>
 
@@ -324,7 +326,7 @@ int NeighborList<T>::eraseTuples(const std::vector<size_t>& idxs)
   {
     if(dIdx != idxs[idxsIndex])
     {
-      replacement[rIdx] = m_Array[dIdx];
+      replacement[rIdx] = std::move(m_Array[dIdx]);
       ++rIdx;
     }
     else
@@ -336,7 +338,7 @@ int NeighborList<T>::eraseTuples(const std::vector<size_t>& idxs)
       }
     }
   }
-  m_Array = replacement;
+  m_Array = std::move(replacement);
   m_NumTuples = m_Array.size();
   return err;
 }
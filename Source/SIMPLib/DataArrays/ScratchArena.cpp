@@ -0,0 +1,330 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "ScratchArena.h"
+
+#include <new>
+#include <utility>
+
+namespace
+{
+thread_local ScratchArena::Pointer s_Current;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* AllocateBlock(int32_t sizeClass)
+{
+  return ::operator new(ScratchArena::GetBlockSize(sizeClass), std::align_val_t(ScratchArena::k_Alignment));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FreeBlock(void* data)
+{
+  ::operator delete(data, std::align_val_t(ScratchArena::k_Alignment));
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ScratchArena::Block::Block(Pointer arena, void* data, int32_t sizeClass)
+: m_Arena(std::move(arena))
+, m_Data(data)
+, m_SizeClass(sizeClass)
+{
+}
+
+// -----------------------------------------------------------------------------
+ScratchArena::Block::~Block()
+{
+  reset();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ScratchArena::Block::Block(Block&& other) noexcept
+: m_Arena(std::move(other.m_Arena))
+, m_Data(other.m_Data)
+, m_SizeClass(other.m_SizeClass)
+{
+  other.m_Data = nullptr;
+  other.m_SizeClass = -1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ScratchArena::Block& ScratchArena::Block::operator=(Block&& other) noexcept
+{
+  if(this != &other)
+  {
+    reset();
+    m_Arena = std::move(other.m_Arena);
+    m_Data = other.m_Data;
+    m_SizeClass = other.m_SizeClass;
+    other.m_Data = nullptr;
+    other.m_SizeClass = -1;
+  }
+  return *this;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ScratchArena::Block::capacity() const
+{
+  return (nullptr != m_Data) ? GetBlockSize(m_SizeClass) : 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ScratchArena::Block::reset()
+{
+  if(nullptr != m_Data)
+  {
+    if(nullptr != m_Arena)
+    {
+      m_Arena->give(m_Data, m_SizeClass);
+    }
+    else
+    {
+      FreeBlock(m_Data);
+    }
+  }
+  m_Arena.reset();
+  m_Data = nullptr;
+  m_SizeClass = -1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ScratchArena::ScratchArena() = default;
+
+// -----------------------------------------------------------------------------
+ScratchArena::~ScratchArena()
+{
+  // Borrowed blocks keep the arena alive, so every block is cached at this point
+  trim();
+}
+
+// -----------------------------------------------------------------------------
+ScratchArena::Pointer ScratchArena::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
+
+// -----------------------------------------------------------------------------
+ScratchArena::Pointer ScratchArena::New()
+{
+  Pointer sharedPtr(new(ScratchArena)());
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ScratchArena::GetBlockSize(int32_t sizeClass)
+{
+  return static_cast<size_t>(1) << sizeClass;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t ScratchArena::GetSizeClass(size_t bytes)
+{
+  int32_t sizeClass = 0;
+  while(GetBlockSize(sizeClass) < k_MinBlockSize)
+  {
+    sizeClass++;
+  }
+  while(GetBlockSize(sizeClass) < bytes)
+  {
+    sizeClass++;
+  }
+  return sizeClass;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ScratchArena::Block ScratchArena::Acquire(const Pointer& arena, size_t bytes)
+{
+  if(bytes == 0)
+  {
+    return Block();
+  }
+  if(bytes > GetBlockSize(static_cast<int32_t>(k_NumSizeClasses - 1)))
+  {
+    throw std::bad_alloc();
+  }
+  int32_t sizeClass = GetSizeClass(bytes);
+  if(nullptr == arena)
+  {
+    return Block(arena, AllocateBlock(sizeClass), sizeClass);
+  }
+  return Block(arena, arena->take(sizeClass), sizeClass);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* ScratchArena::take(int32_t sizeClass)
+{
+  size_t blockSize = GetBlockSize(sizeClass);
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  std::vector<void*>& freeBlocks = m_FreeBlocks[sizeClass];
+  void* data = nullptr;
+  if(freeBlocks.empty())
+  {
+    data = AllocateBlock(sizeClass);
+    m_Statistics.allocationCount++;
+    m_Statistics.bytesReserved += blockSize;
+    m_Statistics.highWaterBytesReserved = std::max(m_Statistics.highWaterBytesReserved, m_Statistics.bytesReserved);
+  }
+  else
+  {
+    data = freeBlocks.back();
+    freeBlocks.pop_back();
+  }
+  m_Statistics.borrowCount++;
+  m_Statistics.bytesInUse += blockSize;
+  m_Statistics.highWaterBytesInUse = std::max(m_Statistics.highWaterBytesInUse, m_Statistics.bytesInUse);
+  return data;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ScratchArena::give(void* data, int32_t sizeClass)
+{
+  size_t blockSize = GetBlockSize(sizeClass);
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  m_Statistics.bytesInUse -= blockSize;
+  try
+  {
+    m_FreeBlocks[sizeClass].push_back(data);
+  } catch(const std::bad_alloc&)
+  {
+    // Blocks are returned from destructors; drop the block rather than throw
+    FreeBlock(data);
+    m_Statistics.bytesReserved -= blockSize;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ScratchArena::Pointer ScratchArena::GetCurrent()
+{
+  return s_Current;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ScratchArena::ScopedCurrent::ScopedCurrent(const Pointer& arena)
+{
+  if(nullptr != arena)
+  {
+    m_Previous = s_Current;
+    s_Current = arena;
+    m_Installed = true;
+  }
+}
+
+// -----------------------------------------------------------------------------
+ScratchArena::ScopedCurrent::~ScopedCurrent()
+{
+  if(m_Installed)
+  {
+    s_Current = m_Previous;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ScratchArena::Statistics ScratchArena::getStatistics() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_Statistics;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ScratchArena::resetStatistics()
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  m_Statistics.borrowCount = 0;
+  m_Statistics.allocationCount = 0;
+  m_Statistics.highWaterBytesInUse = m_Statistics.bytesInUse;
+  m_Statistics.highWaterBytesReserved = m_Statistics.bytesReserved;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ScratchArena::trim(size_t maxCachedBytes)
+{
+  std::vector<std::pair<void*, int32_t>> released;
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    size_t cachedBytes = m_Statistics.bytesReserved - m_Statistics.bytesInUse;
+    // Large blocks go first, so the blocks that stay cached are the cheap, frequently borrowed ones
+    for(size_t sizeClass = k_NumSizeClasses; sizeClass-- > 0 && cachedBytes > maxCachedBytes;)
+    {
+      std::vector<void*>& blocks = m_FreeBlocks[sizeClass];
+      const size_t blockSize = GetBlockSize(static_cast<int32_t>(sizeClass));
+      while(!blocks.empty() && cachedBytes > maxCachedBytes)
+      {
+        released.emplace_back(blocks.back(), static_cast<int32_t>(sizeClass));
+        blocks.pop_back();
+        cachedBytes -= blockSize;
+        m_Statistics.bytesReserved -= blockSize;
+      }
+    }
+  }
+  for(const auto& block : released)
+  {
+    FreeBlock(block.first);
+  }
+}
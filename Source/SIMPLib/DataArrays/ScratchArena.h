@@ -0,0 +1,336 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @class ScratchArena ScratchArena.h SIMPLib/DataArrays/ScratchArena.h
+ * @brief Pool of temporary buffers that code borrows from instead of creating _INTERNAL_USE_ONLY_ arrays. Blocks
+ * are kept in power of two size classes; borrowing pops a cached block of the right class and returning it pushes
+ * the block back, both in O(1). Blocks stay cached until trim() or until the arena is destroyed, so later borrows of
+ * the same size stop allocating, within one run of a pipeline and across runs. At the end of every execute()
+ * FilterPipeline only trims what is cached above its ScratchRetainLimit.
+ *
+ * FilterPipeline owns an arena and installs it as the current arena of the executing thread with ScopedCurrent.
+ * ParallelDataAlgorithm and ParallelTaskAlgorithm install the current arena of the calling thread on their workers,
+ * so GetCurrent() works inside their bodies as well. Borrowing from a null arena allocates a block that is freed
+ * again when it is returned, so code using the arena also works outside of a pipeline.
+ *
+ * The arena is thread safe. Running statistics, including high-water marks of the bytes in use and the bytes
+ * reserved, are available through getStatistics() for profiling.
+ */
+class SIMPLib_EXPORT ScratchArena : public std::enable_shared_from_this<ScratchArena>
+{
+public:
+  using Self = ScratchArena;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+  static Pointer NullPointer();
+
+  static Pointer New();
+
+  virtual ~ScratchArena();
+
+  /**
+   * @brief Alignment of every block
+   */
+  static constexpr size_t k_Alignment = 64;
+
+  /**
+   * @brief Size of the smallest size class
+   */
+  static constexpr size_t k_MinBlockSize = 64;
+
+  struct Statistics
+  {
+    size_t borrowCount = 0;            //!< Number of blocks borrowed
+    size_t allocationCount = 0;        //!< Number of borrows that had to allocate a new block
+    size_t bytesInUse = 0;             //!< Bytes currently borrowed
+    size_t bytesReserved = 0;          //!< Bytes held by the arena, borrowed or cached
+    size_t highWaterBytesInUse = 0;    //!< Largest value of bytesInUse
+    size_t highWaterBytesReserved = 0; //!< Largest value of bytesReserved
+  };
+
+  /**
+   * @brief The Block class owns one borrowed block and returns it to its arena when it is destroyed
+   */
+  class SIMPLib_EXPORT Block
+  {
+  public:
+    Block() = default;
+    ~Block();
+
+    Block(Block&& other) noexcept;
+    Block& operator=(Block&& other) noexcept;
+
+    /**
+     * @brief Returns the start of the block, or nullptr for an empty block
+     * @return
+     */
+    void* data() const
+    {
+      return m_Data;
+    }
+
+    /**
+     * @brief Returns the usable size of the block, which is its size class
+     * @return
+     */
+    size_t capacity() const;
+
+    /**
+     * @brief Returns the block to its arena early
+     */
+    void reset();
+
+  private:
+    friend class ScratchArena;
+    Block(Pointer arena, void* data, int32_t sizeClass);
+
+    Pointer m_Arena;
+    void* m_Data = nullptr;
+    int32_t m_SizeClass = -1;
+
+  public:
+    Block(const Block&) = delete;            // Copy Constructor Not Implemented
+    Block& operator=(const Block&) = delete; // Copy Assignment Not Implemented
+  };
+
+  /**
+   * @brief The Buffer class is a typed view of a borrowed block holding 'size()' values of T
+   */
+  template <typename T>
+  class Buffer
+  {
+    static_assert(std::is_trivially_copyable<T>::value && std::is_trivially_destructible<T>::value, "Scratch buffers hold plain values only");
+
+  public:
+    Buffer() = default;
+    ~Buffer() = default;
+
+    Buffer(Buffer&&) noexcept = default;
+    Buffer& operator=(Buffer&&) noexcept = default;
+
+    T* data() const
+    {
+      return static_cast<T*>(m_Block.data());
+    }
+
+    size_t size() const
+    {
+      return m_Size;
+    }
+
+    bool empty() const
+    {
+      return m_Size == 0;
+    }
+
+    T& operator[](size_t i) const
+    {
+      return data()[i];
+    }
+
+    T* begin() const
+    {
+      return data();
+    }
+
+    T* end() const
+    {
+      return data() + m_Size;
+    }
+
+    /**
+     * @brief Returns the block to its arena early
+     */
+    void reset()
+    {
+      m_Block.reset();
+      m_Size = 0;
+    }
+
+  private:
+    friend class ScratchArena;
+    Buffer(Block&& block, size_t size)
+    : m_Block(std::move(block))
+    , m_Size(size)
+    {
+    }
+
+    Block m_Block;
+    size_t m_Size = 0;
+
+  public:
+    Buffer(const Buffer&) = delete;            // Copy Constructor Not Implemented
+    Buffer& operator=(const Buffer&) = delete; // Copy Assignment Not Implemented
+  };
+
+  /**
+   * @brief Borrows an uninitialized buffer of 'count' values from 'arena'. A null arena allocates a block that is
+   * freed when the buffer is destroyed. Throws std::bad_alloc if a new block cannot be allocated.
+   * @param arena
+   * @param count
+   * @return
+   */
+  template <typename T>
+  static Buffer<T> Borrow(const Pointer& arena, size_t count)
+  {
+    return Buffer<T>(Acquire(arena, count * sizeof(T)), count);
+  }
+
+  /**
+   * @brief Borrows a buffer of 'count' values from 'arena' with every value set to 'value'
+   * @param arena
+   * @param count
+   * @param value
+   * @return
+   */
+  template <typename T>
+  static Buffer<T> Borrow(const Pointer& arena, size_t count, T value)
+  {
+    Buffer<T> buffer = Borrow<T>(arena, count);
+    std::fill_n(buffer.data(), count, value);
+    return buffer;
+  }
+
+  /**
+   * @brief Borrows an uninitialized untyped block of at least 'bytes' bytes from 'arena'
+   * @param arena
+   * @param bytes
+   * @return
+   */
+  static Block Acquire(const Pointer& arena, size_t bytes);
+
+  /**
+   * @brief Returns the arena installed on the calling thread, or NullPointer()
+   * @return
+   */
+  static Pointer GetCurrent();
+
+  /**
+   * @brief The ScopedCurrent class installs an arena as the current arena of the calling thread and restores the
+   * previous one when it goes out of scope. A null arena leaves the current arena unchanged.
+   */
+  class SIMPLib_EXPORT ScopedCurrent
+  {
+  public:
+    explicit ScopedCurrent(const Pointer& arena);
+    ~ScopedCurrent();
+
+  private:
+    bool m_Installed = false;
+    Pointer m_Previous;
+
+  public:
+    ScopedCurrent(const ScopedCurrent&) = delete;            // Copy Constructor Not Implemented
+    ScopedCurrent(ScopedCurrent&&) = delete;                 // Move Constructor Not Implemented
+    ScopedCurrent& operator=(const ScopedCurrent&) = delete; // Copy Assignment Not Implemented
+    ScopedCurrent& operator=(ScopedCurrent&&) = delete;      // Move Assignment Not Implemented
+  };
+
+  /**
+   * @brief Returns the counters and high-water marks
+   * @return
+   */
+  Statistics getStatistics() const;
+
+  /**
+   * @brief Clears the counters and lowers the high-water marks to the current values, e.g. at the start of a run
+   */
+  void resetStatistics();
+
+  /**
+   * @brief Frees cached blocks, largest first, until at most 'maxCachedBytes' bytes stay cached. The default frees
+   * every cached block. Borrowed blocks are not affected.
+   * @param maxCachedBytes
+   */
+  void trim(size_t maxCachedBytes = 0);
+
+  /**
+   * @brief Returns the size of the given size class in bytes
+   * @param sizeClass
+   * @return
+   */
+  static size_t GetBlockSize(int32_t sizeClass);
+
+  /**
+   * @brief Returns the smallest size class that holds 'bytes' bytes
+   * @param bytes
+   * @return
+   */
+  static int32_t GetSizeClass(size_t bytes);
+
+protected:
+  ScratchArena();
+
+  /**
+   * @brief Pops a cached block of the given size class or allocates a new one
+   * @param sizeClass
+   * @return
+   */
+  void* take(int32_t sizeClass);
+
+  /**
+   * @brief Pushes a block back onto the cache of its size class
+   * @param data
+   * @param sizeClass
+   */
+  void give(void* data, int32_t sizeClass);
+
+private:
+  static constexpr size_t k_NumSizeClasses = sizeof(size_t) * 8;
+
+  mutable std::mutex m_Mutex;
+  std::array<std::vector<void*>, k_NumSizeClasses> m_FreeBlocks;
+  Statistics m_Statistics;
+
+public:
+  ScratchArena(const ScratchArena&) = delete;            // Copy Constructor Not Implemented
+  ScratchArena(ScratchArena&&) = delete;                 // Move Constructor Not Implemented
+  ScratchArena& operator=(const ScratchArena&) = delete; // Copy Assignment Not Implemented
+  ScratchArena& operator=(ScratchArena&&) = delete;      // Move Assignment Not Implemented
+};
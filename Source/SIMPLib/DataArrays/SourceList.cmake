@@ -3,10 +3,14 @@ set(SUBDIR_NAME DataArrays)
 
 
 set(SIMPLib_${SUBDIR_NAME}_HDRS
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/BitArray.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ComponentViewArray.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DataArray.hpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataArray.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataArrayFilter.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/MemoryResource.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/NeighborList.hpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ScratchArena.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/StatsDataArray.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/StringDataArray.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/StructArray.hpp
@@ -14,9 +18,13 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
 )
 
 set(SIMPLib_${SUBDIR_NAME}_SRCS
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/BitArray.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ComponentViewArray.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DataArray.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataArray.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataArrayFilter.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/MemoryResource.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ScratchArena.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/StatsDataArray.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/StringDataArray.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/NeighborList.cpp
@@ -0,0 +1,296 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/BitArray.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class BitArrayTest
+{
+public:
+  BitArrayTest() = default;
+  virtual ~BitArrayTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  BoolArrayType::Pointer CreateRandomBoolArray(size_t numTuples, uint32_t seed)
+  {
+    std::mt19937 generator(seed);
+    std::bernoulli_distribution distribution(0.3);
+    BoolArrayType::Pointer array = BoolArrayType::CreateArray(numTuples, std::vector<size_t>(1, 1), "Mask", true);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      array->setValue(i, distribution(generator));
+    }
+    return array;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestConversion()
+  {
+    const std::vector<size_t> sizes = {0, 1, 63, 64, 65, 1000, 300001};
+    for(size_t numTuples : sizes)
+    {
+      BoolArrayType::Pointer source = CreateRandomBoolArray(numTuples, static_cast<uint32_t>(numTuples));
+      BitArray::Pointer bits = BitArray::FromBoolArray(*source);
+      DREAM3D_REQUIRE_VALID_POINTER(bits.get())
+      DREAM3D_REQUIRE_EQUAL(bits->getNumberOfTuples(), numTuples)
+      DREAM3D_REQUIRE_EQUAL(bits->getNumberOfWords(), BitArray::NumberOfWords(numTuples))
+
+      size_t expectedCount = 0;
+      for(size_t i = 0; i < numTuples; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(bits->getValue(i), source->getValue(i))
+        expectedCount += source->getValue(i) ? 1 : 0;
+      }
+      DREAM3D_REQUIRE_EQUAL(bits->count(), expectedCount)
+
+      BoolArrayType::Pointer roundTrip = bits->toBoolArray();
+      DREAM3D_REQUIRE_EQUAL(roundTrip->getNumberOfTuples(), numTuples)
+      for(size_t i = 0; i < numTuples; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(roundTrip->getValue(i), source->getValue(i))
+      }
+    }
+
+    BoolArrayType::Pointer multiComponent = BoolArrayType::CreateArray(10, std::vector<size_t>(1, 2), "Mask", true);
+    DREAM3D_REQUIRE(BitArray::FromBoolArray(*multiComponent).get() == nullptr)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestLogicalOperations()
+  {
+    const size_t numTuples = 200003;
+    BoolArrayType::Pointer a = CreateRandomBoolArray(numTuples, 11);
+    BoolArrayType::Pointer b = CreateRandomBoolArray(numTuples, 12);
+    BitArray::Pointer bitsB = BitArray::FromBoolArray(*b);
+
+    BitArray::Pointer result = BitArray::FromBoolArray(*a);
+    DREAM3D_REQUIRE(result->andWith(*bitsB))
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(result->getValue(i), (a->getValue(i) && b->getValue(i)))
+    }
+
+    result = BitArray::FromBoolArray(*a);
+    DREAM3D_REQUIRE(result->orWith(*bitsB))
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(result->getValue(i), (a->getValue(i) || b->getValue(i)))
+    }
+
+    result = BitArray::FromBoolArray(*a);
+    DREAM3D_REQUIRE(result->xorWith(*bitsB))
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(result->getValue(i), (a->getValue(i) != b->getValue(i)))
+    }
+
+    result = BitArray::FromBoolArray(*a);
+    DREAM3D_REQUIRE(result->andNotWith(*bitsB))
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(result->getValue(i), (a->getValue(i) && !b->getValue(i)))
+    }
+
+    // Inverting must not count the unused bits of the last word
+    result = BitArray::FromBoolArray(*a);
+    size_t count = result->count();
+    result->invert();
+    DREAM3D_REQUIRE_EQUAL(result->count(), numTuples - count)
+    result->setAll(true);
+    DREAM3D_REQUIRE_EQUAL(result->count(), numTuples)
+
+    BitArray::Pointer shorter = BitArray::CreateArray(numTuples - 1, "Short", true);
+    DREAM3D_REQUIRE_EQUAL(result->andWith(*shorter), false)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestEditing()
+  {
+    const size_t numTuples = 150;
+    BoolArrayType::Pointer source = CreateRandomBoolArray(numTuples, 5);
+    BitArray::Pointer bits = BitArray::FromBoolArray(*source);
+
+    // Unaligned packing touches partial words on both ends
+    BitArray::Pointer partial = BitArray::CreateArray(numTuples, "Partial", true);
+    partial->setValues(3, 140, source->getPointer(3));
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      bool expected = (i >= 3 && i < 143) ? source->getValue(i) : false;
+      DREAM3D_REQUIRE_EQUAL(partial->getValue(i), expected)
+    }
+
+    std::vector<size_t> erase = {0, 1, 2, 63, 64, 100, 149};
+    DREAM3D_REQUIRE_EQUAL(bits->eraseTuples(erase), 0)
+    DREAM3D_REQUIRE_EQUAL(bits->getNumberOfTuples(), numTuples - erase.size())
+    size_t next = 0;
+    size_t k = 0;
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      if(k < erase.size() && erase[k] == i)
+      {
+        k++;
+        continue;
+      }
+      DREAM3D_REQUIRE_EQUAL(bits->getValue(next), source->getValue(i))
+      next++;
+    }
+    DREAM3D_REQUIRE(bits->eraseTuples({numTuples}) < 0)
+
+    DREAM3D_REQUIRE_EQUAL(bits->copyTuple(0, 1), 0)
+    DREAM3D_REQUIRE_EQUAL(bits->getValue(1), bits->getValue(0))
+
+    BitArray::Pointer destination = BitArray::CreateArray(numTuples, "Destination", true);
+    DREAM3D_REQUIRE(destination->copyFromArray(10, source, 20, 100))
+    DREAM3D_REQUIRE(destination->copyFromArray(0, bits, 0, 10))
+    for(size_t i = 0; i < 100; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(destination->getValue(10 + i), source->getValue(20 + i))
+    }
+    for(size_t i = 0; i < 10; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(destination->getValue(i), bits->getValue(i))
+    }
+    DREAM3D_REQUIRE_EQUAL(destination->copyFromArray(100, source, 0, 100), false)
+
+    destination->resizeTuples(70);
+    destination->setAll(true);
+    destination->resizeTuples(200);
+    DREAM3D_REQUIRE_EQUAL(destination->count(), 70)
+
+    IDataArray::Pointer copy = destination->deepCopy();
+    BitArray::Pointer bitCopy = std::dynamic_pointer_cast<BitArray>(copy);
+    DREAM3D_REQUIRE_VALID_POINTER(bitCopy.get())
+    DREAM3D_REQUIRE_EQUAL(bitCopy->count(), 70)
+    DREAM3D_REQUIRE_EQUAL(destination->deepCopy(true)->isAllocated(), false)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestUnsortedErase()
+  {
+    const size_t numTuples = 130;
+    BoolArrayType::Pointer source = CreateRandomBoolArray(numTuples, 9);
+    BitArray::Pointer bits = BitArray::FromBoolArray(*source);
+
+    std::vector<size_t> erase = {129, 64, 3, 64, 0, 3, 70};
+    std::vector<size_t> uniqueErase = {0, 3, 64, 70, 129};
+    DREAM3D_REQUIRE_EQUAL(bits->eraseTuples(erase), 0)
+    DREAM3D_REQUIRE_EQUAL(bits->getNumberOfTuples(), numTuples - uniqueErase.size())
+    size_t next = 0;
+    size_t k = 0;
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      if(k < uniqueErase.size() && uniqueErase[k] == i)
+      {
+        k++;
+        continue;
+      }
+      DREAM3D_REQUIRE_EQUAL(bits->getValue(next), source->getValue(i))
+      next++;
+    }
+
+    // As many indices as tuples, but with duplicates, must not clear the array
+    BitArray::Pointer small = BitArray::FromBoolArray(*source);
+    small->resizeTuples(4);
+    DREAM3D_REQUIRE_EQUAL(small->eraseTuples({2, 2, 1, 1}), 0)
+    DREAM3D_REQUIRE_EQUAL(small->getNumberOfTuples(), 2)
+    DREAM3D_REQUIRE_EQUAL(small->getValue(0), source->getValue(0))
+    DREAM3D_REQUIRE_EQUAL(small->getValue(1), source->getValue(3))
+    DREAM3D_REQUIRE(small->eraseTuples({1, 5, 0}) < 0)
+    DREAM3D_REQUIRE_EQUAL(small->getNumberOfTuples(), 2)
+    DREAM3D_REQUIRE_EQUAL(small->eraseTuples({1, 0, 1}), 0)
+    DREAM3D_REQUIRE_EQUAL(small->getNumberOfTuples(), 0)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestVoidPointer()
+  {
+    const size_t numTuples = 100;
+    BoolArrayType::Pointer source = CreateRandomBoolArray(numTuples, 11);
+    BitArray::Pointer bits = BitArray::FromBoolArray(*source);
+
+    // Single bits are not addressable; generic code goes through an unpacked copy
+    IDataArray::Pointer generic = bits;
+    DREAM3D_REQUIRE(generic->getVoidPointer(0) == nullptr)
+    DREAM3D_REQUIRE(generic->getVoidPointer(numTuples) == nullptr)
+
+    BoolArrayType::Pointer unpacked = bits->toBoolArray();
+    bool* values = reinterpret_cast<bool*>(unpacked->getVoidPointer(0));
+    DREAM3D_REQUIRE_VALID_POINTER(values)
+    values[5] = !source->getValue(5);
+    DREAM3D_REQUIRE_EQUAL(bits->copyFromBoolArray(*unpacked), true)
+    DREAM3D_REQUIRE_EQUAL(bits->getValue(5), !source->getValue(5))
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+    std::cout << "#### BitArrayTest Starting ####" << std::endl;
+    DREAM3D_REGISTER_TEST(TestConversion())
+    DREAM3D_REGISTER_TEST(TestLogicalOperations())
+    DREAM3D_REGISTER_TEST(TestEditing())
+    DREAM3D_REGISTER_TEST(TestUnsortedErase())
+    DREAM3D_REGISTER_TEST(TestVoidPointer())
+  }
+
+private:
+  BitArrayTest(const BitArrayTest&) = delete;   // Copy Constructor Not Implemented
+  void operator=(const BitArrayTest&) = delete; // Move assignment Not Implemented
+};
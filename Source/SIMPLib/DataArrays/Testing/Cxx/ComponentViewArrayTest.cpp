@@ -0,0 +1,228 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/ComponentViewArray.h"
+#include "SIMPLib/DataArrays/StringDataArray.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class ComponentViewArrayTest
+{
+public:
+  ComponentViewArrayTest() = default;
+  virtual ~ComponentViewArrayTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  Int32ArrayType::Pointer CreateViewedArray(size_t numTuples)
+  {
+    Int32ArrayType::Pointer array = Int32ArrayType::CreateArray(numTuples, std::vector<size_t>(1, 3), "Viewed", true);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      for(int32_t c = 0; c < 3; c++)
+      {
+        array->setComponent(i, c, static_cast<int32_t>(i * 10) + c);
+      }
+    }
+    return array;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestReadInPlace()
+  {
+    const size_t numTuples = 17;
+    Int32ArrayType::Pointer viewed = CreateViewedArray(numTuples);
+    ComponentViewArray::Pointer view = ComponentViewArray::New(viewed, 2, "View");
+    DREAM3D_REQUIRE_VALID_POINTER(view.get())
+    DREAM3D_REQUIRE_EQUAL(view->getNumberOfTuples(), numTuples)
+    DREAM3D_REQUIRE_EQUAL(view->getNumberOfComponents(), 1)
+    DREAM3D_REQUIRE_EQUAL(view->getStride(), 3)
+    DREAM3D_REQUIRE_EQUAL(view->getComponentOffset(), 2)
+    DREAM3D_REQUIRE_EQUAL(view->getTypeAsString(), QString("int32_t"))
+    DREAM3D_REQUIRE_EQUAL(view->getFullNameOfClass(), QString("ComponentViewArray<int32_t>"))
+    DREAM3D_REQUIRE(std::dynamic_pointer_cast<Int32ArrayType>(view) == nullptr)
+    DREAM3D_REQUIRE(view->getComponentPointer<float>() == nullptr)
+
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(view->getValue<int32_t>(i), static_cast<int32_t>(i * 10) + 2)
+    }
+
+    // Reading the viewed array through its const accessors keeps the view
+    const Int32ArrayType& constViewed = *viewed;
+    DREAM3D_REQUIRE_EQUAL(constViewed[4 * 3 + 2], 42)
+    DREAM3D_REQUIRE_EQUAL(view->isMaterialized(), false)
+
+    Int32ArrayType::Pointer materialized = std::dynamic_pointer_cast<Int32ArrayType>(view->materialize());
+    DREAM3D_REQUIRE_VALID_POINTER(materialized.get())
+    DREAM3D_REQUIRE_EQUAL(materialized->getName(), view->getName())
+    DREAM3D_REQUIRE_EQUAL(materialized->getNumberOfComponents(), 1)
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(materialized->getValue(i), view->getValue<int32_t>(i))
+    }
+    DREAM3D_REQUIRE_EQUAL(view->isMaterialized(), false)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestViewedArrayWrites()
+  {
+    const size_t numTuples = 12;
+    Int32ArrayType::Pointer viewed = CreateViewedArray(numTuples);
+    ComponentViewArray::Pointer first = ComponentViewArray::New(viewed, 0, "First");
+    ComponentViewArray::Pointer second = ComponentViewArray::New(viewed, 2, "Second");
+    DREAM3D_REQUIRE_VALID_POINTER(first.get())
+    DREAM3D_REQUIRE_VALID_POINTER(second.get())
+
+    // Writes in place go through to the views; element access never copies
+    viewed->setComponent(4, 2, -7);
+    viewed->getPointer(0)[0] = 1000;
+    (*viewed)[3 * 3 + 2] = 555;
+    DREAM3D_REQUIRE_EQUAL(first->isMaterialized(), false)
+    DREAM3D_REQUIRE_EQUAL(second->isMaterialized(), false)
+    DREAM3D_REQUIRE_EQUAL(second->getValue<int32_t>(4), -7)
+    DREAM3D_REQUIRE_EQUAL(second->getValue<int32_t>(3), 555)
+    DREAM3D_REQUIRE_EQUAL(first->getValue<int32_t>(0), 1000)
+
+    // Replacing or reshaping the buffer materializes every view first, so the views keep their values
+    DREAM3D_REQUIRE_EQUAL(viewed->eraseTuples({0}), 0)
+    DREAM3D_REQUIRE_EQUAL(first->isMaterialized(), true)
+    DREAM3D_REQUIRE_EQUAL(second->isMaterialized(), true)
+    DREAM3D_REQUIRE_EQUAL(first->getNumberOfTuples(), numTuples)
+    DREAM3D_REQUIRE_EQUAL(first->getValue<int32_t>(0), 1000)
+    DREAM3D_REQUIRE_EQUAL(second->getValue<int32_t>(4), -7)
+
+    ComponentViewArray::Pointer third = ComponentViewArray::New(viewed, 1, "Third");
+    viewed->resizeTuples(numTuples * 2);
+    DREAM3D_REQUIRE_EQUAL(third->isMaterialized(), true)
+    DREAM3D_REQUIRE_EQUAL(third->getNumberOfTuples(), numTuples - 1)
+    DREAM3D_REQUIRE_EQUAL(third->getValue<int32_t>(0), 11)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestCopyOnWrite()
+  {
+    const size_t numTuples = 9;
+    Int32ArrayType::Pointer viewed = CreateViewedArray(numTuples);
+    ComponentViewArray::Pointer view = ComponentViewArray::New(viewed, 1, "View");
+    DREAM3D_REQUIRE_VALID_POINTER(view.get())
+
+    int32_t* values = reinterpret_cast<int32_t*>(view->getVoidPointer(0));
+    DREAM3D_REQUIRE_VALID_POINTER(values)
+    DREAM3D_REQUIRE_EQUAL(view->isMaterialized(), true)
+    DREAM3D_REQUIRE(view->getViewedArray() == nullptr)
+    DREAM3D_REQUIRE_EQUAL(view->getStride(), 1)
+    DREAM3D_REQUIRE_EQUAL(view->getComponentOffset(), 0)
+
+    values[3] = 1234;
+    DREAM3D_REQUIRE_EQUAL(view->getValue<int32_t>(3), 1234)
+    DREAM3D_REQUIRE_EQUAL(viewed->getComponent(3, 1), 31)
+
+    // The materialized array is independent of the formerly viewed array
+    viewed->setComponent(5, 1, -1);
+    DREAM3D_REQUIRE_EQUAL(view->getValue<int32_t>(5), 51)
+
+    DREAM3D_REQUIRE_EQUAL(view->eraseTuples({0, 1}), 0)
+    DREAM3D_REQUIRE_EQUAL(view->getNumberOfTuples(), numTuples - 2)
+    DREAM3D_REQUIRE_EQUAL(view->getValue<int32_t>(1), 1234)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestDeepCopy()
+  {
+    Int32ArrayType::Pointer viewed = CreateViewedArray(5);
+    ComponentViewArray::Pointer view = ComponentViewArray::New(viewed, 0, "View");
+    DREAM3D_REQUIRE_VALID_POINTER(view.get())
+
+    Int32ArrayType::Pointer copy = std::dynamic_pointer_cast<Int32ArrayType>(view->deepCopy());
+    DREAM3D_REQUIRE_VALID_POINTER(copy.get())
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(4), 40)
+
+    IDataArray::Pointer unallocated = view->deepCopy(true);
+    DREAM3D_REQUIRE_VALID_POINTER(std::dynamic_pointer_cast<Int32ArrayType>(unallocated).get())
+    DREAM3D_REQUIRE_EQUAL(unallocated->getNumberOfTuples(), 5)
+    DREAM3D_REQUIRE_EQUAL(unallocated->getNumberOfComponents(), 1)
+    DREAM3D_REQUIRE_EQUAL(view->isMaterialized(), false)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestInvalidViews()
+  {
+    Int32ArrayType::Pointer viewed = CreateViewedArray(4);
+    DREAM3D_REQUIRE(ComponentViewArray::New(viewed, 3, "View") == nullptr)
+    DREAM3D_REQUIRE(ComponentViewArray::New(viewed, -1, "View") == nullptr)
+    DREAM3D_REQUIRE(ComponentViewArray::New(Int32ArrayType::NullPointer(), 0, "View") == nullptr)
+
+    StringDataArray::Pointer strings = StringDataArray::CreateArray(4, "Strings", true);
+    DREAM3D_REQUIRE(ComponentViewArray::New(strings, 0, "View") == nullptr)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+    std::cout << "#### ComponentViewArrayTest Starting ####" << std::endl;
+    DREAM3D_REGISTER_TEST(TestReadInPlace())
+    DREAM3D_REGISTER_TEST(TestViewedArrayWrites())
+    DREAM3D_REGISTER_TEST(TestCopyOnWrite())
+    DREAM3D_REGISTER_TEST(TestDeepCopy())
+    DREAM3D_REGISTER_TEST(TestInvalidViews())
+  }
+
+private:
+  ComponentViewArrayTest(const ComponentViewArrayTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const ComponentViewArrayTest&) = delete;         // Move assignment Not Implemented
+};
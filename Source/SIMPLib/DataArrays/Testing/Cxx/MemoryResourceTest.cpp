@@ -0,0 +1,369 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <QtCore/QUuid>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/MemoryResource.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+namespace
+{
+/**
+ * @brief Creates an array once every pipeline sharing 'arrived' is executing, so the pipelines' resources are
+ * installed at the same time
+ */
+class CreateArrayTogetherFilter : public AbstractFilter
+{
+public:
+  using Self = CreateArrayTogetherFilter;
+  using Pointer = std::shared_ptr<Self>;
+
+  static Pointer New(std::atomic<int32_t>* arrived, int32_t numPipelines)
+  {
+    Pointer sharedPtr(new CreateArrayTogetherFilter(arrived, numPipelines));
+    return sharedPtr;
+  }
+
+  QString getNameOfClass() const override
+  {
+    return QString("CreateArrayTogetherFilter");
+  }
+
+  QUuid getUuid() const override
+  {
+    return QUuid("{4b0bd2a4-5a1c-4a39-9b57-1d0b7c2d6f15}");
+  }
+
+  void dataCheck() override
+  {
+  }
+
+  void execute() override
+  {
+    m_Arrived->fetch_add(1);
+    while(m_Arrived->load() < m_NumPipelines)
+    {
+      std::this_thread::yield();
+    }
+    m_Array = FloatArrayType::CreateArray(16, QString("Together"), true);
+  }
+
+  FloatArrayType::Pointer getArray() const
+  {
+    return m_Array;
+  }
+
+protected:
+  CreateArrayTogetherFilter(std::atomic<int32_t>* arrived, int32_t numPipelines)
+  : m_Arrived(arrived)
+  , m_NumPipelines(numPipelines)
+  {
+  }
+
+private:
+  std::atomic<int32_t>* m_Arrived = nullptr;
+  int32_t m_NumPipelines = 0;
+  FloatArrayType::Pointer m_Array;
+};
+
+/**
+ * @brief Counts the ranges that ran without the expected current resource
+ */
+class CheckCurrentResourceImpl
+{
+public:
+  CheckCurrentResourceImpl(MemoryResource::Pointer expected, std::atomic<int32_t>* mismatches)
+  : m_Expected(std::move(expected))
+  , m_Mismatches(mismatches)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    FloatArrayType::Pointer array = FloatArrayType::CreateArray(range.size(), QString("Worker"), true);
+    if(MemoryResource::GetCurrent() != m_Expected || array->getMemoryResource() != m_Expected)
+    {
+      m_Mismatches->fetch_add(1);
+    }
+  }
+
+private:
+  MemoryResource::Pointer m_Expected;
+  std::atomic<int32_t>* m_Mismatches;
+};
+} // namespace
+
+class MemoryResourceTest
+{
+public:
+  MemoryResourceTest() = default;
+  virtual ~MemoryResourceTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestNames()
+  {
+    QStringList names = MemoryResource::GetNames();
+    for(const QString& name : names)
+    {
+      bool ok = false;
+      MemoryResource::Pointer resource = MemoryResource::FromName(name, &ok);
+      DREAM3D_REQUIRE(ok)
+      if(name == "default")
+      {
+        DREAM3D_REQUIRE(nullptr == resource)
+      }
+      else
+      {
+        DREAM3D_REQUIRE_VALID_POINTER(resource)
+        DREAM3D_REQUIRE(resource->getName() == name)
+      }
+    }
+
+    bool ok = true;
+    DREAM3D_REQUIRE(nullptr == MemoryResource::FromName("no-such-resource", &ok))
+    DREAM3D_REQUIRE_EQUAL(ok, false)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestScopedCurrent()
+  {
+    DREAM3D_REQUIRE(nullptr == MemoryResource::GetCurrent())
+    FloatArrayType::Pointer plain = FloatArrayType::CreateArray(16, QString("Plain"), true);
+    DREAM3D_REQUIRE(nullptr == plain->getMemoryResource())
+
+    MemoryResource::Pointer resource = MemoryResource::Create(MemoryResource::Type::FirstTouch);
+    FloatArrayType::Pointer scoped;
+    {
+      MemoryResource::ScopedCurrent scope(resource);
+      DREAM3D_REQUIRE(MemoryResource::GetCurrent() == resource)
+      {
+        // A null resource leaves the current resource alone
+        MemoryResource::ScopedCurrent nested(MemoryResource::NullPointer());
+        DREAM3D_REQUIRE(MemoryResource::GetCurrent() == resource)
+      }
+      scoped = FloatArrayType::CreateArray(16, QString("Scoped"), true);
+
+      // Other threads are not affected
+      MemoryResource::Pointer otherThreadResource = resource;
+      std::thread otherThread([&otherThreadResource] { otherThreadResource = MemoryResource::GetCurrent(); });
+      otherThread.join();
+      DREAM3D_REQUIRE(nullptr == otherThreadResource)
+
+      // Parallel algorithms hand the resource to their workers
+      std::atomic<int32_t> mismatches(0);
+      ParallelDataAlgorithm dataAlg;
+      dataAlg.setRange(0, 100000);
+      dataAlg.execute(CheckCurrentResourceImpl(resource, &mismatches));
+      DREAM3D_REQUIRE_EQUAL(mismatches.load(), 0)
+    }
+    DREAM3D_REQUIRE(nullptr == MemoryResource::GetCurrent())
+    DREAM3D_REQUIRE(scoped->getMemoryResource() == resource)
+
+    // The array keeps its resource for later allocations
+    scoped->resizeTuples(1024);
+    DREAM3D_REQUIRE(scoped->getMemoryResource() == resource)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Creates, grows, copies and erases arrays that allocate from 'type'
+  // -----------------------------------------------------------------------------
+  template <typename T>
+  int TestArrayLifeCycle(MemoryResource::Type type, size_t numTuples)
+  {
+    MemoryResource::ScopedCurrent scope(MemoryResource::Create(type));
+
+    std::vector<size_t> cDims = {3};
+    typename DataArray<T>::Pointer array = DataArray<T>::CreateArray(numTuples, cDims, QString("Array"), true);
+    DREAM3D_REQUIRE_VALID_POINTER(array)
+    DREAM3D_REQUIRE_EQUAL(array->isAllocated(), true)
+    if(type != MemoryResource::Type::Uninitialized)
+    {
+      for(size_t i = 0; i < array->getSize(); i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(array->getValue(i), static_cast<T>(0))
+      }
+    }
+    for(size_t i = 0; i < array->getSize(); i++)
+    {
+      array->setValue(i, static_cast<T>(i % 100));
+    }
+
+    // Growing keeps the values and fills the new tuples with the initial value
+    array->setInitValue(static_cast<T>(7));
+    array->resizeTuples(numTuples + 10);
+    for(size_t i = 0; i < numTuples * 3; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(array->getValue(i), static_cast<T>(i % 100))
+    }
+    for(size_t i = numTuples * 3; i < array->getSize(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(array->getValue(i), static_cast<T>(7))
+    }
+
+    typename DataArray<T>::Pointer copy = std::dynamic_pointer_cast<DataArray<T>>(array->deepCopy());
+    DREAM3D_REQUIRE_VALID_POINTER(copy)
+    for(size_t i = 0; i < array->getSize(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(copy->getValue(i), array->getValue(i))
+    }
+
+    std::vector<size_t> erase = {0, 2, numTuples};
+    DREAM3D_REQUIRE_EQUAL(copy->eraseTuples(erase), 0)
+    DREAM3D_REQUIRE_EQUAL(copy->getNumberOfTuples(), numTuples + 7)
+    DREAM3D_REQUIRE_EQUAL(copy->getComponent(0, 0), array->getComponent(1, 0))
+    DREAM3D_REQUIRE_EQUAL(copy->getComponent(1, 2), array->getComponent(3, 2))
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestResources()
+  {
+    std::vector<MemoryResource::Type> types = {MemoryResource::Type::Default, MemoryResource::Type::Uninitialized, MemoryResource::Type::FirstTouch, MemoryResource::Type::HugePages};
+    for(MemoryResource::Type type : types)
+    {
+      // The large size crosses HugePageMemoryResource::k_HugePageSize and several pages for FirstTouch
+      for(size_t numTuples : {size_t(10), size_t(300000)})
+      {
+        int err = TestArrayLifeCycle<float>(type, numTuples);
+        DREAM3D_REQUIRE_EQUAL(err, EXIT_SUCCESS)
+        err = TestArrayLifeCycle<uint8_t>(type, numTuples);
+        DREAM3D_REQUIRE_EQUAL(err, EXIT_SUCCESS)
+        err = TestArrayLifeCycle<double>(type, numTuples);
+        DREAM3D_REQUIRE_EQUAL(err, EXIT_SUCCESS)
+      }
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestWrapPointer()
+  {
+    const size_t numValues = 1000;
+    MemoryResource::Pointer resource = MemoryResource::Create(MemoryResource::Type::HugePages);
+    auto data = static_cast<int32_t*>(resource->allocate(numValues * sizeof(int32_t), alignof(int32_t)));
+    DREAM3D_REQUIRE(nullptr != data)
+    for(size_t i = 0; i < numValues; i++)
+    {
+      data[i] = static_cast<int32_t>(i);
+    }
+
+    // The wrapped array releases 'data' through the resource when it goes away
+    std::vector<size_t> cDims = {1};
+    Int32ArrayType::Pointer wrapped = Int32ArrayType::WrapPointer(data, numValues, cDims, "Wrapped", true, resource);
+    DREAM3D_REQUIRE(wrapped->getMemoryResource() == resource)
+    DREAM3D_REQUIRE_EQUAL(wrapped->getValue(999), 999)
+    wrapped.reset();
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestConcurrentPipelines()
+  {
+    std::atomic<int32_t> arrived(0);
+    std::vector<MemoryResource::Pointer> resources = {MemoryResource::Create(MemoryResource::Type::Uninitialized), MemoryResource::Create(MemoryResource::Type::FirstTouch)};
+    std::vector<FilterPipeline::Pointer> pipelines;
+    std::vector<CreateArrayTogetherFilter::Pointer> filters;
+    for(const auto& resource : resources)
+    {
+      FilterPipeline::Pointer pipeline = FilterPipeline::New();
+      pipeline->setMemoryResource(resource);
+      CreateArrayTogetherFilter::Pointer filter = CreateArrayTogetherFilter::New(&arrived, static_cast<int32_t>(resources.size()));
+      pipeline->pushBack(filter);
+      pipelines.push_back(pipeline);
+      filters.push_back(filter);
+    }
+
+    std::vector<std::thread> threads;
+    for(const auto& pipeline : pipelines)
+    {
+      threads.emplace_back([pipeline] { pipeline->execute(DataContainerArray::New()); });
+    }
+    for(auto& thread : threads)
+    {
+      thread.join();
+    }
+
+    for(size_t i = 0; i < pipelines.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(pipelines[i]->getErrorCode(), 0)
+      FloatArrayType::Pointer array = filters[i]->getArray();
+      DREAM3D_REQUIRE_VALID_POINTER(array.get())
+      DREAM3D_REQUIRE(array->getMemoryResource() == resources[i])
+    }
+    DREAM3D_REQUIRE(nullptr == MemoryResource::GetCurrent())
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+    std::cout << "#### MemoryResourceTest Starting ####" << std::endl;
+    DREAM3D_REGISTER_TEST(TestNames())
+    DREAM3D_REGISTER_TEST(TestScopedCurrent())
+    DREAM3D_REGISTER_TEST(TestConcurrentPipelines())
+    DREAM3D_REGISTER_TEST(TestResources())
+    DREAM3D_REGISTER_TEST(TestWrapPointer())
+  }
+
+private:
+  MemoryResourceTest(const MemoryResourceTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const MemoryResourceTest&) = delete;     // Move assignment Not Implemented
+};
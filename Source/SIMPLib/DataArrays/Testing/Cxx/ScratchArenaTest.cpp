@@ -0,0 +1,324 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <QtCore/QUuid>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLRange.h"
+#include "SIMPLib/DataArrays/ScratchArena.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+namespace
+{
+/**
+ * @brief Borrows and fills one buffer per range from the given arena, or from the current arena of the worker
+ * when no arena is given
+ */
+class BorrowImpl
+{
+public:
+  BorrowImpl(ScratchArena::Pointer arena, std::vector<int32_t>& sums)
+  : m_Arena(std::move(arena))
+  , m_Sums(sums)
+  {
+  }
+  virtual ~BorrowImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      ScratchArena::Buffer<int32_t> buffer = ScratchArena::Borrow<int32_t>(nullptr != m_Arena ? m_Arena : ScratchArena::GetCurrent(), 100 + i % 7, 1);
+      int32_t sum = 0;
+      for(int32_t value : buffer)
+      {
+        sum += value;
+      }
+      m_Sums[i] = sum;
+    }
+  }
+
+private:
+  ScratchArena::Pointer m_Arena;
+  std::vector<int32_t>& m_Sums;
+};
+
+/**
+ * @brief Borrows a buffer from the current arena twice so the second borrow reuses the cached block
+ */
+class BorrowFilter : public AbstractFilter
+{
+public:
+  using Self = BorrowFilter;
+  using Pointer = std::shared_ptr<Self>;
+
+  static Pointer New()
+  {
+    Pointer sharedPtr(new BorrowFilter());
+    return sharedPtr;
+  }
+
+  QString getNameOfClass() const override
+  {
+    return QString("BorrowFilter");
+  }
+
+  QUuid getUuid() const override
+  {
+    return QUuid("{0d7f5e1a-93c4-4b2e-8a61-6f3e2c9b4d70}");
+  }
+
+  void dataCheck() override
+  {
+  }
+
+  void execute() override
+  {
+    for(int32_t i = 0; i < 2; i++)
+    {
+      ScratchArena::Buffer<float> buffer = ScratchArena::Borrow<float>(ScratchArena::GetCurrent(), 1000, 0.0f);
+    }
+  }
+
+protected:
+  BorrowFilter() = default;
+};
+} // namespace
+
+class ScratchArenaTest
+{
+public:
+  ScratchArenaTest() = default;
+  virtual ~ScratchArenaTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestSizeClasses()
+  {
+    DREAM3D_REQUIRE_EQUAL(ScratchArena::GetBlockSize(ScratchArena::GetSizeClass(1)), ScratchArena::k_MinBlockSize)
+    DREAM3D_REQUIRE_EQUAL(ScratchArena::GetBlockSize(ScratchArena::GetSizeClass(64)), 64)
+    DREAM3D_REQUIRE_EQUAL(ScratchArena::GetBlockSize(ScratchArena::GetSizeClass(65)), 128)
+    DREAM3D_REQUIRE_EQUAL(ScratchArena::GetBlockSize(ScratchArena::GetSizeClass(1000000)), 1048576)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestReuse()
+  {
+    ScratchArena::Pointer arena = ScratchArena::New();
+    void* first = nullptr;
+    {
+      ScratchArena::Buffer<float> buffer = ScratchArena::Borrow<float>(arena, 1000, 2.0f);
+      DREAM3D_REQUIRE_EQUAL(buffer.size(), 1000)
+      DREAM3D_REQUIRE_EQUAL(buffer[999], 2.0f)
+      DREAM3D_REQUIRE_EQUAL(reinterpret_cast<size_t>(buffer.data()) % ScratchArena::k_Alignment, 0)
+      first = buffer.data();
+    }
+
+    // A buffer of the same size class gets the cached block back
+    {
+      ScratchArena::Buffer<int32_t> buffer = ScratchArena::Borrow<int32_t>(arena, 900);
+      DREAM3D_REQUIRE(buffer.data() == first)
+    }
+
+    ScratchArena::Statistics stats = arena->getStatistics();
+    DREAM3D_REQUIRE_EQUAL(stats.borrowCount, 2)
+    DREAM3D_REQUIRE_EQUAL(stats.allocationCount, 1)
+    DREAM3D_REQUIRE_EQUAL(stats.bytesInUse, 0)
+    DREAM3D_REQUIRE_EQUAL(stats.bytesReserved, 4096)
+
+    // Empty buffers do not touch the arena
+    ScratchArena::Buffer<bool> empty = ScratchArena::Borrow<bool>(arena, 0);
+    DREAM3D_REQUIRE(empty.empty())
+    DREAM3D_REQUIRE(nullptr == empty.data())
+    DREAM3D_REQUIRE_EQUAL(arena->getStatistics().borrowCount, 2)
+
+    arena->trim();
+    DREAM3D_REQUIRE_EQUAL(arena->getStatistics().bytesReserved, 0)
+
+    // Trimming to a limit frees the largest cached blocks first
+    {
+      ScratchArena::Buffer<uint8_t> small = ScratchArena::Borrow<uint8_t>(arena, 1024);
+      ScratchArena::Buffer<uint8_t> large = ScratchArena::Borrow<uint8_t>(arena, 2048);
+    }
+    DREAM3D_REQUIRE_EQUAL(arena->getStatistics().bytesReserved, 3072)
+    arena->trim(1500);
+    DREAM3D_REQUIRE_EQUAL(arena->getStatistics().bytesReserved, 1024)
+    arena->trim(1024);
+    DREAM3D_REQUIRE_EQUAL(arena->getStatistics().bytesReserved, 1024)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestHighWaterMarks()
+  {
+    ScratchArena::Pointer arena = ScratchArena::New();
+    {
+      ScratchArena::Buffer<uint8_t> a = ScratchArena::Borrow<uint8_t>(arena, 1024);
+      ScratchArena::Buffer<uint8_t> b = ScratchArena::Borrow<uint8_t>(arena, 2048);
+      ScratchArena::Buffer<uint8_t> moved = std::move(b);
+      DREAM3D_REQUIRE(nullptr == b.data())
+      DREAM3D_REQUIRE_EQUAL(arena->getStatistics().bytesInUse, 3072)
+    }
+    ScratchArena::Statistics stats = arena->getStatistics();
+    DREAM3D_REQUIRE_EQUAL(stats.bytesInUse, 0)
+    DREAM3D_REQUIRE_EQUAL(stats.highWaterBytesInUse, 3072)
+    DREAM3D_REQUIRE_EQUAL(stats.highWaterBytesReserved, 3072)
+
+    arena->resetStatistics();
+    stats = arena->getStatistics();
+    DREAM3D_REQUIRE_EQUAL(stats.borrowCount, 0)
+    DREAM3D_REQUIRE_EQUAL(stats.highWaterBytesInUse, 0)
+    DREAM3D_REQUIRE_EQUAL(stats.highWaterBytesReserved, 3072)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestScopedCurrent()
+  {
+    DREAM3D_REQUIRE(nullptr == ScratchArena::GetCurrent())
+    ScratchArena::Pointer arena = ScratchArena::New();
+    {
+      ScratchArena::ScopedCurrent scope(arena);
+      DREAM3D_REQUIRE(ScratchArena::GetCurrent() == arena)
+      {
+        ScratchArena::ScopedCurrent nullScope(ScratchArena::NullPointer());
+        DREAM3D_REQUIRE(ScratchArena::GetCurrent() == arena)
+      }
+    }
+    DREAM3D_REQUIRE(nullptr == ScratchArena::GetCurrent())
+
+    // Without an arena every buffer is allocated and freed on its own
+    ScratchArena::Buffer<double> buffer = ScratchArena::Borrow<double>(ScratchArena::GetCurrent(), 10, 1.5);
+    DREAM3D_REQUIRE_EQUAL(buffer[9], 1.5)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestParallelBorrow()
+  {
+    const size_t numRanges = 10000;
+    ScratchArena::Pointer arena = ScratchArena::New();
+    std::vector<int32_t> sums(numRanges, 0);
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numRanges);
+    dataAlg.execute(BorrowImpl(arena, sums));
+
+    for(size_t i = 0; i < numRanges; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(sums[i], static_cast<int32_t>(100 + i % 7))
+    }
+    ScratchArena::Statistics stats = arena->getStatistics();
+    DREAM3D_REQUIRE_EQUAL(stats.borrowCount, numRanges)
+    DREAM3D_REQUIRE_EQUAL(stats.bytesInUse, 0)
+    DREAM3D_REQUIRE(stats.allocationCount < numRanges)
+
+    // Workers borrow from the arena that is current on the calling thread
+    ScratchArena::Pointer current = ScratchArena::New();
+    {
+      ScratchArena::ScopedCurrent scope(current);
+      dataAlg.execute(BorrowImpl(ScratchArena::NullPointer(), sums));
+    }
+    DREAM3D_REQUIRE_EQUAL(current->getStatistics().borrowCount, numRanges)
+    DREAM3D_REQUIRE_EQUAL(sums[numRanges - 1], static_cast<int32_t>(100 + (numRanges - 1) % 7))
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  // The pipeline keeps its cached blocks across runs up to the retain limit
+  // -----------------------------------------------------------------------------
+  int TestPipelineRetain()
+  {
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    pipeline->pushBack(BorrowFilter::New());
+    DREAM3D_REQUIRE_EQUAL(pipeline->getScratchRetainLimit(), FilterPipeline::k_DefaultScratchRetainLimit)
+    pipeline->execute(DataContainerArray::New());
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCode(), 0)
+
+    ScratchArena::Statistics stats = pipeline->getScratchArena()->getStatistics();
+    DREAM3D_REQUIRE_EQUAL(stats.borrowCount, 2)
+    DREAM3D_REQUIRE_EQUAL(stats.allocationCount, 1)
+    DREAM3D_REQUIRE_EQUAL(stats.bytesReserved, 4096)
+
+    // The second run reuses the block cached by the first one
+    pipeline->execute(DataContainerArray::New());
+    stats = pipeline->getScratchArena()->getStatistics();
+    DREAM3D_REQUIRE_EQUAL(stats.borrowCount, 2)
+    DREAM3D_REQUIRE_EQUAL(stats.allocationCount, 0)
+
+    pipeline->setScratchRetainLimit(0);
+    pipeline->execute(DataContainerArray::New());
+    stats = pipeline->getScratchArena()->getStatistics();
+    DREAM3D_REQUIRE(stats.highWaterBytesReserved > 0)
+    DREAM3D_REQUIRE_EQUAL(stats.bytesReserved, 0)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+    std::cout << "#### ScratchArenaTest Starting ####" << std::endl;
+    DREAM3D_REGISTER_TEST(TestSizeClasses())
+    DREAM3D_REGISTER_TEST(TestReuse())
+    DREAM3D_REGISTER_TEST(TestHighWaterMarks())
+    DREAM3D_REGISTER_TEST(TestScopedCurrent())
+    DREAM3D_REGISTER_TEST(TestParallelBorrow())
+    DREAM3D_REGISTER_TEST(TestPipelineRetain())
+  }
+
+private:
+  ScratchArenaTest(const ScratchArenaTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const ScratchArenaTest&) = delete;   // Move assignment Not Implemented
+};
@@ -1,6 +1,10 @@
 
 set(TEST_${SUBDIR_NAME}_NAMES
+  BitArrayTest
+  ComponentViewArrayTest
   DataArrayTest
+  MemoryResourceTest
+  ScratchArenaTest
   StringDataArrayTest
   StructArrayTest
 )
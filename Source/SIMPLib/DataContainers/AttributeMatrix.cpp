@@ -36,6 +36,7 @@
 #include "SIMPLib/DataContainers/AttributeMatrix.h"
 
 // C++ Includes
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 
@@ -49,6 +50,7 @@
 #include <QtCore/QTextStream>
 
 // DREAM3D Includes
+#include "SIMPLib/DataArrays/ComponentViewArray.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataArrays/StatsDataArray.h"
 #include "SIMPLib/DataContainers/AttributeMatrixProxy.h"
@@ -56,6 +58,7 @@
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/HDF5/VTKH5Constants.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
 #include "SIMPLib/Utilities/STLUtilities.hpp"
 
@@ -324,6 +327,8 @@ IDataArray::Pointer AttributeMatrix::removeAttributeArray(const QString& name)
     return IDataArray::NullPointer();
   }
   IDataArray::Pointer p = (*it);
+  // Views of the removed array must not follow whatever the caller does with it next
+  p->detachDependentViews();
   erase(it);
   return p;
 }
@@ -402,6 +407,84 @@ size_t AttributeMatrix::getNumberOfTuples() const
   return numTuples;
 }
 
+namespace
+{
+/**
+ * @brief Materializes the component views among 'arrays', one after the other. A view usually sits next to the
+ * array it reads, so it has to copy its values before any array of the matrix is compacted or resized.
+ */
+void DetachComponentViews(const std::vector<IDataArray::Pointer>& arrays)
+{
+  for(const auto& array : arrays)
+  {
+    if(ComponentViewArray::Pointer view = std::dynamic_pointer_cast<ComponentViewArray>(array))
+    {
+      view->detach();
+    }
+  }
+}
+
+/**
+ * @brief The EraseTuplesImpl class removes the same tuples from a range of arrays and stores the result of
+ * every eraseTuples() call at the index of its array
+ */
+class EraseTuplesImpl
+{
+public:
+  EraseTuplesImpl(const std::vector<IDataArray::Pointer>& arrays, const std::vector<size_t>& removeList, std::vector<int32_t>& errors)
+  : m_Arrays(arrays)
+  , m_RemoveList(removeList)
+  , m_Errors(errors)
+  {
+  }
+  virtual ~EraseTuplesImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      m_Errors[i] = m_Arrays[i]->eraseTuples(m_RemoveList);
+    }
+  }
+
+private:
+  const std::vector<IDataArray::Pointer>& m_Arrays;
+  const std::vector<size_t>& m_RemoveList;
+  std::vector<int32_t>& m_Errors;
+};
+
+/**
+ * @brief The RenumberFeatureIdsImpl class maps a range of Feature Ids through a lookup table
+ */
+class RenumberFeatureIdsImpl
+{
+public:
+  RenumberFeatureIdsImpl(int32_t* featureIds, const std::vector<size_t>& newNames)
+  : m_FeatureIds(featureIds)
+  , m_NewNames(newNames)
+  {
+  }
+  virtual ~RenumberFeatureIdsImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    size_t numNames = m_NewNames.size();
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      int32_t featureId = m_FeatureIds[i];
+      if(featureId >= 0 && static_cast<size_t>(featureId) < numNames)
+      {
+        m_FeatureIds[i] = static_cast<int32_t>(m_NewNames[featureId]);
+      }
+    }
+  }
+
+private:
+  int32_t* m_FeatureIds = nullptr;
+  const std::vector<size_t>& m_NewNames;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -438,32 +521,37 @@ bool AttributeMatrix::removeInactiveObjects(const QVector<bool>& activeObjects,
 
     if(!removeList.empty())
     {
-      QList<QString> headers = getAttributeArrayNames();
-      for(const auto& header : headers)
+      // Every array, NeighborLists included, is compacted with the same remove list.
+      // The arrays are independent of each other so they are compacted concurrently.
+      const ChildCollection& arrays = getChildren();
+      // An array with a different number of tuples would reject the remove list after the others were compacted
+      for(const auto& array : arrays)
       {
-        IDataArray::Pointer p = getAttributeArray(header);
-        QString type = p->getTypeAsString();
-        if(type.compare("NeighborList<T>") == 0)
-        {
-          removeAttributeArray(header);
-        }
-        else
+        if(array->getNumberOfTuples() != totalTuples)
         {
-          p->eraseTuples(removeList);
+          return false;
         }
       }
+
+      DetachComponentViews(arrays);
+      std::vector<int32_t> errors(arrays.size(), 0);
+      ParallelDataAlgorithm eraseAlg;
+      eraseAlg.setRange(0, arrays.size());
+      eraseAlg.execute(EraseTuplesImpl(arrays, removeList, errors));
+      if(std::any_of(errors.begin(), errors.end(), [](int32_t error) { return error < 0; }))
+      {
+        return false;
+      }
+
       std::vector<size_t> tDims(1, (totalTuples - removeList.size()));
       setTupleDimensions(tDims);
 
       // Loop over all the points and correct all the feature names
-      size_t totalPoints = featureIds->getNumberOfTuples();
-      int32_t* featureIdPtr = featureIds->getPointer(0);
-      for(size_t i = 0; i < totalPoints; i++)
+      if(nullptr != featureIds)
       {
-        if(featureIdPtr[i] >= 0 && featureIdPtr[i] < newNames.size())
-        {
-          featureIdPtr[i] = static_cast<int32_t>(newNames[featureIdPtr[i]]);
-        }
+        ParallelDataAlgorithm renumberAlg;
+        renumberAlg.setRange(0, featureIds->getNumberOfTuples());
+        renumberAlg.execute(RenumberFeatureIdsImpl(featureIds->getPointer(0), newNames));
       }
     }
   }
@@ -487,6 +575,7 @@ void AttributeMatrix::resizeAttributeArrays(const std::vector<size_t>& tDims)
   }
 
   const AttributeMatrix::Container_t& dataArrays = getChildren();
+  DetachComponentViews(dataArrays);
   for(const auto& dataArray : dataArrays)
   {
     dataArray->resizeTuples(numTuples);
@@ -498,6 +587,10 @@ void AttributeMatrix::resizeAttributeArrays(const std::vector<size_t>& tDims)
 // -----------------------------------------------------------------------------
 void AttributeMatrix::clearAttributeArrays()
 {
+  for(const auto& dataArray : getChildren())
+  {
+    dataArray->detachDependentViews();
+  }
   clear();
 }
 
@@ -585,6 +678,14 @@ int AttributeMatrix::addAttributeArrayFromHDF5Path(hid_t gid, const QString& nam
       dPtr->resizeTuples(getNumberOfTuples());
     }
   }
+  else if(classType.compare("BitArray") == 0)
+  {
+    dPtr = H5DataArrayReader::ReadBitArray(gid, name, preflight);
+    if(preflight && nullptr != dPtr.get())
+    {
+      dPtr->resizeTuples(getNumberOfTuples());
+    }
+  }
   else if(classType.compare("vector") == 0)
   {
   }
@@ -642,6 +743,10 @@ int AttributeMatrix::readAttributeArraysFromHDF5(hid_t amGid, bool preflight, At
     {
       dPtr = H5DataArrayReader::ReadStringDataArray(amGid, daToRead.getName(), preflight);
     }
+    else if(classType.compare("BitArray") == 0)
+    {
+      dPtr = H5DataArrayReader::ReadBitArray(amGid, daToRead.getName(), preflight);
+    }
     else if(classType.compare("vector") == 0)
     {
     }
@@ -976,9 +1081,28 @@ bool AttributeMatrix::addOrReplaceAttributeArray(const IDataArrayShPtrType& data
     qDebug() << "getNumberOfTuples(): " << getNumberOfTuples() << "  data->getNumberOfTuples(): " << data->getNumberOfTuples();
   }
   Q_ASSERT(getNumberOfTuples() == data->getNumberOfTuples());
+  IDataArray::Pointer replaced = getAttributeArray(data->getName());
+  if(nullptr != replaced && replaced != data)
+  {
+    replaced->detachDependentViews();
+  }
   return insertOrAssign(data);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer AttributeMatrix::getDetachedViewSource(const IDataArray::Pointer& array)
+{
+  ComponentViewArray::Pointer view = std::dynamic_pointer_cast<ComponentViewArray>(array);
+  if(nullptr == view)
+  {
+    return IDataArray::NullPointer();
+  }
+  view->detach();
+  return view->getSourceArray();
+}
+
 IDataArrayShPtrType AttributeMatrix::getAttributeArray(const QString& name) const
 {
   return getChildByName(name);
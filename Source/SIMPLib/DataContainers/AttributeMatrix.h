@@ -366,6 +366,10 @@ public:
 
     IDataArrayShPtrType iDataArray = getAttributeArray(attributeArrayName);
     attributeArray = std::dynamic_pointer_cast<ArrayType>(iDataArray);
+    if(nullptr == attributeArray.get())
+    {
+      attributeArray = std::dynamic_pointer_cast<ArrayType>(getDetachedViewSource(iDataArray));
+    }
     if(nullptr == attributeArray.get() && filter)
     {
       ss = QObject::tr("The AttributeMatrix named '%1' contains an array with name '%2' but the DataArray could not be downcast using std::dynamic_pointer_cast<T>.")
@@ -492,6 +496,10 @@ public:
     IDataArrayShPtrType ida = getAttributeArray(arrayName);
     typename ArrayType::Pointer targetDestArray = std::dynamic_pointer_cast<ArrayType>(ida);
     if(targetDestArray.get() == nullptr)
+    {
+      targetDestArray = std::dynamic_pointer_cast<ArrayType>(getDetachedViewSource(ida));
+    }
+    if(targetDestArray.get() == nullptr)
     {
       if(nullptr != filter)
       {
@@ -559,8 +567,17 @@ public:
 
   /**
   * @brief Removes inactive objects from the Attribute Matrix and renumbers the active objects to preserve a compact matrix
-    (only valid for feature or ensemble type matrices)
-  * @param size The new size of the array
+    (only valid for feature or ensemble type matrices). All arrays, including NeighborLists, are compacted concurrently
+    with the same remove list.
+
+    NeighborList values are NOT renumbered: the lists of the kept objects are moved to their new tuples, but lists that
+    store Feature Ids (e.g. neighbor Ids) still hold the old Ids and may refer to removed objects. Callers that keep
+    such lists must remap them, or delete them and recompute them.
+  * @param activeObjects Flags for each tuple; tuple 0 is always kept
+  * @param featureIds The Feature Ids to renumber, or nullptr
+  * @return false if the matrix type or the number of flags is not acceptable, if an array does not have the number
+    of tuples of the matrix (nothing is changed), or if an array fails to erase its tuples. In the last case the
+    other arrays may already be compacted while the tuple dimensions and the Feature Ids are left unchanged.
   */
   bool removeInactiveObjects(const QVector<bool>& activeObjects, DataArray<int32_t>* featureIds);
 
@@ -673,6 +690,14 @@ private:
   std::vector<size_t> m_TupleDims;
   AttributeMatrix::Type m_Type = {};
 
+  /**
+   * @brief Materializes 'array' if it is a ComponentViewArray and returns the contiguous array the view forwards
+   * to from then on, so code asking for a DataArray<T> can use the view. Returns nullptr for any other array.
+   * @param array
+   * @return
+   */
+  static IDataArray::Pointer getDetachedViewSource(const IDataArray::Pointer& array);
+
   AttributeMatrix(const AttributeMatrix&);
   void operator=(const AttributeMatrix&);
 };
@@ -226,6 +226,33 @@ public:
     return m_DataArrayName;
   }
 
+  /**
+   * @brief Returns the hash of the DataContainer name, computed like IDataStructureNode::getNameHash(). Empty names hash to 0.
+   * @return
+   */
+  HashType getDataContainerHash() const
+  {
+    return m_DataContainerHash;
+  }
+
+  /**
+   * @brief Returns the hash of the AttributeMatrix name, computed like IDataStructureNode::getNameHash(). Empty names hash to 0.
+   * @return
+   */
+  HashType getAttributeMatrixHash() const
+  {
+    return m_AttributeMatrixHash;
+  }
+
+  /**
+   * @brief Returns the hash of the DataArray name, computed like IDataStructureNode::getNameHash(). Empty names hash to 0.
+   * @return
+   */
+  HashType getDataArrayHash() const
+  {
+    return m_DataArrayHash;
+  }
+
   /**
    * @brief Sets the DataContainer name and updates the hash
    * @param name
@@ -250,8 +250,7 @@ DataContainer::Pointer DataContainerArray::getDataContainer(const QString& name)
 // -----------------------------------------------------------------------------
 DataContainer::Pointer DataContainerArray::getDataContainer(const DataArrayPath& path) const
 {
-  QString dcName = path.getDataContainerName();
-  return getDataContainer(dcName);
+  return resolvePath(path, DataArrayPathHelper::DataType::DataContainer).dataContainer;
 }
 
 // -----------------------------------------------------------------------------
@@ -259,13 +258,76 @@ DataContainer::Pointer DataContainerArray::getDataContainer(const DataArrayPath&
 // -----------------------------------------------------------------------------
 AttributeMatrix::Pointer DataContainerArray::getAttributeMatrix(const DataArrayPath& path) const
 {
-  DataContainer::Pointer dc = getDataContainer(path);
-  if(nullptr == dc.get())
+  return resolvePath(path, DataArrayPathHelper::DataType::AttributeMatrix).attributeMatrix;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArrayShPtrType DataContainerArray::getAttributeArray(const DataArrayPath& path) const
+{
+  return resolvePath(path, DataArrayPathHelper::DataType::DataArray).dataArray;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t DataContainerArray::PathHash::operator()(const DataArrayPath& path) const
+{
+  size_t hash = path.getDataContainerHash();
+  hash ^= path.getAttributeMatrixHash() + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  hash ^= path.getDataArrayHash() + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  return hash;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArray::ResolvedPath DataContainerArray::resolvePath(const DataArrayPath& path, DataArrayPathHelper::DataType depth) const
+{
+  ResolvedPath resolved;
+  if(path.getDataContainerName().isEmpty())
   {
-    return AttributeMatrix::NullPointer();
+    return resolved;
+  }
+
+  std::lock_guard<std::mutex> lock(m_PathCacheMutex);
+  if(m_PathCacheRevision != getStructureRevision())
+  {
+    m_PathCache.clear();
+    m_PathCacheRevision = getStructureRevision();
+  }
+  PathCacheEntry& entry = m_PathCache[path];
+
+  resolved.dataContainer = entry.dataContainer.lock();
+  if(nullptr == resolved.dataContainer)
+  {
+    resolved.dataContainer = getChildByNameHash(path.getDataContainerHash());
+    entry.dataContainer = resolved.dataContainer;
+  }
+  if(nullptr == resolved.dataContainer || depth == DataArrayPathHelper::DataType::DataContainer || path.getAttributeMatrixName().isEmpty())
+  {
+    return resolved;
+  }
+
+  resolved.attributeMatrix = entry.attributeMatrix.lock();
+  if(nullptr == resolved.attributeMatrix)
+  {
+    resolved.attributeMatrix = resolved.dataContainer->getChildByNameHash(path.getAttributeMatrixHash());
+    entry.attributeMatrix = resolved.attributeMatrix;
+  }
+  if(nullptr == resolved.attributeMatrix || depth == DataArrayPathHelper::DataType::AttributeMatrix || path.getDataArrayName().isEmpty())
+  {
+    return resolved;
   }
 
-  return dc->getAttributeMatrix(path.getAttributeMatrixName());
+  resolved.dataArray = entry.dataArray.lock();
+  if(nullptr == resolved.dataArray)
+  {
+    resolved.dataArray = resolved.attributeMatrix->getChildByNameHash(path.getDataArrayHash());
+    entry.dataArray = resolved.dataArray;
+  }
+  return resolved;
 }
 
 // -----------------------------------------------------------------------------
@@ -384,7 +446,7 @@ int DataContainerArray::readDataContainersFromHDF5(bool preflight, hid_t dcaGid,
 // -----------------------------------------------------------------------------
 bool DataContainerArray::doesDataContainerExist(const DataArrayPath& dap) const
 {
-  return contains(dap.getDataContainerName());
+  return nullptr != getDataContainer(dap);
 }
 
 // -----------------------------------------------------------------------------
@@ -400,13 +462,7 @@ bool DataContainerArray::doesDataContainerExist(const QString& name) const
 // -----------------------------------------------------------------------------
 bool DataContainerArray::doesAttributeMatrixExist(const DataArrayPath& path) const
 {
-  if(!doesDataContainerExist(path.getDataContainerName()))
-  {
-    return false;
-  }
-
-  DataContainer::Pointer dc = getDataContainer(path);
-  return dc->doesAttributeMatrixExist(path.getAttributeMatrixName());
+  return nullptr != getAttributeMatrix(path);
 }
 
 // -----------------------------------------------------------------------------
@@ -414,17 +470,7 @@ bool DataContainerArray::doesAttributeMatrixExist(const DataArrayPath& path) con
 // -----------------------------------------------------------------------------
 bool DataContainerArray::doesAttributeArrayExist(const DataArrayPath& path) const
 {
-  if(!doesDataContainerExist(path.getDataContainerName()))
-  {
-    return false;
-  }
-  if(!doesAttributeMatrixExist(path))
-  {
-    return false;
-  }
-  AttributeMatrix::Pointer attrMat = getAttributeMatrix(path);
-
-  return attrMat->doesAttributeArrayExist(path.getDataArrayName());
+  return nullptr != getAttributeArray(path);
 }
 
 // -----------------------------------------------------------------------------
@@ -923,24 +969,21 @@ IDataArray::Pointer DataContainerArray::getPrereqIDataArrayFromPath(AbstractFilt
   QString amName = path.getAttributeMatrixName();
   QString daName = path.getDataArrayName();
 
-  DataContainerShPtr dc = getDataContainer(dcName);
-  if(nullptr == dc.get())
-  {
-    if(filter)
-    {
-      ss = QObject::tr("The DataContainer '%1' was not found in the DataContainerArray").arg(dcName);
-      filter->setErrorCondition(-999, ss);
-    }
-    return dataArray;
-  }
-
-  AttributeMatrix::Pointer attrMat = dc->getAttributeMatrix(amName);
+  AttributeMatrix::Pointer attrMat = getAttributeMatrix(path);
   if(nullptr == attrMat.get())
   {
     if(filter)
     {
-      ss = QObject::tr("The AttributeMatrix '%1' was not found in the DataContainer '%2'").arg(amName).arg(dcName);
-      filter->setErrorCondition(-307020, ss);
+      if(nullptr == getDataContainer(path))
+      {
+        ss = QObject::tr("The DataContainer '%1' was not found in the DataContainerArray").arg(dcName);
+        filter->setErrorCondition(-999, ss);
+      }
+      else
+      {
+        ss = QObject::tr("The AttributeMatrix '%1' was not found in the DataContainer '%2'").arg(amName).arg(dcName);
+        filter->setErrorCondition(-307020, ss);
+      }
     }
     return dataArray;
   }
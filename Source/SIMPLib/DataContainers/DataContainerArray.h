@@ -35,6 +35,8 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 
 #include <cstddef> // for nullptr
 
@@ -237,6 +239,13 @@ public:
    */
   virtual AttributeMatrix::Pointer getAttributeMatrix(const DataArrayPath& path) const;
 
+  /**
+   * @brief Returns the IDataArray at the given path or nullptr if it does not exist
+   * @param path
+   * @return
+   */
+  IDataArrayShPtrType getAttributeArray(const DataArrayPath& path) const;
+
   /**
    * @brief printDataContainerNames
    * @param out
@@ -488,24 +497,21 @@ public:
     QString amName = path.getAttributeMatrixName();
     QString daName = path.getDataArrayName();
 
-    DataContainerShPtr dc = getDataContainer(dcName);
-    if(nullptr == dc.get())
-    {
-      if(filter)
-      {
-        ss = QObject::tr("The DataContainer '%1' was not found in the DataContainerArray").arg(dcName);
-        filter->setErrorCondition(-80002, ss);
-      }
-      return dataArray;
-    }
-
-    AttributeMatrix::Pointer attrMat = dc->getAttributeMatrix(amName);
+    AttributeMatrix::Pointer attrMat = getAttributeMatrix(path);
     if(nullptr == attrMat.get())
     {
       if(filter)
       {
-        ss = QObject::tr("The AttributeMatrix '%1' was not found in the DataContainer '%2'").arg(amName).arg(dcName);
-        filter->setErrorCondition(-80003, ss);
+        if(nullptr == getDataContainer(path))
+        {
+          ss = QObject::tr("The DataContainer '%1' was not found in the DataContainerArray").arg(dcName);
+          filter->setErrorCondition(-80002, ss);
+        }
+        else
+        {
+          ss = QObject::tr("The AttributeMatrix '%1' was not found in the DataContainer '%2'").arg(amName).arg(dcName);
+          filter->setErrorCondition(-80003, ss);
+        }
       }
       return dataArray;
     }
@@ -593,24 +599,21 @@ public:
       return dataArray;
     }
 
-    DataContainerShPtr dc = getDataContainer(path.getDataContainerName());
-    if(nullptr == dc.get())
-    {
-      if(filter)
-      {
-        ss = QObject::tr("The DataContainer '%1' was not found in the DataContainerArray").arg(path.getDataContainerName());
-        filter->setErrorCondition(-80002, ss);
-      }
-      return dataArray;
-    }
-
-    AttributeMatrix::Pointer attrMat = dc->getAttributeMatrix(path.getAttributeMatrixName());
+    AttributeMatrix::Pointer attrMat = getAttributeMatrix(path);
     if(nullptr == attrMat.get())
     {
       if(filter)
       {
-        ss = QObject::tr("The AttributeMatrix '%1' was not found in the DataContainer '%2'").arg(path.getAttributeMatrixName()).arg(path.getDataContainerName());
-        filter->setErrorCondition(-80003, ss);
+        if(nullptr == getDataContainer(path))
+        {
+          ss = QObject::tr("The DataContainer '%1' was not found in the DataContainerArray").arg(path.getDataContainerName());
+          filter->setErrorCondition(-80002, ss);
+        }
+        else
+        {
+          ss = QObject::tr("The AttributeMatrix '%1' was not found in the DataContainer '%2'").arg(path.getAttributeMatrixName()).arg(path.getDataContainerName());
+          filter->setErrorCondition(-80003, ss);
+        }
       }
       return dataArray;
     }
@@ -668,6 +671,43 @@ private:
   QMap<QString, IDataContainerBundle::Pointer> m_DataContainerBundles;
   MontageCollection m_MontageCollection;
 
+  /**
+   * @brief The nodes a DataArrayPath resolved to. Only the levels named by the path are set.
+   */
+  struct ResolvedPath
+  {
+    DataContainerShPtr dataContainer;
+    AttributeMatrix::Pointer attributeMatrix;
+    IDataArrayShPtrType dataArray;
+  };
+
+  struct PathCacheEntry
+  {
+    std::weak_ptr<DataContainer> dataContainer;
+    std::weak_ptr<AttributeMatrix> attributeMatrix;
+    std::weak_ptr<IDataArray> dataArray;
+  };
+
+  struct PathHash
+  {
+    size_t operator()(const DataArrayPath& path) const;
+  };
+
+  // Paths resolved since the structure revision m_PathCacheRevision. Every added, removed or renamed
+  // node below this DataContainerArray advances the revision and so invalidates the whole cache.
+  mutable std::mutex m_PathCacheMutex;
+  mutable std::unordered_map<DataArrayPath, PathCacheEntry, PathHash> m_PathCache;
+  mutable uint64_t m_PathCacheRevision = 0;
+
+  /**
+   * @brief Resolves the names of 'path' down to 'depth' through the path cache. Lookups use the name
+   * hashes the DataArrayPath already holds, so resolving does not hash any strings.
+   * @param path
+   * @param depth DataContainer, AttributeMatrix or DataArray
+   * @return
+   */
+  ResolvedPath resolvePath(const DataArrayPath& path, DataArrayPathHelper::DataType depth) const;
+
   /**
    * @brief setMontageTileFromDataContainerName
    * @param row
@@ -38,6 +38,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "IDataStructureNode.h"
@@ -60,8 +61,61 @@ public:
 
 private:
   ChildCollection m_ChildrenNodes;
+  // Position of every child in m_ChildrenNodes by the hash of its name. Children must not be replaced
+  // through the iterators or operator[], which would bypass it.
+  std::unordered_map<HashType, size_t> m_ChildIndex;
+
+  /**
+   * @brief Returns the position of the child with the given name hash, or size() if there is none.
+   * @param nameHash
+   * @return
+   */
+  size_t findIndex(HashType nameHash) const
+  {
+    auto iter = m_ChildIndex.find(nameHash);
+    if(iter == m_ChildIndex.end())
+    {
+      return m_ChildrenNodes.size();
+    }
+    return iter->second;
+  }
+
+  /**
+   * @brief Removes the child at the given position and moves the index entries of the children behind it.
+   * @param index
+   * @return The removed child
+   */
+  ChildShPtr eraseAt(size_t index)
+  {
+    ChildShPtr child = m_ChildrenNodes[index];
+    m_ChildIndex.erase(child->getNameHash());
+    m_ChildrenNodes.erase(m_ChildrenNodes.begin() + index);
+    for(size_t i = index; i < m_ChildrenNodes.size(); i++)
+    {
+      m_ChildIndex[m_ChildrenNodes[i]->getNameHash()] = i;
+    }
+    structureChanged();
+    return child;
+  }
 
 protected:
+  /**
+   * @brief Moves the index entry of a renamed child to its new name.
+   * @param child
+   * @param oldNameHash
+   */
+  void updateChildName(const IDataStructureNode* child, HashType oldNameHash) override
+  {
+    size_t index = findIndex(oldNameHash);
+    if(index == m_ChildrenNodes.size() || m_ChildrenNodes[index].get() != child)
+    {
+      return;
+    }
+    m_ChildIndex.erase(oldNameHash);
+    m_ChildIndex[child->getNameHash()] = index;
+    structureChanged();
+  }
+
 public:
   IDataStructureContainerNode(const QString& name = "")
   : AbstractDataStructureContainer(name)
@@ -211,14 +265,17 @@ public:
   constexpr void clear() noexcept
   {
     auto children = getChildren();
-    for(auto& child : children)
+    // Back to front so each child is removed from the end of the collection
+    for(auto iter = children.rbegin(); iter != children.rend(); ++iter)
     {
-      if(child != nullptr)
+      if(*iter != nullptr)
       {
-        destroyParentConnection(child.get());
+        destroyParentConnection(iter->get());
       }
     }
     m_ChildrenNodes.clear();
+    m_ChildIndex.clear();
+    structureChanged();
   }
 
   /**
@@ -229,16 +286,7 @@ public:
    */
   constexpr iterator find(const QString& name)
   {
-    const auto hash = CreateStringHash(name);
-    for(auto iter = begin(); iter != end(); iter++)
-    {
-      if((*iter)->checkNameHash(hash))
-      {
-        return iter;
-      }
-    }
-
-    return end();
+    return begin() + findIndex(CreateStringHash(name));
   }
 
   /**
@@ -249,16 +297,7 @@ public:
    */
   constexpr const_iterator find(const QString& name) const
   {
-    const auto hash = CreateStringHash(name);
-    for(auto iter = begin(); iter != end(); iter++)
-    {
-      if((*iter)->checkNameHash(hash))
-      {
-        return iter;
-      }
-    }
-
-    return cend();
+    return cbegin() + findIndex(CreateStringHash(name));
   }
 
   /**
@@ -269,17 +308,23 @@ public:
    */
   constexpr ChildShPtr getChildByName(const QString& name) const
   {
-    HashType nameHash = CreateStringHash(name);
+    return getChildByNameHash(CreateStringHash(name));
+  }
 
-    const auto& children = getChildren();
-    for(const auto& child : children)
+  /**
+   * @brief Returns the child whose name has the given hash as a shared_ptr.
+   * If no child is found, return nullptr.
+   * @param nameHash
+   * @return
+   */
+  ChildShPtr getChildByNameHash(HashType nameHash) const
+  {
+    size_t index = findIndex(nameHash);
+    if(index == m_ChildrenNodes.size())
     {
-      if(child->checkNameHash(nameHash))
-      {
-        return child;
-      }
+      return nullptr;
     }
-    return nullptr;
+    return m_ChildrenNodes[index];
   }
 
   /**
@@ -301,15 +346,12 @@ public:
    */
   constexpr bool contains(const ChildShPtr& obj) const
   {
-    const auto& children = getChildren();
-    for(const auto& child : children)
+    if(nullptr == obj)
     {
-      if(child == obj)
-      {
-        return true;
-      }
+      return false;
     }
-    return false;
+    size_t index = findIndex(obj->getNameHash());
+    return index != m_ChildrenNodes.size() && m_ChildrenNodes[index] == obj;
   }
 
   /**
@@ -385,6 +427,8 @@ public:
     }
     typename ChildCollection::size_type size = m_ChildrenNodes.size();
     m_ChildrenNodes.push_back(node);
+    m_ChildIndex[node->getNameHash()] = size;
+    structureChanged();
 
     createParentConnection(node.get(), this);
     return (size != m_ChildrenNodes.size());
@@ -417,7 +461,9 @@ public:
       }
     }
 
+    m_ChildIndex[node->getNameHash()] = m_ChildrenNodes.size();
     m_ChildrenNodes.push_back(node);
+    structureChanged();
     createParentConnection(node.get(), this);
     return true;
   }
@@ -428,8 +474,7 @@ public:
    */
   void erase(iterator iter)
   {
-    ChildShPtr child = (*iter);
-    m_ChildrenNodes.erase(iter);
+    ChildShPtr child = eraseAt(static_cast<size_t>(iter - begin()));
     destroyParentConnection(child.get());
   }
 
@@ -445,16 +490,12 @@ public:
       return NullPointer();
     }
 
-    for(auto iter = m_ChildrenNodes.begin(); iter != m_ChildrenNodes.end(); ++iter)
+    size_t index = findIndex(rmChild->getNameHash());
+    if(index == m_ChildrenNodes.size() || m_ChildrenNodes[index].get() != rmChild)
     {
-      if((*iter).get() == rmChild)
-      {
-        ChildShPtr ptr = *iter;
-        m_ChildrenNodes.erase(iter);
-        return ptr;
-      }
+      return NullPointer();
     }
 
-    return NullPointer();
+    return eraseAt(index);
   }
 };
@@ -112,8 +112,10 @@ bool IDataStructureNode::setName(const QString& newName)
   }
   else if(!m_Parent->hasChildWithName(newName))
   {
+    HashType oldNameHash = m_NameHash;
     m_Name = newName;
     updateNameHash();
+    m_Parent->updateChildName(this, oldNameHash);
     return true;
   }
 
@@ -187,6 +189,17 @@ void AbstractDataStructureContainer::destroyParentConnection(IDataStructureNode*
   child->clearParentNode();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AbstractDataStructureContainer::structureChanged()
+{
+  for(AbstractDataStructureContainer* container = this; nullptr != container; container = container->getParentNode())
+  {
+    container->m_StructureRevision++;
+  }
+}
+
 // -----------------------------------------------------------------------------
 IDataStructureNode::Pointer IDataStructureNode::NullPointer()
 {
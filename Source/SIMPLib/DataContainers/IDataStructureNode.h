@@ -33,6 +33,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <sstream>
 #include <stdexcept>
@@ -134,6 +135,15 @@ public:
     return m_NameHash == nameHash;
   }
 
+  /**
+   * @brief Returns the hash of the node's name. DataArrayPath hashes its names the same way.
+   * @return
+   */
+  HashType getNameHash() const
+  {
+    return m_NameHash;
+  }
+
   /**
    * @brief Returns the node's name.
    * @return
@@ -183,6 +193,8 @@ public:
  */
 class SIMPLib_EXPORT AbstractDataStructureContainer : public IDataStructureNode
 {
+  friend IDataStructureNode;
+
 public:
   AbstractDataStructureContainer(const QString& name = "")
   : IDataStructureNode(name)
@@ -209,7 +221,29 @@ public:
    */
   virtual IDataStructureNode::Pointer removeChildNode(const IDataStructureNode* rmChild) = 0;
 
+  /**
+   * @brief Returns a counter that changes whenever a child is added, removed or renamed anywhere below this
+   * container. Caches of resolved paths compare it to find out whether they are still valid.
+   * @return
+   */
+  uint64_t getStructureRevision() const
+  {
+    return m_StructureRevision;
+  }
+
 protected:
+  /**
+   * @brief Updates the container after 'child' was renamed from a name with the hash 'oldNameHash'.
+   * @param child
+   * @param oldNameHash
+   */
+  virtual void updateChildName(const IDataStructureNode* child, HashType oldNameHash) = 0;
+
+  /**
+   * @brief Advances the structure revision of this container and of all of its ancestors.
+   */
+  void structureChanged();
+
   /**
    * @brief Sets the child's parent container.  This does not add the child to the parent's collection.
    * THIS METHOD IS ONLY USED BY IDataStructureNode<T> AND SHOULD NOT BE USED BY ANY CLASS THAT DERIVES FROM IT.
@@ -224,4 +258,7 @@ protected:
    * @param child
    */
   void destroyParentConnection(IDataStructureNode* child) const;
+
+private:
+  uint64_t m_StructureRevision = 0;
 };
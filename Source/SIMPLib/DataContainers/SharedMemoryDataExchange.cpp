@@ -0,0 +1,932 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "SharedMemoryDataExchange.h"
+
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <new>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define SIMPL_POSIX_SHARED_MEMORY
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QObject>
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/ComponentViewArray.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/MemoryResource.h"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Geometry/EdgeGeom.h"
+#include "SIMPLib/Geometry/HexahedralGeom.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Geometry/QuadGeom.h"
+#include "SIMPLib/Geometry/RectGridGeom.h"
+#include "SIMPLib/Geometry/TetrahedralGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Geometry/VertexGeom.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void setErrorMessage(QString* errorMessage, const QString& message)
+{
+  if(nullptr != errorMessage)
+  {
+    *errorMessage = message;
+  }
+}
+
+#ifdef SIMPL_POSIX_SHARED_MEMORY
+const char k_Magic[8] = {'S', 'I', 'M', 'P', 'L', 'S', 'H', 'M'};
+
+/**
+ * @brief First bytes of every segment. The array buffers start right behind it.
+ */
+struct SegmentHeader
+{
+  char magic[8];
+  uint32_t formatVersion;
+  uint32_t headerSize;
+  uint64_t totalSize;
+  uint64_t descriptorOffset;
+  uint64_t descriptorSize;
+  uint8_t reserved[24];
+};
+static_assert(sizeof(SegmentHeader) == SharedMemoryDataExchange::k_Alignment, "The array buffers must start aligned behind the header");
+
+// JSON numbers are doubles, which hold every integer up to 2^53 exactly
+constexpr double k_MaxJsonInteger = 9007199254740992.0;
+
+namespace Keys
+{
+const QString FormatVersion("FormatVersion");
+const QString DataContainers("DataContainers");
+const QString Name("Name");
+const QString Geometry("Geometry");
+const QString Type("Type");
+const QString Dimensions("Dimensions");
+const QString Spacing("Spacing");
+const QString Origin("Origin");
+const QString AttributeMatrices("AttributeMatrices");
+const QString TupleDimensions("TupleDimensions");
+const QString DataArrays("DataArrays");
+const QString NumberOfTuples("NumberOfTuples");
+const QString ComponentDimensions("ComponentDimensions");
+const QString Offset("Offset");
+const QString Size("Size");
+} // namespace Keys
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t alignUp(size_t value)
+{
+  return (value + SharedMemoryDataExchange::k_Alignment - 1) / SharedMemoryDataExchange::k_Alignment * SharedMemoryDataExchange::k_Alignment;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+QJsonArray toJsonArray(const T& values)
+{
+  QJsonArray jsonArray;
+  for(const auto& value : values)
+  {
+    jsonArray.append(static_cast<double>(value));
+  }
+  return jsonArray;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool fitsInJson(size_t value)
+{
+  return static_cast<double>(value) <= k_MaxJsonInteger;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool fitsInJson(const std::vector<size_t>& values)
+{
+  for(size_t value : values)
+  {
+    if(!fitsInJson(value))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Reads a size written by Export(). Rejects anything that is not a whole number a double holds exactly.
+ */
+bool toSize(const QJsonValue& value, size_t& result)
+{
+  if(!value.isDouble())
+  {
+    return false;
+  }
+  double number = value.toDouble();
+  if(number < 0.0 || number > k_MaxJsonInteger || number > static_cast<double>(std::numeric_limits<size_t>::max()) || std::floor(number) != number)
+  {
+    return false;
+  }
+  result = static_cast<size_t>(number);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool toSizeVector(const QJsonValue& value, std::vector<size_t>& values)
+{
+  values.clear();
+  for(const auto& entry : value.toArray())
+  {
+    size_t size = 0;
+    if(!toSize(entry, size))
+    {
+      return false;
+    }
+    values.push_back(size);
+  }
+  return true;
+}
+
+/**
+ * @brief Calls 'func' with a null T* for the primitive type named 'type'. Returns false for any other type.
+ */
+template <typename Func>
+bool forPrimitiveType(const QString& type, Func&& func)
+{
+  if(type == SIMPL::TypeNames::Bool)
+  {
+    func(static_cast<bool*>(nullptr));
+  }
+  else if(type == SIMPL::TypeNames::Int8)
+  {
+    func(static_cast<int8_t*>(nullptr));
+  }
+  else if(type == SIMPL::TypeNames::UInt8)
+  {
+    func(static_cast<uint8_t*>(nullptr));
+  }
+  else if(type == SIMPL::TypeNames::Int16)
+  {
+    func(static_cast<int16_t*>(nullptr));
+  }
+  else if(type == SIMPL::TypeNames::UInt16)
+  {
+    func(static_cast<uint16_t*>(nullptr));
+  }
+  else if(type == SIMPL::TypeNames::Int32)
+  {
+    func(static_cast<int32_t*>(nullptr));
+  }
+  else if(type == SIMPL::TypeNames::UInt32)
+  {
+    func(static_cast<uint32_t*>(nullptr));
+  }
+  else if(type == SIMPL::TypeNames::Int64)
+  {
+    func(static_cast<int64_t*>(nullptr));
+  }
+  else if(type == SIMPL::TypeNames::UInt64)
+  {
+    func(static_cast<uint64_t*>(nullptr));
+  }
+  else if(type == SIMPL::TypeNames::Float)
+  {
+    func(static_cast<float*>(nullptr));
+  }
+  else if(type == SIMPL::TypeNames::Double)
+  {
+    func(static_cast<double*>(nullptr));
+  }
+  else if(type == SIMPL::TypeNames::SizeT)
+  {
+    func(static_cast<size_t*>(nullptr));
+  }
+  else
+  {
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Returns the contiguous DataArray<T> holding the values of 'array', or nullptr if the array is not a
+ * primitive DataArray<T>. Component views are copied instead of being materialized in place.
+ */
+IDataArray::Pointer contiguousArray(const IDataArray::Pointer& array)
+{
+  IDataArray::Pointer contiguous;
+  forPrimitiveType(array->getTypeAsString(), [&](auto* tag) {
+    using T = std::remove_pointer_t<decltype(tag)>;
+    if(nullptr != std::dynamic_pointer_cast<DataArray<T>>(array))
+    {
+      contiguous = array;
+    }
+    else if(ComponentViewArray::Pointer view = std::dynamic_pointer_cast<ComponentViewArray>(array))
+    {
+      contiguous = view->materialize();
+    }
+  });
+  return contiguous;
+}
+
+/**
+ * @brief Collects the arrays that make up 'geometry', vertices first, in the order Import() expects them.
+ * Returns false for a geometry the exchange cannot carry.
+ */
+bool findGeometryArrays(const IGeometry::Pointer& geometry, std::vector<IDataArray::Pointer>& arrays)
+{
+  switch(geometry->getGeometryType())
+  {
+  case IGeometry::Type::Image:
+    break;
+  case IGeometry::Type::RectGrid:
+  {
+    RectGridGeom::Pointer rectGrid = std::dynamic_pointer_cast<RectGridGeom>(geometry);
+    arrays = {rectGrid->getXBounds(), rectGrid->getYBounds(), rectGrid->getZBounds()};
+    break;
+  }
+  case IGeometry::Type::Vertex:
+    arrays = {std::dynamic_pointer_cast<VertexGeom>(geometry)->getVertices()};
+    break;
+  case IGeometry::Type::Edge:
+  {
+    EdgeGeom::Pointer edges = std::dynamic_pointer_cast<EdgeGeom>(geometry);
+    arrays = {edges->getVertices(), edges->getEdges()};
+    break;
+  }
+  case IGeometry::Type::Triangle:
+  {
+    TriangleGeom::Pointer triangles = std::dynamic_pointer_cast<TriangleGeom>(geometry);
+    arrays = {triangles->getVertices(), triangles->getTriangles()};
+    break;
+  }
+  case IGeometry::Type::Quad:
+  {
+    QuadGeom::Pointer quads = std::dynamic_pointer_cast<QuadGeom>(geometry);
+    arrays = {quads->getVertices(), quads->getQuads()};
+    break;
+  }
+  case IGeometry::Type::Tetrahedral:
+  {
+    TetrahedralGeom::Pointer tets = std::dynamic_pointer_cast<TetrahedralGeom>(geometry);
+    arrays = {tets->getVertices(), tets->getTetrahedra()};
+    break;
+  }
+  case IGeometry::Type::Hexahedral:
+  {
+    HexahedralGeom::Pointer hexas = std::dynamic_pointer_cast<HexahedralGeom>(geometry);
+    arrays = {hexas->getVertices(), hexas->getHexahedra()};
+    break;
+  }
+  default:
+    return false;
+  }
+  for(IDataArray::Pointer& array : arrays)
+  {
+    if(nullptr == array)
+    {
+      return false;
+    }
+    array = contiguousArray(array);
+  }
+  return true;
+}
+
+/**
+ * @brief An array selected for export and where its buffer goes in the segment
+ */
+struct ExportedArray
+{
+  IDataArray::Pointer array;
+  size_t offset = 0;
+  size_t bytes = 0;
+};
+
+/**
+ * @brief Owns the private mapping of an imported segment. The imported arrays wrap their buffers with this
+ * resource, so the mapping goes away with the last of them. Buffers the arrays allocate later (when they are
+ * resized) come from aligned operator new.
+ */
+class SegmentMemoryResource : public MemoryResource
+{
+public:
+  SegmentMemoryResource(uint8_t* base, size_t size)
+  : m_Base(base)
+  , m_Size(size)
+  {
+  }
+
+  ~SegmentMemoryResource() override
+  {
+    munmap(m_Base, m_Size);
+  }
+
+  QString getName() const override
+  {
+    return "shared-memory";
+  }
+
+protected:
+  void* doAllocate(size_t bytes, size_t alignment) override
+  {
+    return ::operator new(bytes, std::align_val_t(alignment), std::nothrow);
+  }
+
+  void doDeallocate(void* p, size_t bytes, size_t alignment) override
+  {
+    Q_UNUSED(bytes)
+    auto* bytePtr = static_cast<uint8_t*>(p);
+    if(bytePtr >= m_Base && bytePtr < m_Base + m_Size)
+    {
+      // Part of the mapping, which is released in the destructor
+      return;
+    }
+    ::operator delete(p, std::align_val_t(alignment));
+  }
+
+private:
+  uint8_t* m_Base = nullptr;
+  size_t m_Size = 0;
+};
+
+/**
+ * @brief A segment mapped by this process and its parsed descriptor
+ */
+struct MappedSegment
+{
+  uint8_t* base = nullptr;
+  size_t size = 0;
+  size_t dataEnd = 0;
+  QJsonObject descriptor;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t mapSegment(const QString& name, bool copyOnWrite, MappedSegment& segment, QString* errorMessage)
+{
+  QString objectName = SharedMemoryDataExchange::NormalizeName(name);
+  if(objectName.isEmpty())
+  {
+    setErrorMessage(errorMessage, QObject::tr("'%1' is not a valid shared memory name").arg(name));
+    return SharedMemoryDataExchange::k_InvalidName;
+  }
+
+  int fd = shm_open(objectName.toLocal8Bit().constData(), O_RDONLY, 0);
+  if(fd < 0)
+  {
+    setErrorMessage(errorMessage, QObject::tr("Could not open shared memory '%1': %2").arg(objectName, QString::fromLocal8Bit(std::strerror(errno))));
+    return SharedMemoryDataExchange::k_OpenFailed;
+  }
+  struct stat info;
+  if(fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(SegmentHeader))
+  {
+    close(fd);
+    setErrorMessage(errorMessage, QObject::tr("Shared memory '%1' is too small to hold a segment header").arg(objectName));
+    return SharedMemoryDataExchange::k_InvalidSegment;
+  }
+  size_t size = static_cast<size_t>(info.st_size);
+  // A private mapping lets the imported arrays be modified (or scribbled over when they are released)
+  // without touching the producer's segment
+  int prot = copyOnWrite ? PROT_READ | PROT_WRITE : PROT_READ;
+  void* p = mmap(nullptr, size, prot, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if(MAP_FAILED == p)
+  {
+    setErrorMessage(errorMessage, QObject::tr("Could not map shared memory '%1': %2").arg(objectName, QString::fromLocal8Bit(std::strerror(errno))));
+    return SharedMemoryDataExchange::k_OpenFailed;
+  }
+
+  auto* base = static_cast<uint8_t*>(p);
+  SegmentHeader header;
+  std::memcpy(&header, base, sizeof(SegmentHeader));
+  bool validHeader = std::memcmp(header.magic, k_Magic, sizeof(k_Magic)) == 0 && header.headerSize == sizeof(SegmentHeader) && header.totalSize <= size &&
+                     header.descriptorOffset >= sizeof(SegmentHeader) && header.descriptorOffset <= header.totalSize &&
+                     header.descriptorSize <= header.totalSize - header.descriptorOffset;
+  if(!validHeader)
+  {
+    munmap(p, size);
+    setErrorMessage(errorMessage, QObject::tr("Shared memory '%1' was not written by SharedMemoryDataExchange").arg(objectName));
+    return SharedMemoryDataExchange::k_InvalidSegment;
+  }
+  if(header.formatVersion != SharedMemoryDataExchange::k_FormatVersion)
+  {
+    munmap(p, size);
+    setErrorMessage(errorMessage, QObject::tr("Shared memory '%1' has format version %2, expected %3").arg(objectName).arg(header.formatVersion).arg(SharedMemoryDataExchange::k_FormatVersion));
+    return SharedMemoryDataExchange::k_InvalidSegment;
+  }
+
+  QJsonParseError parseError;
+  QByteArray descriptorBytes = QByteArray::fromRawData(reinterpret_cast<const char*>(base + header.descriptorOffset), static_cast<int>(header.descriptorSize));
+  QJsonDocument doc = QJsonDocument::fromJson(descriptorBytes, &parseError);
+  if(parseError.error != QJsonParseError::NoError || !doc.isObject())
+  {
+    munmap(p, size);
+    setErrorMessage(errorMessage, QObject::tr("The descriptor of shared memory '%1' could not be parsed: %2").arg(objectName, parseError.errorString()));
+    return SharedMemoryDataExchange::k_InvalidDescriptor;
+  }
+
+  segment.base = base;
+  segment.size = size;
+  segment.dataEnd = header.descriptorOffset;
+  segment.descriptor = doc.object();
+  return 0;
+}
+
+/**
+ * @brief Wraps the buffer described by 'daObject' in place. Returns nullptr if the description does not fit the
+ * segment or names an unsupported type.
+ */
+IDataArray::Pointer wrapArray(const QJsonObject& daObject, const MappedSegment& segment, const MemoryResource::Pointer& resource)
+{
+  QString arrayName = daObject[Keys::Name].toString();
+  size_t numTuples = 0;
+  size_t offset = 0;
+  size_t bytes = 0;
+  std::vector<size_t> cDims;
+  if(!toSize(daObject[Keys::NumberOfTuples], numTuples) || !toSize(daObject[Keys::Offset], offset) || !toSize(daObject[Keys::Size], bytes) ||
+     !toSizeVector(daObject[Keys::ComponentDimensions], cDims))
+  {
+    return IDataArray::NullPointer();
+  }
+  size_t numComps = std::accumulate(cDims.cbegin(), cDims.cend(), static_cast<size_t>(1), std::multiplies<size_t>());
+  if(cDims.empty() || offset % SharedMemoryDataExchange::k_Alignment != 0 || offset < sizeof(SegmentHeader) || offset > segment.dataEnd || bytes > segment.dataEnd - offset)
+  {
+    return IDataArray::NullPointer();
+  }
+
+  IDataArray::Pointer array;
+  forPrimitiveType(daObject[Keys::Type].toString(), [&](auto* tag) {
+    using T = std::remove_pointer_t<decltype(tag)>;
+    if(bytes == numTuples * numComps * sizeof(T))
+    {
+      array = DataArray<T>::WrapPointer(reinterpret_cast<T*>(segment.base + offset), numTuples, cDims, arrayName, true, resource);
+    }
+  });
+  return array;
+}
+
+/**
+ * @brief Rebuilds the geometry described by 'geomObject' around the wrapped 'arrays'. Returns nullptr if the
+ * arrays do not match the geometry type.
+ */
+IGeometry::Pointer importGeometry(const QJsonObject& geomObject, const std::vector<IDataArray::Pointer>& arrays)
+{
+  QString type = geomObject[Keys::Type].toString();
+  QString name = geomObject[Keys::Name].toString(type);
+
+  if(type == SIMPL::Geometry::ImageGeometry)
+  {
+    std::vector<size_t> dims;
+    QJsonArray spacing = geomObject[Keys::Spacing].toArray();
+    QJsonArray origin = geomObject[Keys::Origin].toArray();
+    if(!arrays.empty() || !toSizeVector(geomObject[Keys::Dimensions], dims) || dims.size() != 3 || spacing.size() != 3 || origin.size() != 3)
+    {
+      return IGeometry::NullPointer();
+    }
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry(name);
+    image->setDimensions(dims[0], dims[1], dims[2]);
+    image->setSpacing(static_cast<float>(spacing[0].toDouble()), static_cast<float>(spacing[1].toDouble()), static_cast<float>(spacing[2].toDouble()));
+    image->setOrigin(static_cast<float>(origin[0].toDouble()), static_cast<float>(origin[1].toDouble()), static_cast<float>(origin[2].toDouble()));
+    return image;
+  }
+
+  if(type == SIMPL::Geometry::RectGridGeometry)
+  {
+    std::vector<FloatArrayType::Pointer> bounds;
+    for(const IDataArray::Pointer& array : arrays)
+    {
+      FloatArrayType::Pointer floats = std::dynamic_pointer_cast<FloatArrayType>(array);
+      if(nullptr == floats || floats->getNumberOfComponents() != 1 || floats->getNumberOfTuples() < 1)
+      {
+        return IGeometry::NullPointer();
+      }
+      bounds.push_back(floats);
+    }
+    if(bounds.size() != 3)
+    {
+      return IGeometry::NullPointer();
+    }
+    RectGridGeom::Pointer rectGrid = RectGridGeom::CreateGeometry(name);
+    rectGrid->setDimensions(SizeVec3Type(bounds[0]->getNumberOfTuples() - 1, bounds[1]->getNumberOfTuples() - 1, bounds[2]->getNumberOfTuples() - 1));
+    rectGrid->setXBounds(bounds[0]);
+    rectGrid->setYBounds(bounds[1]);
+    rectGrid->setZBounds(bounds[2]);
+    return rectGrid;
+  }
+
+  // Every other geometry is a shared vertex list followed by at most one shared element list
+  SharedVertexList::Pointer vertices = arrays.empty() ? SharedVertexList::NullPointer() : std::dynamic_pointer_cast<SharedVertexList>(arrays[0]);
+  if(nullptr == vertices || vertices->getNumberOfComponents() != 3)
+  {
+    return IGeometry::NullPointer();
+  }
+  auto elementList = [&](int32_t numVerts) {
+    MeshIndexArrayType::Pointer elements = arrays.size() == 2 ? std::dynamic_pointer_cast<MeshIndexArrayType>(arrays[1]) : MeshIndexArrayType::NullPointer();
+    if(nullptr != elements && elements->getNumberOfComponents() != numVerts)
+    {
+      elements = MeshIndexArrayType::NullPointer();
+    }
+    return elements;
+  };
+
+  if(type == SIMPL::Geometry::VertexGeometry)
+  {
+    return arrays.size() == 1 ? VertexGeom::CreateGeometry(vertices, name) : IGeometry::NullPointer();
+  }
+  if(type == SIMPL::Geometry::EdgeGeometry)
+  {
+    MeshIndexArrayType::Pointer edges = elementList(2);
+    return nullptr != edges ? EdgeGeom::CreateGeometry(edges, vertices, name) : IGeometry::NullPointer();
+  }
+  if(type == SIMPL::Geometry::TriangleGeometry)
+  {
+    MeshIndexArrayType::Pointer triangles = elementList(3);
+    return nullptr != triangles ? TriangleGeom::CreateGeometry(triangles, vertices, name) : IGeometry::NullPointer();
+  }
+  if(type == SIMPL::Geometry::QuadGeometry)
+  {
+    MeshIndexArrayType::Pointer quads = elementList(4);
+    return nullptr != quads ? QuadGeom::CreateGeometry(quads, vertices, name) : IGeometry::NullPointer();
+  }
+  if(type == SIMPL::Geometry::TetrahedralGeometry)
+  {
+    MeshIndexArrayType::Pointer tets = elementList(4);
+    return nullptr != tets ? TetrahedralGeom::CreateGeometry(tets, vertices, name) : IGeometry::NullPointer();
+  }
+  if(type == SIMPL::Geometry::HexahedralGeometry)
+  {
+    MeshIndexArrayType::Pointer hexas = elementList(8);
+    return nullptr != hexas ? HexahedralGeom::CreateGeometry(hexas, vertices, name) : IGeometry::NullPointer();
+  }
+  return IGeometry::NullPointer();
+}
+#endif
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SharedMemoryDataExchange::IsSupported()
+{
+#ifdef SIMPL_POSIX_SHARED_MEMORY
+  return true;
+#else
+  return false;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString SharedMemoryDataExchange::NormalizeName(const QString& name)
+{
+  QString objectName = name.trimmed();
+  if(!objectName.startsWith('/'))
+  {
+    objectName.prepend('/');
+  }
+  // shm_open() only accepts a single leading slash; NAME_MAX bounds the rest
+  if(objectName.size() < 2 || objectName.indexOf('/', 1) >= 0 || objectName.toLocal8Bit().size() > 255)
+  {
+    return QString();
+  }
+  return objectName;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t SharedMemoryDataExchange::Export(const DataContainerArrayShPtrType& dca, const QString& name, QString* errorMessage)
+{
+#ifdef SIMPL_POSIX_SHARED_MEMORY
+  QString objectName = NormalizeName(name);
+  if(objectName.isEmpty())
+  {
+    setErrorMessage(errorMessage, QObject::tr("'%1' is not a valid shared memory name").arg(name));
+    return k_InvalidName;
+  }
+  if(nullptr == dca)
+  {
+    setErrorMessage(errorMessage, QObject::tr("There is no DataContainerArray to export"));
+    return k_InvalidDescriptor;
+  }
+
+  // Lay out the buffers behind the header and describe them
+  std::vector<ExportedArray> exportedArrays;
+  size_t cursor = sizeof(SegmentHeader);
+  bool sizesFit = true;
+  auto describeArray = [&](const IDataArray::Pointer& array) {
+    ExportedArray exported;
+    exported.array = array;
+    exported.offset = alignUp(cursor);
+    exported.bytes = array->getSize() * array->getTypeSize();
+    cursor = exported.offset + exported.bytes;
+    exportedArrays.push_back(exported);
+    sizesFit = sizesFit && fitsInJson(array->getNumberOfTuples()) && fitsInJson(array->getComponentDimensions());
+
+    QJsonObject daObject;
+    daObject[Keys::Name] = array->getName();
+    daObject[Keys::Type] = array->getTypeAsString();
+    daObject[Keys::NumberOfTuples] = static_cast<double>(array->getNumberOfTuples());
+    daObject[Keys::ComponentDimensions] = toJsonArray(array->getComponentDimensions());
+    daObject[Keys::Offset] = static_cast<double>(exported.offset);
+    daObject[Keys::Size] = static_cast<double>(exported.bytes);
+    return daObject;
+  };
+
+  QJsonArray dcArray;
+  for(const DataContainer::Pointer& dc : dca->getDataContainers())
+  {
+    QJsonObject dcObject;
+    dcObject[Keys::Name] = dc->getName();
+    IGeometry::Pointer geometry = dc->getGeometry();
+    if(nullptr != geometry)
+    {
+      std::vector<IDataArray::Pointer> geometryArrays;
+      if(!findGeometryArrays(geometry, geometryArrays))
+      {
+        setErrorMessage(errorMessage, QObject::tr("The %1 of Data Container '%2' cannot be exported").arg(geometry->getGeometryTypeAsString(), dc->getName()));
+        return k_UnsupportedGeometry;
+      }
+      QJsonObject geomObject;
+      geomObject[Keys::Type] = geometry->getGeometryTypeAsString();
+      geomObject[Keys::Name] = geometry->getName();
+      ImageGeom::Pointer image = std::dynamic_pointer_cast<ImageGeom>(geometry);
+      if(nullptr != image)
+      {
+        std::vector<size_t> dims = {image->getDimensions()[0], image->getDimensions()[1], image->getDimensions()[2]};
+        sizesFit = sizesFit && fitsInJson(dims);
+        geomObject[Keys::Dimensions] = toJsonArray(dims);
+        geomObject[Keys::Spacing] = toJsonArray(image->getSpacing());
+        geomObject[Keys::Origin] = toJsonArray(image->getOrigin());
+      }
+      QJsonArray geomArrays;
+      for(const IDataArray::Pointer& array : geometryArrays)
+      {
+        geomArrays.append(describeArray(array));
+      }
+      geomObject[Keys::DataArrays] = geomArrays;
+      dcObject[Keys::Geometry] = geomObject;
+    }
+
+    QJsonArray amArray;
+    for(const AttributeMatrix::Pointer& am : dc->getAttributeMatrices())
+    {
+      QJsonObject amObject;
+      amObject[Keys::Name] = am->getName();
+      amObject[Keys::Type] = AttributeMatrix::TypeToString(am->getType());
+      amObject[Keys::TupleDimensions] = toJsonArray(am->getTupleDimensions());
+      sizesFit = sizesFit && fitsInJson(am->getTupleDimensions());
+
+      QJsonArray daArray;
+      for(const QString& arrayName : am->getAttributeArrayNames())
+      {
+        IDataArray::Pointer array = contiguousArray(am->getAttributeArray(arrayName));
+        if(nullptr == array)
+        {
+          continue;
+        }
+        daArray.append(describeArray(array));
+      }
+      amObject[Keys::DataArrays] = daArray;
+      amArray.append(amObject);
+    }
+    dcObject[Keys::AttributeMatrices] = amArray;
+    dcArray.append(dcObject);
+  }
+  // Offsets and sizes grow with the cursor, so checking where it ends covers all of them
+  if(!sizesFit || !fitsInJson(cursor))
+  {
+    setErrorMessage(errorMessage, QObject::tr("The arrays are too large to be described exactly by the JSON descriptor"));
+    return k_InvalidDescriptor;
+  }
+  QJsonObject descriptor;
+  descriptor[Keys::FormatVersion] = static_cast<int>(k_FormatVersion);
+  descriptor[Keys::DataContainers] = dcArray;
+  QByteArray descriptorBytes = QJsonDocument(descriptor).toJson(QJsonDocument::Compact);
+
+  SegmentHeader header;
+  std::memset(&header, 0, sizeof(SegmentHeader));
+  std::memcpy(header.magic, k_Magic, sizeof(k_Magic));
+  header.formatVersion = k_FormatVersion;
+  header.headerSize = sizeof(SegmentHeader);
+  header.descriptorOffset = cursor;
+  header.descriptorSize = static_cast<uint64_t>(descriptorBytes.size());
+  header.totalSize = header.descriptorOffset + header.descriptorSize;
+
+  QByteArray objectNameBytes = objectName.toLocal8Bit();
+  int fd = shm_open(objectNameBytes.constData(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+  if(fd < 0)
+  {
+    setErrorMessage(errorMessage, QObject::tr("Could not create shared memory '%1': %2").arg(objectName, QString::fromLocal8Bit(std::strerror(errno))));
+    return k_CreateFailed;
+  }
+  size_t totalSize = static_cast<size_t>(header.totalSize);
+  void* p = MAP_FAILED;
+  if(ftruncate(fd, static_cast<off_t>(totalSize)) == 0)
+  {
+    p = mmap(nullptr, totalSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  }
+  close(fd);
+  if(MAP_FAILED == p)
+  {
+    setErrorMessage(errorMessage, QObject::tr("Could not size shared memory '%1' to %2 bytes: %3").arg(objectName).arg(totalSize).arg(QString::fromLocal8Bit(std::strerror(errno))));
+    shm_unlink(objectNameBytes.constData());
+    return k_CreateFailed;
+  }
+
+  auto* base = static_cast<uint8_t*>(p);
+  for(const ExportedArray& exported : exportedArrays)
+  {
+    if(exported.bytes > 0)
+    {
+      std::memcpy(base + exported.offset, exported.array->getVoidPointer(0), exported.bytes);
+    }
+  }
+  std::memcpy(base + header.descriptorOffset, descriptorBytes.constData(), descriptorBytes.size());
+  // The header goes in last so a reader never sees the magic in front of a half written segment
+  std::memcpy(base, &header, sizeof(SegmentHeader));
+  munmap(p, totalSize);
+  return 0;
+#else
+  Q_UNUSED(dca)
+  Q_UNUSED(name)
+  setErrorMessage(errorMessage, QObject::tr("Shared memory is not supported on this platform"));
+  return k_NotSupported;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArrayShPtrType SharedMemoryDataExchange::Import(const QString& name, QString* errorMessage)
+{
+#ifdef SIMPL_POSIX_SHARED_MEMORY
+  MappedSegment segment;
+  if(mapSegment(name, true, segment, errorMessage) < 0)
+  {
+    return DataContainerArray::NullPointer();
+  }
+  // From here on the resource owns the mapping, including on the error paths
+  MemoryResource::Pointer resource = std::make_shared<SegmentMemoryResource>(segment.base, segment.size);
+
+  auto invalidDescriptor = [&](const QString& message) {
+    setErrorMessage(errorMessage, QObject::tr("The descriptor of shared memory '%1' is invalid: %2").arg(NormalizeName(name), message));
+    return DataContainerArray::NullPointer();
+  };
+
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  for(const auto& dcValue : segment.descriptor[Keys::DataContainers].toArray())
+  {
+    QJsonObject dcObject = dcValue.toObject();
+    DataContainer::Pointer dc = DataContainer::New(dcObject[Keys::Name].toString());
+    if(dcObject.contains(Keys::Geometry))
+    {
+      QJsonObject geomObject = dcObject[Keys::Geometry].toObject();
+      std::vector<IDataArray::Pointer> geometryArrays;
+      for(const auto& daValue : geomObject[Keys::DataArrays].toArray())
+      {
+        IDataArray::Pointer array = wrapArray(daValue.toObject(), segment, resource);
+        if(nullptr == array)
+        {
+          return invalidDescriptor(QObject::tr("an array of the geometry of '%1' does not fit into the segment").arg(dc->getName()));
+        }
+        geometryArrays.push_back(array);
+      }
+      IGeometry::Pointer geometry = importGeometry(geomObject, geometryArrays);
+      if(nullptr == geometry)
+      {
+        return invalidDescriptor(QObject::tr("the %1 of '%2' could not be rebuilt").arg(geomObject[Keys::Type].toString(), dc->getName()));
+      }
+      dc->setGeometry(geometry);
+    }
+
+    for(const auto& amValue : dcObject[Keys::AttributeMatrices].toArray())
+    {
+      QJsonObject amObject = amValue.toObject();
+      std::vector<size_t> tDims;
+      if(!toSizeVector(amObject[Keys::TupleDimensions], tDims))
+      {
+        return invalidDescriptor(QObject::tr("the tuple dimensions of '%1' are not valid sizes").arg(amObject[Keys::Name].toString()));
+      }
+      AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, amObject[Keys::Name].toString(), AttributeMatrix::StringToType(amObject[Keys::Type].toString()));
+
+      for(const auto& daValue : amObject[Keys::DataArrays].toArray())
+      {
+        QJsonObject daObject = daValue.toObject();
+        IDataArray::Pointer array = wrapArray(daObject, segment, resource);
+        if(nullptr == array || array->getNumberOfTuples() != am->getNumberOfTuples())
+        {
+          return invalidDescriptor(QObject::tr("array '%1' has an unsupported type or does not fit into the segment or its attribute matrix").arg(daObject[Keys::Name].toString()));
+        }
+        am->insertOrAssign(array);
+      }
+      dc->addOrReplaceAttributeMatrix(am);
+    }
+    dca->addOrReplaceDataContainer(dc);
+  }
+  return dca;
+#else
+  Q_UNUSED(name)
+  setErrorMessage(errorMessage, QObject::tr("Shared memory is not supported on this platform"));
+  return DataContainerArray::NullPointer();
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject SharedMemoryDataExchange::ReadDescriptor(const QString& name, QString* errorMessage)
+{
+#ifdef SIMPL_POSIX_SHARED_MEMORY
+  MappedSegment segment;
+  if(mapSegment(name, false, segment, errorMessage) < 0)
+  {
+    return QJsonObject();
+  }
+  munmap(segment.base, segment.size);
+  return segment.descriptor;
+#else
+  Q_UNUSED(name)
+  setErrorMessage(errorMessage, QObject::tr("Shared memory is not supported on this platform"));
+  return QJsonObject();
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SharedMemoryDataExchange::Unlink(const QString& name)
+{
+#ifdef SIMPL_POSIX_SHARED_MEMORY
+  QString objectName = NormalizeName(name);
+  if(objectName.isEmpty())
+  {
+    return false;
+  }
+  return shm_unlink(objectName.toLocal8Bit().constData()) == 0;
+#else
+  Q_UNUSED(name)
+  return false;
+#endif
+}
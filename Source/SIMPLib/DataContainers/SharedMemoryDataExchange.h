@@ -0,0 +1,143 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <QtCore/QJsonObject>
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+
+class DataContainerArray;
+using DataContainerArrayShPtrType = std::shared_ptr<DataContainerArray>;
+
+/**
+ * @class SharedMemoryDataExchange SharedMemoryDataExchange.h SIMPLib/DataContainers/SharedMemoryDataExchange.h
+ * @brief Hands a DataContainerArray to another process through a named POSIX shared memory object instead of
+ * a .dream3d file. Export() copies the buffers of the primitive DataArray<T> arrays into the segment once; Import()
+ * maps the segment copy-on-write and wraps the buffers in place, so any number of readers attach without copying.
+ *
+ * The segment starts with a fixed header, followed by the array buffers, each aligned to k_Alignment bytes, and
+ * a JSON descriptor laid out like the HDF5 groups of a .dream3d file:
+ * @code
+ * { "FormatVersion": 1,
+ *   "DataContainers": [ { "Name": "...", "Geometry": { "Type": "ImageGeometry", "Name": "...", "Dimensions": [], "Spacing": [], "Origin": [],
+ *                                                      "DataArrays": [] },
+ *                         "AttributeMatrices": [ { "Name": "...", "Type": "Cell", "TupleDimensions": [],
+ *                                                  "DataArrays": [ { "Name": "...", "Type": "float", "NumberOfTuples": 0,
+ *                                                                    "ComponentDimensions": [], "Offset": 0, "Size": 0 } ] } ] } ] }
+ * @endcode
+ * Offset and Size are in bytes from the start of the segment. Every size is a JSON number holding an integer of
+ * at most 2^53, which a double represents exactly; Export() fails rather than write a larger one. Readers outside
+ * SIMPL (numpy.frombuffer on a mmap of /dev/shm/<name>) only need the header and the descriptor.
+ *
+ * The DataArrays of a geometry hold the arrays it is built from: nothing for an ImageGeom, the x, y and z bounds
+ * of a RectGridGeom, and the shared vertex list followed by the shared element list (if any) of the vertex based
+ * geometries. Arrays that are not primitive DataArray<T> (strings, neighbor lists, stats) are left out. The
+ * segment stays in place until Unlink() is called; imported arrays keep their mapping alive after the unlink.
+ * Only available where POSIX shared memory exists; elsewhere every call fails with k_NotSupported.
+ */
+class SIMPLib_EXPORT SharedMemoryDataExchange
+{
+public:
+  static constexpr uint32_t k_FormatVersion = 1;
+  static constexpr size_t k_Alignment = 64;
+
+  static constexpr int32_t k_NotSupported = -12100;
+  static constexpr int32_t k_InvalidName = -12101;
+  static constexpr int32_t k_CreateFailed = -12102;
+  static constexpr int32_t k_OpenFailed = -12103;
+  static constexpr int32_t k_InvalidSegment = -12104;
+  static constexpr int32_t k_InvalidDescriptor = -12105;
+  static constexpr int32_t k_UnsupportedGeometry = -12106;
+
+  /**
+   * @brief Returns true if this platform provides POSIX shared memory
+   * @return
+   */
+  static bool IsSupported();
+
+  /**
+   * @brief Copies the arrays of 'dca' into a new shared memory object called 'name'. An existing object with
+   * the same name is not replaced. Fails with k_UnsupportedGeometry, before anything is created, if a Data
+   * Container holds a geometry that cannot be carried.
+   * @param dca
+   * @param name The object name, with or without the leading '/'; it may not contain any other '/'
+   * @param errorMessage Receives the reason of a failure
+   * @return 0 on success or one of the negative error codes
+   */
+  static int32_t Export(const DataContainerArrayShPtrType& dca, const QString& name, QString* errorMessage = nullptr);
+
+  /**
+   * @brief Maps the shared memory object 'name' and rebuilds the DataContainerArray around its buffers.
+   * Writes to the imported arrays stay private to this process.
+   * @param name
+   * @param errorMessage Receives the reason of a failure
+   * @return nullptr on failure
+   */
+  static DataContainerArrayShPtrType Import(const QString& name, QString* errorMessage = nullptr);
+
+  /**
+   * @brief Returns the descriptor of the shared memory object 'name' without wrapping any array
+   * @param name
+   * @param errorMessage Receives the reason of a failure
+   * @return An empty object on failure
+   */
+  static QJsonObject ReadDescriptor(const QString& name, QString* errorMessage = nullptr);
+
+  /**
+   * @brief Removes the name of the shared memory object. Processes that have it mapped keep their mapping.
+   * @param name
+   * @return false if the object did not exist
+   */
+  static bool Unlink(const QString& name);
+
+  /**
+   * @brief Returns 'name' in the form shm_open() expects, or an empty string if it is not a valid object name
+   * @param name
+   * @return
+   */
+  static QString NormalizeName(const QString& name);
+
+public:
+  SharedMemoryDataExchange() = delete;
+  SharedMemoryDataExchange(const SharedMemoryDataExchange&) = delete;            // Copy Constructor Not Implemented
+  SharedMemoryDataExchange(SharedMemoryDataExchange&&) = delete;                 // Move Constructor Not Implemented
+  SharedMemoryDataExchange& operator=(const SharedMemoryDataExchange&) = delete; // Copy Assignment Not Implemented
+  SharedMemoryDataExchange& operator=(SharedMemoryDataExchange&&) = delete;      // Move Assignment Not Implemented
+};
@@ -61,6 +61,7 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataStructureContainerNode.hpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataStructureNode.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/RenameDataPath.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SharedMemoryDataExchange.h
 )
 
 set(SIMPLib_${SUBDIR_NAME}_SRCS
@@ -76,6 +77,7 @@ set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataContainerBundle.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataStructureNode.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/RenameDataPath.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SharedMemoryDataExchange.cpp
 )
 
 cmp_IDE_SOURCE_PROPERTIES( "${SUBDIR_NAME}" "${SIMPLib_${SUBDIR_NAME}_HDRS};${SIMPLib_${SUBDIR_NAME}_Moc_HDRS}" "${SIMPLib_${SUBDIR_NAME}_SRCS}" "${PROJECT_INSTALL_HEADERS}")
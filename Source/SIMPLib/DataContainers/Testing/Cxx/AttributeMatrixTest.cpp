@@ -0,0 +1,263 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <algorithm>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/ComponentViewArray.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/NeighborList.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class AttributeMatrixTest
+{
+public:
+  AttributeMatrixTest() = default;
+  virtual ~AttributeMatrixTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRemoveInactiveObjects()
+  {
+    const size_t numFeatures = 1000;
+    const size_t numCells = 20000;
+    std::vector<size_t> tDims(1, numFeatures);
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, "CellFeatureData", AttributeMatrix::Type::CellFeature);
+
+    // Several arrays so the compaction is spread over more than one task
+    for(int32_t a = 0; a < 8; a++)
+    {
+      FloatArrayType::Pointer values = FloatArrayType::CreateArray(numFeatures, std::vector<size_t>(1, 3), QString("Values%1").arg(a), true);
+      for(size_t i = 0; i < numFeatures * 3; i++)
+      {
+        values->setValue(i, static_cast<float>(i + a));
+      }
+      am->insertOrAssign(values);
+    }
+    NeighborList<int32_t>::Pointer neighbors = NeighborList<int32_t>::CreateArray(numFeatures, "Neighbors", true);
+    for(int32_t f = 0; f < static_cast<int32_t>(numFeatures); f++)
+    {
+      for(int32_t n = 0; n < f % 4; n++)
+      {
+        neighbors->addEntry(f, f * 10 + n);
+      }
+    }
+    am->insertOrAssign(neighbors);
+
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(numCells, std::vector<size_t>(1, 1), "FeatureIds", true);
+    for(size_t i = 0; i < numCells; i++)
+    {
+      featureIds->setValue(i, static_cast<int32_t>(i % numFeatures));
+    }
+
+    // Every third Feature is removed; Feature 0 is always kept
+    QVector<bool> activeObjects(static_cast<int32_t>(numFeatures), true);
+    std::vector<int32_t> newIds(numFeatures, 0);
+    std::vector<size_t> oldIds;
+    for(size_t f = 0; f < numFeatures; f++)
+    {
+      if(f > 0 && f % 3 == 0)
+      {
+        activeObjects[static_cast<int32_t>(f)] = false;
+        continue;
+      }
+      newIds[f] = static_cast<int32_t>(oldIds.size());
+      oldIds.push_back(f);
+    }
+
+    bool success = am->removeInactiveObjects(activeObjects, featureIds.get());
+    DREAM3D_REQUIRE_EQUAL(success, true)
+    DREAM3D_REQUIRE_EQUAL(am->getNumberOfTuples(), oldIds.size())
+
+    for(int32_t a = 0; a < 8; a++)
+    {
+      FloatArrayType::Pointer values = am->getAttributeArrayAs<FloatArrayType>(QString("Values%1").arg(a));
+      DREAM3D_REQUIRE_VALID_POINTER(values.get())
+      DREAM3D_REQUIRE_EQUAL(values->getNumberOfTuples(), oldIds.size())
+      for(size_t f = 0; f < oldIds.size(); f++)
+      {
+        for(size_t c = 0; c < 3; c++)
+        {
+          DREAM3D_REQUIRE_EQUAL(values->getValue(f * 3 + c), static_cast<float>(oldIds[f] * 3 + c + a))
+        }
+      }
+    }
+
+    NeighborList<int32_t>::Pointer compacted = am->getAttributeArrayAs<NeighborList<int32_t>>("Neighbors");
+    DREAM3D_REQUIRE_VALID_POINTER(compacted.get())
+    DREAM3D_REQUIRE_EQUAL(compacted->getNumberOfTuples(), oldIds.size())
+    for(size_t f = 0; f < oldIds.size(); f++)
+    {
+      int32_t oldId = static_cast<int32_t>(oldIds[f]);
+      DREAM3D_REQUIRE_EQUAL(compacted->getListSize(static_cast<int32_t>(f)), oldId % 4)
+      for(int32_t n = 0; n < oldId % 4; n++)
+      {
+        bool ok = false;
+        DREAM3D_REQUIRE_EQUAL(compacted->getValue(static_cast<int32_t>(f), n, ok), oldId * 10 + n)
+        DREAM3D_REQUIRE_EQUAL(ok, true)
+      }
+    }
+
+    for(size_t i = 0; i < numCells; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(featureIds->getValue(i), newIds[i % numFeatures])
+    }
+
+    // Element matrices are rejected
+    AttributeMatrix::Pointer cellAm = AttributeMatrix::New(tDims, "CellData", AttributeMatrix::Type::Cell);
+    QVector<bool> cellActive(static_cast<int32_t>(numFeatures), true);
+    success = cellAm->removeInactiveObjects(cellActive, featureIds.get());
+    DREAM3D_REQUIRE_EQUAL(success, false)
+
+    // An array that does not match the matrix fails the call before anything is erased or renumbered
+    AttributeMatrix::Pointer badAm = AttributeMatrix::New(tDims, "BadFeatureData", AttributeMatrix::Type::CellFeature);
+    Int32ArrayType::Pointer matching = Int32ArrayType::CreateArray(numFeatures, std::vector<size_t>(1, 1), "Matching", true);
+    matching->initializeWithValue(7);
+    badAm->insertOrAssign(matching);
+    badAm->insertOrAssign(Int32ArrayType::CreateArray(numFeatures - 1, std::vector<size_t>(1, 1), "Short", true));
+    std::vector<int32_t> idsBefore(featureIds->begin(), featureIds->end());
+    success = badAm->removeInactiveObjects(activeObjects, featureIds.get());
+    DREAM3D_REQUIRE_EQUAL(success, false)
+    DREAM3D_REQUIRE_EQUAL(badAm->getNumberOfTuples(), numFeatures)
+    DREAM3D_REQUIRE_EQUAL(matching->getNumberOfTuples(), numFeatures)
+    DREAM3D_REQUIRE(std::equal(idsBefore.begin(), idsBefore.end(), featureIds->begin()))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRemoveInactiveObjectsWithViews()
+  {
+    const size_t numFeatures = 500;
+    std::vector<size_t> tDims(1, numFeatures);
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, "CellFeatureData", AttributeMatrix::Type::CellFeature);
+
+    Int32ArrayType::Pointer parent = Int32ArrayType::CreateArray(numFeatures, std::vector<size_t>(1, 3), "Parent", true);
+    for(size_t i = 0; i < numFeatures * 3; i++)
+    {
+      parent->setValue(i, static_cast<int32_t>(i));
+    }
+    am->insertOrAssign(parent);
+    // The views sit next to the array they read, in front of and behind it
+    am->insertOrAssign(ComponentViewArray::New(parent, 0, "AView0"));
+    am->insertOrAssign(ComponentViewArray::New(parent, 2, "ZView2"));
+    for(int32_t a = 0; a < 8; a++)
+    {
+      am->insertOrAssign(FloatArrayType::CreateArray(numFeatures, std::vector<size_t>(1, 1), QString("Filler%1").arg(a), true));
+    }
+
+    QVector<bool> activeObjects(static_cast<int32_t>(numFeatures), true);
+    std::vector<size_t> oldIds(1, 0);
+    for(size_t f = 1; f < numFeatures; f++)
+    {
+      if(f % 2 == 1)
+      {
+        activeObjects[static_cast<int32_t>(f)] = false;
+        continue;
+      }
+      oldIds.push_back(f);
+    }
+
+    bool success = am->removeInactiveObjects(activeObjects, nullptr);
+    DREAM3D_REQUIRE_EQUAL(success, true)
+
+    Int32ArrayType::Pointer compactedParent = am->getAttributeArrayAs<Int32ArrayType>("Parent");
+    ComponentViewArray::Pointer view0 = std::dynamic_pointer_cast<ComponentViewArray>(am->getAttributeArray("AView0"));
+    ComponentViewArray::Pointer view2 = std::dynamic_pointer_cast<ComponentViewArray>(am->getAttributeArray("ZView2"));
+    DREAM3D_REQUIRE_VALID_POINTER(compactedParent.get())
+    DREAM3D_REQUIRE_VALID_POINTER(view0.get())
+    DREAM3D_REQUIRE_VALID_POINTER(view2.get())
+    DREAM3D_REQUIRE_EQUAL(view0->isMaterialized(), true)
+    DREAM3D_REQUIRE_EQUAL(view2->isMaterialized(), true)
+    DREAM3D_REQUIRE_EQUAL(compactedParent->getNumberOfTuples(), oldIds.size())
+    DREAM3D_REQUIRE_EQUAL(view0->getNumberOfTuples(), oldIds.size())
+    DREAM3D_REQUIRE_EQUAL(view2->getNumberOfTuples(), oldIds.size())
+    for(size_t f = 0; f < oldIds.size(); f++)
+    {
+      DREAM3D_REQUIRE_EQUAL(compactedParent->getComponent(f, 0), static_cast<int32_t>(oldIds[f] * 3))
+      DREAM3D_REQUIRE_EQUAL(view0->getValue<int32_t>(f), static_cast<int32_t>(oldIds[f] * 3))
+      DREAM3D_REQUIRE_EQUAL(view2->getValue<int32_t>(f), static_cast<int32_t>(oldIds[f] * 3 + 2))
+    }
+
+    // Resizing the matrix materializes new views before any array changes size
+    am->insertOrAssign(ComponentViewArray::New(compactedParent, 1, "AView1"));
+    am->resizeAttributeArrays(std::vector<size_t>(1, oldIds.size() + 5));
+    ComponentViewArray::Pointer view1 = std::dynamic_pointer_cast<ComponentViewArray>(am->getAttributeArray("AView1"));
+    DREAM3D_REQUIRE_EQUAL(view1->isMaterialized(), true)
+    DREAM3D_REQUIRE_EQUAL(view1->getNumberOfTuples(), oldIds.size() + 5)
+    DREAM3D_REQUIRE_EQUAL(view1->getValue<int32_t>(1), static_cast<int32_t>(oldIds[1] * 3 + 1))
+
+    // Removing or replacing the viewed array materializes its views
+    Int32ArrayType::Pointer resizedParent = am->getAttributeArrayAs<Int32ArrayType>("Parent");
+    am->insertOrAssign(ComponentViewArray::New(resizedParent, 0, "AView3"));
+    ComponentViewArray::Pointer view3 = std::dynamic_pointer_cast<ComponentViewArray>(am->getAttributeArray("AView3"));
+    DREAM3D_REQUIRE_EQUAL(view3->isMaterialized(), false)
+    am->addOrReplaceAttributeArray(Int32ArrayType::CreateArray(oldIds.size() + 5, std::vector<size_t>(1, 3), "Parent", true));
+    DREAM3D_REQUIRE_EQUAL(view3->isMaterialized(), true)
+
+    Int32ArrayType::Pointer replacedParent = am->getAttributeArrayAs<Int32ArrayType>("Parent");
+    am->insertOrAssign(ComponentViewArray::New(replacedParent, 2, "AView4"));
+    ComponentViewArray::Pointer view4 = std::dynamic_pointer_cast<ComponentViewArray>(am->getAttributeArray("AView4"));
+    DREAM3D_REQUIRE(am->removeAttributeArray("Parent") == replacedParent)
+    DREAM3D_REQUIRE_EQUAL(view4->isMaterialized(), true)
+
+    // Asking for a view as DataArray<T> hands out the array the view forwards to
+    Int32ArrayType::Pointer asDataArray = am->getPrereqArray<Int32ArrayType>(nullptr, "AView1", -1, std::vector<size_t>(1, 1));
+    DREAM3D_REQUIRE_VALID_POINTER(asDataArray.get())
+    DREAM3D_REQUIRE(asDataArray == view1->getSourceArray())
+    asDataArray->setValue(0, -5);
+    DREAM3D_REQUIRE_EQUAL(view1->getValue<int32_t>(0), -5)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### AttributeMatrixTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestRemoveInactiveObjects());
+    DREAM3D_REGISTER_TEST(TestRemoveInactiveObjectsWithViews());
+  }
+
+private:
+  AttributeMatrixTest(const AttributeMatrixTest&); // Copy Constructor Not Implemented
+  void operator=(const AttributeMatrixTest&);      // Move assignment Not Implemented
+};
@@ -0,0 +1,169 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class DataContainerArrayTest
+{
+public:
+  DataContainerArrayTest() = default;
+  virtual ~DataContainerArrayTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestChildIndex()
+  {
+    const size_t numArrays = 200;
+    std::vector<size_t> tDims(1, 10);
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, "CellData", AttributeMatrix::Type::Cell);
+    for(size_t a = 0; a < numArrays; a++)
+    {
+      am->insertOrAssign(Int32ArrayType::CreateArray(10, std::vector<size_t>(1, 1), QString("Array%1").arg(a), true));
+    }
+    DREAM3D_REQUIRE_EQUAL(am->size(), numArrays)
+    for(size_t a = 0; a < numArrays; a++)
+    {
+      IDataArray::Pointer array = am->getAttributeArray(QString("Array%1").arg(a));
+      DREAM3D_REQUIRE_VALID_POINTER(array.get())
+      DREAM3D_REQUIRE(array->getName() == QString("Array%1").arg(a))
+    }
+
+    // Replacing keeps a single entry under the name
+    am->insertOrAssign(FloatArrayType::CreateArray(10, std::vector<size_t>(1, 1), "Array5", true));
+    DREAM3D_REQUIRE_EQUAL(am->size(), numArrays)
+    DREAM3D_REQUIRE_VALID_POINTER(am->getAttributeArrayAs<FloatArrayType>("Array5").get())
+
+    // Removing shifts the children behind it; every remaining name must still resolve
+    DREAM3D_REQUIRE_VALID_POINTER(am->removeAttributeArray("Array0").get())
+    DREAM3D_REQUIRE_VALID_POINTER(am->removeAttributeArray("Array100").get())
+    DREAM3D_REQUIRE_EQUAL(am->size(), numArrays - 2)
+    DREAM3D_REQUIRE(nullptr == am->getAttributeArray("Array0"))
+    DREAM3D_REQUIRE(nullptr == am->getAttributeArray("Array100"))
+    for(size_t a = 1; a < numArrays; a++)
+    {
+      if(a == 100)
+      {
+        continue;
+      }
+      IDataArray::Pointer array = am->getAttributeArray(QString("Array%1").arg(a));
+      DREAM3D_REQUIRE_VALID_POINTER(array.get())
+      DREAM3D_REQUIRE(array->getName() == QString("Array%1").arg(a))
+    }
+
+    // Renaming moves the index entry and refuses names that are taken
+    DREAM3D_REQUIRE_EQUAL(am->renameAttributeArray("Array7", "Renamed", false), RenameErrorCodes::SUCCESS)
+    DREAM3D_REQUIRE(nullptr == am->getAttributeArray("Array7"))
+    DREAM3D_REQUIRE_VALID_POINTER(am->getAttributeArray("Renamed").get())
+    DREAM3D_REQUIRE_EQUAL(am->renameAttributeArray("Array8", "Renamed", false), RenameErrorCodes::NEW_EXISTS)
+    DREAM3D_REQUIRE_VALID_POINTER(am->getAttributeArray("Array8").get())
+
+    am->clear();
+    DREAM3D_REQUIRE(am->empty())
+    DREAM3D_REQUIRE(nullptr == am->getAttributeArray("Array9"))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPathCache()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("DataContainer");
+    dca->addOrReplaceDataContainer(dc);
+    std::vector<size_t> tDims(1, 10);
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, "CellData", AttributeMatrix::Type::Cell);
+    dc->addOrReplaceAttributeMatrix(am);
+    Int32ArrayType::Pointer ids = Int32ArrayType::CreateArray(10, std::vector<size_t>(1, 1), "FeatureIds", true);
+    am->insertOrAssign(ids);
+
+    DataArrayPath idsPath("DataContainer", "CellData", "FeatureIds");
+    DREAM3D_REQUIRE(dca->getAttributeArray(idsPath) == ids)
+    DREAM3D_REQUIRE(dca->getAttributeMatrix(idsPath) == am)
+    DREAM3D_REQUIRE(dca->getDataContainer(idsPath) == dc)
+    DREAM3D_REQUIRE_EQUAL(dca->doesAttributeArrayExist(idsPath), true)
+
+    // A cached path must not survive a rename of any level
+    DREAM3D_REQUIRE_EQUAL(am->renameAttributeArray("FeatureIds", "GrainIds", false), RenameErrorCodes::SUCCESS)
+    DREAM3D_REQUIRE(nullptr == dca->getAttributeArray(idsPath))
+    DREAM3D_REQUIRE_EQUAL(dca->doesAttributeArrayExist(idsPath), false)
+    DataArrayPath grainIdsPath("DataContainer", "CellData", "GrainIds");
+    DREAM3D_REQUIRE(dca->getAttributeArray(grainIdsPath) == ids)
+
+    DREAM3D_REQUIRE_EQUAL(dc->renameAttributeMatrix("CellData", "Cells", false), true)
+    DREAM3D_REQUIRE(nullptr == dca->getAttributeArray(grainIdsPath))
+    DREAM3D_REQUIRE_EQUAL(dca->doesAttributeMatrixExist(grainIdsPath), false)
+    DataArrayPath cellsPath("DataContainer", "Cells", "GrainIds");
+    DREAM3D_REQUIRE(dca->getAttributeArray(cellsPath) == ids)
+
+    DREAM3D_REQUIRE_EQUAL(dca->renameDataContainer("DataContainer", "Volume"), true)
+    DREAM3D_REQUIRE(nullptr == dca->getAttributeArray(cellsPath))
+    DataArrayPath volumePath("Volume", "Cells", "GrainIds");
+    DREAM3D_REQUIRE(dca->getAttributeArray(volumePath) == ids)
+
+    // Replacing an array under the same name resolves to the new array
+    Int32ArrayType::Pointer newIds = Int32ArrayType::CreateArray(10, std::vector<size_t>(1, 1), "GrainIds", true);
+    am->insertOrAssign(newIds);
+    DREAM3D_REQUIRE(dca->getAttributeArray(volumePath) == newIds)
+
+    // Removal of the data container drops everything below it
+    uint64_t revision = dca->getStructureRevision();
+    DREAM3D_REQUIRE_VALID_POINTER(dca->removeDataContainer("Volume").get())
+    DREAM3D_REQUIRE(dca->getStructureRevision() != revision)
+    DREAM3D_REQUIRE(nullptr == dca->getAttributeArray(volumePath))
+    DREAM3D_REQUIRE(nullptr == dca->getAttributeMatrix(volumePath))
+    DREAM3D_REQUIRE(nullptr == dca->getDataContainer(volumePath))
+    DREAM3D_REQUIRE_EQUAL(dca->doesAttributeArrayExist(volumePath), false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### DataContainerArrayTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestChildIndex());
+    DREAM3D_REGISTER_TEST(TestPathCache());
+  }
+
+private:
+  DataContainerArrayTest(const DataContainerArrayTest&); // Copy Constructor Not Implemented
+  void operator=(const DataContainerArrayTest&);         // Move assignment Not Implemented
+};
@@ -0,0 +1,324 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonObject>
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/StringDataArray.h"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/DataContainers/SharedMemoryDataExchange.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Geometry/RectGridGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Geometry/VertexGeom.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class SharedMemoryDataExchangeTest
+{
+public:
+  SharedMemoryDataExchangeTest() = default;
+  virtual ~SharedMemoryDataExchangeTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QString segmentName(const QString& suffix) const
+  {
+    return QString("SIMPLSharedMemoryTest_%1_%2").arg(QCoreApplication::applicationPid()).arg(suffix);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer createDataContainerArray() const
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("ImageDataContainer");
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    image->setDimensions(4, 3, 2);
+    image->setSpacing(0.5f, 0.25f, 2.0f);
+    image->setOrigin(1.0f, -2.0f, 3.0f);
+    dc->setGeometry(image);
+
+    std::vector<size_t> tDims = {4, 3, 2};
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, "CellData", AttributeMatrix::Type::Cell);
+    FloatArrayType::Pointer floats = FloatArrayType::CreateArray(24, std::vector<size_t>(1, 3), "Floats", true);
+    for(size_t i = 0; i < floats->getSize(); i++)
+    {
+      floats->setValue(i, static_cast<float>(i) * 0.5f);
+    }
+    am->insertOrAssign(floats);
+    Int32ArrayType::Pointer ints = Int32ArrayType::CreateArray(24, std::vector<size_t>(1, 1), "Ints", true);
+    for(size_t i = 0; i < ints->getSize(); i++)
+    {
+      ints->setValue(i, -static_cast<int32_t>(i));
+    }
+    am->insertOrAssign(ints);
+    UInt8ArrayType::Pointer bytes = UInt8ArrayType::CreateArray(24, std::vector<size_t>{2, 2}, "Bytes", true);
+    for(size_t i = 0; i < bytes->getSize(); i++)
+    {
+      bytes->setValue(i, static_cast<uint8_t>(i % 256));
+    }
+    am->insertOrAssign(bytes);
+    am->insertOrAssign(StringDataArray::CreateArray(24, QString("Strings"), true));
+    dc->addOrReplaceAttributeMatrix(am);
+
+    AttributeMatrix::Pointer emptyAm = AttributeMatrix::New(std::vector<size_t>(1, 0), "EnsembleData", AttributeMatrix::Type::CellEnsemble);
+    emptyAm->insertOrAssign(DoubleArrayType::CreateArray(0, std::vector<size_t>(1, 1), "Empty", true));
+    dc->addOrReplaceAttributeMatrix(emptyAm);
+    dca->addOrReplaceDataContainer(dc);
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestNames()
+  {
+    DREAM3D_REQUIRE(SharedMemoryDataExchange::NormalizeName("Results") == QString("/Results"))
+    DREAM3D_REQUIRE(SharedMemoryDataExchange::NormalizeName("/Results") == QString("/Results"))
+    DREAM3D_REQUIRE(SharedMemoryDataExchange::NormalizeName("").isEmpty())
+    DREAM3D_REQUIRE(SharedMemoryDataExchange::NormalizeName("/").isEmpty())
+    DREAM3D_REQUIRE(SharedMemoryDataExchange::NormalizeName("a/b").isEmpty())
+
+    QString errorMessage;
+    DREAM3D_REQUIRE(SharedMemoryDataExchange::Export(createDataContainerArray(), "a/b", &errorMessage) < 0)
+    DREAM3D_REQUIRE(!errorMessage.isEmpty())
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRoundTrip()
+  {
+    QString name = segmentName("RoundTrip");
+    DataContainerArray::Pointer source = createDataContainerArray();
+    QString errorMessage;
+    int32_t err = SharedMemoryDataExchange::Export(source, name, &errorMessage);
+    if(!SharedMemoryDataExchange::IsSupported())
+    {
+      DREAM3D_REQUIRE_EQUAL(err, SharedMemoryDataExchange::k_NotSupported)
+      DREAM3D_REQUIRE(nullptr == SharedMemoryDataExchange::Import(name))
+      return;
+    }
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+
+    // The same name can not be exported twice
+    DREAM3D_REQUIRE_EQUAL(SharedMemoryDataExchange::Export(source, name, &errorMessage), SharedMemoryDataExchange::k_CreateFailed)
+
+    QJsonObject descriptor = SharedMemoryDataExchange::ReadDescriptor(name, &errorMessage);
+    DREAM3D_REQUIRE_EQUAL(descriptor["FormatVersion"].toInt(), SharedMemoryDataExchange::k_FormatVersion)
+    QJsonArray dcArray = descriptor["DataContainers"].toArray();
+    DREAM3D_REQUIRE_EQUAL(dcArray.size(), 1)
+    QJsonArray amArray = dcArray[0].toObject()["AttributeMatrices"].toArray();
+    DREAM3D_REQUIRE_EQUAL(amArray.size(), 2)
+    for(const auto& daValue : amArray[0].toObject()["DataArrays"].toArray())
+    {
+      size_t offset = static_cast<size_t>(daValue.toObject()["Offset"].toDouble());
+      DREAM3D_REQUIRE_EQUAL(offset % SharedMemoryDataExchange::k_Alignment, 0)
+    }
+
+    DataContainerArray::Pointer imported = SharedMemoryDataExchange::Import(name, &errorMessage);
+    DREAM3D_REQUIRE_VALID_POINTER(imported.get())
+    DataContainer::Pointer dc = imported->getDataContainer("ImageDataContainer");
+    DREAM3D_REQUIRE_VALID_POINTER(dc.get())
+    ImageGeom::Pointer image = dc->getGeometryAs<ImageGeom>();
+    DREAM3D_REQUIRE_VALID_POINTER(image.get())
+    SizeVec3Type dims = image->getDimensions();
+    DREAM3D_REQUIRE(dims[0] == 4 && dims[1] == 3 && dims[2] == 2)
+    FloatVec3Type spacing = image->getSpacing();
+    DREAM3D_REQUIRE(spacing[0] == 0.5f && spacing[1] == 0.25f && spacing[2] == 2.0f)
+    FloatVec3Type origin = image->getOrigin();
+    DREAM3D_REQUIRE(origin[0] == 1.0f && origin[1] == -2.0f && origin[2] == 3.0f)
+
+    AttributeMatrix::Pointer am = dc->getAttributeMatrix("CellData");
+    DREAM3D_REQUIRE_VALID_POINTER(am.get())
+    DREAM3D_REQUIRE(am->getType() == AttributeMatrix::Type::Cell)
+    DREAM3D_REQUIRE(am->getTupleDimensions() == std::vector<size_t>({4, 3, 2}))
+    // String arrays have no flat buffer and are left out
+    DREAM3D_REQUIRE(nullptr == am->getAttributeArray("Strings"))
+
+    FloatArrayType::Pointer floats = am->getAttributeArrayAs<FloatArrayType>("Floats");
+    DREAM3D_REQUIRE_VALID_POINTER(floats.get())
+    DREAM3D_REQUIRE_EQUAL(floats->getNumberOfComponents(), 3)
+    for(size_t i = 0; i < floats->getSize(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(floats->getValue(i), static_cast<float>(i) * 0.5f)
+    }
+    Int32ArrayType::Pointer ints = am->getAttributeArrayAs<Int32ArrayType>("Ints");
+    DREAM3D_REQUIRE_VALID_POINTER(ints.get())
+    for(size_t i = 0; i < ints->getSize(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(ints->getValue(i), -static_cast<int32_t>(i))
+    }
+    UInt8ArrayType::Pointer bytes = am->getAttributeArrayAs<UInt8ArrayType>("Bytes");
+    DREAM3D_REQUIRE_VALID_POINTER(bytes.get())
+    DREAM3D_REQUIRE(bytes->getComponentDimensions() == std::vector<size_t>({2, 2}))
+    DREAM3D_REQUIRE_EQUAL(bytes->getValue(95), 95)
+
+    DoubleArrayType::Pointer empty = dc->getAttributeMatrix("EnsembleData")->getAttributeArrayAs<DoubleArrayType>("Empty");
+    DREAM3D_REQUIRE_VALID_POINTER(empty.get())
+    DREAM3D_REQUIRE_EQUAL(empty->getNumberOfTuples(), 0)
+
+    // Writes stay private to the importing array
+    floats->setValue(0, 42.0f);
+    DataContainerArray::Pointer second = SharedMemoryDataExchange::Import(name, &errorMessage);
+    DREAM3D_REQUIRE_VALID_POINTER(second.get())
+    FloatArrayType::Pointer secondFloats = second->getDataContainer("ImageDataContainer")->getAttributeMatrix("CellData")->getAttributeArrayAs<FloatArrayType>("Floats");
+    DREAM3D_REQUIRE_EQUAL(secondFloats->getValue(0), 0.0f)
+
+    // Growing an imported array moves it off the mapping
+    ints->resizeTuples(48);
+    DREAM3D_REQUIRE_EQUAL(ints->getValue(23), -23)
+
+    // Imported arrays outlive the name
+    DREAM3D_REQUIRE(SharedMemoryDataExchange::Unlink(name))
+    DREAM3D_REQUIRE(!SharedMemoryDataExchange::Unlink(name))
+    DREAM3D_REQUIRE(nullptr == SharedMemoryDataExchange::Import(name, &errorMessage))
+    DREAM3D_REQUIRE_EQUAL(secondFloats->getValue(3), 1.5f)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestGeometries()
+  {
+    QString name = segmentName("Geometries");
+    DataContainerArray::Pointer source = DataContainerArray::New();
+
+    SharedVertexList::Pointer vertices = TriangleGeom::CreateSharedVertexList(4);
+    float coords[12] = {0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.5f};
+    std::copy(coords, coords + 12, vertices->getPointer(0));
+    TriangleGeom::Pointer triangles = TriangleGeom::CreateGeometry(2, vertices, SIMPL::Geometry::TriangleGeometry);
+    MeshIndexType tris[6] = {0, 1, 2, 0, 2, 3};
+    std::copy(tris, tris + 6, triangles->getTriangles()->getPointer(0));
+    DataContainer::Pointer triangleDc = DataContainer::New("TriangleDataContainer");
+    triangleDc->setGeometry(triangles);
+    AttributeMatrix::Pointer faceAm = AttributeMatrix::New(std::vector<size_t>(1, 2), "FaceData", AttributeMatrix::Type::Face);
+    faceAm->insertOrAssign(Int32ArrayType::CreateArray(2, std::vector<size_t>(1, 2), "FaceLabels", true));
+    triangleDc->addOrReplaceAttributeMatrix(faceAm);
+    source->addOrReplaceDataContainer(triangleDc);
+
+    DataContainer::Pointer vertexDc = DataContainer::New("VertexDataContainer");
+    vertexDc->setGeometry(VertexGeom::CreateGeometry(std::static_pointer_cast<SharedVertexList>(vertices->deepCopy()), SIMPL::Geometry::VertexGeometry));
+    source->addOrReplaceDataContainer(vertexDc);
+
+    RectGridGeom::Pointer rectGrid = RectGridGeom::CreateGeometry(SIMPL::Geometry::RectGridGeometry);
+    rectGrid->setDimensions(SizeVec3Type(2, 1, 3));
+    std::vector<size_t> boundsCounts = {3, 2, 4};
+    std::vector<FloatArrayType::Pointer> bounds;
+    for(size_t axis = 0; axis < 3; axis++)
+    {
+      FloatArrayType::Pointer axisBounds = FloatArrayType::CreateArray(boundsCounts[axis], std::vector<size_t>(1, 1), "Bounds", true);
+      for(size_t i = 0; i < boundsCounts[axis]; i++)
+      {
+        axisBounds->setValue(i, static_cast<float>(axis) + static_cast<float>(i * i));
+      }
+      bounds.push_back(axisBounds);
+    }
+    rectGrid->setXBounds(bounds[0]);
+    rectGrid->setYBounds(bounds[1]);
+    rectGrid->setZBounds(bounds[2]);
+    DataContainer::Pointer rectGridDc = DataContainer::New("RectGridDataContainer");
+    rectGridDc->setGeometry(rectGrid);
+    source->addOrReplaceDataContainer(rectGridDc);
+
+    QString errorMessage;
+    int32_t err = SharedMemoryDataExchange::Export(source, name, &errorMessage);
+    if(!SharedMemoryDataExchange::IsSupported())
+    {
+      DREAM3D_REQUIRE_EQUAL(err, SharedMemoryDataExchange::k_NotSupported)
+      return;
+    }
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+
+    DataContainerArray::Pointer imported = SharedMemoryDataExchange::Import(name, &errorMessage);
+    DREAM3D_REQUIRE(SharedMemoryDataExchange::Unlink(name))
+    DREAM3D_REQUIRE_VALID_POINTER(imported.get())
+
+    TriangleGeom::Pointer importedTriangles = imported->getDataContainer("TriangleDataContainer")->getGeometryAs<TriangleGeom>();
+    DREAM3D_REQUIRE_VALID_POINTER(importedTriangles.get())
+    DREAM3D_REQUIRE_EQUAL(importedTriangles->getNumberOfVertices(), 4)
+    DREAM3D_REQUIRE_EQUAL(importedTriangles->getNumberOfTris(), 2)
+    for(size_t i = 0; i < 12; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(importedTriangles->getVertices()->getValue(i), coords[i])
+    }
+    for(size_t i = 0; i < 6; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(importedTriangles->getTriangles()->getValue(i), tris[i])
+    }
+    DREAM3D_REQUIRE_VALID_POINTER(imported->getDataContainer("TriangleDataContainer")->getAttributeMatrix("FaceData")->getAttributeArray("FaceLabels").get())
+
+    VertexGeom::Pointer importedVertices = imported->getDataContainer("VertexDataContainer")->getGeometryAs<VertexGeom>();
+    DREAM3D_REQUIRE_VALID_POINTER(importedVertices.get())
+    DREAM3D_REQUIRE_EQUAL(importedVertices->getNumberOfVertices(), 4)
+    DREAM3D_REQUIRE_EQUAL(importedVertices->getVertices()->getValue(11), 0.5f)
+
+    RectGridGeom::Pointer importedRectGrid = imported->getDataContainer("RectGridDataContainer")->getGeometryAs<RectGridGeom>();
+    DREAM3D_REQUIRE_VALID_POINTER(importedRectGrid.get())
+    SizeVec3Type dims = importedRectGrid->getDimensions();
+    DREAM3D_REQUIRE(dims[0] == 2 && dims[1] == 1 && dims[2] == 3)
+    DREAM3D_REQUIRE_EQUAL(importedRectGrid->getXBounds()->getValue(2), 4.0f)
+    DREAM3D_REQUIRE_EQUAL(importedRectGrid->getYBounds()->getValue(1), 2.0f)
+    DREAM3D_REQUIRE_EQUAL(importedRectGrid->getZBounds()->getValue(3), 11.0f)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### SharedMemoryDataExchangeTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestNames());
+    DREAM3D_REGISTER_TEST(TestRoundTrip());
+    DREAM3D_REGISTER_TEST(TestGeometries());
+  }
+
+private:
+  SharedMemoryDataExchangeTest(const SharedMemoryDataExchangeTest&); // Copy Constructor Not Implemented
+  void operator=(const SharedMemoryDataExchangeTest&);               // Move assignment Not Implemented
+};
@@ -1,5 +1,8 @@
 set(TEST_${SUBDIR_NAME}_NAMES
+  AttributeMatrixTest
+  DataContainerArrayTest
   DataContainerBundleTest
+  SharedMemoryDataExchangeTest
 )
 
 SIMPL_ADD_UNIT_TEST("${TEST_${SUBDIR_NAME}_NAMES}" "${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/Testing/Cxx")
@@ -132,18 +132,28 @@ int H5FilterParametersWriter::writePipelineToFile(FilterPipeline::Pointer pipeli
   QH5Lite::writeStringAttribute(fileId, "/", SIMPL::HDF5::FileVersionName, SIMPL::HDF5::FileVersion);
   QH5Lite::writeStringAttribute(fileId, "/", SIMPL::HDF5::DREAM3DVersion, SIMPLib::Version::Complete());
 
+  JsonFilterParametersWriter::Pointer jsonWriter = JsonFilterParametersWriter::New();
+  QString jsonString = jsonWriter->writePipelineToString(pipeline, pipelineName, expandPipeline, obs);
+
+  return WritePipelineString(fileId, pipelineName, jsonString);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int H5FilterParametersWriter::WritePipelineString(hid_t fileId, const QString& pipelineName, const QString& jsonString)
+{
   hid_t pipelineGroupId = QH5Utilities::createGroup(fileId, SIMPL::StringConstants::PipelineGroupName);
-  scopedFileSentinel.addGroupId(pipelineGroupId);
-  setGroupId(pipelineGroupId);
+  if(pipelineGroupId < 0)
+  {
+    return -1;
+  }
+  H5ScopedGroupSentinel groupSentinel(pipelineGroupId, false);
 
   QH5Lite::writeScalarAttribute(pipelineGroupId, "/" + SIMPL::StringConstants::PipelineGroupName, SIMPL::StringConstants::PipelineVersionName, 2);
   QH5Lite::writeStringAttribute(pipelineGroupId, "/" + SIMPL::StringConstants::PipelineGroupName, SIMPL::StringConstants::PipelineCurrentName, pipelineName);
 
-  JsonFilterParametersWriter::Pointer jsonWriter = JsonFilterParametersWriter::New();
-  QString jsonString = jsonWriter->writePipelineToString(pipeline, pipelineName, expandPipeline, obs);
-  QH5Lite::writeStringDataset(pipelineGroupId, pipelineName, jsonString);
-
-  return 0;
+  return QH5Lite::writeStringDataset(pipelineGroupId, pipelineName, jsonString);
 }
 
 // -----------------------------------------------------------------------------
@@ -83,6 +83,16 @@ public:
    */
   int writePipelineToFile(FilterPipeline::Pointer pipeline, QString filePath, QString pipelineName, bool expandPipeline, QList<IObserver*> obs = QList<IObserver*>()) override;
 
+  /**
+   * @brief WritePipelineString Writes a pipeline that was already converted to Json into the
+   * Pipeline group of an open DREAM3D file.
+   * @param fileId The open HDF5 file
+   * @param pipelineName The name of the pipeline dataset
+   * @param jsonString The pipeline as produced by JsonFilterParametersWriter::writePipelineToString()
+   * @return Negative value on error
+   */
+  static int WritePipelineString(hid_t fileId, const QString& pipelineName, const QString& jsonString);
+
   /**
    * @brief Setter property for PipelineGroupId
    */
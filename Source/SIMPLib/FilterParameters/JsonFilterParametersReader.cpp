@@ -34,18 +34,163 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "JsonFilterParametersReader.h"
 
+#include <algorithm>
+#include <vector>
+
+#include <QtCore/QCborMap>
+#include <QtCore/QCborValue>
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
 #include <QtCore/QFileInfo>
 #include <QtCore/QJsonDocument>
+#include <QtCore/QSaveFile>
+#include <QtCore/QStandardPaths>
 #include <QtCore/QStringList>
 #include <QtCore/QTextStream>
+#include <QtCore/QThread>
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/CoreFilters/EmptyFilter.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Messages/PipelineErrorMessage.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 #include "SIMPLib/Utilities/StringOperations.h"
 
+namespace
+{
+// Smaller pipelines parse faster than the cache can be looked up
+const qint64 k_MinCachedPipelineSize = 64 * 1024;
+// Smaller pipelines are not worth handing the filters between threads
+const size_t k_MinParallelFilterCount = 16;
+// Increment whenever the layout of the cached pipelines changes
+const char k_CachedPipelineFormat[] = "SIMPLPipelineCache1";
+
+/**
+ * @brief Returns the path of the cached binary form of a pipeline file with the given contents
+ */
+QString cachedPipelinePath(const QByteArray& contents)
+{
+  QCryptographicHash hash(QCryptographicHash::Sha1);
+  hash.addData(k_CachedPipelineFormat);
+  hash.addData(contents);
+  return JsonFilterParametersReader::PipelineCacheDirectory() + "/" + QString::fromLatin1(hash.result().toHex()) + ".cbor";
+}
+
+/**
+ * @brief Reads a cached pipeline into 'root'. Returns false if there is no usable cache file.
+ */
+bool readCachedPipeline(const QString& cachePath, QJsonObject& root)
+{
+  QFile cacheFile(cachePath);
+  if(!cacheFile.open(QIODevice::ReadOnly))
+  {
+    return false;
+  }
+  QCborParserError cborError;
+  QCborValue value = QCborValue::fromCbor(cacheFile.readAll(), &cborError);
+  if(cborError.error != QCborError::NoError || !value.isMap())
+  {
+    return false;
+  }
+  root = value.toMap().toJsonObject();
+
+  // The modification time orders the entries for eviction, so a hit marks the entry as recently used
+  cacheFile.setFileTime(QDateTime::currentDateTime(), QFileDevice::FileModificationTime);
+  return true;
+}
+
+/**
+ * @brief Removes the least recently used cached pipelines until at most 'maxEntries' are left
+ */
+void trimPipelineCache(const QString& cacheDirPath, int maxEntries)
+{
+  QDir cacheDir(cacheDirPath);
+  QFileInfoList entries = cacheDir.entryInfoList({"*.cbor"}, QDir::Files, QDir::Time);
+  for(int i = std::max(maxEntries, 0); i < entries.size(); i++)
+  {
+    QFile::remove(entries[i].absoluteFilePath());
+  }
+}
+
+/**
+ * @brief Writes 'root' as the cached form of a pipeline. Failures are ignored; the next read parses the Json again.
+ */
+void writeCachedPipeline(const QString& cachePath, const QJsonObject& root)
+{
+  if(!QDir().mkpath(QFileInfo(cachePath).absolutePath()))
+  {
+    return;
+  }
+  QSaveFile cacheFile(cachePath);
+  if(cacheFile.open(QIODevice::WriteOnly))
+  {
+    cacheFile.write(QCborValue::fromJsonValue(root).toCbor());
+    cacheFile.commit();
+  }
+}
+
+/**
+ * @brief A filter of the pipeline being read, collected serially and then instantiated and read in parallel
+ */
+struct PipelineFilterEntry
+{
+  IFilterFactory::Pointer factory;
+  QJsonObject json;
+  QString filterName;
+  bool enabled = true;
+  bool serial = false;
+  bool parametersRead = false;
+  AbstractFilter::Pointer filter;
+};
+
+/**
+ * @brief Instantiates the filters of a range of entries and reads their parameters. Filters that cannot read their
+ * parameters concurrently are left for the caller. Every filter is moved to the thread that reads the pipeline.
+ */
+class ReadPipelineFiltersImpl
+{
+public:
+  ReadPipelineFiltersImpl(std::vector<PipelineFilterEntry>& entries, QThread* targetThread)
+  : m_Entries(entries)
+  , m_TargetThread(targetThread)
+  {
+  }
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      PipelineFilterEntry& entry = m_Entries[i];
+      if(nullptr == entry.factory || entry.serial)
+      {
+        continue;
+      }
+      entry.filter = entry.factory->create();
+      if(nullptr == entry.filter)
+      {
+        continue;
+      }
+      if(entry.filter->thread() != m_TargetThread)
+      {
+        entry.filter->moveToThread(m_TargetThread);
+      }
+      entry.filter->setEnabled(entry.enabled);
+      if(entry.filter->canReadFilterParametersConcurrently())
+      {
+        entry.filter->readFilterParameters(entry.json);
+        entry.parametersRead = true;
+      }
+    }
+  }
+
+private:
+  std::vector<PipelineFilterEntry>& m_Entries;
+  QThread* m_TargetThread = nullptr;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -433,49 +578,75 @@ FilterPipeline::Pointer JsonFilterParametersReader::readPipeline(IObserver* obs)
     pipeline = FilterPipeline::NullPointer();
   }
 
+  // Looking up the factories may load plugins, so it happens serially
+  std::vector<PipelineFilterEntry> entries(filterCount > 0 ? static_cast<size_t>(filterCount) : 0);
   for(int i = 0; i < filterCount; ++i)
   {
     openFilterGroup(nullptr, i);
 
-    IFilterFactory::Pointer factory = IFilterFactory::NullPointer();
-    QString filterName = m_CurrentFilterIndex[SIMPL::Settings::FilterName].toString();
-    bool filterEnabled = m_CurrentFilterIndex[SIMPL::Settings::FilterEnabled].toBool(true);
+    PipelineFilterEntry& entry = entries[i];
+    entry.filterName = m_CurrentFilterIndex[SIMPL::Settings::FilterName].toString();
+    entry.enabled = m_CurrentFilterIndex[SIMPL::Settings::FilterEnabled].toBool(true);
     // First try the UUID for the filter and see what we get.
     QUuid uuid = QUuid(m_CurrentFilterIndex[SIMPL::Settings::FilterUuid].toString(""));
     if(!uuid.isNull())
     {
-      factory = filtManager->getFactoryFromUuid(uuid);
+      entry.factory = filtManager->getFactoryFromUuid(uuid);
     }
     // If the UUID was not available, then try the filter class name
-    if(nullptr == factory.get())
+    if(nullptr == entry.factory.get())
     {
       QJsonValue jsValue = m_CurrentFilterIndex[SIMPL::Settings::FilterName];
       if(jsValue.isString())
       {
-        filterName = jsValue.toString("JSON Key 'Filter_Name' missing.");
-        factory = filtManager->getFactoryFromClassName(filterName);
+        entry.filterName = jsValue.toString("JSON Key 'Filter_Name' missing.");
+        entry.factory = filtManager->getFactoryFromClassName(entry.filterName);
       }
     }
+#ifdef SIMPL_EMBED_PYTHON
+    // Python filters need the interpreter lock to be created
+    entry.serial = nullptr != entry.factory.get() && filtManager->isPythonFilter(entry.factory->getUuid());
+#endif
+    entry.json = m_CurrentFilterIndex;
+    closeFilterGroup();
+  }
 
-    if(nullptr != factory.get())
-    {
-      AbstractFilter::Pointer filter = factory->create();
+  // Instantiating the filters and reading their parameters is independent for every filter
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, entries.size());
+  dataAlg.setParallelizationEnabled(entries.size() >= k_MinParallelFilterCount);
+  dataAlg.execute(ReadPipelineFiltersImpl(entries, QThread::currentThread()));
 
-      if(nullptr != filter.get())
+  for(auto& entry : entries)
+  {
+    if(nullptr != entry.factory.get())
+    {
+      if(entry.serial)
       {
-        filter->setEnabled(filterEnabled);
-        filter->readFilterParameters(m_CurrentFilterIndex);
-        pipeline->pushBack(filter);
+        entry.filter = entry.factory->create();
+        if(nullptr != entry.filter.get())
+        {
+          entry.filter->setEnabled(entry.enabled);
+        }
+      }
+      if(nullptr != entry.filter.get())
+      {
+        if(!entry.parametersRead)
+        {
+          entry.filter->readFilterParameters(entry.json);
+        }
+        pipeline->pushBack(entry.filter);
       }
     }
     else // Could not find the filter because the specific name has not been registered. This could
          // be due to a name change for the filter.
     {
+      QString filterName = entry.filterName;
       EmptyFilter::Pointer filter = EmptyFilter::New();
       QString humanLabel = QString("UNKNOWN FILTER: ") + filterName;
       filter->setHumanLabel(humanLabel);
       filter->setOriginalFilterName(filterName);
-      filter->setEnabled(filterEnabled);
+      filter->setEnabled(entry.enabled);
       pipeline->pushBack(filter);
 
       if(nullptr != obs)
@@ -491,7 +662,6 @@ FilterPipeline::Pointer JsonFilterParametersReader::readPipeline(IObserver* obs)
         obs->processPipelineMessage(pm);
       }
     }
-    closeFilterGroup();
   }
   return pipeline;
 }
@@ -557,16 +727,33 @@ QJsonParseError JsonFilterParametersReader::openFile(QString filePath)
     closeFile();
   }
   QJsonParseError parseError;
+  parseError.offset = 0;
+  parseError.error = QJsonParseError::NoError;
   QFile inputFile(filePath);
   if(inputFile.open(QIODevice::ReadOnly))
   {
     QByteArray byteArray = inputFile.readAll();
-    QJsonDocument doc = QJsonDocument::fromJson(byteArray, &parseError);
-    if(parseError.error != QJsonParseError::NoError)
+
+    // Large pipelines are kept in binary form, keyed by the hash of the file contents
+    QString cachePath;
+    if(m_UsePipelineCache && byteArray.size() >= k_MinCachedPipelineSize)
     {
-      return parseError;
+      cachePath = cachedPipelinePath(byteArray);
+    }
+    if(cachePath.isEmpty() || !readCachedPipeline(cachePath, m_Root))
+    {
+      QJsonDocument doc = QJsonDocument::fromJson(byteArray, &parseError);
+      if(parseError.error != QJsonParseError::NoError)
+      {
+        return parseError;
+      }
+      m_Root = doc.object();
+      if(!cachePath.isEmpty())
+      {
+        writeCachedPipeline(cachePath, m_Root);
+        trimPipelineCache(QFileInfo(cachePath).absolutePath(), m_PipelineCacheLimit);
+      }
     }
-    m_Root = doc.object();
 
     QJsonObject meta = m_Root[SIMPL::Settings::PipelineBuilderGroup].toObject();
     m_MaxFilterIndex = meta[SIMPL::Settings::NumFilters].toInt();
@@ -750,3 +937,38 @@ int JsonFilterParametersReader::getMaxFilterIndex() const
 {
   return m_MaxFilterIndex;
 }
+
+// -----------------------------------------------------------------------------
+void JsonFilterParametersReader::setUsePipelineCache(bool value)
+{
+  m_UsePipelineCache = value;
+}
+
+// -----------------------------------------------------------------------------
+bool JsonFilterParametersReader::getUsePipelineCache() const
+{
+  return m_UsePipelineCache;
+}
+
+// -----------------------------------------------------------------------------
+void JsonFilterParametersReader::setPipelineCacheLimit(int value)
+{
+  m_PipelineCacheLimit = value;
+}
+
+// -----------------------------------------------------------------------------
+int JsonFilterParametersReader::getPipelineCacheLimit() const
+{
+  return m_PipelineCacheLimit;
+}
+
+// -----------------------------------------------------------------------------
+QString JsonFilterParametersReader::PipelineCacheDirectory()
+{
+  QByteArray envPath = qgetenv("SIMPL_PIPELINE_CACHE");
+  if(!envPath.isEmpty())
+  {
+    return QString::fromLocal8Bit(envPath);
+  }
+  return QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation) + "/SIMPL/Pipelines";
+}
@@ -101,6 +101,36 @@ public:
    */
   int getMaxFilterIndex() const;
 
+  /**
+   * @brief Setter property for UsePipelineCache
+   */
+  void setUsePipelineCache(bool value);
+  /**
+   * @brief Getter property for UsePipelineCache. When true, openFile() keeps a binary form of large pipeline files
+   * in PipelineCacheDirectory(), keyed by the hash of the file contents, and reads it instead of parsing the Json.
+   * The cache is off by default.
+   * @return Value of UsePipelineCache
+   */
+  bool getUsePipelineCache() const;
+
+  /**
+   * @brief Setter property for PipelineCacheLimit
+   */
+  void setPipelineCacheLimit(int value);
+  /**
+   * @brief Getter property for PipelineCacheLimit. Adding a pipeline to the cache removes the least recently used
+   * entries beyond this number.
+   * @return Value of PipelineCacheLimit
+   */
+  int getPipelineCacheLimit() const;
+
+  /**
+   * @brief Returns the directory of the cached binary pipelines: the SIMPL_PIPELINE_CACHE environment variable if it
+   * is set, otherwise Pipelines in the user's generic cache directory.
+   * @return
+   */
+  static QString PipelineCacheDirectory();
+
   /**
    * @brief ReadPipelineFromFile Reads the Json formatted file and returns a FilterPipeline object
    * that contains all the filters that could be found. If a filter can not be found then that filter is simply skipped.
@@ -221,10 +251,17 @@ protected:
 private:
   QString m_FileName = {};
   int m_MaxFilterIndex = {};
+  bool m_UsePipelineCache = {false};
+  int m_PipelineCacheLimit = {32};
 
   QJsonObject m_Root;
   QJsonObject m_CurrentFilterIndex;
 
+  /**
+   * @brief Collects the filters serially, then instantiates them and reads their parameters in parallel
+   * @param obs
+   * @return
+   */
   FilterPipeline::Pointer readPipeline(IObserver* obs);
 
 public:
@@ -0,0 +1,228 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QUuid>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/CoreFilters/CreateDataContainer.h"
+#include "SIMPLib/FilterParameters/JsonFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/JsonFilterParametersWriter.h"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class JsonFilterParametersReaderTest
+{
+public:
+  JsonFilterParametersReaderTest() = default;
+  virtual ~JsonFilterParametersReaderTest() = default;
+
+  const int k_FilterCount = 600;
+
+  QString testDir()
+  {
+    return UnitTest::TestTempDir + "/JsonFilterParametersReaderTest";
+  }
+
+  QString pipelineFilePath()
+  {
+    return testDir() + "/LargePipeline.json";
+  }
+
+  QString cacheDir()
+  {
+    return testDir() + "/PipelineCache";
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QDir(testDir()).removeRecursively();
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void checkPipeline(const FilterPipeline::Pointer& pipeline)
+  {
+    DREAM3D_REQUIRE_VALID_POINTER(pipeline.get())
+    DREAM3D_REQUIRE_EQUAL(pipeline->size(), k_FilterCount)
+    FilterPipeline::FilterContainerType& filters = pipeline->getFilterContainer();
+    for(int i = 0; i < k_FilterCount; i++)
+    {
+      CreateDataContainer::Pointer filter = std::dynamic_pointer_cast<CreateDataContainer>(filters[i]);
+      DREAM3D_REQUIRE_VALID_POINTER(filter.get())
+      DREAM3D_REQUIRE(filter->getDataContainerName().getDataContainerName() == QString("DataContainer%1").arg(i))
+      DREAM3D_REQUIRE_EQUAL(filter->getEnabled(), i % 7 != 0)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestLargePipeline()
+  {
+    QDir(testDir()).removeRecursively();
+    QDir().mkpath(testDir());
+    qputenv("SIMPL_PIPELINE_CACHE", cacheDir().toLocal8Bit());
+
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    for(int i = 0; i < k_FilterCount; i++)
+    {
+      CreateDataContainer::Pointer filter = CreateDataContainer::New();
+      filter->setDataContainerName(DataArrayPath(QString("DataContainer%1").arg(i), "", ""));
+      filter->setEnabled(i % 7 != 0);
+      pipeline->pushBack(filter);
+    }
+    JsonFilterParametersWriter::Pointer writer = JsonFilterParametersWriter::New();
+    int err = writer->writePipelineToFile(pipeline, pipelineFilePath(), "LargePipeline", false);
+    DREAM3D_REQUIRE(err >= 0)
+
+    // The cache is off by default
+    JsonFilterParametersReader::Pointer reader = JsonFilterParametersReader::New();
+    DREAM3D_REQUIRE_EQUAL(reader->getUsePipelineCache(), false)
+    checkPipeline(reader->readPipelineFromFile(pipelineFilePath()));
+    DREAM3D_REQUIRE_EQUAL(QDir(cacheDir()).exists(), false)
+
+    // The first read with the cache creates the binary form, the second one reads it
+    reader = JsonFilterParametersReader::New();
+    reader->setUsePipelineCache(true);
+    checkPipeline(reader->readPipelineFromFile(pipelineFilePath()));
+    QStringList cacheFiles = QDir(cacheDir()).entryList(QDir::Files);
+    DREAM3D_REQUIRE_EQUAL(cacheFiles.size(), 1)
+
+    reader = JsonFilterParametersReader::New();
+    reader->setUsePipelineCache(true);
+    checkPipeline(reader->readPipelineFromFile(pipelineFilePath()));
+    DREAM3D_REQUIRE_EQUAL(QDir(cacheDir()).entryList(QDir::Files).size(), 1)
+
+    // Changing the file changes the key
+    pipeline->popFront();
+    err = writer->writePipelineToFile(pipeline, pipelineFilePath(), "LargePipeline", false);
+    DREAM3D_REQUIRE(err >= 0)
+    reader = JsonFilterParametersReader::New();
+    reader->setUsePipelineCache(true);
+    FilterPipeline::Pointer shorter = reader->readPipelineFromFile(pipelineFilePath());
+    DREAM3D_REQUIRE_VALID_POINTER(shorter.get())
+    DREAM3D_REQUIRE_EQUAL(shorter->size(), k_FilterCount - 1)
+    DREAM3D_REQUIRE_EQUAL(QDir(cacheDir()).entryList(QDir::Files).size(), 2)
+
+    // Adding an entry beyond the limit evicts the older ones
+    pipeline->popFront();
+    err = writer->writePipelineToFile(pipeline, pipelineFilePath(), "LargePipeline", false);
+    DREAM3D_REQUIRE(err >= 0)
+    reader = JsonFilterParametersReader::New();
+    reader->setUsePipelineCache(true);
+    reader->setPipelineCacheLimit(1);
+    shorter = reader->readPipelineFromFile(pipelineFilePath());
+    DREAM3D_REQUIRE_VALID_POINTER(shorter.get())
+    DREAM3D_REQUIRE_EQUAL(shorter->size(), k_FilterCount - 2)
+    DREAM3D_REQUIRE_EQUAL(QDir(cacheDir()).entryList(QDir::Files).size(), 1)
+
+    qunsetenv("SIMPL_PIPELINE_CACHE");
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestUnknownFilters()
+  {
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    for(int i = 0; i < 40; i++)
+    {
+      CreateDataContainer::Pointer filter = CreateDataContainer::New();
+      filter->setDataContainerName(DataArrayPath(QString("DataContainer%1").arg(i), "", ""));
+      pipeline->pushBack(filter);
+    }
+    JsonFilterParametersWriter::Pointer writer = JsonFilterParametersWriter::New();
+    QString json = writer->writePipelineToString(pipeline, "UnknownFilters", false);
+
+    // Every third filter is renamed to a class nobody provides
+    QJsonObject root = QJsonDocument::fromJson(json.toUtf8()).object();
+    for(int i = 0; i < 40; i += 3)
+    {
+      QString key = QString::number(i);
+      QJsonObject filterObj = root[key].toObject();
+      filterObj[SIMPL::Settings::FilterName] = "NoSuchFilter";
+      filterObj[SIMPL::Settings::FilterUuid] = QUuid::createUuid().toString();
+      root[key] = filterObj;
+    }
+
+    JsonFilterParametersReader::Pointer reader = JsonFilterParametersReader::New();
+    FilterPipeline::Pointer readPipeline = reader->readPipelineFromJson(root);
+    DREAM3D_REQUIRE_VALID_POINTER(readPipeline.get())
+    DREAM3D_REQUIRE_EQUAL(readPipeline->size(), 40)
+    FilterPipeline::FilterContainerType& filters = readPipeline->getFilterContainer();
+    for(int i = 0; i < 40; i++)
+    {
+      if(i % 3 == 0)
+      {
+        DREAM3D_REQUIRE(filters[i]->getNameOfClass() == "EmptyFilter")
+        continue;
+      }
+      CreateDataContainer::Pointer filter = std::dynamic_pointer_cast<CreateDataContainer>(filters[i]);
+      DREAM3D_REQUIRE_VALID_POINTER(filter.get())
+      DREAM3D_REQUIRE(filter->getDataContainerName().getDataContainerName() == QString("DataContainer%1").arg(i))
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### JsonFilterParametersReaderTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestLargePipeline());
+    DREAM3D_REGISTER_TEST(TestUnknownFilters());
+
+    DREAM3D_REGISTER_TEST(RemoveTestFiles());
+  }
+
+private:
+  JsonFilterParametersReaderTest(const JsonFilterParametersReaderTest&); // Copy Constructor Not Implemented
+  void operator=(const JsonFilterParametersReaderTest&);                 // Move assignment Not Implemented
+};
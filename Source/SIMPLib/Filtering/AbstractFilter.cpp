@@ -344,6 +344,12 @@ void AbstractFilter::readFilterParameters(QJsonObject& obj)
   }
 }
 
+// -----------------------------------------------------------------------------
+bool AbstractFilter::canReadFilterParametersConcurrently() const
+{
+  return false;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -513,6 +519,13 @@ void AbstractFilter::printValues(std::ostream& out) const
 {
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AbstractFilter::finishBackgroundWork()
+{
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -205,6 +205,14 @@ public:
    */
   virtual void readFilterParameters(QJsonObject& obj);
 
+  /**
+   * @brief Returns true if readFilterParameters(QJsonObject&) only reads the Json object and the filter's own
+   * members, so that pipeline readers may read the parameters of several filters concurrently. The default is
+   * false; filters opt in once their parameters and setters were checked not to open files or touch shared state.
+   * @return
+   */
+  virtual bool canReadFilterParametersConcurrently() const;
+
   /**
    * @brief This method is called just before the writeFilterParameters() completes
    * @param obj The json object to add the filter parameters into
@@ -236,6 +244,12 @@ public:
    */
   virtual void execute() = 0;
 
+  /**
+   * @brief finishBackgroundWork Waits for work that execute() left running on another thread and reports its
+   * failures through setErrorCondition(). FilterPipeline calls this on its own thread before the pipeline finishes.
+   */
+  virtual void finishBackgroundWork();
+
   /**
    * @brief preflight Communicates with the GUI to request user settings for the filter and
    * run any necessary sanity checks before execution
@@ -44,6 +44,7 @@
 #include "SIMPLib/Filtering/CorePlugin.h"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Plugin/SIMPLPluginConstants.h"
+#include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
 
 FilterManager* FilterManager::s_Self = nullptr;
 
@@ -101,6 +102,7 @@ void FilterManager::RegisterKnownFilters(FilterManager* /* fm */)
 // -----------------------------------------------------------------------------
 FilterManager::Collection FilterManager::getFactories() const
 {
+  loadDeferredPlugins();
   return m_Factories;
 }
 
@@ -109,6 +111,7 @@ FilterManager::Collection FilterManager::getFactories() const
 // -----------------------------------------------------------------------------
 void FilterManager::printFactoryNames() const
 {
+  loadDeferredPlugins();
   QList<QString> keys = m_Factories.keys();
   for(const auto& key : keys)
   {
@@ -121,6 +124,7 @@ void FilterManager::printFactoryNames() const
 // -----------------------------------------------------------------------------
 FilterManager::Collection FilterManager::getFactories(const QString& groupName)
 {
+  loadDeferredPlugins();
   FilterManager::Collection groupFactories;
 
   for(FilterManager::Collection::iterator factory = m_Factories.begin(); factory != m_Factories.end(); ++factory)
@@ -139,6 +143,7 @@ FilterManager::Collection FilterManager::getFactories(const QString& groupName)
 // -----------------------------------------------------------------------------
 FilterManager::Collection FilterManager::getFactories(const QString& groupName, const QString& subGroupName)
 {
+  loadDeferredPlugins();
   FilterManager::Collection groupFactories;
   for(FilterManager::Collection::iterator factoryIter = m_Factories.begin(); factoryIter != m_Factories.end(); ++factoryIter)
   {
@@ -154,7 +159,7 @@ FilterManager::Collection FilterManager::getFactories(const QString& groupName,
 // -----------------------------------------------------------------------------
 bool FilterManager::contains(const QUuid& uuid) const
 {
-  return m_UuidFactories.contains(uuid);
+  return m_UuidFactories.contains(uuid) || m_DeferredNames.contains(uuid);
 }
 
 // -----------------------------------------------------------------------------
@@ -193,6 +198,86 @@ void FilterManager::addFilterFactory(const QString& name, IFilterFactory::Pointe
 
   m_Factories[name] = factory;
   m_UuidFactories[uuid] = factory;
+  m_DeferredPaths.remove(name);
+  m_DeferredNames.remove(uuid);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FilterManager::addDeferredFilterFactory(const QString& name, const QUuid& uuid, const QString& pluginPath)
+{
+  if(name.isEmpty() || uuid.isNull())
+  {
+    return false;
+  }
+  if(m_Factories.contains(name) || m_UuidFactories.contains(uuid) || m_DeferredPaths.contains(name) || m_DeferredNames.contains(uuid))
+  {
+    return false;
+  }
+
+  m_DeferredPaths[name] = pluginPath;
+  m_DeferredNames[uuid] = name;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+bool FilterManager::isDeferred(const QUuid& uuid) const
+{
+  return m_DeferredNames.contains(uuid);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterManager::loadDeferredPlugins() const
+{
+  while(!m_DeferredPaths.isEmpty())
+  {
+    loadDeferredPlugin(m_DeferredPaths.first());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterManager::loadDeferredPlugin(const QString& pluginPath) const
+{
+  // The manager always lives on the heap as a non-const singleton. Loading a plugin only completes the
+  // registrations that were already advertised, which is why lookups can do it and stay const.
+  FilterManager* self = const_cast<FilterManager*>(this);
+
+  // Drop the entries first so a plugin that fails to load, or no longer provides a filter, is not retried
+  for(auto iter = self->m_DeferredNames.begin(); iter != self->m_DeferredNames.end();)
+  {
+    if(m_DeferredPaths.value(iter.value()) == pluginPath)
+    {
+      iter = self->m_DeferredNames.erase(iter);
+    }
+    else
+    {
+      ++iter;
+    }
+  }
+  for(auto iter = self->m_DeferredPaths.begin(); iter != self->m_DeferredPaths.end();)
+  {
+    if(iter.value() == pluginPath)
+    {
+      iter = self->m_DeferredPaths.erase(iter);
+    }
+    else
+    {
+      ++iter;
+    }
+  }
+
+  SIMPLibPluginLoader::LoadPlugin(pluginPath, self, true);
+}
+
+// -----------------------------------------------------------------------------
+QList<QUuid> FilterManager::getRegisteredUuids() const
+{
+  return m_UuidFactories.keys();
 }
 
 // -----------------------------------------------------------------------------
@@ -243,6 +328,10 @@ QSet<QString> FilterManager::getSubGroupNames(const QString& groupName)
 // -----------------------------------------------------------------------------
 IFilterFactory::Pointer FilterManager::getFactoryFromClassName(const QString& filterName) const
 {
+  if(m_DeferredPaths.contains(filterName))
+  {
+    loadDeferredPlugin(m_DeferredPaths[filterName]);
+  }
   if(m_Factories.contains(filterName))
   {
     return m_Factories[filterName];
@@ -255,6 +344,10 @@ IFilterFactory::Pointer FilterManager::getFactoryFromClassName(const QString& fi
 // -----------------------------------------------------------------------------
 IFilterFactory::Pointer FilterManager::getFactoryFromUuid(const QUuid& uuid) const
 {
+  if(m_DeferredNames.contains(uuid))
+  {
+    loadDeferredPlugin(m_DeferredPaths[m_DeferredNames[uuid]]);
+  }
   if(m_UuidFactories.contains(uuid))
   {
     return m_UuidFactories[uuid];
@@ -267,6 +360,7 @@ IFilterFactory::Pointer FilterManager::getFactoryFromUuid(const QUuid& uuid) con
 // -----------------------------------------------------------------------------
 IFilterFactory::Pointer FilterManager::getFactoryFromHumanName(const QString& humanName)
 {
+  loadDeferredPlugins();
   IFilterFactory::Pointer Factory;
 
   for(FilterManager::Collection::iterator factory = m_Factories.begin(); factory != m_Factories.end(); ++factory)
@@ -322,6 +416,12 @@ QString FilterManager::ClassName()
 // -----------------------------------------------------------------------------
 bool FilterManager::removeFilterFactory(const QUuid& uuid)
 {
+  if(m_DeferredNames.contains(uuid))
+  {
+    m_DeferredPaths.remove(m_DeferredNames.take(uuid));
+    return true;
+  }
+
   if(!m_UuidFactories.contains(uuid))
   {
     return false;
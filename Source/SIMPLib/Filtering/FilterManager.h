@@ -133,6 +133,35 @@ public:
    */
   void addFilterFactory(const QString& name, IFilterFactory::Pointer factory);
 
+  /**
+   * @brief Records that the plugin at 'pluginPath' provides the filter 'name' with 'uuid' without loading the
+   * plugin. The plugin is loaded, and its filters registered, by the first call that needs one of its factories.
+   * Calls that enumerate factories load every deferred plugin first.
+   * @param name
+   * @param uuid
+   * @param pluginPath
+   * @return false if a filter with the same name or UUID is already registered
+   */
+  bool addDeferredFilterFactory(const QString& name, const QUuid& uuid, const QString& pluginPath);
+
+  /**
+   * @brief Returns true if the filter with the given UUID is provided by a plugin that has not been loaded yet
+   * @param uuid
+   * @return
+   */
+  bool isDeferred(const QUuid& uuid) const;
+
+  /**
+   * @brief Loads every plugin that still has deferred filters
+   */
+  void loadDeferredPlugins() const;
+
+  /**
+   * @brief Returns the UUIDs of the factories that are registered now, leaving deferred plugins unloaded
+   * @return
+   */
+  QList<QUuid> getRegisteredUuids() const;
+
   /**
    * @brief Removes the given filter factory by UUID. Returns true if successful
    * @param uuid
@@ -214,6 +243,14 @@ protected:
 private:
   Collection m_Factories;
   UuidCollection m_UuidFactories;
+  QMap<QString, QString> m_DeferredPaths;
+  QMap<QUuid, QString> m_DeferredNames;
+
+  /**
+   * @brief Loads the plugin at 'pluginPath' after dropping its deferred entries
+   * @param pluginPath
+   */
+  void loadDeferredPlugin(const QString& pluginPath) const;
 
 #ifdef SIMPL_EMBED_PYTHON
   QSet<QUuid> m_PythonUuids;
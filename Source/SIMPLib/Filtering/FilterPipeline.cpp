@@ -141,6 +141,8 @@ FilterPipeline::Pointer FilterPipeline::deepCopy()
   // Convert from JSon
   FilterPipeline::Pointer copy = FilterPipeline::New();
   copy->fromJson(json);
+  copy->setMemoryResource(m_MemoryResource);
+  copy->setScratchRetainLimit(m_ScratchRetainLimit);
 
   return copy;
 }
@@ -875,6 +877,12 @@ DataContainerArray::Pointer FilterPipeline::execute(DataContainerArray::Pointer
 
   int err = 0;
 
+  // Arrays created by the filters allocate from this pipeline's memory resource
+  MemoryResource::ScopedCurrent memoryResourceScope(m_MemoryResource);
+  // Temporary buffers are borrowed from this pipeline's arena
+  ScratchArena::ScopedCurrent scratchArenaScope(m_ScratchArena);
+  m_ScratchArena->resetStatistics();
+
   connectSignalsSlots();
 
   m_ExecutionResult = FilterPipeline::ExecutionResult::Invalid;
@@ -915,9 +923,13 @@ DataContainerArray::Pointer FilterPipeline::execute(DataContainerArray::Pointer
 
         notifyProgressMessage(100, "");
 
+        // Work that earlier filters left running in the background may still use the data, so it finishes first
+        finishBackgroundWork();
+
         Q_EMIT filt->filterCompleted(filt.get());
         Q_EMIT pipelineFinished();
         disconnectSignalsSlots();
+        m_ScratchArena->trim(m_ScratchRetainLimit);
         m_State = FilterPipeline::State::Idle;
         m_ExecutionResult = FilterPipeline::ExecutionResult::Failed;
         return m_Dca;
@@ -936,11 +948,32 @@ DataContainerArray::Pointer FilterPipeline::execute(DataContainerArray::Pointer
 
     notifyProgressMessage(static_cast<int>(static_cast<float>(filtIndex + 1) / (m_Pipeline.size()) * 100.0f), "");
   }
+
+  AbstractFilter::Pointer failedFilter = finishBackgroundWork();
+  if(nullptr != failedFilter)
+  {
+    QString ss = QObject::tr("[%1/%2] %3 caused an error while finishing its background work.").arg(failedFilter->getPipelineIndex() + 1).arg(m_Pipeline.size()).arg(failedFilter->getHumanLabel());
+    setErrorCondition(failedFilter->getErrorCode(), ss);
+  }
+
   now = QDateTime::currentDateTime();
   msg.clear();
   out << "Pipline End: " << now.toString(Qt::ISODate);
   notifyStatusMessage(msg);
 
+  ScratchArena::Statistics scratchStats = m_ScratchArena->getStatistics();
+  if(scratchStats.borrowCount > 0)
+  {
+    QString scratchMsg = QObject::tr("Scratch Memory: %1 buffers borrowed, %2 allocated, high-water %3 KiB in use, %4 KiB reserved")
+                             .arg(scratchStats.borrowCount)
+                             .arg(scratchStats.allocationCount)
+                             .arg(scratchStats.highWaterBytesInUse / 1024)
+                             .arg(scratchStats.highWaterBytesReserved / 1024);
+    notifyStatusMessage(scratchMsg);
+  }
+  // Keep the cached blocks for the next run, but do not let an idle pipeline hold on to more than the retain limit
+  m_ScratchArena->trim(m_ScratchRetainLimit);
+
   disconnectSignalsSlots();
 
   switch(m_State)
@@ -950,6 +983,11 @@ DataContainerArray::Pointer FilterPipeline::execute(DataContainerArray::Pointer
     notifyStatusMessage("Pipeline Canceled");
     break;
   case FilterPipeline::State::Executing:
+    if(nullptr != failedFilter)
+    {
+      m_ExecutionResult = FilterPipeline::ExecutionResult::Failed;
+      break;
+    }
     m_ExecutionResult = FilterPipeline::ExecutionResult::Completed;
     notifyStatusMessage("Pipeline Complete");
     break;
@@ -978,6 +1016,30 @@ void FilterPipeline::printFilterNames(QTextStream& out)
   out << "---------------------------------------------------------------------";
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AbstractFilter::Pointer FilterPipeline::finishBackgroundWork()
+{
+  AbstractFilter::Pointer failedFilter = AbstractFilter::NullPointer();
+  for(const auto& filt : m_Pipeline)
+  {
+    if(!filt->getEnabled())
+    {
+      continue;
+    }
+    int previousErr = filt->getErrorCode();
+    connectFilterNotifications(filt.get());
+    filt->finishBackgroundWork();
+    disconnectFilterNotifications(filt.get());
+    if(previousErr >= 0 && filt->getErrorCode() < 0 && nullptr == failedFilter)
+    {
+      failedFilter = filt;
+    }
+  }
+  return failedFilter;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -1057,6 +1119,36 @@ FilterPipeline::Pointer FilterPipeline::New()
   return sharedPtr;
 }
 
+// -----------------------------------------------------------------------------
+void FilterPipeline::setMemoryResource(const MemoryResource::Pointer& value)
+{
+  m_MemoryResource = value;
+}
+
+// -----------------------------------------------------------------------------
+MemoryResource::Pointer FilterPipeline::getMemoryResource() const
+{
+  return m_MemoryResource;
+}
+
+// -----------------------------------------------------------------------------
+ScratchArena::Pointer FilterPipeline::getScratchArena() const
+{
+  return m_ScratchArena;
+}
+
+// -----------------------------------------------------------------------------
+void FilterPipeline::setScratchRetainLimit(size_t value)
+{
+  m_ScratchRetainLimit = value;
+}
+
+// -----------------------------------------------------------------------------
+size_t FilterPipeline::getScratchRetainLimit() const
+{
+  return m_ScratchRetainLimit;
+}
+
 // -----------------------------------------------------------------------------
 void FilterPipeline::setCurrentFilter(const AbstractFilter::Pointer& value)
 {
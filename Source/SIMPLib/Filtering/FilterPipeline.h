@@ -45,6 +45,8 @@
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/Observer.h"
+#include "SIMPLib/DataArrays/MemoryResource.h"
+#include "SIMPLib/DataArrays/ScratchArena.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 
 class IObserver;
@@ -131,6 +133,11 @@ public:
 
   typedef QList<AbstractFilter::Pointer> FilterContainerType;
 
+  /**
+   * @brief Default number of bytes of cached scratch blocks kept between runs, 256 MiB
+   */
+  static constexpr size_t k_DefaultScratchRetainLimit = 256 * 1024 * 1024;
+
   /**
    * @brief Getter property for ExecutionResult
    * @return Value of ExecutionResult
@@ -155,6 +162,38 @@ public:
    */
   int getWarningCode() const;
 
+  /**
+   * @brief Sets the memory resource the arrays created while execute() runs allocate from. It is installed on the
+   * executing thread only, so pipelines running on other threads are not affected. The default null resource
+   * leaves the current MemoryResource::GetCurrent() of the executing thread in place.
+   * @param value
+   */
+  void setMemoryResource(const MemoryResource::Pointer& value);
+  /**
+   * @brief Getter property for MemoryResource
+   * @return Value of MemoryResource
+   */
+  MemoryResource::Pointer getMemoryResource() const;
+
+  /**
+   * @brief Returns the arena the filters borrow temporary buffers from while execute() runs. Cached blocks are
+   * reused by the filters of one run and by later runs; call trim() on it to release them explicitly.
+   * @return
+   */
+  ScratchArena::Pointer getScratchArena() const;
+
+  /**
+   * @brief Sets how many bytes of cached scratch blocks the arena keeps when execute() returns. Blocks cached
+   * above this limit are freed, largest first. 0 frees every cached block after each run.
+   * @param value
+   */
+  void setScratchRetainLimit(size_t value);
+  /**
+   * @brief Getter property for ScratchRetainLimit
+   * @return Value of ScratchRetainLimit
+   */
+  size_t getScratchRetainLimit() const;
+
   /**
    * @brief Setter property for CurrentFilter
    */
@@ -356,6 +395,9 @@ Q_SIGNALS:
 
 private:
   AbstractFilter::Pointer m_CurrentFilter = {};
+  MemoryResource::Pointer m_MemoryResource = {};
+  ScratchArena::Pointer m_ScratchArena = ScratchArena::New();
+  size_t m_ScratchRetainLimit = k_DefaultScratchRetainLimit;
 
   FilterContainerType m_Pipeline;
   QString m_PipelineName;
@@ -373,6 +415,12 @@ private:
   void connectSignalsSlots();
   void disconnectSignalsSlots();
 
+  /**
+   * @brief Lets every enabled filter finish its background work, see AbstractFilter::finishBackgroundWork()
+   * @return The first filter whose background work failed, otherwise NullPointer()
+   */
+  AbstractFilter::Pointer finishBackgroundWork();
+
 public:
   FilterPipeline(const FilterPipeline&) = delete;            // Copy Constructor Not Implemented
   FilterPipeline(FilterPipeline&&) = delete;                 // Move Constructor Not Implemented
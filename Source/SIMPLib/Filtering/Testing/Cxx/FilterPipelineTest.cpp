@@ -33,6 +33,8 @@
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <thread>
+
 #include <QtCore/QFile>
 
 //#include "Applications/DREAM3D/DREAM3DApplication.h"
@@ -52,9 +54,73 @@
 #endif
 
 #include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/Testing/SIMPLTestFileLocations.h"
 #include "SIMPLib/Testing/UnitTestSupport.hpp"
 
+namespace
+{
+/**
+ * @brief Leaves work behind in execute() that fails when the pipeline collects it
+ */
+class BackgroundWorkFilter : public AbstractFilter
+{
+public:
+  using Self = BackgroundWorkFilter;
+  using Pointer = std::shared_ptr<Self>;
+
+  static Pointer New()
+  {
+    Pointer sharedPtr(new BackgroundWorkFilter());
+    return sharedPtr;
+  }
+
+  QString getNameOfClass() const override
+  {
+    return QString("BackgroundWorkFilter");
+  }
+
+  QUuid getUuid() const override
+  {
+    return QUuid("{5b1c7e2d-4f8a-4c36-9e0b-2d7a6f1c8e43}");
+  }
+
+  void dataCheck() override
+  {
+    clearErrorCode();
+  }
+
+  void execute() override
+  {
+    dataCheck();
+    m_Pending = true;
+  }
+
+  void finishBackgroundWork() override
+  {
+    if(!m_Pending)
+    {
+      return;
+    }
+    m_Pending = false;
+    m_FinishThread = std::this_thread::get_id();
+    setErrorCondition(-123, "The background work failed");
+  }
+
+  std::thread::id getFinishThread() const
+  {
+    return m_FinishThread;
+  }
+
+protected:
+  BackgroundWorkFilter() = default;
+
+private:
+  bool m_Pending = false;
+  std::thread::id m_FinishThread;
+};
+} // namespace
+
 class FilterPipelineTest
 {
 public:
@@ -151,6 +217,22 @@ public:
 #endif
   }
 
+  // -----------------------------------------------------------------------------
+  // Background work is finished on the executing thread and its failure fails the pipeline
+  // -----------------------------------------------------------------------------
+  void TestFinishBackgroundWork()
+  {
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+    BackgroundWorkFilter::Pointer filter = BackgroundWorkFilter::New();
+    pipeline->pushBack(filter);
+    pipeline->execute(DataContainerArray::New());
+
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCode(), -123)
+    DREAM3D_REQUIRE_EQUAL(pipeline->getErrorCode(), -123)
+    DREAM3D_REQUIRE(pipeline->getExecutionResult() == FilterPipeline::ExecutionResult::Failed)
+    DREAM3D_REQUIRE(filter->getFinishThread() == std::this_thread::get_id())
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -165,6 +247,7 @@ public:
 #endif
 
     DREAM3D_REGISTER_TEST(TestPipelinePushPop());
+    DREAM3D_REGISTER_TEST(TestFinishBackgroundWork());
 
 #if REMOVE_TEST_FILES
 //  DREAM3D_REGISTER_TEST( RemoveTestFiles() );
@@ -0,0 +1,178 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <cstdlib>
+
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/BitArray.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/StringDataArray.h"
+#include "SIMPLib/Filtering/ThresholdEvaluator.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class ThresholdEvaluatorTest
+{
+public:
+  ThresholdEvaluatorTest() = default;
+  virtual ~ThresholdEvaluatorTest() = default;
+
+  // -----------------------------------------------------------------------------
+  // Sizes straddle the evaluator's block size so partial blocks are exercised
+  // -----------------------------------------------------------------------------
+  const std::vector<size_t> k_Sizes = {1, 17, 4095, 4096, 4097, 10000};
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFlatComparisons()
+  {
+    for(size_t numValues : k_Sizes)
+    {
+      Int32ArrayType::Pointer ints = Int32ArrayType::CreateArray(numValues, std::string("Ints"), true);
+      FloatArrayType::Pointer floats = FloatArrayType::CreateArray(numValues, std::string("Floats"), true);
+      for(size_t i = 0; i < numValues; i++)
+      {
+        ints->setValue(i, static_cast<int32_t>(i % 23));
+        floats->setValue(i, 0.25f * static_cast<float>(i % 11));
+      }
+
+      // ints > 4 AND floats != 1.5 AND ints < 20.7 (20.7 is truncated to 20 for the integer array)
+      ThresholdEvaluator::Pointer evaluator = ThresholdEvaluator::New();
+      DREAM3D_REQUIRE_EQUAL(evaluator->addComparison(ints, SIMPL::Comparison::Operator_GreaterThan, 4.0), 0)
+      DREAM3D_REQUIRE_EQUAL(evaluator->addComparison(floats, SIMPL::Comparison::Operator_NotEqual, 1.5), 0)
+      DREAM3D_REQUIRE_EQUAL(evaluator->addComparison(ints, SIMPL::Comparison::Operator_LessThan, 20.7), 0)
+      DREAM3D_REQUIRE_EQUAL(evaluator->getNumberOfComparisons(), 3)
+
+      std::unique_ptr<bool[]> output(new bool[numValues]);
+      DREAM3D_REQUIRE_EQUAL(evaluator->execute(output.get(), numValues), 0)
+      for(size_t i = 0; i < numValues; i++)
+      {
+        bool expected = ints->getValue(i) > 4 && floats->getValue(i) != 1.5f && ints->getValue(i) < 20;
+        DREAM3D_REQUIRE_EQUAL(output[i], expected)
+      }
+
+      BitArray::Pointer packed = BitArray::CreateArray(numValues, "Packed", true);
+      DREAM3D_REQUIRE_EQUAL(evaluator->execute(*packed), 0)
+      for(size_t i = 0; i < numValues; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(packed->getValue(i), output[i])
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  // Nested sets evaluate left to right with each entry's own union operator
+  // -----------------------------------------------------------------------------
+  void TestNestedSets()
+  {
+    for(size_t numValues : k_Sizes)
+    {
+      Int32ArrayType::Pointer ints = Int32ArrayType::CreateArray(numValues, std::string("Ints"), true);
+      UInt8ArrayType::Pointer bytes = UInt8ArrayType::CreateArray(numValues, std::string("Bytes"), true);
+      for(size_t i = 0; i < numValues; i++)
+      {
+        ints->setValue(i, static_cast<int32_t>(i % 31) - 15);
+        bytes->setValue(i, static_cast<uint8_t>(i % 7));
+      }
+
+      // NOT( (ints < 0 OR NOT(bytes == 3 AND ints > 10)) AND bytes != 5 OR <empty set> )
+      ThresholdEvaluator::Pointer evaluator = ThresholdEvaluator::New();
+      evaluator->setInvert(true);
+      evaluator->beginSet(SIMPL::Union::Operator_And, false);
+      DREAM3D_REQUIRE_EQUAL(evaluator->addComparison(ints, SIMPL::Comparison::Operator_LessThan, 0.0), 0)
+      evaluator->beginSet(SIMPL::Union::Operator_Or, true);
+      DREAM3D_REQUIRE_EQUAL(evaluator->addComparison(bytes, SIMPL::Comparison::Operator_Equal, 3.0), 0)
+      DREAM3D_REQUIRE_EQUAL(evaluator->addComparison(ints, SIMPL::Comparison::Operator_GreaterThan, 10.0, SIMPL::Union::Operator_And), 0)
+      evaluator->endSet();
+      evaluator->endSet();
+      DREAM3D_REQUIRE_EQUAL(evaluator->addComparison(bytes, SIMPL::Comparison::Operator_NotEqual, 5.0, SIMPL::Union::Operator_And), 0)
+      evaluator->beginSet(SIMPL::Union::Operator_Or, false);
+      evaluator->endSet();
+
+      std::unique_ptr<bool[]> output(new bool[numValues]);
+      DREAM3D_REQUIRE_EQUAL(evaluator->execute(output.get(), numValues), 0)
+      for(size_t i = 0; i < numValues; i++)
+      {
+        int32_t intValue = ints->getValue(i);
+        uint8_t byteValue = bytes->getValue(i);
+        bool inner = !(byteValue == 3 && intValue > 10);
+        bool expected = !(((intValue < 0 || inner) && byteValue != 5) || false);
+        DREAM3D_REQUIRE_EQUAL(output[i], expected)
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestErrors()
+  {
+    ThresholdEvaluator::Pointer evaluator = ThresholdEvaluator::New();
+    DREAM3D_REQUIRE_EQUAL(evaluator->addComparison(IDataArray::NullPointer(), SIMPL::Comparison::Operator_LessThan, 1.0), -1)
+
+    StringDataArray::Pointer strings = StringDataArray::CreateArray(10, QString("Strings"), true);
+    DREAM3D_REQUIRE_EQUAL(evaluator->addComparison(strings, SIMPL::Comparison::Operator_LessThan, 1.0), -1)
+
+    Int32ArrayType::Pointer ints = Int32ArrayType::CreateArray(10, std::string("Ints"), true);
+    DREAM3D_REQUIRE_EQUAL(evaluator->addComparison(ints, SIMPL::Comparison::Operator_LessThan, 1.0), 0)
+    std::unique_ptr<bool[]> output(new bool[20]);
+    DREAM3D_REQUIRE_EQUAL(evaluator->execute(output.get(), 20), -1)
+
+    evaluator->beginSet(SIMPL::Union::Operator_And, false);
+    DREAM3D_REQUIRE_EQUAL(evaluator->execute(output.get(), 10), -1)
+    evaluator->endSet();
+    DREAM3D_REQUIRE_EQUAL(evaluator->execute(output.get(), 10), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### ThresholdEvaluatorTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestFlatComparisons());
+    DREAM3D_REGISTER_TEST(TestNestedSets());
+    DREAM3D_REGISTER_TEST(TestErrors());
+  }
+
+private:
+  ThresholdEvaluatorTest(const ThresholdEvaluatorTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const ThresholdEvaluatorTest&) = delete;         // Move assignment Not Implemented
+};
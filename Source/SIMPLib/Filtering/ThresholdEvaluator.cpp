@@ -0,0 +1,527 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "ThresholdEvaluator.h"
+
+#include <algorithm>
+#include <functional>
+
+#include "SIMPLib/DataArrays/BitArray.h"
+#include "SIMPLib/DataArrays/ComponentViewArray.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/ScratchArena.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+namespace
+{
+// Elements per block. Large enough to amortize the per block dispatch, small enough that
+// the result and set scratch blocks stay in L1/L2 while every input is streamed over them.
+constexpr size_t k_BlockSize = 4096;
+static_assert(k_BlockSize % BitArray::k_BitsPerWord == 0, "Blocks must pack into whole BitArray words");
+} // namespace
+
+/**
+ * @brief The ComparisonKernel class evaluates one comparison over a block of elements and folds the
+ * result into a block of booleans
+ */
+class ThresholdEvaluator::ComparisonKernel
+{
+public:
+  ComparisonKernel() = default;
+  virtual ~ComparisonKernel() = default;
+
+  virtual size_t getNumberOfTuples() const = 0;
+  virtual void evaluate(size_t start, size_t count, CombineMode mode, bool* result) const = 0;
+
+public:
+  ComparisonKernel(const ComparisonKernel&) = delete;            // Copy Constructor Not Implemented
+  ComparisonKernel(ComparisonKernel&&) = delete;                 // Move Constructor Not Implemented
+  ComparisonKernel& operator=(const ComparisonKernel&) = delete; // Copy Assignment Not Implemented
+  ComparisonKernel& operator=(ComparisonKernel&&) = delete;      // Move Assignment Not Implemented
+};
+
+/**
+ * @brief The TypedComparisonKernel class compares a DataArray<T> against a value. The operator and
+ * combine mode are resolved once per block so each inner loop is a single branch free pass. Value i is
+ * read at offset + i * stride, which lets component views be compared without copying them.
+ */
+template <typename T>
+class ThresholdEvaluator::TypedComparisonKernel : public ThresholdEvaluator::ComparisonKernel
+{
+public:
+  TypedComparisonKernel(const typename DataArray<T>::Pointer& input, size_t offset, size_t stride, SIMPL::Comparison::Enumeration compOperator, double compValue)
+  : m_Input(input)
+  , m_Offset(offset)
+  , m_Stride(stride)
+  , m_Operator(compOperator)
+  , m_Value(static_cast<T>(compValue))
+  {
+  }
+  ~TypedComparisonKernel() override = default;
+
+  size_t getNumberOfTuples() const override
+  {
+    return m_Input->getNumberOfTuples();
+  }
+
+  void evaluate(size_t start, size_t count, CombineMode mode, bool* result) const override
+  {
+    // Read through the const accessor so the component views of the input stay views
+    const T* data = static_cast<const DataArray<T>&>(*m_Input).data() + start * m_Stride + m_Offset;
+    switch(m_Operator)
+    {
+    case SIMPL::Comparison::Operator_LessThan:
+      dispatch(data, count, mode, result, std::less<T>());
+      break;
+    case SIMPL::Comparison::Operator_GreaterThan:
+      dispatch(data, count, mode, result, std::greater<T>());
+      break;
+    case SIMPL::Comparison::Operator_Equal:
+      dispatch(data, count, mode, result, std::equal_to<T>());
+      break;
+    case SIMPL::Comparison::Operator_NotEqual:
+      dispatch(data, count, mode, result, std::not_equal_to<T>());
+      break;
+    default:
+      // An unknown operator never matches
+      dispatch(data, count, mode, result, [](T, T) { return false; });
+      break;
+    }
+  }
+
+private:
+  typename DataArray<T>::Pointer m_Input;
+  size_t m_Offset = 0;
+  size_t m_Stride = 1;
+  SIMPL::Comparison::Enumeration m_Operator;
+  T m_Value;
+
+  template <typename Compare>
+  void dispatch(const T* data, size_t count, CombineMode mode, bool* result, Compare compare) const
+  {
+    // Contiguous input keeps a unit stride known at compile time so the loops vectorize
+    if(m_Stride == 1)
+    {
+      apply<false>(data, count, mode, result, compare);
+    }
+    else
+    {
+      apply<true>(data, count, mode, result, compare);
+    }
+  }
+
+  template <bool Strided, typename Compare>
+  void apply(const T* data, size_t count, CombineMode mode, bool* result, Compare compare) const
+  {
+    const T value = m_Value;
+    const size_t stride = Strided ? m_Stride : 1;
+    switch(mode)
+    {
+    case CombineMode::Replace:
+      for(size_t i = 0; i < count; i++)
+      {
+        result[i] = compare(data[i * stride], value);
+      }
+      break;
+    case CombineMode::And:
+      for(size_t i = 0; i < count; i++)
+      {
+        result[i] = result[i] & compare(data[i * stride], value);
+      }
+      break;
+    case CombineMode::Or:
+      for(size_t i = 0; i < count; i++)
+      {
+        result[i] = result[i] | compare(data[i * stride], value);
+      }
+      break;
+    }
+  }
+};
+
+/**
+ * @brief The ThresholdEvaluatorImpl class evaluates a range of blocks
+ */
+class ThresholdEvaluatorImpl
+{
+public:
+  ThresholdEvaluatorImpl(const ThresholdEvaluator* evaluator, bool* output, size_t numValues)
+  : m_Evaluator(evaluator)
+  , m_Output(output)
+  , m_NumValues(numValues)
+  , m_Arena(ScratchArena::GetCurrent())
+  {
+  }
+  ThresholdEvaluatorImpl(const ThresholdEvaluator* evaluator, BitArray* output, size_t numValues)
+  : m_Evaluator(evaluator)
+  , m_BitOutput(output)
+  , m_NumValues(numValues)
+  , m_Arena(ScratchArena::GetCurrent())
+  {
+  }
+  virtual ~ThresholdEvaluatorImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    // The workers borrow from the arena of the thread that created this object
+    ScratchArena::Buffer<bool> scratch = ScratchArena::Borrow<bool>(m_Arena, m_Evaluator->m_MaxDepth * k_BlockSize);
+    // Packed output is evaluated into a block buffer first. k_BlockSize is a multiple of the word size
+    // so every block packs into its own words.
+    ScratchArena::Buffer<bool> blockOutput = ScratchArena::Borrow<bool>(m_Arena, nullptr != m_BitOutput ? k_BlockSize : 0);
+    for(size_t block = range.min(); block < range.max(); block++)
+    {
+      size_t start = block * k_BlockSize;
+      size_t count = std::min(k_BlockSize, m_NumValues - start);
+      if(nullptr != m_BitOutput)
+      {
+        m_Evaluator->evaluateBlock(start, count, blockOutput.data(), scratch.data());
+        m_BitOutput->setValues(start, count, blockOutput.data());
+      }
+      else
+      {
+        m_Evaluator->evaluateBlock(start, count, m_Output + start, scratch.data());
+      }
+    }
+  }
+
+private:
+  const ThresholdEvaluator* m_Evaluator = nullptr;
+  bool* m_Output = nullptr;
+  BitArray* m_BitOutput = nullptr;
+  size_t m_NumValues = 0;
+  ScratchArena::Pointer m_Arena;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThresholdEvaluator::ThresholdEvaluator()
+{
+  m_OpenSets.push_back({false, CombineMode::Replace, false});
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThresholdEvaluator::~ThresholdEvaluator() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThresholdEvaluator::CombineMode ThresholdEvaluator::nextCombineMode(SIMPL::Union::Enumeration unionOperator)
+{
+  OpenSet& current = m_OpenSets.back();
+  if(!current.hasEntry)
+  {
+    current.hasEntry = true;
+    return CombineMode::Replace;
+  }
+  return unionOperator == SIMPL::Union::Operator_Or ? CombineMode::Or : CombineMode::And;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ThresholdEvaluator::addComparison(const IDataArray::Pointer& input, SIMPL::Comparison::Enumeration compOperator, double compValue, SIMPL::Union::Enumeration unionOperator)
+{
+  if(nullptr == input)
+  {
+    return -1;
+  }
+
+  // Component views are compared in place inside the array they view
+  IDataArray::Pointer source = input;
+  size_t offset = 0;
+  size_t stride = 1;
+  if(ComponentViewArray::Pointer view = std::dynamic_pointer_cast<ComponentViewArray>(input))
+  {
+    source = view->getSourceArray();
+    offset = view->getComponentOffset();
+    stride = view->getStride();
+  }
+
+  std::shared_ptr<ComparisonKernel> kernel;
+  if(FloatArrayType::Pointer floatArray = std::dynamic_pointer_cast<FloatArrayType>(source))
+  {
+    kernel = std::make_shared<TypedComparisonKernel<float>>(floatArray, offset, stride, compOperator, compValue);
+  }
+  else if(DoubleArrayType::Pointer doubleArray = std::dynamic_pointer_cast<DoubleArrayType>(source))
+  {
+    kernel = std::make_shared<TypedComparisonKernel<double>>(doubleArray, offset, stride, compOperator, compValue);
+  }
+  else if(Int8ArrayType::Pointer int8Array = std::dynamic_pointer_cast<Int8ArrayType>(source))
+  {
+    kernel = std::make_shared<TypedComparisonKernel<int8_t>>(int8Array, offset, stride, compOperator, compValue);
+  }
+  else if(UInt8ArrayType::Pointer uint8Array = std::dynamic_pointer_cast<UInt8ArrayType>(source))
+  {
+    kernel = std::make_shared<TypedComparisonKernel<uint8_t>>(uint8Array, offset, stride, compOperator, compValue);
+  }
+  else if(Int16ArrayType::Pointer int16Array = std::dynamic_pointer_cast<Int16ArrayType>(source))
+  {
+    kernel = std::make_shared<TypedComparisonKernel<int16_t>>(int16Array, offset, stride, compOperator, compValue);
+  }
+  else if(UInt16ArrayType::Pointer uint16Array = std::dynamic_pointer_cast<UInt16ArrayType>(source))
+  {
+    kernel = std::make_shared<TypedComparisonKernel<uint16_t>>(uint16Array, offset, stride, compOperator, compValue);
+  }
+  else if(Int32ArrayType::Pointer int32Array = std::dynamic_pointer_cast<Int32ArrayType>(source))
+  {
+    kernel = std::make_shared<TypedComparisonKernel<int32_t>>(int32Array, offset, stride, compOperator, compValue);
+  }
+  else if(UInt32ArrayType::Pointer uint32Array = std::dynamic_pointer_cast<UInt32ArrayType>(source))
+  {
+    kernel = std::make_shared<TypedComparisonKernel<uint32_t>>(uint32Array, offset, stride, compOperator, compValue);
+  }
+  else if(Int64ArrayType::Pointer int64Array = std::dynamic_pointer_cast<Int64ArrayType>(source))
+  {
+    kernel = std::make_shared<TypedComparisonKernel<int64_t>>(int64Array, offset, stride, compOperator, compValue);
+  }
+  else if(UInt64ArrayType::Pointer uint64Array = std::dynamic_pointer_cast<UInt64ArrayType>(source))
+  {
+    kernel = std::make_shared<TypedComparisonKernel<uint64_t>>(uint64Array, offset, stride, compOperator, compValue);
+  }
+  else if(BoolArrayType::Pointer boolArray = std::dynamic_pointer_cast<BoolArrayType>(source))
+  {
+    kernel = std::make_shared<TypedComparisonKernel<bool>>(boolArray, offset, stride, compOperator, compValue);
+  }
+  else
+  {
+    return -1;
+  }
+
+  Instruction instruction = {InstructionType::Compare, nextCombineMode(unionOperator), false, false, m_Kernels.size()};
+  m_Kernels.push_back(kernel);
+  m_Instructions.push_back(instruction);
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ThresholdEvaluator::beginSet(SIMPL::Union::Enumeration unionOperator, bool invert)
+{
+  CombineMode mode = nextCombineMode(unionOperator);
+  m_Instructions.push_back({InstructionType::BeginSet, mode, invert, false, 0});
+  m_OpenSets.push_back({false, mode, invert});
+  m_MaxDepth = std::max(m_MaxDepth, m_OpenSets.size() - 1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ThresholdEvaluator::endSet()
+{
+  if(m_OpenSets.size() < 2)
+  {
+    return;
+  }
+  OpenSet closed = m_OpenSets.back();
+  m_OpenSets.pop_back();
+  m_Instructions.push_back({InstructionType::EndSet, closed.mode, closed.invert, !closed.hasEntry, 0});
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ThresholdEvaluator::evaluateBlock(size_t start, size_t count, bool* output, bool* scratch) const
+{
+  // Level 0 is the output itself, level n > 0 is the n-th scratch block
+  size_t level = 0;
+  bool* result = output;
+  if(m_Instructions.empty())
+  {
+    std::fill_n(output, count, false);
+  }
+
+  for(const Instruction& instruction : m_Instructions)
+  {
+    switch(instruction.type)
+    {
+    case InstructionType::Compare:
+      m_Kernels[instruction.kernel]->evaluate(start, count, instruction.mode, result);
+      break;
+    case InstructionType::BeginSet:
+      level++;
+      result = scratch + (level - 1) * k_BlockSize;
+      break;
+    case InstructionType::EndSet:
+    {
+      bool* setResult = result;
+      if(instruction.emptySet)
+      {
+        std::fill_n(setResult, count, false);
+      }
+      level--;
+      result = (level == 0) ? output : scratch + (level - 1) * k_BlockSize;
+      const bool invert = instruction.invert;
+      switch(instruction.mode)
+      {
+      case CombineMode::Replace:
+        for(size_t i = 0; i < count; i++)
+        {
+          result[i] = setResult[i] != invert;
+        }
+        break;
+      case CombineMode::And:
+        for(size_t i = 0; i < count; i++)
+        {
+          result[i] = result[i] & (setResult[i] != invert);
+        }
+        break;
+      case CombineMode::Or:
+        for(size_t i = 0; i < count; i++)
+        {
+          result[i] = result[i] | (setResult[i] != invert);
+        }
+        break;
+      }
+      break;
+    }
+    }
+  }
+
+  if(m_Invert)
+  {
+    for(size_t i = 0; i < count; i++)
+    {
+      output[i] = !output[i];
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ThresholdEvaluator::execute(bool* output, size_t numValues) const
+{
+  if(!isExecutable(numValues))
+  {
+    return -1;
+  }
+  if(numValues == 0)
+  {
+    return 0;
+  }
+
+  size_t numBlocks = (numValues + k_BlockSize - 1) / k_BlockSize;
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numBlocks);
+  dataAlg.execute(ThresholdEvaluatorImpl(this, output, numValues));
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ThresholdEvaluator::execute(BitArray& output) const
+{
+  const size_t numValues = output.getNumberOfTuples();
+  if(!isExecutable(numValues) || !output.isAllocated())
+  {
+    return -1;
+  }
+  if(numValues == 0)
+  {
+    return 0;
+  }
+
+  size_t numBlocks = (numValues + k_BlockSize - 1) / k_BlockSize;
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numBlocks);
+  dataAlg.execute(ThresholdEvaluatorImpl(this, &output, numValues));
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ThresholdEvaluator::isExecutable(size_t numValues) const
+{
+  if(m_OpenSets.size() != 1)
+  {
+    return false;
+  }
+  for(const std::shared_ptr<ComparisonKernel>& kernel : m_Kernels)
+  {
+    if(kernel->getNumberOfTuples() < numValues)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+size_t ThresholdEvaluator::getNumberOfComparisons() const
+{
+  return m_Kernels.size();
+}
+
+// -----------------------------------------------------------------------------
+void ThresholdEvaluator::setInvert(bool invert)
+{
+  m_Invert = invert;
+}
+
+// -----------------------------------------------------------------------------
+bool ThresholdEvaluator::getInvert() const
+{
+  return m_Invert;
+}
+
+// -----------------------------------------------------------------------------
+ThresholdEvaluator::Pointer ThresholdEvaluator::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
+
+// -----------------------------------------------------------------------------
+ThresholdEvaluator::Pointer ThresholdEvaluator::New()
+{
+  Pointer sharedPtr(new(ThresholdEvaluator));
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+QString ThresholdEvaluator::getNameOfClass() const
+{
+  return QString("ThresholdEvaluator");
+}
+
+// -----------------------------------------------------------------------------
+QString ThresholdEvaluator::ClassName()
+{
+  return QString("ThresholdEvaluator");
+}
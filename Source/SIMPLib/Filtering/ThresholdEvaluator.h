@@ -0,0 +1,211 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/IDataArray.h"
+
+class BitArray;
+
+/**
+ * @brief The ThresholdEvaluator class compiles a tree of threshold comparisons into a flat program and
+ * evaluates it in a single fused pass. The output is processed in cache sized blocks: every comparison
+ * streams its input once and is folded straight into the running result of its set, so no full size
+ * temporary arrays are created. Blocks are evaluated in parallel.
+ *
+ * Comparisons and sets are appended in order. Inside a set the first entry initializes the result and
+ * each following entry is combined with it using its own union operator, which is the left to right
+ * evaluation order used by MultiThresholdObjects and MultiThresholdObjects2.
+ */
+class SIMPLib_EXPORT ThresholdEvaluator
+{
+public:
+  using Self = ThresholdEvaluator;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+  static Pointer NullPointer();
+
+  static Pointer New();
+
+  /**
+   * @brief Returns the name of the class for ThresholdEvaluator
+   */
+  QString getNameOfClass() const;
+  /**
+   * @brief Returns the name of the class for ThresholdEvaluator
+   */
+  static QString ClassName();
+
+  virtual ~ThresholdEvaluator();
+
+  /**
+   * @brief addComparison Appends the comparison "input compOperator compValue" to the current set. The
+   * value is cast to the input's type before comparing.
+   * @param input Array to compare; a ComponentViewArray is read in place without materializing it
+   * @param compOperator Comparison operator
+   * @param compValue Value to compare against
+   * @param unionOperator How the comparison is combined with the preceding entries of its set
+   * @return 0 on success, -1 if the input is null or of an unsupported type
+   */
+  int addComparison(const IDataArray::Pointer& input, SIMPL::Comparison::Enumeration compOperator, double compValue, SIMPL::Union::Enumeration unionOperator = SIMPL::Union::Operator_And);
+
+  /**
+   * @brief beginSet Opens a nested set. Entries added until the matching endSet() are evaluated as a
+   * group whose result is combined with the enclosing set.
+   * @param unionOperator How the set is combined with the preceding entries of the enclosing set
+   * @param invert Whether the result of the set is inverted before it is combined
+   */
+  void beginSet(SIMPL::Union::Enumeration unionOperator, bool invert);
+
+  /**
+   * @brief endSet Closes the set opened by the last beginSet(). An empty set evaluates to false.
+   */
+  void endSet();
+
+  /**
+   * @brief Sets whether the final result is inverted
+   * @param invert
+   */
+  void setInvert(bool invert);
+
+  /**
+   * @brief Returns whether the final result is inverted
+   * @return
+   */
+  bool getInvert() const;
+
+  /**
+   * @brief Returns the number of comparisons that have been added
+   * @return
+   */
+  size_t getNumberOfComparisons() const;
+
+  /**
+   * @brief execute Evaluates the compiled comparisons for the first numValues elements of every input
+   * @param output Destination for numValues results
+   * @param numValues Number of elements to evaluate
+   * @return 0 on success, -1 if a set is still open or an input holds fewer than numValues tuples
+   */
+  int execute(bool* output, size_t numValues) const;
+
+  /**
+   * @brief execute Evaluates the compiled comparisons into a packed mask, one value per tuple of 'output'
+   * @param output Allocated destination
+   * @return 0 on success, -1 if a set is still open, the output is not allocated or an input is too short
+   */
+  int execute(BitArray& output) const;
+
+protected:
+  ThresholdEvaluator();
+
+private:
+  friend class ThresholdEvaluatorImpl;
+
+  class ComparisonKernel;
+  template <typename T>
+  class TypedComparisonKernel;
+
+  enum class CombineMode
+  {
+    Replace,
+    And,
+    Or
+  };
+
+  enum class InstructionType
+  {
+    Compare,
+    BeginSet,
+    EndSet
+  };
+
+  struct Instruction
+  {
+    InstructionType type;
+    CombineMode mode;
+    bool invert;
+    bool emptySet;
+    size_t kernel;
+  };
+
+  struct OpenSet
+  {
+    bool hasEntry;
+    CombineMode mode;
+    bool invert;
+  };
+
+  std::vector<std::shared_ptr<ComparisonKernel>> m_Kernels;
+  std::vector<Instruction> m_Instructions;
+  std::vector<OpenSet> m_OpenSets;
+  size_t m_MaxDepth = 0;
+  bool m_Invert = false;
+
+  /**
+   * @brief nextCombineMode Returns how the next entry of the innermost open set is combined and marks
+   * that set as having an entry
+   * @param unionOperator
+   * @return
+   */
+  CombineMode nextCombineMode(SIMPL::Union::Enumeration unionOperator);
+
+  /**
+   * @brief evaluateBlock Runs the program over one block of elements
+   * @param start First element of the block
+   * @param count Number of elements in the block
+   * @param output Destination for the block's results
+   * @param scratch Storage for the results of nested sets, m_MaxDepth blocks long
+   */
+  void evaluateBlock(size_t start, size_t count, bool* output, bool* scratch) const;
+
+  /**
+   * @brief isExecutable Returns whether all sets are closed and every input holds at least numValues tuples
+   * @param numValues
+   * @return
+   */
+  bool isExecutable(size_t numValues) const;
+
+public:
+  ThresholdEvaluator(const ThresholdEvaluator&) = delete;            // Copy Constructor Not Implemented
+  ThresholdEvaluator(ThresholdEvaluator&&) = delete;                 // Move Constructor Not Implemented
+  ThresholdEvaluator& operator=(const ThresholdEvaluator&) = delete; // Copy Assignment Not Implemented
+  ThresholdEvaluator& operator=(ThresholdEvaluator&&) = delete;      // Move Assignment Not Implemented
+};
@@ -44,7 +44,8 @@ MeshIndexArrayType::Pointer GeomIO::ReadMeshIndexListFromHDF5(const QString& lis
   Int64ArrayType::Pointer tempInt64 = GeometryHelpers::GeomIO::ReadListFromHDF5<Int64ArrayType>(listName, parentId, preflight, err);
   if(tempInt64.get() != nullptr)
   {
-    meshIndex = SharedEdgeList::WrapPointer(reinterpret_cast<MeshIndexType*>(tempInt64->data()), tempInt64->getNumberOfTuples(), tempInt64->getComponentDimensions(), tempInt64->getName(), true);
+    meshIndex = SharedEdgeList::WrapPointer(reinterpret_cast<MeshIndexType*>(tempInt64->data()), tempInt64->getNumberOfTuples(), tempInt64->getComponentDimensions(), tempInt64->getName(), true,
+                                         tempInt64->getMemoryResource());
     // Release the ownership of the memory from TempTris and essentially pass it to tris.
     tempInt64->releaseOwnership();
   }
@@ -59,7 +60,8 @@ MeshIndexArrayType::Pointer GeomIO::ReadMeshIndexListFromHDF5(const QString& lis
 #endif
     if(tempUInt64.get() != nullptr)
     {
-      meshIndex = SharedEdgeList::WrapPointer(reinterpret_cast<MeshIndexType*>(tempUInt64->data()), tempUInt64->getNumberOfTuples(), tempUInt64->getComponentDimensions(), tempUInt64->getName(), true);
+      meshIndex = SharedEdgeList::WrapPointer(reinterpret_cast<MeshIndexType*>(tempUInt64->data()), tempUInt64->getNumberOfTuples(), tempUInt64->getComponentDimensions(), tempUInt64->getName(), true,
+                                           tempUInt64->getMemoryResource());
       // Release the ownership of the memory from TempTris and essentially pass it to tris.
       tempUInt64->releaseOwnership();
     }
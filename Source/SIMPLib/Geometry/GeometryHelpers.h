@@ -31,6 +31,7 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <map>
 #include <memory>
@@ -43,10 +44,12 @@
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/ScratchArena.h"
 #include "SIMPLib/Geometry/IGeometry.h"
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/Math/GeometryMath.h"
 #include "SIMPLib/Math/MatrixMath.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
 
 class IDataArray;
 using IDataArrayShPtrType = std::shared_ptr<IDataArray>;
@@ -56,6 +59,60 @@ using IDataArrayShPtrType = std::shared_ptr<IDataArray>;
  */
 namespace GeometryHelpers
 {
+namespace Detail
+{
+/**
+ * @brief The ElementRangeImpl class adapts a functor taking a [start, end) range of elements to ParallelDataAlgorithm
+ */
+template <typename Func>
+class ElementRangeImpl
+{
+public:
+  explicit ElementRangeImpl(const Func& func)
+  : m_Func(func)
+  {
+  }
+  virtual ~ElementRangeImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    m_Func(range.min(), range.max());
+  }
+
+private:
+  Func m_Func;
+};
+
+/**
+ * @brief ParallelForEachElement Runs func over [0, numElems), split across threads when parallel algorithms are enabled
+ * @param numElems
+ * @param func
+ */
+template <typename Func>
+void ParallelForEachElement(size_t numElems, const Func& func)
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numElems);
+  dataAlg.execute(ElementRangeImpl<Func>(func));
+}
+
+/**
+ * @brief TetDeterminant Returns the determinant of the matrix whose columns are the edges from v0 to v1, v2 and v3
+ */
+template <typename T>
+inline float TetDeterminant(const float* vertices, T v0, T v1, T v2, T v3)
+{
+  const float* vert0 = vertices + 3 * v0;
+  const float* vert1 = vertices + 3 * v1;
+  const float* vert2 = vertices + 3 * v2;
+  const float* vert3 = vertices + 3 * v3;
+  float vertMatrix[3][3] = {{vert1[0] - vert0[0], vert2[0] - vert0[0], vert3[0] - vert0[0]},
+                            {vert1[1] - vert0[1], vert2[1] - vert0[1], vert3[1] - vert0[1]},
+                            {vert1[2] - vert0[2], vert2[2] - vert0[2], vert3[2] - vert0[2]}};
+  return MatrixMath::Determinant3x3(vertMatrix);
+}
+} // namespace Detail
+
 
 /**
  * @brief The GeomIO class
@@ -241,9 +298,8 @@ public:
     size_t elemId = 0;
 
     // Fill out lists with number of references to cells
-    typename DataArray<K>::Pointer linkLocPtr = DataArray<K>::CreateArray(numVerts, std::string("_INTERNAL_USE_ONLY_Vertices"), true);
-    linkLocPtr->initializeWithValue(0);
-    K* linkLoc = linkLocPtr->getPointer(0);
+    ScratchArena::Buffer<K> linkLocBuffer = ScratchArena::Borrow<K>(ScratchArena::GetCurrent(), numVerts, static_cast<K>(0));
+    K* linkLoc = linkLocBuffer.data();
     K* verts = nullptr;
 
     // vtkPolyData *pdata = static_cast<vtkPolyData *>(data);
@@ -328,9 +384,8 @@ public:
     dynamicList->allocateLists(linkCount);
 
     // Allocate an array of bools that we use each iteration so that we don't put duplicates into the array
-    typename DataArray<bool>::Pointer visitedPtr = DataArray<bool>::CreateArray(numElems, std::string("_INTERNAL_USE_ONLY_Visited"), true);
-    visitedPtr->initializeWithValue(false);
-    bool* visited = visitedPtr->getPointer(0);
+    ScratchArena::Buffer<bool> visitedBuffer = ScratchArena::Borrow<bool>(ScratchArena::GetCurrent(), numElems, false);
+    bool* visited = visitedBuffer.data();
 
     // Reuse this vector for each loop. Avoids re-allocating the memory each time through the loop
     QVector<K> loop_neighbors(32, 0);
@@ -992,6 +1047,11 @@ public:
 
 /**
  * @brief The Topology class
+ *
+ * Each kernel is available in two forms: one taking the geometry's arrays, which is what the
+ * IGeometry subclasses call from their find* methods, and one taking raw element, vertex and
+ * output pointers. Both split the elements across threads with ParallelDataAlgorithm; every
+ * element writes only its own output value, so the results do not depend on the thread count.
  */
 class Topology
 {
@@ -1008,26 +1068,38 @@ public:
   template <typename T>
   static void FindElementCentroids(typename DataArray<T>::Pointer elemList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer centroids)
   {
-    size_t numElems = elemList->getNumberOfTuples();
-    size_t numVertsPerElem = elemList->getNumberOfComponents();
-    size_t numDims = 3;
-    float* elementCentroids = centroids->getPointer(0);
-    float* vertex = vertices->getPointer(0);
+    FindElementCentroids<T>(elemList->getPointer(0), elemList->getNumberOfTuples(), elemList->getNumberOfComponents(), vertices->getPointer(0), centroids->getPointer(0));
+  }
 
-    for(size_t i = 0; i < numDims; i++)
-    {
-      for(size_t j = 0; j < numElems; j++)
+  /**
+   * @brief FindElementCentroids
+   * @param elems Vertex ids of the elements, numVertsPerElem per element
+   * @param numElems
+   * @param numVertsPerElem
+   * @param vertices Vertex coordinates, 3 per vertex
+   * @param centroids Output, 3 per element
+   */
+  template <typename T>
+  static void FindElementCentroids(const T* elems, size_t numElems, size_t numVertsPerElem, const float* vertices, float* centroids)
+  {
+    Detail::ParallelForEachElement(numElems, [=](size_t start, size_t end) {
+      const float scale = static_cast<float>(numVertsPerElem);
+      for(size_t j = start; j < end; j++)
       {
-        T* Elem = elemList->getTuplePointer(j);
-        float vertPos = 0.0;
+        const T* elem = elems + numVertsPerElem * j;
+        float centroid[3] = {0.0f, 0.0f, 0.0f};
         for(size_t k = 0; k < numVertsPerElem; k++)
         {
-          vertPos += vertex[3 * Elem[k] + i];
+          const float* vert = vertices + 3 * elem[k];
+          centroid[0] += vert[0];
+          centroid[1] += vert[1];
+          centroid[2] += vert[2];
         }
-        vertPos /= static_cast<float>(numVertsPerElem);
-        elementCentroids[numDims * j + i] = vertPos;
+        centroids[3 * j + 0] = centroid[0] / scale;
+        centroids[3 * j + 1] = centroid[1] / scale;
+        centroids[3 * j + 2] = centroid[2] / scale;
       }
-    }
+    });
   }
 
   /**
@@ -1039,83 +1111,60 @@ public:
   template <typename T>
   static void Find2DElementAreas(typename DataArray<T>::Pointer elemList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer areas)
   {
-    float nx, ny, nz;
-    int32_t projection;
+    Find2DElementAreas<T>(elemList->getPointer(0), elemList->getNumberOfTuples(), elemList->getNumberOfComponents(), vertices->getPointer(0), areas->getPointer(0));
+  }
 
-    size_t numElems = elemList->getNumberOfTuples();
-    int64_t numVertsPerElem = static_cast<int64_t>(elemList->getNumberOfComponents());
+  /**
+   * @brief Find2DElementAreas
+   * @param elems Vertex ids of the elements, numVertsPerElem per element
+   * @param numElems
+   * @param numVertsPerElem
+   * @param vertices Vertex coordinates, 3 per vertex
+   * @param areas Output, 1 per element
+   */
+  template <typename T>
+  static void Find2DElementAreas(const T* elems, size_t numElems, size_t numVertsPerElem, const float* vertices, float* areas)
+  {
     if(numVertsPerElem < 3)
     {
       return;
     }
-    float* vertex = vertices->getPointer(0);
-    float* elemAreas = areas->getPointer(0);
-    float normal[3] = {0.0f, 0.0f, 0.0f};
-    std::vector<float> coords(3 * numVertsPerElem, 0.0f);
-    float vert0[3] = {0.0f, 0.0f, 0.0f};
-    float vert1[3] = {0.0f, 0.0f, 0.0f};
-    float vert2[3] = {0.0f, 0.0f, 0.0f};
-
-    for(size_t i = 0; i < numElems; i++)
-    {
-      float area = 0.0f;
-      T* elem = elemList->getTuplePointer(i);
-
-      // Create a contiguous vertex coordinates list
-      // This simplifies the pointer arithmetic a bit
-      for(int64_t j = 0; j < numVertsPerElem; j++)
-      {
-        std::copy(vertex + (3 * elem[j]), vertex + (3 * elem[j] + 3), coords.begin() + (3 * j));
-      }
 
+    Detail::ParallelForEachElement(numElems, [=](size_t start, size_t end) {
+      const int64_t numVerts = static_cast<int64_t>(numVertsPerElem);
+      // Contiguous coordinates of one element; each range gets its own copy
+      std::vector<float> coords(3 * numVertsPerElem, 0.0f);
       float* coordinates = coords.data();
-      GeometryMath::FindPolygonNormal(coordinates, numVertsPerElem, normal);
-      MatrixMath::Normalize3x1(normal);
-
-      nx = (normal[0] > 0.0 ? normal[0] : -normal[0]);
-      ny = (normal[1] > 0.0 ? normal[1] : -normal[1]);
-      nz = (normal[2] > 0.0 ? normal[2] : -normal[2]);
-      projection = (nx > ny ? (nx > nz ? 0 : 2) : (ny > nz ? 1 : 2));
-
-      for(int64_t j = 0; j < numVertsPerElem; j++)
+      for(size_t i = start; i < end; i++)
       {
-        std::copy(coordinates + (3 * j), coordinates + (3 * j + 3), vert0);
-        std::copy(coordinates + (3 * ((j + 1) % numVertsPerElem)), coordinates + (3 * ((j + 1) % numVertsPerElem) + 3), vert1);
-        std::copy(coordinates + (3 * ((j + 2) % numVertsPerElem)), coordinates + (3 * ((j + 2) % numVertsPerElem) + 3), vert2);
-
-        switch(projection)
+        const T* elem = elems + numVertsPerElem * i;
+        for(size_t j = 0; j < numVertsPerElem; j++)
         {
-        case 0: {
-          area += coordinates[3 * ((j + 1) % numVertsPerElem) + 1] * (coordinates[3 * ((j + 2) % numVertsPerElem) + 2] - coordinates[3 * j + 2]);
-          continue;
-        }
-        case 1: {
-          area += coordinates[3 * ((j + 1) % numVertsPerElem) + 0] * (coordinates[3 * ((j + 2) % numVertsPerElem) + 2] - coordinates[3 * j + 2]);
-          continue;
-        }
-        case 2: {
-          area += coordinates[3 * ((j + 1) % numVertsPerElem) + 0] * (coordinates[3 * ((j + 2) % numVertsPerElem) + 1] - coordinates[3 * j + 1]);
-          continue;
-        }
+          std::copy(vertices + (3 * elem[j]), vertices + (3 * elem[j] + 3), coordinates + (3 * j));
         }
-      }
 
-      switch(projection)
-      {
-      case 0: {
-        area /= (2.0f * nx);
-        break;
-      }
-      case 1: {
-        area /= (2.0f * ny);
-        break;
-      }
-      case 2: {
-        area /= (2.0f * nz);
-      }
+        float normal[3] = {0.0f, 0.0f, 0.0f};
+        GeometryMath::FindPolygonNormal(coordinates, numVerts, normal);
+        MatrixMath::Normalize3x1(normal);
+
+        // Project onto the coordinate plane most parallel to the polygon and use the shoelace formula
+        float nx = (normal[0] > 0.0 ? normal[0] : -normal[0]);
+        float ny = (normal[1] > 0.0 ? normal[1] : -normal[1]);
+        float nz = (normal[2] > 0.0 ? normal[2] : -normal[2]);
+        int32_t projection = (nx > ny ? (nx > nz ? 0 : 2) : (ny > nz ? 1 : 2));
+        const size_t u = (projection == 0 ? 1 : 0);
+        const size_t v = (projection == 2 ? 1 : 2);
+        const float nProj = (projection == 0 ? nx : (projection == 1 ? ny : nz));
+
+        float area = 0.0f;
+        for(int64_t j = 0; j < numVerts; j++)
+        {
+          area += coordinates[3 * ((j + 1) % numVerts) + u] * (coordinates[3 * ((j + 2) % numVerts) + v] - coordinates[3 * j + v]);
+        }
+        area /= (2.0f * nProj);
+        areas[i] = fabsf(area);
       }
-      elemAreas[i] = fabsf(area);
-    }
+    });
   }
 
   /**
@@ -1127,24 +1176,26 @@ public:
   template <typename T>
   static void FindTetVolumes(typename DataArray<T>::Pointer tetList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer volumes)
   {
-    size_t numTets = tetList->getNumberOfTuples();
-    float* vertex = vertices->getPointer(0);
-    float* volumePtr = volumes->getPointer(0);
-
-    for(size_t i = 0; i < numTets; i++)
-    {
-      T* tet = tetList->getTuplePointer(i);
-      float vert0[3] = {vertex[3 * tet[0] + 0], vertex[3 * tet[0] + 1], vertex[3 * tet[0] + 2]};
-      float vert1[3] = {vertex[3 * tet[1] + 0], vertex[3 * tet[1] + 1], vertex[3 * tet[1] + 2]};
-      float vert2[3] = {vertex[3 * tet[2] + 0], vertex[3 * tet[2] + 1], vertex[3 * tet[2] + 2]};
-      float vert3[3] = {vertex[3 * tet[3] + 0], vertex[3 * tet[3] + 1], vertex[3 * tet[3] + 2]};
-
-      float vertMatrix[3][3] = {{vert1[0] - vert0[0], vert2[0] - vert0[0], vert3[0] - vert0[0]},
-                                {vert1[1] - vert0[1], vert2[1] - vert0[1], vert3[1] - vert0[1]},
-                                {vert1[2] - vert0[2], vert2[2] - vert0[2], vert3[2] - vert0[2]}};
+    FindTetVolumes<T>(tetList->getPointer(0), tetList->getNumberOfTuples(), vertices->getPointer(0), volumes->getPointer(0));
+  }
 
-      volumePtr[i] = (MatrixMath::Determinant3x3(vertMatrix) / 6.0f);
-    }
+  /**
+   * @brief FindTetVolumes
+   * @param tets Vertex ids of the tetrahedra, 4 per tetrahedron
+   * @param numTets
+   * @param vertices Vertex coordinates, 3 per vertex
+   * @param volumes Output, 1 per tetrahedron
+   */
+  template <typename T>
+  static void FindTetVolumes(const T* tets, size_t numTets, const float* vertices, float* volumes)
+  {
+    Detail::ParallelForEachElement(numTets, [=](size_t start, size_t end) {
+      for(size_t i = start; i < end; i++)
+      {
+        const T* tet = tets + 4 * i;
+        volumes[i] = Detail::TetDeterminant(vertices, tet[0], tet[1], tet[2], tet[3]) / 6.0f;
+      }
+    });
   }
 
   /**
@@ -1156,64 +1207,34 @@ public:
   template <typename T>
   static void FindHexVolumes(typename DataArray<T>::Pointer hexList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer volumes)
   {
-    size_t numHexas = hexList->getNumberOfTuples();
-    float* vertex = vertices->getPointer(0);
-    float* volumePtr = volumes->getPointer(0);
+    FindHexVolumes<T>(hexList->getPointer(0), hexList->getNumberOfTuples(), vertices->getPointer(0), volumes->getPointer(0));
+  }
 
-    for(size_t i = 0; i < numHexas; i++)
-    {
-      // Subdivide each hexahedron into 5 tetrahedra & sum their volumes
-      std::vector<std::vector<int64_t>> subTets(5, std::vector<int64_t>(4, 0));
-      T* hex = hexList->getTuplePointer(i);
-
-      // First tetrahedron from hexahedron vertices (0, 1, 3, 4);
-      subTets[0][0] = hex[0];
-      subTets[0][1] = hex[1];
-      subTets[0][2] = hex[3];
-      subTets[0][3] = hex[4];
-
-      // Second tetrahedron from hexahedron vertices (1, 4, 5, 6);
-      subTets[1][0] = hex[1];
-      subTets[1][1] = hex[4];
-      subTets[1][2] = hex[5];
-      subTets[1][3] = hex[6];
-
-      // Third tetrahedron from hexahedron vertices (1, 4, 6, 3);
-      subTets[2][0] = hex[1];
-      subTets[2][1] = hex[3];
-      subTets[2][2] = hex[6];
-      subTets[2][3] = hex[3];
-
-      // Fourth tetrahedron from hexahedron vertices (1, 3, 6, 2);
-      subTets[3][0] = hex[1];
-      subTets[3][1] = hex[3];
-      subTets[3][2] = hex[6];
-      subTets[3][3] = hex[2];
-
-      // Fifth tetrahedron from hexahedron vertices (3, 6, 7, 4);
-      subTets[4][0] = hex[3];
-      subTets[4][1] = hex[6];
-      subTets[4][2] = hex[7];
-      subTets[4][3] = hex[4];
-
-      float volume = 0.0f;
-
-      for(auto&& tet : subTets)
+  /**
+   * @brief FindHexVolumes
+   * @param hexas Vertex ids of the hexahedra, 8 per hexahedron
+   * @param numHexas
+   * @param vertices Vertex coordinates, 3 per vertex
+   * @param volumes Output, 1 per hexahedron
+   */
+  template <typename T>
+  static void FindHexVolumes(const T* hexas, size_t numHexas, const float* vertices, float* volumes)
+  {
+    Detail::ParallelForEachElement(numHexas, [=](size_t start, size_t end) {
+      for(size_t i = start; i < end; i++)
       {
-        float vert0[3] = {vertex[3 * tet[0] + 0], vertex[3 * tet[0] + 1], vertex[3 * tet[0] + 2]};
-        float vert1[3] = {vertex[3 * tet[1] + 0], vertex[3 * tet[1] + 1], vertex[3 * tet[1] + 2]};
-        float vert2[3] = {vertex[3 * tet[2] + 0], vertex[3 * tet[2] + 1], vertex[3 * tet[2] + 2]};
-        float vert3[3] = {vertex[3 * tet[3] + 0], vertex[3 * tet[3] + 1], vertex[3 * tet[3] + 2]};
-
-        float vertMatrix[3][3] = {{vert1[0] - vert0[0], vert2[0] - vert0[0], vert3[0] - vert0[0]},
-                                  {vert1[1] - vert0[1], vert2[1] - vert0[1], vert3[1] - vert0[1]},
-                                  {vert1[2] - vert0[2], vert2[2] - vert0[2], vert3[2] - vert0[2]}};
-
-        volume += (MatrixMath::Determinant3x3(vertMatrix) / 6.0f);
+        // Subdivide each hexahedron into 5 tetrahedra & sum their volumes:
+        // (0, 1, 3, 4), (1, 4, 5, 6), (1, 4, 6, 3), (1, 3, 6, 2) and (3, 6, 7, 4)
+        const T* hex = hexas + 8 * i;
+        float volume = 0.0f;
+        volume += Detail::TetDeterminant(vertices, hex[0], hex[1], hex[3], hex[4]) / 6.0f;
+        volume += Detail::TetDeterminant(vertices, hex[1], hex[4], hex[5], hex[6]) / 6.0f;
+        volume += Detail::TetDeterminant(vertices, hex[1], hex[4], hex[6], hex[3]) / 6.0f;
+        volume += Detail::TetDeterminant(vertices, hex[1], hex[3], hex[6], hex[2]) / 6.0f;
+        volume += Detail::TetDeterminant(vertices, hex[3], hex[6], hex[7], hex[4]) / 6.0f;
+        volumes[i] = volume;
       }
-
-      volumePtr[i] = volume;
-    }
+    });
   }
 
   /**
@@ -1225,25 +1246,27 @@ public:
   template <typename T>
   static void FindTetJacobians(typename DataArray<T>::Pointer tetList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer jacobians)
   {
-    size_t numTets = tetList->getNumberOfTuples();
-    float* vertex = vertices->getPointer(0);
-    float* jacobianPtr = jacobians->getPointer(0);
+    FindTetJacobians<T>(tetList->getPointer(0), tetList->getNumberOfTuples(), vertices->getPointer(0), jacobians->getPointer(0));
+  }
 
-    for(size_t i = 0; i < numTets; i++)
-    {
-      T* tet = tetList->getTuplePointer(i);
-      // get vert positions
-      float vert0[3] = {vertex[3 * tet[0] + 0], vertex[3 * tet[0] + 1], vertex[3 * tet[0] + 2]};
-      float vert1[3] = {vertex[3 * tet[1] + 0], vertex[3 * tet[1] + 1], vertex[3 * tet[1] + 2]};
-      float vert2[3] = {vertex[3 * tet[2] + 0], vertex[3 * tet[2] + 1], vertex[3 * tet[2] + 2]};
-      float vert3[3] = {vertex[3 * tet[3] + 0], vertex[3 * tet[3] + 1], vertex[3 * tet[3] + 2]};
-      // build jacobian matrix
-      float vertMatrix[3][3] = {{vert1[0] - vert0[0], vert2[0] - vert0[0], vert3[0] - vert0[0]},
-                                {vert1[1] - vert0[1], vert2[1] - vert0[1], vert3[1] - vert0[1]},
-                                {vert1[2] - vert0[2], vert2[2] - vert0[2], vert3[2] - vert0[2]}};
-      // find jacobian, which is determinant of the jacobian matrix
-      jacobianPtr[i] = MatrixMath::Determinant3x3(vertMatrix);
-    }
+  /**
+   * @brief FindTetJacobians
+   * @param tets Vertex ids of the tetrahedra, 4 per tetrahedron
+   * @param numTets
+   * @param vertices Vertex coordinates, 3 per vertex
+   * @param jacobians Output, 1 per tetrahedron
+   */
+  template <typename T>
+  static void FindTetJacobians(const T* tets, size_t numTets, const float* vertices, float* jacobians)
+  {
+    Detail::ParallelForEachElement(numTets, [=](size_t start, size_t end) {
+      for(size_t i = start; i < end; i++)
+      {
+        // The jacobian is the determinant of the jacobian matrix
+        const T* tet = tets + 4 * i;
+        jacobians[i] = Detail::TetDeterminant(vertices, tet[0], tet[1], tet[2], tet[3]);
+      }
+    });
   }
 
   /**
@@ -1255,66 +1278,57 @@ public:
   template <typename T>
   static void FindTetMinDihedralAngles(typename DataArray<T>::Pointer tetList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer minAngles)
   {
-    size_t numTets = tetList->getNumberOfTuples();
-    float* vertex = vertices->getPointer(0);
-    float* minAnglesPtr = minAngles->getPointer(0);
+    FindTetMinDihedralAngles<T>(tetList->getPointer(0), tetList->getNumberOfTuples(), vertices->getPointer(0), minAngles->getPointer(0));
+  }
 
-    for(size_t i = 0; i < numTets; i++)
-    {
-      T* tet = tetList->getTuplePointer(i);
-      // get vert positions
-      float vert0[3] = {vertex[3 * tet[0] + 0], vertex[3 * tet[0] + 1], vertex[3 * tet[0] + 2]};
-      float vert1[3] = {vertex[3 * tet[1] + 0], vertex[3 * tet[1] + 1], vertex[3 * tet[1] + 2]};
-      float vert2[3] = {vertex[3 * tet[2] + 0], vertex[3 * tet[2] + 1], vertex[3 * tet[2] + 2]};
-      float vert3[3] = {vertex[3 * tet[3] + 0], vertex[3 * tet[3] + 1], vertex[3 * tet[3] + 2]};
-      // find 5 edges needed to find 4 face normals
-      float v10[3] = {(vert1[0] - vert0[0]), (vert1[1] - vert0[1]), (vert1[2] - vert0[2])};
-      float v20[3] = {(vert2[0] - vert0[0]), (vert2[1] - vert0[1]), (vert2[2] - vert0[2])};
-      float v30[3] = {(vert3[0] - vert0[0]), (vert3[1] - vert0[1]), (vert3[2] - vert0[2])};
-      float v21[3] = {(vert2[0] - vert1[0]), (vert2[1] - vert1[1]), (vert2[2] - vert1[2])};
-      float v31[3] = {(vert3[0] - vert1[0]), (vert3[1] - vert1[1]), (vert3[2] - vert1[2])};
-      // find 4 face-to-face normals
-      float norm1[3] = {(v10[1] * v20[2] - v10[2] * v20[1]), (v10[2] * v20[0] - v10[0] * v20[2]), (v10[0] * v20[1] - v10[1] * v20[0])};
-      float norm2[3] = {(v30[1] * v10[2] - v30[2] * v10[1]), (v30[2] * v10[0] - v30[0] * v10[2]), (v30[0] * v10[1] - v30[1] * v10[0])};
-      float norm3[3] = {(v20[1] * v30[2] - v20[2] * v30[1]), (v20[2] * v30[0] - v20[0] * v30[2]), (v20[0] * v30[1] - v20[1] * v30[0])};
-      float norm4[3] = {(v31[1] * v21[2] - v31[2] * v21[1]), (v31[2] * v21[0] - v31[0] * v21[2]), (v31[0] * v21[1] - v31[1] * v21[0])};
-      // find the magnitudes of each normal
-      float norm1mag = sqrtf(norm1[0] * norm1[0] + norm1[1] * norm1[1] + norm1[2] * norm1[2]);
-      float norm2mag = sqrtf(norm2[0] * norm2[0] + norm2[1] * norm2[1] + norm2[2] * norm2[2]);
-      float norm3mag = sqrtf(norm3[0] * norm3[0] + norm3[1] * norm3[1] + norm3[2] * norm3[2]);
-      float norm4mag = sqrtf(norm4[0] * norm4[0] + norm4[1] * norm4[1] + norm4[2] * norm4[2]);
-      // find angles between faces
-      float ang1 = (norm1[0] * norm2[0] + norm1[1] * norm2[1] + norm1[2] * norm2[2]) / (norm1mag * norm2mag);
-      float ang2 = (norm1[0] * norm3[0] + norm1[1] * norm3[1] + norm1[2] * norm3[2]) / (norm1mag * norm3mag);
-      float ang3 = (norm1[0] * norm4[0] + norm1[1] * norm4[1] + norm1[2] * norm4[2]) / (norm1mag * norm4mag);
-      float ang4 = (norm2[0] * norm3[0] + norm2[1] * norm3[1] + norm2[2] * norm3[2]) / (norm2mag * norm3mag);
-      float ang5 = (norm2[0] * norm4[0] + norm2[1] * norm4[1] + norm2[2] * norm4[2]) / (norm2mag * norm4mag);
-      float ang6 = (norm3[0] * norm4[0] + norm3[1] * norm4[1] + norm3[2] * norm4[2]) / (norm3mag * norm4mag);
-      // find the maximum ang value, which will be the minimum angle after the acos
-      float minAng = ang1;
-      if(ang2 > minAng)
-      {
-        minAng = ang2;
-      }
-      if(ang3 > minAng)
-      {
-        minAng = ang3;
-      }
-      if(ang4 > minAng)
-      {
-        minAng = ang4;
-      }
-      if(ang5 > minAng)
-      {
-        minAng = ang5;
-      }
-      if(ang6 > minAng)
+  /**
+   * @brief FindTetMinDihedralAngles
+   * @param tets Vertex ids of the tetrahedra, 4 per tetrahedron
+   * @param numTets
+   * @param vertices Vertex coordinates, 3 per vertex
+   * @param minAngles Output in degrees, 1 per tetrahedron
+   */
+  template <typename T>
+  static void FindTetMinDihedralAngles(const T* tets, size_t numTets, const float* vertices, float* minAngles)
+  {
+    Detail::ParallelForEachElement(numTets, [=](size_t start, size_t end) {
+      for(size_t i = start; i < end; i++)
       {
-        minAng = ang6;
+        const T* tet = tets + 4 * i;
+        // get vert positions
+        const float* vert0 = vertices + 3 * tet[0];
+        const float* vert1 = vertices + 3 * tet[1];
+        const float* vert2 = vertices + 3 * tet[2];
+        const float* vert3 = vertices + 3 * tet[3];
+        // find 5 edges needed to find 4 face normals
+        float v10[3] = {(vert1[0] - vert0[0]), (vert1[1] - vert0[1]), (vert1[2] - vert0[2])};
+        float v20[3] = {(vert2[0] - vert0[0]), (vert2[1] - vert0[1]), (vert2[2] - vert0[2])};
+        float v30[3] = {(vert3[0] - vert0[0]), (vert3[1] - vert0[1]), (vert3[2] - vert0[2])};
+        float v21[3] = {(vert2[0] - vert1[0]), (vert2[1] - vert1[1]), (vert2[2] - vert1[2])};
+        float v31[3] = {(vert3[0] - vert1[0]), (vert3[1] - vert1[1]), (vert3[2] - vert1[2])};
+        // find 4 face-to-face normals
+        float norm1[3] = {(v10[1] * v20[2] - v10[2] * v20[1]), (v10[2] * v20[0] - v10[0] * v20[2]), (v10[0] * v20[1] - v10[1] * v20[0])};
+        float norm2[3] = {(v30[1] * v10[2] - v30[2] * v10[1]), (v30[2] * v10[0] - v30[0] * v10[2]), (v30[0] * v10[1] - v30[1] * v10[0])};
+        float norm3[3] = {(v20[1] * v30[2] - v20[2] * v30[1]), (v20[2] * v30[0] - v20[0] * v30[2]), (v20[0] * v30[1] - v20[1] * v30[0])};
+        float norm4[3] = {(v31[1] * v21[2] - v31[2] * v21[1]), (v31[2] * v21[0] - v31[0] * v21[2]), (v31[0] * v21[1] - v31[1] * v21[0])};
+        // find the magnitudes of each normal
+        float norm1mag = sqrtf(norm1[0] * norm1[0] + norm1[1] * norm1[1] + norm1[2] * norm1[2]);
+        float norm2mag = sqrtf(norm2[0] * norm2[0] + norm2[1] * norm2[1] + norm2[2] * norm2[2]);
+        float norm3mag = sqrtf(norm3[0] * norm3[0] + norm3[1] * norm3[1] + norm3[2] * norm3[2]);
+        float norm4mag = sqrtf(norm4[0] * norm4[0] + norm4[1] * norm4[1] + norm4[2] * norm4[2]);
+        // find angles between faces
+        float ang1 = (norm1[0] * norm2[0] + norm1[1] * norm2[1] + norm1[2] * norm2[2]) / (norm1mag * norm2mag);
+        float ang2 = (norm1[0] * norm3[0] + norm1[1] * norm3[1] + norm1[2] * norm3[2]) / (norm1mag * norm3mag);
+        float ang3 = (norm1[0] * norm4[0] + norm1[1] * norm4[1] + norm1[2] * norm4[2]) / (norm1mag * norm4mag);
+        float ang4 = (norm2[0] * norm3[0] + norm2[1] * norm3[1] + norm2[2] * norm3[2]) / (norm2mag * norm3mag);
+        float ang5 = (norm2[0] * norm4[0] + norm2[1] * norm4[1] + norm2[2] * norm4[2]) / (norm2mag * norm4mag);
+        float ang6 = (norm3[0] * norm4[0] + norm3[1] * norm4[1] + norm3[2] * norm4[2]) / (norm3mag * norm4mag);
+        // find the maximum ang value, which will be the minimum angle after the acos
+        float minAng = std::max(std::max(std::max(ang1, ang2), std::max(ang3, ang4)), std::max(ang5, ang6));
+
+        minAngles[i] = SIMPLib::Constants::k_180OverPiD * acosf(minAng);
       }
-
-      minAnglesPtr[i] = SIMPLib::Constants::k_180OverPiD * acosf(minAng);
-    }
+    });
   }
 };
 
@@ -1339,27 +1353,39 @@ public:
     Q_ASSERT(outElemArray->getComponentDimensions() == inVertexArray->getComponentDimensions());
     Q_ASSERT(elemList->getNumberOfTuples() == outElemArray->getNumberOfTuples());
 
-    K* vertArray = inVertexArray->getPointer(0);
-    float* elemArray = outElemArray->getPointer(0);
-
-    size_t numElems = outElemArray->getNumberOfTuples();
-    size_t numDims = inVertexArray->getNumberOfComponents();
-    size_t numVertsPerElem = elemList->getNumberOfComponents();
+    AverageVertexArrayValues<T, K>(elemList->getPointer(0), outElemArray->getNumberOfTuples(), elemList->getNumberOfComponents(), inVertexArray->getPointer(0), inVertexArray->getNumberOfComponents(),
+                                   outElemArray->getPointer(0));
+  }
 
-    for(size_t i = 0; i < numDims; i++)
-    {
-      for(size_t j = 0; j < numElems; j++)
+  /**
+   * @brief AverageVertexArrayValues
+   * @param elems Vertex ids of the elements, numVertsPerElem per element
+   * @param numElems
+   * @param numVertsPerElem
+   * @param vertArray Vertex values, numComps per vertex
+   * @param numComps
+   * @param elemArray Output, numComps per element
+   */
+  template <typename T, typename K>
+  static void AverageVertexArrayValues(const T* elems, size_t numElems, size_t numVertsPerElem, const K* vertArray, size_t numComps, float* elemArray)
+  {
+    Detail::ParallelForEachElement(numElems, [=](size_t start, size_t end) {
+      const float scale = static_cast<float>(numVertsPerElem);
+      for(size_t j = start; j < end; j++)
       {
-        T* Elem = elemList->getTuplePointer(j);
-        float vertValue = 0.0;
-        for(size_t k = 0; k < numVertsPerElem; k++)
+        const T* elem = elems + numVertsPerElem * j;
+        float* elemValue = elemArray + numComps * j;
+        for(size_t i = 0; i < numComps; i++)
         {
-          vertValue += vertArray[numDims * Elem[k] + i];
+          float vertValue = 0.0;
+          for(size_t k = 0; k < numVertsPerElem; k++)
+          {
+            vertValue += vertArray[numComps * elem[k] + i];
+          }
+          elemValue[i] = vertValue / scale;
         }
-        vertValue /= static_cast<float>(numVertsPerElem);
-        elemArray[numDims * j + i] = vertValue;
       }
-    }
+    });
   }
 
   /**
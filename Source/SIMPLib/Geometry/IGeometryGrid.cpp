@@ -35,6 +35,49 @@
 
 #include "SIMPLib/Geometry/IGeometryGrid.h"
 
+#include <array>
+#include <vector>
+
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+/**
+ * @brief The CopyCellCentersImpl class implements a threaded algorithm that fills whole rows of cell
+ * centers from the per axis coordinates
+ */
+class CopyCellCentersImpl
+{
+public:
+  CopyCellCentersImpl(const std::array<std::vector<float>, 3>& axisCoords, float* destination)
+  : m_AxisCoords(axisCoords)
+  , m_Destination(destination)
+  {
+  }
+  virtual ~CopyCellCentersImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    const size_t dimX = m_AxisCoords[0].size();
+    const size_t dimY = m_AxisCoords[1].size();
+    const float* xCoords = m_AxisCoords[0].data();
+    for(size_t row = range.min(); row < range.max(); row++)
+    {
+      const float yCoord = m_AxisCoords[1][row % dimY];
+      const float zCoord = m_AxisCoords[2][row / dimY];
+      float* destination = m_Destination + 3 * row * dimX;
+      for(size_t x = 0; x < dimX; x++)
+      {
+        destination[3 * x] = xCoords[x];
+        destination[3 * x + 1] = yCoord;
+        destination[3 * x + 2] = zCoord;
+      }
+    }
+  }
+
+private:
+  const std::array<std::vector<float>, 3>& m_AxisCoords;
+  float* m_Destination;
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -45,6 +88,42 @@ IGeometryGrid::IGeometryGrid() = default;
 // -----------------------------------------------------------------------------
 IGeometryGrid::~IGeometryGrid() = default;
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool IGeometryGrid::copyCellCenters(FloatArrayType& destination) const
+{
+  SizeVec3Type dims = getDimensions();
+  const size_t numCells = dims[0] * dims[1] * dims[2];
+  if(destination.getNumberOfTuples() != numCells || destination.getNumberOfComponents() != 3 || (numCells > 0 && !destination.isAllocated()))
+  {
+    return false;
+  }
+  if(numCells == 0)
+  {
+    return true;
+  }
+
+  std::array<std::vector<float>, 3> axisCoords;
+  float coords[3] = {0.0f, 0.0f, 0.0f};
+  for(size_t axis = 0; axis < 3; axis++)
+  {
+    axisCoords[axis].resize(dims[axis]);
+    for(size_t i = 0; i < dims[axis]; i++)
+    {
+      size_t idx[3] = {0, 0, 0};
+      idx[axis] = i;
+      getCoords(idx, coords);
+      axisCoords[axis][i] = coords[axis];
+    }
+  }
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, dims[1] * dims[2]);
+  dataAlg.execute(CopyCellCentersImpl(axisCoords, destination.getPointer(0)));
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 IGeometryGrid::Pointer IGeometryGrid::NullPointer()
 {
@@ -100,6 +100,15 @@ public:
   virtual std::optional<size_t> getIndex(float xCoord, float yCoord, float zCoord) const = 0;
   virtual std::optional<size_t> getIndex(double xCoord, double yCoord, double zCoord) const = 0;
 
+  /**
+   * @brief Writes the cell center of every cell into 'destination' in x fastest order. The coordinates of each
+   * axis are looked up once through getCoords() and whole rows are filled from them, so the values match calling
+   * getCoords() for every cell. Rows are filled in parallel.
+   * @param destination Allocated 3 component array with one tuple per cell
+   * @return false if 'destination' does not match the number of cells
+   */
+  bool copyCellCenters(FloatArrayType& destination) const;
+
 public:
   IGeometryGrid(const IGeometryGrid&) = delete;            // Copy Constructor Not Implemented
   IGeometryGrid(IGeometryGrid&&) = delete;                 // Move Constructor Not Implemented
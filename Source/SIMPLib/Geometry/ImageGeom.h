@@ -422,8 +422,6 @@ private:
   FloatVec3Type m_Origin;
   SizeVec3Type m_Dimensions;
 
-  friend class FindImageDerivativesImpl;
-
 public:
   ImageGeom(const ImageGeom&) = delete;            // Copy Constructor Not Implemented
   ImageGeom(ImageGeom&&) = delete;                 // Move Constructor Not Implemented
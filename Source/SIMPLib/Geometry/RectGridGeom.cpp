@@ -45,345 +45,12 @@
 
 #include <QtCore/QTextStream>
 
-#include <thread>
-
 #include "SIMPLib/Geometry/RectGridGeom.h"
 
 #include "H5Support/H5Lite.h"
 #include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Geometry/StructuredGridDerivatives.h"
 #include "SIMPLib/HDF5/VTKH5Constants.h"
-#include "SIMPLib/Utilities/ParallelData3DAlgorithm.h"
-
-/**
- * @brief The FindImageDerivativesImpl class implements a threaded algorithm that computes the
- * derivative of an arbitrary dimensional field on the underlying rectilinear grid
- */
-class FindRectGridDerivativesImpl
-{
-public:
-  FindRectGridDerivativesImpl(RectGridGeom* image, DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivs)
-  : m_RectGrid(image)
-  , m_Field(field)
-  , m_Derivatives(derivs)
-  {
-  }
-  virtual ~FindRectGridDerivativesImpl() = default;
-
-  void compute(size_t zStart, size_t zEnd, size_t yStart, size_t yEnd, size_t xStart, size_t xEnd) const
-  {
-    double xp[3] = {0.0, 0.0, 0.0};
-    double xm[3] = {0.0, 0.0, 0.0};
-    double factor = 0.0;
-    double xxi, yxi, zxi, xeta, yeta, zeta, xzeta, yzeta, zzeta;
-    xxi = yxi = zxi = xeta = yeta = zeta = xzeta = yzeta = zzeta = 0;
-    double aj, xix, xiy, xiz, etax, etay, etaz, zetax, zetay, zetaz;
-    aj = xix = xiy = xiz = etax = etay = etaz = zetax = zetay = zetaz = 0;
-    size_t index = 0;
-    int32_t numComps = m_Field->getNumberOfComponents();
-    double* fieldPtr = m_Field->getPointer(0);
-    double* derivsPtr = m_Derivatives->getPointer(0);
-    std::vector<double> plusValues(numComps);
-    std::vector<double> minusValues(numComps);
-    std::vector<double> dValuesdXi(numComps);
-    std::vector<double> dValuesdEta(numComps);
-    std::vector<double> dValuesdZeta(numComps);
-
-    SizeVec3Type dims = m_RectGrid->getDimensions();
-
-    int64_t counter = 0;
-    size_t totalElements = m_RectGrid->getNumberOfElements();
-    int64_t progIncrement = static_cast<int64_t>(totalElements / 100);
-
-    for(size_t z = zStart; z < zEnd; z++)
-    {
-      for(size_t y = yStart; y < yEnd; y++)
-      {
-        for(size_t x = xStart; x < xEnd; x++)
-        {
-          //  Xi derivatives (X)
-          if(dims[0] == 1)
-          {
-            findValuesForFiniteDifference(TwoDimensional, XDirection, x, y, z, dims.data(), xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else if(x == 0)
-          {
-            findValuesForFiniteDifference(LeftSide, XDirection, x, y, z, dims.data(), xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else if(x == (dims[0] - 1))
-          {
-            findValuesForFiniteDifference(RightSide, XDirection, x, y, z, dims.data(), xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else
-          {
-            findValuesForFiniteDifference(Centered, XDirection, x, y, z, dims.data(), xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-
-          xxi = factor * (xp[0] - xm[0]);
-          yxi = factor * (xp[1] - xm[1]);
-          zxi = factor * (xp[2] - xm[2]);
-          for(int32_t i = 0; i < numComps; i++)
-          {
-            dValuesdXi[i] = factor * (plusValues[i] - minusValues[i]);
-          }
-
-          //  Eta derivatives (Y)
-          if(dims[1] == 1)
-          {
-            findValuesForFiniteDifference(TwoDimensional, YDirection, x, y, z, dims.data(), xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else if(y == 0)
-          {
-            findValuesForFiniteDifference(LeftSide, YDirection, x, y, z, dims.data(), xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else if(y == (dims[1] - 1))
-          {
-            findValuesForFiniteDifference(RightSide, YDirection, x, y, z, dims.data(), xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else
-          {
-            findValuesForFiniteDifference(Centered, YDirection, x, y, z, dims.data(), xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-
-          xeta = factor * (xp[0] - xm[0]);
-          yeta = factor * (xp[1] - xm[1]);
-          zeta = factor * (xp[2] - xm[2]);
-          for(int32_t i = 0; i < numComps; i++)
-          {
-            dValuesdEta[i] = factor * (plusValues[i] - minusValues[i]);
-          }
-
-          //  Zeta derivatives (Z)
-          if(dims[2] == 1)
-          {
-            findValuesForFiniteDifference(TwoDimensional, ZDirection, x, y, z, dims.data(), xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else if(z == 0)
-          {
-            findValuesForFiniteDifference(LeftSide, ZDirection, x, y, z, dims.data(), xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else if(z == (dims[2] - 1))
-          {
-            findValuesForFiniteDifference(RightSide, ZDirection, x, y, z, dims.data(), xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else
-          {
-            findValuesForFiniteDifference(Centered, ZDirection, x, y, z, dims.data(), xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-
-          xzeta = factor * (xp[0] - xm[0]);
-          yzeta = factor * (xp[1] - xm[1]);
-          zzeta = factor * (xp[2] - xm[2]);
-          for(int32_t i = 0; i < numComps; i++)
-          {
-            dValuesdZeta[i] = factor * (plusValues[i] - minusValues[i]);
-          }
-
-          // Now calculate the Jacobian.  Grids occasionally have
-          // singularities, or points where the Jacobian is infinite (the
-          // inverse is zero).  For these cases, we'll set the Jacobian to
-          // zero, which will result in a zero derivative.
-          aj = xxi * yeta * zzeta + yxi * zeta * xzeta + zxi * xeta * yzeta - zxi * yeta * xzeta - yxi * xeta * zzeta - xxi * zeta * yzeta;
-          if(aj != 0.0)
-          {
-            aj = 1.0 / aj;
-          }
-
-          //  Xi metrics
-          xix = aj * (yeta * zzeta - zeta * yzeta);
-          xiy = -aj * (xeta * zzeta - zeta * xzeta);
-          xiz = aj * (xeta * yzeta - yeta * xzeta);
-
-          //  Eta metrics
-          etax = -aj * (yxi * zzeta - zxi * yzeta);
-          etay = aj * (xxi * zzeta - zxi * xzeta);
-          etaz = -aj * (xxi * yzeta - yxi * xzeta);
-
-          //  Zeta metrics
-          zetax = aj * (yxi * zeta - zxi * yeta);
-          zetay = -aj * (xxi * zeta - zxi * xeta);
-          zetaz = aj * (xxi * yeta - yxi * xeta);
-
-          // Compute the actual derivatives
-          index = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
-          for(size_t i = 0; i < numComps; i++)
-          {
-            derivsPtr[index * numComps * 3 + i * 3] = xix * dValuesdXi[i] + etax * dValuesdEta[i] + zetax * dValuesdZeta[i];
-
-            derivsPtr[index * numComps * 3 + i * 3 + 1] = xiy * dValuesdXi[i] + etay * dValuesdEta[i] + zetay * dValuesdZeta[i];
-
-            derivsPtr[index * numComps * 3 + i * 3 + 2] = xiz * dValuesdXi[i] + etaz * dValuesdEta[i] + zetaz * dValuesdZeta[i];
-          }
-
-          if(counter > progIncrement)
-          {
-            m_RectGrid->sendThreadSafeProgressMessage(counter, totalElements);
-            counter = 0;
-          }
-          counter++;
-        }
-      }
-    }
-  }
-
-  void operator()(const SIMPLRange3D& r) const
-  {
-    compute(r[0], r[1], r[2], r[3], r[4], r[5]);
-  }
-
-  void computeIndices(int32_t differenceType, int32_t directionType, size_t& index1, size_t& index2, size_t dims[3], size_t x, size_t y, size_t z, double xp[3], double xm[3]) const
-
-  {
-    size_t tmpIndex1 = 0;
-    size_t tmpIndex2 = 0;
-
-    switch(directionType)
-    {
-    case XDirection: {
-      if(differenceType == LeftSide)
-      {
-        index1 = (z * dims[1] * dims[0]) + (y * dims[0]) + (x + 1);
-        index2 = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
-        tmpIndex1 = x + 1;
-        m_RectGrid->getCoords(tmpIndex1, y, z, xp);
-        m_RectGrid->getCoords(x, y, z, xm);
-      }
-      else if(differenceType == RightSide)
-      {
-        index1 = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
-        index2 = (z * dims[1] * dims[0]) + (y * dims[0]) + (x - 1);
-        tmpIndex1 = x - 1;
-        m_RectGrid->getCoords(x, y, z, xp);
-        m_RectGrid->getCoords(tmpIndex1, y, z, xm);
-      }
-      else if(differenceType == Centered)
-      {
-        index1 = (z * dims[1] * dims[0]) + (y * dims[0]) + (x + 1);
-        index2 = (z * dims[1] * dims[0]) + (y * dims[0]) + (x - 1);
-        tmpIndex1 = x + 1;
-        tmpIndex2 = x - 1;
-        m_RectGrid->getCoords(tmpIndex1, y, z, xp);
-        m_RectGrid->getCoords(tmpIndex2, y, z, xm);
-      }
-      break;
-    }
-    case YDirection: {
-      if(differenceType == LeftSide)
-      {
-        index1 = (z * dims[1] * dims[0]) + ((y + 1) * dims[0]) + x;
-        index2 = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
-        tmpIndex1 = y + 1;
-        m_RectGrid->getCoords(x, tmpIndex1, z, xp);
-        m_RectGrid->getCoords(x, y, z, xm);
-      }
-      else if(differenceType == RightSide)
-      {
-        index1 = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
-        index2 = (z * dims[1] * dims[0]) + ((y - 1) * dims[0]) + x;
-        tmpIndex1 = y - 1;
-        m_RectGrid->getCoords(x, y, z, xp);
-        m_RectGrid->getCoords(x, tmpIndex1, z, xm);
-      }
-      else if(differenceType == Centered)
-      {
-        index1 = (z * dims[1] * dims[0]) + ((y + 1) * dims[0]) + x;
-        index2 = (z * dims[1] * dims[0]) + ((y - 1) * dims[0]) + x;
-        tmpIndex1 = y + 1;
-        tmpIndex2 = y - 1;
-        m_RectGrid->getCoords(x, tmpIndex1, z, xp);
-        m_RectGrid->getCoords(x, tmpIndex2, z, xm);
-      }
-      break;
-    }
-    case ZDirection: {
-      if(differenceType == LeftSide)
-      {
-        index1 = ((z + 1) * dims[1] * dims[0]) + (y * dims[0]) + x;
-        index2 = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
-        tmpIndex1 = z + 1;
-        m_RectGrid->getCoords(x, y, tmpIndex1, xp);
-        m_RectGrid->getCoords(x, y, z, xm);
-      }
-      else if(differenceType == RightSide)
-      {
-        index1 = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
-        index2 = ((z - 1) * dims[1] * dims[0]) + (y * dims[0]) + x;
-        tmpIndex1 = z - 1;
-        m_RectGrid->getCoords(x, y, z, xp);
-        m_RectGrid->getCoords(x, y, tmpIndex1, xm);
-      }
-      else if(differenceType == Centered)
-      {
-        index1 = ((z + 1) * dims[1] * dims[0]) + (y * dims[0]) + x;
-        index2 = ((z - 1) * dims[1] * dims[0]) + (y * dims[0]) + x;
-        tmpIndex1 = z + 1;
-        tmpIndex2 = z - 1;
-        m_RectGrid->getCoords(x, y, tmpIndex1, xp);
-        m_RectGrid->getCoords(x, y, tmpIndex2, xm);
-      }
-      break;
-    }
-    default: {
-      break;
-    }
-    }
-  }
-
-  void findValuesForFiniteDifference(int32_t differenceType, int32_t directionType, size_t x, size_t y, size_t z, size_t dims[3], double xp[3], double xm[3], double& factor, int32_t numComps,
-                                     std::vector<double>& plusValues, std::vector<double>& minusValues, double* field) const
-  {
-    size_t index1 = 0;
-    size_t index2 = 0;
-
-    factor = 1.0;
-
-    if(differenceType == TwoDimensional)
-    {
-      for(size_t i = 0; i < 3; i++)
-      {
-        xp[i] = xm[i] = 0.0;
-      }
-      xp[directionType] = 1.0;
-      for(int32_t i = 0; i < numComps; i++)
-      {
-        plusValues[i] = minusValues[i] = 0.0;
-      }
-    }
-    else
-    {
-      computeIndices(differenceType, directionType, index1, index2, dims, x, y, z, xp, xm);
-      for(int32_t i = 0; i < numComps; i++)
-      {
-        plusValues[i] = field[index1 * numComps + i];
-        minusValues[i] = field[index2 * numComps + i];
-      }
-    }
-
-    if(differenceType == Centered)
-    {
-      factor = 0.5;
-    }
-  }
-
-private:
-  RectGridGeom* m_RectGrid;
-  DoubleArrayType::Pointer m_Field;
-  DoubleArrayType::Pointer m_Derivatives;
-
-  enum FiniteDifferenceType_t
-  {
-    TwoDimensional = 0,
-    LeftSide,
-    RightSide,
-    Centered
-  };
-
-  enum DirectionType_t
-  {
-    XDirection = 0,
-    YDirection,
-    ZDirection
-  };
-};
 
 // -----------------------------------------------------------------------------
 //
@@ -1031,23 +698,17 @@ void RectGridGeom::getShapeFunctions(double pCoords[3], double* shape) const
 void RectGridGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
 {
   m_ProgressCounter = 0;
-  SizeVec3Type dims = getDimensions();
 
   if(observable != nullptr)
   {
     connect(this, SIGNAL(messageGenerated(const AbstractMessage::Pointer&)), observable, SLOT(processDerivativesMessage(const AbstractMessage::Pointer&)));
   }
 
-  size_t grain = dims[2] == 1 ? 1 : dims[2] / std::thread::hardware_concurrency();
-  if(grain == 0)
-  {
-    grain = 1;
-  }
-
-  ParallelData3DAlgorithm dataAlg;
-  dataAlg.setRange(dims[2], dims[1], dims[0]);
-  dataAlg.setGrain(grain);
-  dataAlg.execute(FindRectGridDerivativesImpl(this, field, derivatives));
+  // The cells are axis aligned, so the derivatives reduce to per axis finite differences
+  int64_t totalElements = static_cast<int64_t>(getNumberOfElements());
+  StructuredGridDerivatives derivativeEngine(*this);
+  derivativeEngine.findGradient(field->getPointer(0), field->getNumberOfComponents(), derivatives->getPointer(0),
+                                [this, totalElements](size_t numCells) { sendThreadSafeProgressMessage(static_cast<int64_t>(numCells), totalElements); });
 }
 
 // -----------------------------------------------------------------------------
@@ -308,8 +308,6 @@ private:
   FloatArrayType::Pointer m_VoxelSizes;
   SizeVec3Type m_Dimensions;
 
-  friend class FindRectGridDerivativesImpl;
-
 public:
   RectGridGeom(const RectGridGeom&) = delete;            // Copy Constructor Not Implemented
   RectGridGeom(RectGridGeom&&) = delete;                 // Move Constructor Not Implemented
@@ -44,57 +44,12 @@ float ShapeClass3Omega3[41][2] = {{0.787873524f, 0.0f},  {0.78793553f, 0.05f},
                                   {0.957466141f, 1.4f},  {0.950703099f, 1.45f}, {0.940991385f, 1.5f},  {0.92849772f, 1.55f},  {0.913552923f, 1.6f},  {0.89667764f, 1.65f},  {0.878608694f, 1.7f},
                                   {0.860322715f, 1.75f}, {0.843047317f, 1.8f},  {0.828232275f, 1.85f}, {0.81740437f, 1.9f},   {0.811701359f, 1.95f}, {0.810569469f, 2.0f}};
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-CubeOctohedronOps::CubeOctohedronOps()
-: Gvalue(0.0f)
-{
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-CubeOctohedronOps::~CubeOctohedronOps() = default;
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-float CubeOctohedronOps::radcur1(QMap<ArgName, float> args)
+namespace
 {
-  float radcur1 = 0.0f;
-  float Gvaluedist = 0.0f;
-  float bestGvaluedist = 1000000.0f;
-
-  float omega3 = args[Omega3];
-  float volcur = args[VolCur];
-
-  for(int i = 0; i < 41; i++)
-  {
-    Gvaluedist = fabsf(omega3 - ShapeClass3Omega3[i][0]);
-    if(Gvaluedist < bestGvaluedist)
-    {
-      bestGvaluedist = Gvaluedist;
-      Gvalue = ShapeClass3Omega3[i][1];
-    }
-  }
-  if(Gvalue >= 0 && Gvalue <= 1)
-  {
-    radcur1 = static_cast<float>((volcur * 6.0) / (6 - (Gvalue * Gvalue * Gvalue)));
-  }
-  if(Gvalue > 1 && Gvalue <= 2)
-  {
-    radcur1 = static_cast<float>((volcur * 6.0) / (3 + (9 * Gvalue) - (9 * Gvalue * Gvalue) + (2 * Gvalue * Gvalue * Gvalue)));
-  }
-  radcur1 = powf(radcur1, 0.333333333333f);
-  radcur1 = radcur1 * 0.5f;
-  return radcur1;
-}
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-float CubeOctohedronOps::inside(float axis1comp, float axis2comp, float axis3comp)
+inline float CubeOctohedronInside(float axis1comp, float axis2comp, float axis3comp, float Gvalue)
 {
   float inside = 0;
   inside = 1 - fabs(axis1comp);
@@ -169,6 +124,74 @@ float CubeOctohedronOps::inside(float axis1comp, float axis2comp, float axis3com
   }
   return inside;
 }
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CubeOctohedronOps::CubeOctohedronOps()
+: Gvalue(0.0f)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CubeOctohedronOps::~CubeOctohedronOps() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float CubeOctohedronOps::radcur1(const ShapeArgs& args)
+{
+  float radcur1 = 0.0f;
+  float Gvaluedist = 0.0f;
+  float bestGvaluedist = 1000000.0f;
+
+  float omega3 = args.omega3;
+  float volcur = args.volCur;
+
+  for(int i = 0; i < 41; i++)
+  {
+    Gvaluedist = fabsf(omega3 - ShapeClass3Omega3[i][0]);
+    if(Gvaluedist < bestGvaluedist)
+    {
+      bestGvaluedist = Gvaluedist;
+      Gvalue = ShapeClass3Omega3[i][1];
+    }
+  }
+  if(Gvalue >= 0 && Gvalue <= 1)
+  {
+    radcur1 = static_cast<float>((volcur * 6.0) / (6 - (Gvalue * Gvalue * Gvalue)));
+  }
+  if(Gvalue > 1 && Gvalue <= 2)
+  {
+    radcur1 = static_cast<float>((volcur * 6.0) / (3 + (9 * Gvalue) - (9 * Gvalue * Gvalue) + (2 * Gvalue * Gvalue * Gvalue)));
+  }
+  radcur1 = powf(radcur1, 0.333333333333f);
+  radcur1 = radcur1 * 0.5f;
+  return radcur1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float CubeOctohedronOps::inside(float axis1comp, float axis2comp, float axis3comp)
+{
+  return CubeOctohedronInside(axis1comp, axis2comp, axis3comp, Gvalue);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CubeOctohedronOps::inside(const float* axis1comps, const float* axis2comps, const float* axis3comps, size_t count, float* values)
+{
+  const float gvalue = Gvalue;
+  for(size_t i = 0; i < count; i++)
+  {
+    values[i] = CubeOctohedronInside(axis1comps[i], axis2comps[i], axis3comps[i], gvalue);
+  }
+}
 
 // -----------------------------------------------------------------------------
 CubeOctohedronOps::Pointer CubeOctohedronOps::NullPointer()
@@ -33,10 +33,24 @@
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <cmath>
+
 #include "CylinderAOps.h"
 
 #include "SIMPLib/Math/SIMPLibMath.h"
 
+namespace
+{
+// -----------------------------------------------------------------------------
+// Written as a select rather than a branch so the batch loop vectorizes
+// -----------------------------------------------------------------------------
+inline float CylinderAInside(float axis1comp, float axis2comp, float axis3comp)
+{
+  float inside = 1.0f - axis2comp * axis2comp - axis3comp * axis3comp;
+  return std::fabs(axis1comp) <= 1.0f ? inside : -1.0f;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -50,13 +64,13 @@ CylinderAOps::~CylinderAOps() = default;
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-float CylinderAOps::radcur1(QMap<ArgName, float> args)
+float CylinderAOps::radcur1(const ShapeArgs& args)
 {
   float radcur1 = 0.0f;
 
-  float volcur = args[VolCur];
-  float bovera = args[B_OverA];
-  float covera = args[C_OverA];
+  float volcur = args.volCur;
+  float bovera = args.bOverA;
+  float covera = args.cOverA;
 
   // the equation for volume for an A cylinder is pi*b*c*h where b and c are semi axis lengths, but
   // h is a full axis length - meaning h = 2a. However, since our aspect ratios relate semi axis lengths, the 2.0
@@ -71,17 +85,18 @@ float CylinderAOps::radcur1(QMap<ArgName, float> args)
 // -----------------------------------------------------------------------------
 float CylinderAOps::inside(float axis1comp, float axis2comp, float axis3comp)
 {
-  float inside = -1.0;
-  if(fabs(axis1comp) <= 1.0)
+  return CylinderAInside(axis1comp, axis2comp, axis3comp);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CylinderAOps::inside(const float* axis1comps, const float* axis2comps, const float* axis3comps, size_t count, float* values)
+{
+  for(size_t i = 0; i < count; i++)
   {
-    // inside = 1.0;
-    axis2comp = fabs(axis2comp);
-    axis3comp = fabs(axis3comp);
-    axis2comp = axis2comp * axis2comp;
-    axis3comp = axis3comp * axis3comp;
-    inside = static_cast<float>(1.0 - axis2comp - axis3comp);
+    values[i] = CylinderAInside(axis1comps[i], axis2comps[i], axis3comps[i]);
   }
-  return inside;
 }
 
 // -----------------------------------------------------------------------------
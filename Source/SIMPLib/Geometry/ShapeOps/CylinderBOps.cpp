@@ -33,10 +33,24 @@
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <cmath>
+
 #include "CylinderBOps.h"
 
 #include "SIMPLib/Math/SIMPLibMath.h"
 
+namespace
+{
+// -----------------------------------------------------------------------------
+// Written as a select rather than a branch so the batch loop vectorizes
+// -----------------------------------------------------------------------------
+inline float CylinderBInside(float axis1comp, float axis2comp, float axis3comp)
+{
+  float inside = 1.0f - axis1comp * axis1comp - axis3comp * axis3comp;
+  return std::fabs(axis2comp) <= 1.0f ? inside : -1.0f;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -50,13 +64,13 @@ CylinderBOps::~CylinderBOps() = default;
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-float CylinderBOps::radcur1(QMap<ArgName, float> args)
+float CylinderBOps::radcur1(const ShapeArgs& args)
 {
   float radcur1 = 0.0f;
 
-  float volcur = args[VolCur];
-  float bovera = args[B_OverA];
-  float covera = args[C_OverA];
+  float volcur = args.volCur;
+  float bovera = args.bOverA;
+  float covera = args.cOverA;
 
   // the equation for volume for a B cylinder is pi*a*c*h where a and c are semi axis lengths, but
   // h is a full axis length - meaning h = 2b.  However, since our aspect ratios relate semi axis lengths, the 2.0
@@ -71,17 +85,18 @@ float CylinderBOps::radcur1(QMap<ArgName, float> args)
 // -----------------------------------------------------------------------------
 float CylinderBOps::inside(float axis1comp, float axis2comp, float axis3comp)
 {
-  float inside = -1.0;
-  if(fabs(axis2comp) <= 1.0)
+  return CylinderBInside(axis1comp, axis2comp, axis3comp);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CylinderBOps::inside(const float* axis1comps, const float* axis2comps, const float* axis3comps, size_t count, float* values)
+{
+  for(size_t i = 0; i < count; i++)
   {
-    // inside = 1.0;
-    axis1comp = fabs(axis1comp);
-    axis3comp = fabs(axis3comp);
-    axis1comp = axis1comp * axis1comp;
-    axis3comp = axis3comp * axis3comp;
-    inside = static_cast<float>(1.0 - axis1comp - axis3comp);
+    values[i] = CylinderBInside(axis1comps[i], axis2comps[i], axis3comps[i]);
   }
-  return inside;
 }
 
 // -----------------------------------------------------------------------------
@@ -33,10 +33,24 @@
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <cmath>
+
 #include "CylinderCOps.h"
 
 #include "SIMPLib/Math/SIMPLibMath.h"
 
+namespace
+{
+// -----------------------------------------------------------------------------
+// Written as a select rather than a branch so the batch loop vectorizes
+// -----------------------------------------------------------------------------
+inline float CylinderCInside(float axis1comp, float axis2comp, float axis3comp)
+{
+  float inside = 1.0f - axis1comp * axis1comp - axis2comp * axis2comp;
+  return std::fabs(axis3comp) <= 1.0f ? inside : -1.0f;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -50,13 +64,13 @@ CylinderCOps::~CylinderCOps() = default;
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-float CylinderCOps::radcur1(QMap<ArgName, float> args)
+float CylinderCOps::radcur1(const ShapeArgs& args)
 {
   float radcur1 = 0.0f;
 
-  float volcur = args[VolCur];
-  float bovera = args[B_OverA];
-  float covera = args[C_OverA];
+  float volcur = args.volCur;
+  float bovera = args.bOverA;
+  float covera = args.cOverA;
 
   // the equation for volume for a C cylinder is pi*a*b*h where a and b are semi axis lengths, but
   // h is a full axis length - meaning h = 2c.  However, since our aspect ratios relate semi axis lengths, the 2.0
@@ -71,17 +85,18 @@ float CylinderCOps::radcur1(QMap<ArgName, float> args)
 // -----------------------------------------------------------------------------
 float CylinderCOps::inside(float axis1comp, float axis2comp, float axis3comp)
 {
-  float inside = -1.0;
-  if(fabs(axis3comp) <= 1.0)
+  return CylinderCInside(axis1comp, axis2comp, axis3comp);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CylinderCOps::inside(const float* axis1comps, const float* axis2comps, const float* axis3comps, size_t count, float* values)
+{
+  for(size_t i = 0; i < count; i++)
   {
-    // inside = 1.0;
-    axis1comp = fabs(axis1comp);
-    axis2comp = fabs(axis2comp);
-    axis1comp = axis1comp * axis1comp;
-    axis2comp = axis2comp * axis2comp;
-    inside = static_cast<float>(1.0 - axis1comp - axis2comp);
+    values[i] = CylinderCInside(axis1comps[i], axis2comps[i], axis3comps[i]);
   }
-  return inside;
 }
 
 // -----------------------------------------------------------------------------
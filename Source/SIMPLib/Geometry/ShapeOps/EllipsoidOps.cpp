@@ -37,6 +37,17 @@
 
 #include "SIMPLib/Math/SIMPLibMath.h"
 
+namespace
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+inline float EllipsoidInside(float axis1comp, float axis2comp, float axis3comp)
+{
+  return 1.0f - axis1comp * axis1comp - axis2comp * axis2comp - axis3comp * axis3comp;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -50,13 +61,13 @@ EllipsoidOps::~EllipsoidOps() = default;
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-float EllipsoidOps::radcur1(QMap<ArgName, float> args)
+float EllipsoidOps::radcur1(const ShapeArgs& args)
 {
   float radcur1 = 0.0f;
 
-  float volcur = args[VolCur];
-  float bovera = args[B_OverA];
-  float covera = args[C_OverA];
+  float volcur = args.volCur;
+  float bovera = args.bOverA;
+  float covera = args.cOverA;
 
   radcur1 = (volcur * 0.75f * (SIMPLib::Constants::k_1OverPiD) * (1.0f / bovera) * (1.0f / covera));
   radcur1 = powf(radcur1, 0.333333333333f);
@@ -68,15 +79,18 @@ float EllipsoidOps::radcur1(QMap<ArgName, float> args)
 // -----------------------------------------------------------------------------
 float EllipsoidOps::inside(float axis1comp, float axis2comp, float axis3comp)
 {
-  float inside = 1;
-  axis1comp = fabs(axis1comp);
-  axis2comp = fabs(axis2comp);
-  axis3comp = fabs(axis3comp);
-  axis1comp = axis1comp * axis1comp;
-  axis2comp = axis2comp * axis2comp;
-  axis3comp = axis3comp * axis3comp;
-  inside = 1.0f - axis1comp - axis2comp - axis3comp;
-  return inside;
+  return EllipsoidInside(axis1comp, axis2comp, axis3comp);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void EllipsoidOps::inside(const float* axis1comps, const float* axis2comps, const float* axis3comps, size_t count, float* values)
+{
+  for(size_t i = 0; i < count; i++)
+  {
+    values[i] = EllipsoidInside(axis1comps[i], axis2comps[i], axis3comps[i]);
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -90,11 +90,24 @@ std::vector<ShapeOps::Pointer> ShapeOps::getShapeOpsVector()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-float ShapeOps::radcur1(QMap<ArgName, float> args)
+float ShapeOps::radcur1(const ShapeArgs& args)
 {
   return cube_root_of_one;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float ShapeOps::radcur1(const QMap<ArgName, float>& args)
+{
+  ShapeArgs shapeArgs;
+  shapeArgs.omega3 = args.value(Omega3, 0.0f);
+  shapeArgs.bOverA = args.value(B_OverA, 0.0f);
+  shapeArgs.cOverA = args.value(C_OverA, 0.0f);
+  shapeArgs.volCur = args.value(VolCur, 0.0f);
+  return radcur1(shapeArgs);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -103,6 +116,17 @@ float ShapeOps::inside(float axis1comp, float axis2comp, float axis3comp)
   return -1.0;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ShapeOps::inside(const float* axis1comps, const float* axis2comps, const float* axis3comps, size_t count, float* values)
+{
+  for(size_t i = 0; i < count; i++)
+  {
+    values[i] = inside(axis1comps[i], axis2comps[i], axis3comps[i]);
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -77,6 +77,18 @@ public:
     VolCur = 3
   };
 
+  /**
+   * @brief The ShapeArgs struct holds the per feature shape parameters consumed by radcur1. It replaces
+   * the ArgName keyed map so callers do not build and copy a map for every feature.
+   */
+  struct ShapeArgs
+  {
+    float omega3 = 0.0f;
+    float bOverA = 0.0f;
+    float cOverA = 0.0f;
+    float volCur = 0.0f;
+  };
+
   float ShapeClass2Omega[41][2];
 
   /**
@@ -93,10 +105,35 @@ public:
    */
   static std::vector<ShapeOps::Pointer> getShapeOpsVector();
 
-  virtual float radcur1(QMap<ArgName, float> args);
+  /**
+   * @brief radcur1 Computes the primary semi axis length for a feature and prepares any per feature
+   * state (such as the shape exponent) used by the following calls to inside().
+   * @param args Shape parameters of the feature
+   * @return Semi axis length
+   */
+  virtual float radcur1(const ShapeArgs& args);
+
+  /**
+   * @brief radcur1 Convenience overload that unpacks the map and forwards to radcur1(const ShapeArgs&)
+   * @param args Shape parameters of the feature keyed by ArgName
+   * @return Semi axis length
+   */
+  float radcur1(const QMap<ArgName, float>& args);
 
   virtual float inside(float axis1comp, float axis2comp, float axis3comp);
 
+  /**
+   * @brief inside Evaluates the inside function over a span of points given in the shape's normalized
+   * axis frame. Subclasses override this with a tight, non virtual loop so the shape dispatch happens
+   * once per span instead of once per voxel. Call radcur1() for the feature first.
+   * @param axis1comps First axis component of each point
+   * @param axis2comps Second axis component of each point
+   * @param axis3comps Third axis component of each point
+   * @param count Number of points
+   * @param values Output values; positive inside the shape, negative outside
+   */
+  virtual void inside(const float* axis1comps, const float* axis2comps, const float* axis3comps, size_t count, float* values);
+
   virtual void init();
 
 protected:
@@ -33,6 +33,8 @@
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <cmath>
+
 #include "SuperEllipsoidOps.h"
 
 #include "SIMPLib/Math/SIMPLibMath.h"
@@ -42,12 +44,54 @@ float ShapeClass2Omega3[41][2] = {{0.0f, 0.0f},  {0.0f, 0.25f}, {0.0f, 0.5f},  {
                                   {0.0f, 5.5f},  {0.0f, 5.75f}, {0.0f, 6.0f},  {0.0f, 6.25f}, {0.0f, 6.5f},  {0.0f, 6.75f}, {0.0f, 7.0f},  {0.0f, 7.25f}, {0.0f, 7.5f},  {0.0f, 7.75f}, {0.0f, 8.0f},
                                   {0.0f, 8.25f}, {0.0f, 8.5f},  {0.0f, 8.75f}, {0.0f, 9.0f},  {0.0f, 9.25f}, {0.0f, 9.5f},  {0.0f, 9.75f}, {0.0f, 10.0f}};
 
+namespace
+{
+// -----------------------------------------------------------------------------
+// Fills in the omega3 column of ShapeClass2Omega3. The values only depend on the
+// exponent column so they are computed once instead of on every radcur1 call.
+// -----------------------------------------------------------------------------
+bool InitializeShapeClass2Omega3()
+{
+  for(int i = 0; i < 41; i++)
+  {
+    float a = SIMPLibMath::Gamma(1.0f + 1.0f / ShapeClass2Omega3[i][1]);
+    float b = SIMPLibMath::Gamma(5.0f / ShapeClass2Omega3[i][1]);
+    float c = SIMPLibMath::Gamma(3.0f / ShapeClass2Omega3[i][1]);
+    float d = SIMPLibMath::Gamma(1.0f + 3.0f / ShapeClass2Omega3[i][1]);
+    ShapeClass2Omega3[i][0] = static_cast<float>(powf(20.0f * ((a * a * a) * b) / (c * powf(d, 5.0f / 3.0f)), 3.0f) / (2000.0f * M_PI * M_PI / 9.0f));
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+// x^(whole + quarters / 4) for whole < 16 using only multiplies, square roots and
+// selects so a loop over it vectorizes. Every exponent in ShapeClass2Omega3 is a
+// multiple of 0.25 so this covers all the shapes radcur1 can select.
+// -----------------------------------------------------------------------------
+inline float QuarterPower(float x, int whole, int quarters)
+{
+  float result = 1.0f;
+  float base = x;
+  for(int bit = 0; bit < 4; bit++)
+  {
+    result *= ((whole >> bit) & 1) != 0 ? base : 1.0f;
+    base *= base;
+  }
+  float root2 = std::sqrt(x);
+  float root4 = std::sqrt(root2);
+  result *= (quarters & 2) != 0 ? root2 : 1.0f;
+  result *= (quarters & 1) != 0 ? root4 : 1.0f;
+  return result;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 SuperEllipsoidOps::SuperEllipsoidOps()
 : Nvalue(0.0f)
 {
+  updatePowerTerms();
 }
 
 // -----------------------------------------------------------------------------
@@ -61,29 +105,48 @@ SuperEllipsoidOps::~SuperEllipsoidOps() = default;
 void SuperEllipsoidOps::init()
 {
   Nvalue = 0.0f;
+  updatePowerTerms();
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-float SuperEllipsoidOps::radcur1(QMap<ArgName, float> args)
+float SuperEllipsoidOps::getNvalue() const
+{
+  return Nvalue;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SuperEllipsoidOps::updatePowerTerms()
+{
+  float quarters = Nvalue * 4.0f;
+  float rounded = std::round(quarters);
+  NvalueIsQuarter = (rounded == quarters && rounded >= 0.0f && rounded < 64.0f);
+  NvalueWhole = NvalueIsQuarter ? static_cast<int>(rounded) / 4 : 0;
+  NvalueQuarters = NvalueIsQuarter ? static_cast<int>(rounded) % 4 : 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float SuperEllipsoidOps::radcur1(const ShapeArgs& args)
 {
   float radcur1 = 0.0f;
   float Nvaluedist = 0.0f;
   float bestNvaluedist = 1000000.0f;
 
-  float omega3 = args[Omega3];
-  float volcur = args[VolCur];
-  float bovera = args[B_OverA];
-  float covera = args[C_OverA];
+  float omega3 = args.omega3;
+  float volcur = args.volCur;
+  float bovera = args.bOverA;
+  float covera = args.cOverA;
+
+  static const bool tableInitialized = InitializeShapeClass2Omega3();
+  (void)tableInitialized;
 
   for(int i = 0; i < 41; i++)
   {
-    float a = SIMPLibMath::Gamma(1.0f + 1.0f / ShapeClass2Omega3[i][1]);
-    float b = SIMPLibMath::Gamma(5.0f / ShapeClass2Omega3[i][1]);
-    float c = SIMPLibMath::Gamma(3.0f / ShapeClass2Omega3[i][1]);
-    float d = SIMPLibMath::Gamma(1.0f + 3.0f / ShapeClass2Omega3[i][1]);
-    ShapeClass2Omega3[i][0] = static_cast<float>(powf(20.0f * ((a * a * a) * b) / (c * powf(d, 5.0f / 3.0f)), 3.0f) / (2000.0f * M_PI * M_PI / 9.0f));
     Nvaluedist = fabsf(omega3 - ShapeClass2Omega3[i][0]);
     if(Nvaluedist < bestNvaluedist)
     {
@@ -91,6 +154,8 @@ float SuperEllipsoidOps::radcur1(QMap<ArgName, float> args)
       Nvalue = ShapeClass2Omega3[i][1];
     }
   }
+  updatePowerTerms();
+
   float beta1 = (SIMPLibMath::Gamma((1.0f / Nvalue)) * SIMPLibMath::Gamma((1.0f / Nvalue))) / SIMPLibMath::Gamma((2.0f / Nvalue));
   float beta2 = (SIMPLibMath::Gamma((2.0f / Nvalue)) * SIMPLibMath::Gamma((1.0f / Nvalue))) / SIMPLibMath::Gamma((3.0f / Nvalue));
   radcur1 = (volcur * (3.0f / 2.0f) * (1.0f / bovera) * (1.0f / covera) * ((Nvalue * Nvalue) / 4.0f) * (1.0f / beta1) * (1.0f / beta2));
@@ -103,15 +168,35 @@ float SuperEllipsoidOps::radcur1(QMap<ArgName, float> args)
 // -----------------------------------------------------------------------------
 float SuperEllipsoidOps::inside(float axis1comp, float axis2comp, float axis3comp)
 {
-  float inside = 1.0f;
-  axis1comp = fabs(axis1comp);
-  axis2comp = fabs(axis2comp);
-  axis3comp = fabs(axis3comp);
-  axis1comp = powf(axis1comp, Nvalue);
-  axis2comp = powf(axis2comp, Nvalue);
-  axis3comp = powf(axis3comp, Nvalue);
-  inside = 1.0f - axis1comp - axis2comp - axis3comp;
-  return inside;
+  axis1comp = std::fabs(axis1comp);
+  axis2comp = std::fabs(axis2comp);
+  axis3comp = std::fabs(axis3comp);
+  if(NvalueIsQuarter)
+  {
+    return 1.0f - QuarterPower(axis1comp, NvalueWhole, NvalueQuarters) - QuarterPower(axis2comp, NvalueWhole, NvalueQuarters) - QuarterPower(axis3comp, NvalueWhole, NvalueQuarters);
+  }
+  return 1.0f - powf(axis1comp, Nvalue) - powf(axis2comp, Nvalue) - powf(axis3comp, Nvalue);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SuperEllipsoidOps::inside(const float* axis1comps, const float* axis2comps, const float* axis3comps, size_t count, float* values)
+{
+  if(!NvalueIsQuarter)
+  {
+    ShapeOps::inside(axis1comps, axis2comps, axis3comps, count, values);
+    return;
+  }
+  const int whole = NvalueWhole;
+  const int quarters = NvalueQuarters;
+  for(size_t i = 0; i < count; i++)
+  {
+    float axis1comp = QuarterPower(std::fabs(axis1comps[i]), whole, quarters);
+    float axis2comp = QuarterPower(std::fabs(axis2comps[i]), whole, quarters);
+    float axis3comp = QuarterPower(std::fabs(axis3comps[i]), whole, quarters);
+    values[i] = 1.0f - axis1comp - axis2comp - axis3comp;
+  }
 }
 
 // -----------------------------------------------------------------------------
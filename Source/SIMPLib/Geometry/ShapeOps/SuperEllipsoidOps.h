@@ -65,16 +65,33 @@ public:
 
   ~SuperEllipsoidOps() override;
 
-  float radcur1(QMap<ArgName, float> args) override;
+  using ShapeOps::radcur1;
+
+  float radcur1(const ShapeArgs& args) override;
 
   float inside(float axis1comp, float axis2comp, float axis3comp) override;
+  void inside(const float* axis1comps, const float* axis2comps, const float* axis3comps, size_t count, float* values) override;
   void init() override;
 
+  /**
+   * @brief Returns the exponent selected by the last radcur1() call
+   * @return
+   */
+  float getNvalue() const;
+
 protected:
   SuperEllipsoidOps();
 
 private:
   float Nvalue;
+  int NvalueWhole = 0;
+  int NvalueQuarters = 0;
+  bool NvalueIsQuarter = false;
+
+  /**
+   * @brief updatePowerTerms Splits Nvalue into whole and quarter parts so inside() can avoid powf
+   */
+  void updatePowerTerms();
 
 public:
   SuperEllipsoidOps(const SuperEllipsoidOps&) = delete;            // Copy Constructor Not Implemented
@@ -33,6 +33,11 @@
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+// Geometries that cache data derived from the triangle list define this to drop it
+#ifndef GEOM_TRIANGLES_CHANGED
+#define GEOM_TRIANGLES_CHANGED()
+#endif
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -49,6 +54,7 @@ SharedTriList::Pointer GEOM_CLASS_NAME::CreateSharedTriList(size_t numTris, bool
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::resizeTriList(size_t newNumTris)
 {
+  GEOM_TRIANGLES_CHANGED();
   m_TriList->resizeTuples(newNumTris);
 }
 
@@ -64,6 +70,7 @@ void GEOM_CLASS_NAME::setTriangles(SharedTriList::Pointer triangles)
       triangles->setName(SIMPL::Geometry::SharedTriList);
     }
   }
+  GEOM_TRIANGLES_CHANGED();
   m_TriList = triangles;
 }
 
@@ -80,6 +87,7 @@ SharedTriList::Pointer GEOM_CLASS_NAME::getTriangles() const
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::setVertsAtTri(size_t triId, size_t verts[3])
 {
+  GEOM_TRIANGLES_CHANGED();
   size_t* Tri = m_TriList->getTuplePointer(triId);
   Tri[0] = verts[0];
   Tri[1] = verts[1];
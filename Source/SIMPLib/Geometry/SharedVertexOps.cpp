@@ -33,6 +33,11 @@
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+// Geometries that cache data derived from the vertex coordinates define this to drop it
+#ifndef GEOM_VERTICES_CHANGED
+#define GEOM_VERTICES_CHANGED()
+#endif
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -49,6 +54,7 @@ SharedVertexList::Pointer GEOM_CLASS_NAME::CreateSharedVertexList(size_t numVert
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::resizeVertexList(size_t newNumVertices)
 {
+  GEOM_VERTICES_CHANGED();
   m_VertexList->resizeTuples(newNumVertices);
 }
 
@@ -64,6 +70,7 @@ void GEOM_CLASS_NAME::setVertices(SharedVertexList::Pointer vertices)
       vertices->setName(SIMPL::Geometry::SharedVertexList);
     }
   }
+  GEOM_VERTICES_CHANGED();
   m_VertexList = vertices;
 }
 
@@ -80,6 +87,7 @@ SharedVertexList::Pointer GEOM_CLASS_NAME::getVertices() const
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::setCoords(size_t vertId, float coords[3])
 {
+  GEOM_VERTICES_CHANGED();
   float* Vert = m_VertexList->getTuplePointer(vertId);
   Vert[0] = coords[0];
   Vert[1] = coords[1];
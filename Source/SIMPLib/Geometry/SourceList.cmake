@@ -16,6 +16,7 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/Geometry/MeshStructs.h
   ${SIMPLib_SOURCE_DIR}/Geometry/QuadGeom.h
   ${SIMPLib_SOURCE_DIR}/Geometry/RectGridGeom.h
+  ${SIMPLib_SOURCE_DIR}/Geometry/StructuredGridDerivatives.h
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/CubeOctohedronOps.h
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/CylinderAOps.h
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/CylinderBOps.h
@@ -24,9 +25,12 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/ShapeOps.h
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/SuperEllipsoidOps.h
   ${SIMPLib_SOURCE_DIR}/Geometry/TetrahedralGeom.h
+  ${SIMPLib_SOURCE_DIR}/Geometry/TriangleBVH.h
   ${SIMPLib_SOURCE_DIR}/Geometry/TransformContainer.h
   ${SIMPLib_SOURCE_DIR}/Geometry/TriangleGeom.h
   ${SIMPLib_SOURCE_DIR}/Geometry/VertexGeom.h
+  ${SIMPLib_SOURCE_DIR}/Geometry/VertexKdTree.h
+  ${SIMPLib_SOURCE_DIR}/Geometry/VertexUniformGrid.h
 )
 
 set(SIMPLib_${SUBDIR_NAME}_SRCS
@@ -42,6 +46,7 @@ set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/Geometry/ITransformContainer.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/QuadGeom.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/RectGridGeom.cpp
+  ${SIMPLib_SOURCE_DIR}/Geometry/StructuredGridDerivatives.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/CubeOctohedronOps.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/CylinderAOps.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/CylinderBOps.cpp
@@ -50,9 +55,12 @@ set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/ShapeOps.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/SuperEllipsoidOps.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/TetrahedralGeom.cpp
+  ${SIMPLib_SOURCE_DIR}/Geometry/TriangleBVH.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/TransformContainer.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/TriangleGeom.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/VertexGeom.cpp
+  ${SIMPLib_SOURCE_DIR}/Geometry/VertexKdTree.cpp
+  ${SIMPLib_SOURCE_DIR}/Geometry/VertexUniformGrid.cpp
 )
 
 if(SIMPL_USE_EIGEN)
@@ -0,0 +1,313 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "StructuredGridDerivatives.h"
+
+#include <algorithm>
+
+#include "SIMPLib/Geometry/IGeometryGrid.h"
+#include "SIMPLib/Utilities/ParallelData3DAlgorithm.h"
+
+namespace
+{
+// Per core working set the row tiles are sized for
+constexpr size_t k_L2CacheBytes = 256 * 1024;
+// Minimum number of cells handed to one task, smaller tasks are dominated by the scheduling overhead
+constexpr size_t k_MinCellsPerTask = 32 * 1024;
+} // namespace
+
+/**
+ * @brief The StructuredGridDerivativesImpl class implements a threaded algorithm that evaluates a
+ * finite difference operation over slabs of a structured grid
+ */
+class StructuredGridDerivativesImpl
+{
+public:
+  StructuredGridDerivativesImpl(const StructuredGridDerivatives* engine, StructuredGridDerivatives::Operation operation, const double* field, int32_t numComps, double* output, bool splitRows,
+                                const StructuredGridDerivatives::ProgressCallback& progress)
+  : m_Engine(engine)
+  , m_Operation(operation)
+  , m_Field(field)
+  , m_NumComps(numComps)
+  , m_Output(output)
+  , m_SplitRows(splitRows)
+  , m_Progress(progress)
+  {
+  }
+  virtual ~StructuredGridDerivativesImpl() = default;
+
+  void operator()(const SIMPLRange3D& r) const
+  {
+    std::array<size_t, 3> dims = m_Engine->getDimensions();
+    size_t numCells = 0;
+    if(m_SplitRows)
+    {
+      m_Engine->computeSlab(m_Operation, m_Field, m_NumComps, m_Output, 0, 1, r[0], r[1]);
+      numCells = (r[1] - r[0]) * dims[0];
+    }
+    else
+    {
+      m_Engine->computeSlab(m_Operation, m_Field, m_NumComps, m_Output, r[0], r[1], 0, dims[1]);
+      numCells = (r[1] - r[0]) * dims[1] * dims[0];
+    }
+    if(m_Progress)
+    {
+      m_Progress(numCells);
+    }
+  }
+
+private:
+  const StructuredGridDerivatives* m_Engine;
+  StructuredGridDerivatives::Operation m_Operation;
+  const double* m_Field;
+  int32_t m_NumComps;
+  double* m_Output;
+  bool m_SplitRows;
+  StructuredGridDerivatives::ProgressCallback m_Progress;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+StructuredGridDerivatives::StructuredGridDerivatives(const IGeometryGrid& geometry)
+{
+  SizeVec3Type dims = geometry.getDimensions();
+  double coords[3] = {0.0, 0.0, 0.0};
+  for(size_t axis = 0; axis < 3; axis++)
+  {
+    const size_t numCells = dims[axis];
+    m_Dims[axis] = numCells;
+
+    std::vector<double> centers(numCells);
+    for(size_t i = 0; i < numCells; i++)
+    {
+      size_t idx[3] = {0, 0, 0};
+      idx[axis] = i;
+      geometry.getCoords(idx, coords);
+      centers[i] = coords[axis];
+    }
+
+    m_PlusIndex[axis].resize(numCells);
+    m_MinusIndex[axis].resize(numCells);
+    m_InverseDelta[axis].resize(numCells);
+    for(size_t i = 0; i < numCells; i++)
+    {
+      size_t plus = (numCells == 1) ? 0 : std::min(i + 1, numCells - 1);
+      size_t minus = (i == 0) ? 0 : i - 1;
+      double delta = centers[plus] - centers[minus];
+      m_PlusIndex[axis][i] = plus;
+      m_MinusIndex[axis][i] = minus;
+      // Single cell axes and degenerate spacings get a zero derivative
+      m_InverseDelta[axis][i] = (delta != 0.0) ? 1.0 / delta : 0.0;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+StructuredGridDerivatives::~StructuredGridDerivatives() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::array<size_t, 3> StructuredGridDerivatives::getDimensions() const
+{
+  return m_Dims;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t StructuredGridDerivatives::getRowsPerTile(int32_t numComps) const
+{
+  // Three input slices (z - 1, z, z + 1) plus the gradient output, which is three values per input value
+  size_t bytesPerRow = m_Dims[0] * static_cast<size_t>(numComps) * sizeof(double) * 6;
+  if(bytesPerRow == 0)
+  {
+    return 1;
+  }
+  return std::max(static_cast<size_t>(1), std::min(k_L2CacheBytes / bytesPerRow, m_Dims[1]));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void StructuredGridDerivatives::findGradient(const double* field, int32_t numComps, double* gradient, const ProgressCallback& progress) const
+{
+  execute(Operation::Gradient, field, numComps, gradient, progress);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void StructuredGridDerivatives::findDivergence(const double* field, double* divergence, const ProgressCallback& progress) const
+{
+  execute(Operation::Divergence, field, 3, divergence, progress);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void StructuredGridDerivatives::findCurl(const double* field, double* curl, const ProgressCallback& progress) const
+{
+  execute(Operation::Curl, field, 3, curl, progress);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void StructuredGridDerivatives::execute(Operation operation, const double* field, int32_t numComps, double* output, const ProgressCallback& progress) const
+{
+  if(m_Dims[0] == 0 || m_Dims[1] == 0 || m_Dims[2] == 0 || numComps <= 0)
+  {
+    return;
+  }
+
+  // Slabs are split along z; a single slice is split along y instead so 2D images are threaded as well
+  const bool splitRows = (m_Dims[2] == 1);
+  const size_t numSlabs = splitRows ? m_Dims[1] : m_Dims[2];
+  const size_t cellsPerSlab = splitRows ? m_Dims[0] : m_Dims[0] * m_Dims[1];
+  const size_t grain = std::max(static_cast<size_t>(1), (k_MinCellsPerTask + cellsPerSlab - 1) / cellsPerSlab);
+
+  ParallelData3DAlgorithm dataAlg;
+  dataAlg.setRange(numSlabs, splitRows ? 1 : m_Dims[1], m_Dims[0]);
+  dataAlg.setGrain(grain);
+  dataAlg.execute(StructuredGridDerivativesImpl(this, operation, field, numComps, output, splitRows, progress));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void StructuredGridDerivatives::computeSlab(Operation operation, const double* field, int32_t numComps, double* output, size_t zStart, size_t zEnd, size_t yStart, size_t yEnd) const
+{
+  const size_t dimX = m_Dims[0];
+  const size_t dimY = m_Dims[1];
+  const size_t rowsPerTile = getRowsPerTile(numComps);
+
+  std::vector<double> scratch;
+  if(operation != Operation::Gradient)
+  {
+    scratch.resize(dimX * static_cast<size_t>(numComps) * 3);
+  }
+
+  for(size_t yTile = yStart; yTile < yEnd; yTile += rowsPerTile)
+  {
+    const size_t yTileEnd = std::min(yTile + rowsPerTile, yEnd);
+    for(size_t z = zStart; z < zEnd; z++)
+    {
+      for(size_t y = yTile; y < yTileEnd; y++)
+      {
+        const size_t rowOffset = (z * dimY + y) * dimX;
+        if(operation == Operation::Gradient)
+        {
+          computeRowGradient(field, numComps, output + rowOffset * static_cast<size_t>(numComps) * 3, y, z);
+          continue;
+        }
+
+        // The 3x3 gradient of the vector field per cell is laid out as d(Fi)/d(xj) at [3 * i + j]
+        computeRowGradient(field, numComps, scratch.data(), y, z);
+        const double* g = scratch.data();
+        if(operation == Operation::Divergence)
+        {
+          double* div = output + rowOffset;
+          for(size_t x = 0; x < dimX; x++)
+          {
+            div[x] = g[9 * x + 0] + g[9 * x + 4] + g[9 * x + 8];
+          }
+        }
+        else
+        {
+          double* curl = output + rowOffset * 3;
+          for(size_t x = 0; x < dimX; x++)
+          {
+            curl[3 * x + 0] = g[9 * x + 7] - g[9 * x + 5];
+            curl[3 * x + 1] = g[9 * x + 2] - g[9 * x + 6];
+            curl[3 * x + 2] = g[9 * x + 3] - g[9 * x + 1];
+          }
+        }
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void StructuredGridDerivatives::computeRowGradient(const double* field, int32_t numComps, double* gradient, size_t y, size_t z) const
+{
+  const size_t dimX = m_Dims[0];
+  const size_t dimY = m_Dims[1];
+  const size_t nc = static_cast<size_t>(numComps);
+  const size_t rowValues = dimX * nc;
+
+  const double* f = field + (z * dimY + y) * rowValues;
+  const double* fYPlus = field + (z * dimY + m_PlusIndex[1][y]) * rowValues;
+  const double* fYMinus = field + (z * dimY + m_MinusIndex[1][y]) * rowValues;
+  const double* fZPlus = field + (m_PlusIndex[2][z] * dimY + y) * rowValues;
+  const double* fZMinus = field + (m_MinusIndex[2][z] * dimY + y) * rowValues;
+  const double invDy = m_InverseDelta[1][y];
+  const double invDz = m_InverseDelta[2][z];
+
+  // Y and Z use the same neighbor rows for the whole row
+  for(size_t j = 0; j < rowValues; j++)
+  {
+    gradient[3 * j + 1] = (fYPlus[j] - fYMinus[j]) * invDy;
+    gradient[3 * j + 2] = (fZPlus[j] - fZMinus[j]) * invDz;
+  }
+
+  // X interior cells use central differences
+  const double* invDx = m_InverseDelta[0].data();
+  for(size_t x = 1; x + 1 < dimX; x++)
+  {
+    const double inv = invDx[x];
+    for(size_t c = 0; c < nc; c++)
+    {
+      gradient[3 * (x * nc + c)] = (f[(x + 1) * nc + c] - f[(x - 1) * nc + c]) * inv;
+    }
+  }
+
+  // X boundary cells
+  const size_t boundary[2] = {0, dimX - 1};
+  for(size_t b = 0; b < ((dimX > 1) ? 2 : 1); b++)
+  {
+    const size_t x = boundary[b];
+    const size_t plus = m_PlusIndex[0][x];
+    const size_t minus = m_MinusIndex[0][x];
+    for(size_t c = 0; c < nc; c++)
+    {
+      gradient[3 * (x * nc + c)] = (f[plus * nc + c] - f[minus * nc + c]) * invDx[x];
+    }
+  }
+}
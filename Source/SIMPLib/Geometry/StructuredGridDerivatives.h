@@ -0,0 +1,166 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <array>
+#include <functional>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+
+class IGeometryGrid;
+
+/**
+ * @brief The StructuredGridDerivatives class computes finite difference derivatives of cell fields on an
+ * ImageGeom or RectGridGeom. The cells of both geometries are axis aligned, so the generic shape function
+ * Jacobian reduces to one inverse difference per axis and cell index. Those are tabulated once; every cell
+ * then costs one subtraction and one multiplication per component and direction.
+ *
+ * Interior cells use central differences and the first and last cell along an axis use one sided differences,
+ * which matches the results of the per cell Jacobian formulation. Axes with a single cell have a zero derivative.
+ *
+ * The volume is processed in z slabs in parallel. Inside a slab the rows are visited in blocks of y so the
+ * three neighboring slices of a block stay in the L2 cache, and each row is evaluated with unit stride loops
+ * along x that the compiler can vectorize. The boundary cells of a row are handled outside of those loops.
+ */
+class SIMPLib_EXPORT StructuredGridDerivatives
+{
+public:
+  enum class Operation : int32_t
+  {
+    Gradient = 0,
+    Divergence,
+    Curl
+  };
+
+  /**
+   * @brief Called after each processed tile with the number of cells in the tile. May be called from several threads.
+   */
+  using ProgressCallback = std::function<void(size_t)>;
+
+  /**
+   * @brief Tabulates the cell center differences of 'geometry'. The geometry is not referenced afterwards.
+   * @param geometry
+   */
+  explicit StructuredGridDerivatives(const IGeometryGrid& geometry);
+  virtual ~StructuredGridDerivatives();
+
+  /**
+   * @brief Computes the gradient of every component of 'field'. The output holds numComps * 3 values per cell,
+   * the x, y and z derivative of the first component followed by those of the next component.
+   * @param field
+   * @param numComps
+   * @param gradient
+   * @param progress
+   */
+  void findGradient(const double* field, int32_t numComps, double* gradient, const ProgressCallback& progress = ProgressCallback()) const;
+
+  /**
+   * @brief Computes the divergence of a 3 component vector field, one value per cell.
+   * @param field
+   * @param divergence
+   * @param progress
+   */
+  void findDivergence(const double* field, double* divergence, const ProgressCallback& progress = ProgressCallback()) const;
+
+  /**
+   * @brief Computes the curl of a 3 component vector field, three values per cell.
+   * @param field
+   * @param curl
+   * @param progress
+   */
+  void findCurl(const double* field, double* curl, const ProgressCallback& progress = ProgressCallback()) const;
+
+  /**
+   * @brief Returns the cell dimensions of the grid
+   * @return
+   */
+  std::array<size_t, 3> getDimensions() const;
+
+  /**
+   * @brief Returns the number of y rows that are processed together so that the input and output of
+   * the neighboring z slices fit in the L2 cache.
+   * @param numComps
+   * @return
+   */
+  size_t getRowsPerTile(int32_t numComps) const;
+
+  /**
+   * @brief Evaluates 'operation' for the cells of the given slab. Used by the parallel tasks.
+   * @param operation
+   * @param field
+   * @param numComps
+   * @param output
+   * @param zStart
+   * @param zEnd
+   * @param yStart
+   * @param yEnd
+   */
+  void computeSlab(Operation operation, const double* field, int32_t numComps, double* output, size_t zStart, size_t zEnd, size_t yStart, size_t yEnd) const;
+
+protected:
+  /**
+   * @brief Runs 'operation' over the whole grid in parallel
+   * @param operation
+   * @param field
+   * @param numComps
+   * @param output
+   * @param progress
+   */
+  void execute(Operation operation, const double* field, int32_t numComps, double* output, const ProgressCallback& progress) const;
+
+  /**
+   * @brief Computes the gradient of one row of cells into 'gradient', which points at the first cell of the row.
+   * @param field
+   * @param numComps
+   * @param gradient
+   * @param y
+   * @param z
+   */
+  void computeRowGradient(const double* field, int32_t numComps, double* gradient, size_t y, size_t z) const;
+
+private:
+  std::array<size_t, 3> m_Dims = {{0, 0, 0}};
+  // Per axis and cell: index of the neighbor on the plus and minus side and 1 / (plus - minus) of their centers
+  std::array<std::vector<size_t>, 3> m_PlusIndex;
+  std::array<std::vector<size_t>, 3> m_MinusIndex;
+  std::array<std::vector<double>, 3> m_InverseDelta;
+
+public:
+  StructuredGridDerivatives(const StructuredGridDerivatives&) = delete;            // Copy Constructor Not Implemented
+  StructuredGridDerivatives(StructuredGridDerivatives&&) = delete;                 // Move Constructor Not Implemented
+  StructuredGridDerivatives& operator=(const StructuredGridDerivatives&) = delete; // Copy Assignment Not Implemented
+  StructuredGridDerivatives& operator=(StructuredGridDerivatives&&) = delete;      // Move Assignment Not Implemented
+};
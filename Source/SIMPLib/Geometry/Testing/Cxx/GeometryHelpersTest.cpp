@@ -0,0 +1,198 @@
+#include <cmath>
+#include <cstdlib>
+
+#include <iostream>
+#include <vector>
+
+#include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Geometry/HexahedralGeom.h"
+#include "SIMPLib/Geometry/QuadGeom.h"
+#include "SIMPLib/Geometry/TetrahedralGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class GeometryHelpersTest
+{
+  static const size_t k_NumCells = 16;
+  static constexpr float k_Spacing = 0.5f;
+
+public:
+  GeometryHelpersTest() = default;
+  virtual ~GeometryHelpersTest() = default;
+
+  // -----------------------------------------------------------------------------
+  // Vertices of a (k_NumCells + 1)^3 grid with k_Spacing between neighbors
+  // -----------------------------------------------------------------------------
+  SharedVertexList::Pointer createGridVertices(size_t numZ)
+  {
+    const size_t numXY = k_NumCells + 1;
+    SharedVertexList::Pointer vertices = HexahedralGeom::CreateSharedVertexList(numXY * numXY * numZ);
+    float* coords = vertices->getPointer(0);
+    for(size_t k = 0; k < numZ; k++)
+    {
+      for(size_t j = 0; j < numXY; j++)
+      {
+        for(size_t i = 0; i < numXY; i++)
+        {
+          size_t id = i + numXY * (j + numXY * k);
+          coords[3 * id + 0] = k_Spacing * static_cast<float>(i);
+          coords[3 * id + 1] = k_Spacing * static_cast<float>(j);
+          coords[3 * id + 2] = k_Spacing * static_cast<float>(k);
+        }
+      }
+    }
+    return vertices;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Fills the 8 vertex ids of grid cell (i, j, k) in hexahedron order
+  // -----------------------------------------------------------------------------
+  void cellVertices(size_t i, size_t j, size_t k, size_t verts[8])
+  {
+    const size_t numXY = k_NumCells + 1;
+    const size_t base = i + numXY * (j + numXY * k);
+    verts[0] = base;
+    verts[1] = base + 1;
+    verts[2] = base + 1 + numXY;
+    verts[3] = base + numXY;
+    for(size_t v = 0; v < 4; v++)
+    {
+      verts[4 + v] = verts[v] + numXY * numXY;
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestHexahedra()
+  {
+    const size_t numHexas = k_NumCells * k_NumCells * k_NumCells;
+    HexahedralGeom::Pointer geom = HexahedralGeom::CreateGeometry(numHexas, createGridVertices(k_NumCells + 1), "Hexahedra");
+    for(size_t h = 0; h < numHexas; h++)
+    {
+      cellVertices(h % k_NumCells, (h / k_NumCells) % k_NumCells, h / (k_NumCells * k_NumCells), geom->getHexPointer(h));
+    }
+
+    DREAM3D_REQUIRE(geom->findElementSizes() >= 0)
+    DREAM3D_REQUIRE(geom->findElementCentroids() >= 0)
+    float* volumes = geom->getElementSizes()->getPointer(0);
+    float* centroids = geom->getElementCentroids()->getPointer(0);
+    for(size_t h = 0; h < numHexas; h++)
+    {
+      DREAM3D_REQUIRE(std::fabs(volumes[h] - k_Spacing * k_Spacing * k_Spacing) < 1.0E-6f)
+      float expectedX = k_Spacing * (static_cast<float>(h % k_NumCells) + 0.5f);
+      DREAM3D_REQUIRE(std::fabs(centroids[3 * h] - expectedX) < 1.0E-5f)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestTetrahedra()
+  {
+    // Each grid cell is split into the 5 tetrahedra used by FindHexVolumes
+    const size_t subTets[5][4] = {{0, 1, 3, 4}, {1, 4, 5, 6}, {1, 4, 6, 3}, {1, 3, 6, 2}, {3, 6, 7, 4}};
+    const size_t numCells = k_NumCells * k_NumCells * k_NumCells;
+    TetrahedralGeom::Pointer geom = TetrahedralGeom::CreateGeometry(5 * numCells, createGridVertices(k_NumCells + 1), "Tetrahedra");
+    for(size_t c = 0; c < numCells; c++)
+    {
+      size_t verts[8];
+      cellVertices(c % k_NumCells, (c / k_NumCells) % k_NumCells, c / (k_NumCells * k_NumCells), verts);
+      for(size_t t = 0; t < 5; t++)
+      {
+        size_t* tet = geom->getTetPointer(5 * c + t);
+        for(size_t v = 0; v < 4; v++)
+        {
+          tet[v] = verts[subTets[t][v]];
+        }
+      }
+    }
+
+    DREAM3D_REQUIRE(geom->findElementSizes() >= 0)
+    FloatArrayType::Pointer volumes = geom->getElementSizes();
+    FloatArrayType::Pointer jacobians = FloatArrayType::CreateArray(5 * numCells, "Jacobians", true);
+    GeometryHelpers::Topology::FindTetJacobians<size_t>(geom->getTetrahedra(), geom->getVertices(), jacobians);
+
+    double totalVolume = 0.0;
+    for(size_t t = 0; t < 5 * numCells; t++)
+    {
+      DREAM3D_REQUIRE(volumes->getValue(t) > 0.0f)
+      DREAM3D_REQUIRE(std::fabs(jacobians->getValue(t) - 6.0f * volumes->getValue(t)) < 1.0E-6f)
+      totalVolume += volumes->getValue(t);
+    }
+    double expected = std::pow(static_cast<double>(k_Spacing * k_NumCells), 3.0);
+    DREAM3D_REQUIRE(std::fabs(totalVolume - expected) < 1.0E-3)
+
+    // The corner tetrahedron of a cube has right angles between its axis aligned faces
+    FloatArrayType::Pointer minAngles = FloatArrayType::CreateArray(5 * numCells, "MinDihedralAngles", true);
+    GeometryHelpers::Topology::FindTetMinDihedralAngles<size_t>(geom->getTetrahedra(), geom->getVertices(), minAngles);
+    DREAM3D_REQUIRE(std::fabs(minAngles->getValue(0) - 90.0f) < 1.0E-3f)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestQuadsAndTriangles()
+  {
+    const size_t numXY = k_NumCells + 1;
+    const size_t numQuads = k_NumCells * k_NumCells;
+    SharedVertexList::Pointer vertices = createGridVertices(1);
+    QuadGeom::Pointer quads = QuadGeom::CreateGeometry(numQuads, vertices, "Quads");
+    TriangleGeom::Pointer tris = TriangleGeom::CreateGeometry(2 * numQuads, vertices, "Triangles");
+    for(size_t q = 0; q < numQuads; q++)
+    {
+      size_t verts[8];
+      cellVertices(q % k_NumCells, q / k_NumCells, 0, verts);
+      std::copy(verts, verts + 4, quads->getQuadPointer(q));
+      size_t* tri0 = tris->getTriPointer(2 * q);
+      size_t* tri1 = tris->getTriPointer(2 * q + 1);
+      tri0[0] = verts[0];
+      tri0[1] = verts[1];
+      tri0[2] = verts[2];
+      tri1[0] = verts[0];
+      tri1[1] = verts[2];
+      tri1[2] = verts[3];
+    }
+
+    DREAM3D_REQUIRE(quads->findElementSizes() >= 0)
+    DREAM3D_REQUIRE(tris->findElementSizes() >= 0)
+    for(size_t q = 0; q < numQuads; q++)
+    {
+      DREAM3D_REQUIRE(std::fabs(quads->getElementSizes()->getValue(q) - k_Spacing * k_Spacing) < 1.0E-6f)
+      DREAM3D_REQUIRE(std::fabs(tris->getElementSizes()->getValue(2 * q) - 0.5f * k_Spacing * k_Spacing) < 1.0E-6f)
+      DREAM3D_REQUIRE(std::fabs(tris->getElementSizes()->getValue(2 * q + 1) - 0.5f * k_Spacing * k_Spacing) < 1.0E-6f)
+    }
+
+    // Averaging a linear vertex field gives its value at the element centroid
+    DoubleArrayType::Pointer vertexValues = DoubleArrayType::CreateArray(numXY * numXY, std::vector<size_t>(1, 2), "VertexValues", true);
+    for(size_t v = 0; v < numXY * numXY; v++)
+    {
+      vertexValues->setComponent(v, 0, static_cast<double>(v % numXY));
+      vertexValues->setComponent(v, 1, static_cast<double>(v / numXY));
+    }
+    FloatArrayType::Pointer quadValues = FloatArrayType::CreateArray(numQuads, std::vector<size_t>(1, 2), "QuadValues", true);
+    GeometryHelpers::Generic::AverageVertexArrayValues<size_t, double>(quads->getQuads(), vertexValues, quadValues);
+    for(size_t q = 0; q < numQuads; q++)
+    {
+      DREAM3D_REQUIRE(std::fabs(quadValues->getComponent(q, 0) - (static_cast<float>(q % k_NumCells) + 0.5f)) < 1.0E-6f)
+      DREAM3D_REQUIRE(std::fabs(quadValues->getComponent(q, 1) - (static_cast<float>(q / k_NumCells) + 0.5f)) < 1.0E-6f)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### GeometryHelpersTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestHexahedra());
+    DREAM3D_REGISTER_TEST(TestTetrahedra());
+    DREAM3D_REGISTER_TEST(TestQuadsAndTriangles());
+  }
+
+private:
+  GeometryHelpersTest(const GeometryHelpersTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const GeometryHelpersTest&) = delete;      // Move assignment Not Implemented
+};
@@ -90,6 +90,34 @@ public:
     DREAM3D_REQUIRE(err == ImageGeom::ErrorType::ZOutOfBoundsHigh)
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCopyCellCenters()
+  {
+    ImageGeom::Pointer geom = ImageGeom::CreateGeometry("Test Geometry");
+    geom->setDimensions(SizeVec3Type(7, 5, 3));
+    geom->setSpacing(FloatVec3Type(0.25f, 1.5f, 3.0f));
+    geom->setOrigin(FloatVec3Type(-10.0f, 2.0f, 0.125f));
+
+    size_t numCells = geom->getNumberOfElements();
+    FloatArrayType::Pointer centers = FloatArrayType::CreateArray(numCells, std::vector<size_t>(1, 3), "Centers", true);
+    DREAM3D_REQUIRE_EQUAL(geom->copyCellCenters(*centers), true)
+
+    float expected[3] = {0.0f, 0.0f, 0.0f};
+    for(size_t i = 0; i < numCells; i++)
+    {
+      geom->getCoords(i, expected);
+      for(int32_t c = 0; c < 3; c++)
+      {
+        DREAM3D_REQUIRE_EQUAL(centers->getComponent(i, c), expected[c])
+      }
+    }
+
+    FloatArrayType::Pointer wrongSize = FloatArrayType::CreateArray(numCells - 1, std::vector<size_t>(1, 3), "Centers", true);
+    DREAM3D_REQUIRE_EQUAL(geom->copyCellCenters(*wrongSize), false)
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -100,6 +128,7 @@ public:
 
     // Use this to register a specific function that will run a test
     DREAM3D_REGISTER_TEST(TestIndexCalculation());
+    DREAM3D_REGISTER_TEST(TestCopyCellCenters());
     DREAM3D_REGISTER_TEST(RemoveTestFiles());
   }
 
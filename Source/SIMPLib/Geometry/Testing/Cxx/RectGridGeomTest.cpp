@@ -1,4 +1,6 @@
 
+#include <array>
+
 #include "SIMPLib/Geometry/RectGridGeom.h"
 #include "SIMPLib/Testing/UnitTestSupport.hpp"
 
@@ -80,6 +82,44 @@ public:
     DREAM3D_REQUIRE_EQUAL(idxOpt.has_value(), false)
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCopyCellCenters()
+  {
+    RectGridGeom::Pointer geom = RectGridGeom::CreateGeometry("Test Geometry");
+    SizeVec3Type dims(4, 3, 2);
+    geom->setDimensions(dims);
+    std::array<FloatArrayType::Pointer, 3> bounds;
+    for(size_t axis = 0; axis < 3; axis++)
+    {
+      bounds[axis] = FloatArrayType::CreateArray(dims[axis] + 1, QString("Bounds%1").arg(axis), true);
+      float value = static_cast<float>(axis);
+      for(size_t i = 0; i <= dims[axis]; i++)
+      {
+        bounds[axis]->setValue(i, value);
+        value += 0.5f + static_cast<float>(i * i);
+      }
+    }
+    geom->setXBounds(bounds[0]);
+    geom->setYBounds(bounds[1]);
+    geom->setZBounds(bounds[2]);
+
+    size_t numCells = geom->getNumberOfElements();
+    FloatArrayType::Pointer centers = FloatArrayType::CreateArray(numCells, std::vector<size_t>(1, 3), "Centers", true);
+    DREAM3D_REQUIRE_EQUAL(geom->copyCellCenters(*centers), true)
+
+    float expected[3] = {0.0f, 0.0f, 0.0f};
+    for(size_t i = 0; i < numCells; i++)
+    {
+      geom->getCoords(i, expected);
+      for(int32_t c = 0; c < 3; c++)
+      {
+        DREAM3D_REQUIRE_EQUAL(centers->getComponent(i, c), expected[c])
+      }
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -90,6 +130,7 @@ public:
 
     // Use this to register a specific function that will run a test
     DREAM3D_REGISTER_TEST(TestGetIndex());
+    DREAM3D_REGISTER_TEST(TestCopyCellCenters());
   }
 
 private:
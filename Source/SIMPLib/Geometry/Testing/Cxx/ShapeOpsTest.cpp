@@ -0,0 +1,174 @@
+#include <cmath>
+#include <cstdlib>
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "SIMPLib/Geometry/ShapeOps/ShapeOps.h"
+#include "SIMPLib/Geometry/ShapeOps/SuperEllipsoidOps.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class ShapeOpsTest
+{
+public:
+  ShapeOpsTest() = default;
+  virtual ~ShapeOpsTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRadcur1Args()
+  {
+    ShapeOps::ShapeArgs shapeArgs;
+    shapeArgs.omega3 = 0.8f;
+    shapeArgs.bOverA = 0.7f;
+    shapeArgs.cOverA = 0.5f;
+    shapeArgs.volCur = 20.0f;
+
+    QMap<ShapeOps::ArgName, float> mapArgs;
+    mapArgs[ShapeOps::Omega3] = shapeArgs.omega3;
+    mapArgs[ShapeOps::B_OverA] = shapeArgs.bOverA;
+    mapArgs[ShapeOps::C_OverA] = shapeArgs.cOverA;
+    mapArgs[ShapeOps::VolCur] = shapeArgs.volCur;
+
+    for(const ShapeOps::Pointer& shapeOps : ShapeOps::getShapeOpsVector())
+    {
+      float fromStruct = shapeOps->radcur1(shapeArgs);
+      float fromMap = shapeOps->radcur1(mapArgs);
+      DREAM3D_REQUIRE_EQUAL(fromStruct, fromMap)
+      DREAM3D_REQUIRE(fromStruct > 0.0f)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  // The batch evaluation must match the per point evaluation for every shape
+  // -----------------------------------------------------------------------------
+  void TestBatchInside()
+  {
+    const size_t count = 1001;
+    std::mt19937 generator(3);
+    std::uniform_real_distribution<float> distribution(-1.5f, 1.5f);
+    std::vector<float> axis1(count);
+    std::vector<float> axis2(count);
+    std::vector<float> axis3(count);
+    for(size_t i = 0; i < count; i++)
+    {
+      axis1[i] = distribution(generator);
+      axis2[i] = distribution(generator);
+      axis3[i] = distribution(generator);
+    }
+    std::vector<float> values(count);
+
+    ShapeOps::ShapeArgs shapeArgs;
+    shapeArgs.bOverA = 1.0f;
+    shapeArgs.cOverA = 1.0f;
+    shapeArgs.volCur = 1.0f;
+    const std::vector<float> omega3s = {0.3f, 0.6f, 0.8f, 0.9f, 0.95f, 1.0f};
+
+    for(const ShapeOps::Pointer& shapeOps : ShapeOps::getShapeOpsVector())
+    {
+      for(float omega3 : omega3s)
+      {
+        shapeArgs.omega3 = omega3;
+        shapeOps->radcur1(shapeArgs);
+        shapeOps->inside(axis1.data(), axis2.data(), axis3.data(), count, values.data());
+        for(size_t i = 0; i < count; i++)
+        {
+          DREAM3D_REQUIRE_EQUAL(values[i], shapeOps->inside(axis1[i], axis2[i], axis3[i]))
+        }
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  // The super ellipsoid avoids powf for quarter step exponents; compare against powf
+  // -----------------------------------------------------------------------------
+  void TestSuperEllipsoidPower()
+  {
+    SuperEllipsoidOps::Pointer shapeOps = SuperEllipsoidOps::New();
+    ShapeOps::ShapeArgs shapeArgs;
+    shapeArgs.bOverA = 1.0f;
+    shapeArgs.cOverA = 1.0f;
+    shapeArgs.volCur = 1.0f;
+
+    const std::vector<float> points = {0.0f, 0.1f, 0.37f, 0.5f, 0.81f, 1.0f, 1.2f};
+    for(int step = 0; step <= 40; step++)
+    {
+      shapeArgs.omega3 = 0.025f * static_cast<float>(step);
+      shapeOps->radcur1(shapeArgs);
+      // Recover the selected exponent, always a multiple of 0.25, from a point on the first axis
+      double n = std::log(1.0 - shapeOps->inside(0.5f, 0.0f, 0.0f)) / std::log(0.5);
+      n = std::round(n * 4.0) / 4.0;
+      for(float x : points)
+      {
+        double expected = 1.0 - std::pow(x, n) - std::pow(0.5 * x, n) - std::pow(0.25 * x, n);
+        float value = shapeOps->inside(-x, 0.5f * x, -0.25f * x);
+        DREAM3D_REQUIRE(std::fabs(value - expected) < 1.0E-5 * (1.0 + std::fabs(expected)))
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  // QuarterPower does not round like powf, so inside() is no longer bitwise identical to the powf
+  // evaluation it replaced. The difference must stay within k_Tolerance, and only points that close to
+  // the surface may switch between inside and outside.
+  // -----------------------------------------------------------------------------
+  void TestSuperEllipsoidMatchesPowf()
+  {
+    const float k_Tolerance = 1.0E-5f;
+    const size_t count = 20000;
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<float> distribution(-1.2f, 1.2f);
+    std::vector<float> axis1(count);
+    std::vector<float> axis2(count);
+    std::vector<float> axis3(count);
+    for(size_t i = 0; i < count; i++)
+    {
+      axis1[i] = distribution(generator);
+      axis2[i] = distribution(generator);
+      axis3[i] = distribution(generator);
+    }
+
+    SuperEllipsoidOps::Pointer shapeOps = SuperEllipsoidOps::New();
+    ShapeOps::ShapeArgs shapeArgs;
+    shapeArgs.bOverA = 1.0f;
+    shapeArgs.cOverA = 1.0f;
+    shapeArgs.volCur = 1.0f;
+    for(int step = 0; step <= 40; step++)
+    {
+      shapeArgs.omega3 = 0.025f * static_cast<float>(step);
+      shapeOps->radcur1(shapeArgs);
+      float n = shapeOps->getNvalue();
+      for(size_t i = 0; i < count; i++)
+      {
+        float powfValue = 1.0f - powf(std::fabs(axis1[i]), n) - powf(std::fabs(axis2[i]), n) - powf(std::fabs(axis3[i]), n);
+        float value = shapeOps->inside(axis1[i], axis2[i], axis3[i]);
+        float tolerance = k_Tolerance * (1.0f + std::fabs(powfValue));
+        DREAM3D_REQUIRE(std::fabs(value - powfValue) <= tolerance)
+        if(std::fabs(powfValue) > tolerance)
+        {
+          DREAM3D_REQUIRE_EQUAL(value >= 0.0f, powfValue >= 0.0f)
+        }
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### ShapeOpsTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestRadcur1Args());
+    DREAM3D_REGISTER_TEST(TestBatchInside());
+    DREAM3D_REGISTER_TEST(TestSuperEllipsoidPower());
+    DREAM3D_REGISTER_TEST(TestSuperEllipsoidMatchesPowf());
+  }
+
+private:
+  ShapeOpsTest(const ShapeOpsTest&) = delete;    // Copy Constructor Not Implemented
+  void operator=(const ShapeOpsTest&) = delete; // Move assignment Not Implemented
+};
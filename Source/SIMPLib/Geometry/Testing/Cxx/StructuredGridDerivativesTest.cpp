@@ -0,0 +1,151 @@
+#include <cmath>
+#include <cstdlib>
+
+#include <iostream>
+#include <vector>
+
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Geometry/RectGridGeom.h"
+#include "SIMPLib/Geometry/StructuredGridDerivatives.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class StructuredGridDerivativesTest
+{
+  static constexpr double k_Tolerance = 1.0E-9;
+
+public:
+  StructuredGridDerivativesTest() = default;
+  virtual ~StructuredGridDerivativesTest() = default;
+
+  // -----------------------------------------------------------------------------
+  // Linear vector field F = J * x, central and one sided differences are exact for it
+  // -----------------------------------------------------------------------------
+  DoubleArrayType::Pointer createLinearField(const IGeometryGrid& geom)
+  {
+    SizeVec3Type dims = geom.getDimensions();
+    size_t numCells = dims[0] * dims[1] * dims[2];
+    DoubleArrayType::Pointer field = DoubleArrayType::CreateArray(numCells, std::vector<size_t>(1, 3), "Field", true);
+    double coords[3] = {0.0, 0.0, 0.0};
+    for(size_t i = 0; i < numCells; i++)
+    {
+      geom.getCoords(i, coords);
+      for(size_t a = 0; a < 3; a++)
+      {
+        double value = 0.0;
+        for(size_t d = 0; d < 3; d++)
+        {
+          value += k_Jacobian[a][d] * coords[d];
+        }
+        field->setComponent(i, static_cast<int>(a), value);
+      }
+    }
+    return field;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  double expectedDerivative(const SizeVec3Type& dims, size_t a, size_t d)
+  {
+    return dims[d] == 1 ? 0.0 : k_Jacobian[a][d];
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int CheckOperators(IGeometryGrid& geom)
+  {
+    SizeVec3Type dims = geom.getDimensions();
+    size_t numCells = dims[0] * dims[1] * dims[2];
+    DoubleArrayType::Pointer field = createLinearField(geom);
+
+    DoubleArrayType::Pointer gradient = DoubleArrayType::CreateArray(numCells, std::vector<size_t>(1, 9), "Gradient", true);
+    geom.findDerivatives(field, gradient, nullptr);
+
+    StructuredGridDerivatives engine(geom);
+    std::vector<double> divergence(numCells);
+    std::vector<double> curl(numCells * 3);
+    engine.findDivergence(field->getPointer(0), divergence.data());
+    engine.findCurl(field->getPointer(0), curl.data());
+
+    for(size_t i = 0; i < numCells; i++)
+    {
+      for(size_t a = 0; a < 3; a++)
+      {
+        for(size_t d = 0; d < 3; d++)
+        {
+          DREAM3D_REQUIRE(std::fabs(gradient->getValue(i * 9 + a * 3 + d) - expectedDerivative(dims, a, d)) < k_Tolerance)
+        }
+      }
+      double div = expectedDerivative(dims, 0, 0) + expectedDerivative(dims, 1, 1) + expectedDerivative(dims, 2, 2);
+      DREAM3D_REQUIRE(std::fabs(divergence[i] - div) < k_Tolerance)
+      DREAM3D_REQUIRE(std::fabs(curl[3 * i + 0] - (expectedDerivative(dims, 2, 1) - expectedDerivative(dims, 1, 2))) < k_Tolerance)
+      DREAM3D_REQUIRE(std::fabs(curl[3 * i + 1] - (expectedDerivative(dims, 0, 2) - expectedDerivative(dims, 2, 0))) < k_Tolerance)
+      DREAM3D_REQUIRE(std::fabs(curl[3 * i + 2] - (expectedDerivative(dims, 1, 0) - expectedDerivative(dims, 0, 1))) < k_Tolerance)
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestImageGeom()
+  {
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry("Image");
+    image->setSpacing(FloatVec3Type(0.5f, 2.0f, 1.25f));
+    image->setOrigin(FloatVec3Type(-4.0f, 1.0f, 3.0f));
+
+    image->setDimensions(SizeVec3Type(13, 7, 5));
+    int err = CheckOperators(*image);
+    DREAM3D_REQUIRE_EQUAL(err, EXIT_SUCCESS)
+
+    // Single slice images are split along y and have a zero z derivative
+    image->setDimensions(SizeVec3Type(9, 11, 1));
+    err = CheckOperators(*image);
+    DREAM3D_REQUIRE_EQUAL(err, EXIT_SUCCESS)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestRectGridGeom()
+  {
+    RectGridGeom::Pointer rectGrid = RectGridGeom::CreateGeometry("RectGrid");
+    SizeVec3Type dims(6, 2, 4);
+    rectGrid->setDimensions(dims);
+    std::vector<FloatArrayType::Pointer> bounds(3);
+    for(size_t axis = 0; axis < 3; axis++)
+    {
+      bounds[axis] = FloatArrayType::CreateArray(dims[axis] + 1, QString("Bounds%1").arg(axis), true);
+      float value = static_cast<float>(axis);
+      for(size_t i = 0; i <= dims[axis]; i++)
+      {
+        bounds[axis]->setValue(i, value);
+        value += 0.5f + 0.25f * static_cast<float>(i * i);
+      }
+    }
+    rectGrid->setXBounds(bounds[0]);
+    rectGrid->setYBounds(bounds[1]);
+    rectGrid->setZBounds(bounds[2]);
+    return CheckOperators(*rectGrid);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### StructuredGridDerivativesTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestImageGeom());
+    DREAM3D_REGISTER_TEST(TestRectGridGeom());
+  }
+
+private:
+  const double k_Jacobian[3][3] = {{2.0, -1.0, 3.0}, {0.5, -1.0, 4.0}, {1.0, 1.0, 0.0}};
+
+  StructuredGridDerivativesTest(const StructuredGridDerivativesTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const StructuredGridDerivativesTest&) = delete;                // Move assignment Not Implemented
+};
@@ -0,0 +1,223 @@
+#include <cmath>
+#include <cstdlib>
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "SIMPLib/Geometry/TriangleBVH.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Math/GeometryMath.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class TriangleBVHTest
+{
+public:
+  TriangleBVHTest() = default;
+  virtual ~TriangleBVHTest() = default;
+
+  // -----------------------------------------------------------------------------
+  // Closed unit cube made of 12 outward facing triangles
+  // -----------------------------------------------------------------------------
+  TriangleGeom::Pointer createCube()
+  {
+    const std::vector<float> coords = {0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1};
+    const std::vector<size_t> tris = {0, 2, 1, 0, 3, 2, 4, 5, 6, 4, 6, 7, 0, 1, 5, 0, 5, 4, 3, 7, 6, 3, 6, 2, 0, 4, 7, 0, 7, 3, 1, 2, 6, 1, 6, 5};
+
+    SharedVertexList::Pointer vertices = TriangleGeom::CreateSharedVertexList(8);
+    std::copy(coords.begin(), coords.end(), vertices->getPointer(0));
+    TriangleGeom::Pointer geom = TriangleGeom::CreateGeometry(12, vertices, "Cube");
+    std::copy(tris.begin(), tris.end(), geom->getTriPointer(0));
+    return geom;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCache()
+  {
+    TriangleGeom::Pointer geom = createCube();
+    DREAM3D_REQUIRE(geom->getBoundingVolumeHierarchy().get() == nullptr)
+    DREAM3D_REQUIRE(geom->findBoundingVolumeHierarchy() >= 0)
+
+    TriangleBVH::Pointer bvh = geom->getBoundingVolumeHierarchy();
+    DREAM3D_REQUIRE_VALID_POINTER(bvh.get())
+    DREAM3D_REQUIRE_EQUAL(bvh->getNumberOfTriangles(), 12)
+
+    float lowerLeft[3] = {0.0f, 0.0f, 0.0f};
+    float upperRight[3] = {0.0f, 0.0f, 0.0f};
+    bvh->getBounds(lowerLeft, upperRight);
+    DREAM3D_REQUIRE(lowerLeft[0] <= 0.0f && upperRight[2] >= 1.0f)
+
+    geom->deleteBoundingVolumeHierarchy();
+    DREAM3D_REQUIRE(geom->getBoundingVolumeHierarchy().get() == nullptr)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestInvalidation()
+  {
+    TriangleGeom::Pointer geom = createCube();
+
+    // Every setter of the vertex or triangle list drops the hierarchy built from them
+    DREAM3D_REQUIRE(geom->findBoundingVolumeHierarchy() >= 0)
+    float coords[3] = {2.0f, 0.0f, 0.0f};
+    geom->setCoords(1, coords);
+    DREAM3D_REQUIRE(geom->getBoundingVolumeHierarchy().get() == nullptr)
+
+    DREAM3D_REQUIRE(geom->findBoundingVolumeHierarchy() >= 0)
+    geom->resizeVertexList(9);
+    DREAM3D_REQUIRE(geom->getBoundingVolumeHierarchy().get() == nullptr)
+    float apex[3] = {0.5f, 0.5f, 2.0f};
+    geom->setCoords(8, apex);
+
+    DREAM3D_REQUIRE(geom->findBoundingVolumeHierarchy() >= 0)
+    geom->setVertices(geom->getVertices());
+    DREAM3D_REQUIRE(geom->getBoundingVolumeHierarchy().get() == nullptr)
+
+    DREAM3D_REQUIRE(geom->findBoundingVolumeHierarchy() >= 0)
+    size_t verts[3] = {0, 1, 8};
+    geom->setVertsAtTri(0, verts);
+    DREAM3D_REQUIRE(geom->getBoundingVolumeHierarchy().get() == nullptr)
+
+    DREAM3D_REQUIRE(geom->findBoundingVolumeHierarchy() >= 0)
+    geom->resizeTriList(11);
+    DREAM3D_REQUIRE(geom->getBoundingVolumeHierarchy().get() == nullptr)
+
+    DREAM3D_REQUIRE(geom->findBoundingVolumeHierarchy() >= 0)
+    geom->setTriangles(geom->getTriangles());
+    DREAM3D_REQUIRE(geom->getBoundingVolumeHierarchy().get() == nullptr)
+
+    // A deep copy shares the hierarchy until one of the two geometries changes
+    DREAM3D_REQUIRE(geom->findBoundingVolumeHierarchy() >= 0)
+    TriangleGeom::Pointer copy = std::dynamic_pointer_cast<TriangleGeom>(geom->deepCopy(false));
+    DREAM3D_REQUIRE_VALID_POINTER(copy.get())
+    DREAM3D_REQUIRE(copy->getBoundingVolumeHierarchy() == geom->getBoundingVolumeHierarchy())
+    copy->setCoords(0, coords);
+    DREAM3D_REQUIRE(copy->getBoundingVolumeHierarchy().get() == nullptr)
+    DREAM3D_REQUIRE_VALID_POINTER(geom->getBoundingVolumeHierarchy().get())
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestContainment()
+  {
+    TriangleGeom::Pointer geom = createCube();
+    TriangleBVH::Pointer bvh = TriangleBVH::New(*geom);
+
+    const float inside[3] = {0.5f, 0.5f, 0.5f};
+    const float outside[3] = {1.5f, 0.5f, 0.5f};
+    const float onFace[3] = {0.25f, 0.5f, 1.0f};
+    const float onEdge[3] = {0.5f, 0.0f, 0.0f};
+    const float onVertex[3] = {1.0f, 1.0f, 1.0f};
+    DREAM3D_REQUIRE_EQUAL(bvh->findContainment(inside), 'i')
+    DREAM3D_REQUIRE_EQUAL(bvh->findContainment(outside), 'o')
+    DREAM3D_REQUIRE_EQUAL(bvh->findContainment(onFace), 'F')
+    DREAM3D_REQUIRE_EQUAL(bvh->findContainment(onEdge), 'E')
+    DREAM3D_REQUIRE_EQUAL(bvh->findContainment(onVertex), 'V')
+
+    float distToBoundary = 0.0f;
+    DREAM3D_REQUIRE_EQUAL(GeometryMath::PointInPolyhedron(*bvh, inside, distToBoundary), 'i')
+    DREAM3D_REQUIRE(std::fabs(distToBoundary - 0.5f) < 1.0E-5f)
+
+    // Points on the planes of the cube faces make the rays graze edges, which must not change the result
+    std::mt19937 generator(5489u);
+    std::uniform_int_distribution<int> distribution(-2, 6);
+    const size_t numPoints = 500;
+    std::vector<float> points(3 * numPoints);
+    for(auto& value : points)
+    {
+      value = 0.25f * static_cast<float>(distribution(generator));
+    }
+    std::vector<char> codes(numPoints, '?');
+    bvh->findContainments(points.data(), numPoints, codes.data());
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      const float* p = points.data() + 3 * i;
+      bool strictlyInside = p[0] > 0.0f && p[0] < 1.0f && p[1] > 0.0f && p[1] < 1.0f && p[2] > 0.0f && p[2] < 1.0f;
+      bool strictlyOutside = p[0] < 0.0f || p[0] > 1.0f || p[1] < 0.0f || p[1] > 1.0f || p[2] < 0.0f || p[2] > 1.0f;
+      if(strictlyInside)
+      {
+        DREAM3D_REQUIRE_EQUAL(codes[i], 'i')
+      }
+      else if(strictlyOutside)
+      {
+        DREAM3D_REQUIRE_EQUAL(codes[i], 'o')
+      }
+      else
+      {
+        DREAM3D_REQUIRE(codes[i] == 'V' || codes[i] == 'E' || codes[i] == 'F')
+      }
+      DREAM3D_REQUIRE_EQUAL(codes[i], bvh->findContainment(p))
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRayHits()
+  {
+    TriangleGeom::Pointer geom = createCube();
+    TriangleBVH::Pointer bvh = TriangleBVH::New(*geom);
+
+    const std::vector<float> origins = {0.25f, 0.5f, -1.0f, 0.5f, 0.5f, 0.5f, 2.0f, 2.0f, 2.0f};
+    const std::vector<float> directions = {0.0f, 0.0f, 1.0f, 2.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f};
+    std::vector<TriangleBVH::RayHit> hits(3);
+    bvh->findFirstHits(origins.data(), directions.data(), 3, hits.data());
+
+    // The bottom face is triangles 0 and 1
+    DREAM3D_REQUIRE(hits[0].triangleId == 0 || hits[0].triangleId == 1)
+    DREAM3D_REQUIRE(std::fabs(hits[0].distance - 1.0f) < 1.0E-5f)
+    // Distance is measured in lengths of the direction
+    DREAM3D_REQUIRE(hits[1].triangleId == 10 || hits[1].triangleId == 11)
+    DREAM3D_REQUIRE(std::fabs(hits[1].distance - 0.25f) < 1.0E-5f)
+    DREAM3D_REQUIRE_EQUAL(hits[2].triangleId, TriangleBVH::InvalidTriangle)
+
+    TriangleBVH::RayHit hit = bvh->findFirstHit(origins.data(), directions.data(), 0.5f);
+    DREAM3D_REQUIRE_EQUAL(hit.triangleId, TriangleBVH::InvalidTriangle)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestClosestPoints()
+  {
+    TriangleGeom::Pointer geom = createCube();
+    const std::vector<size_t> topFace = {2, 3};
+    TriangleBVH::Pointer bvh = TriangleBVH::New(*geom, topFace.data(), topFace.size());
+    DREAM3D_REQUIRE_EQUAL(bvh->getNumberOfTriangles(), 2)
+
+    const std::vector<float> points = {0.5f, 0.5f, 3.0f, 2.0f, 0.5f, 1.0f, 0.5f, 0.5f, 0.0f};
+    std::vector<TriangleBVH::ClosestPoint> closest(3);
+    bvh->findClosestPoints(points.data(), 3, closest.data());
+
+    DREAM3D_REQUIRE(std::fabs(closest[0].distance - 2.0f) < 1.0E-5f)
+    DREAM3D_REQUIRE(std::fabs(closest[0].point[2] - 1.0f) < 1.0E-5f)
+    DREAM3D_REQUIRE(std::fabs(closest[1].distance - 1.0f) < 1.0E-5f)
+    DREAM3D_REQUIRE(std::fabs(closest[1].point[0] - 1.0f) < 1.0E-5f)
+    // Only the top face is in the hierarchy
+    DREAM3D_REQUIRE(std::fabs(closest[2].distance - 1.0f) < 1.0E-5f)
+    DREAM3D_REQUIRE(closest[2].triangleId == 2 || closest[2].triangleId == 3)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### TriangleBVHTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestCache());
+    DREAM3D_REGISTER_TEST(TestInvalidation());
+    DREAM3D_REGISTER_TEST(TestContainment());
+    DREAM3D_REGISTER_TEST(TestRayHits());
+    DREAM3D_REGISTER_TEST(TestClosestPoints());
+  }
+
+private:
+  TriangleBVHTest(const TriangleBVHTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const TriangleBVHTest&) = delete;  // Move assignment Not Implemented
+};
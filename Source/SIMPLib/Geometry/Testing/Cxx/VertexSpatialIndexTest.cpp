@@ -0,0 +1,177 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "SIMPLib/Geometry/VertexGeom.h"
+#include "SIMPLib/Geometry/VertexKdTree.h"
+#include "SIMPLib/Geometry/VertexUniformGrid.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class VertexSpatialIndexTest
+{
+public:
+  VertexSpatialIndexTest() = default;
+  virtual ~VertexSpatialIndexTest() = default;
+
+  // -----------------------------------------------------------------------------
+  // Random point cloud in [-10, 10]^3 with a few exact duplicates
+  // -----------------------------------------------------------------------------
+  VertexGeom::Pointer createPointCloud(size_t numVertices)
+  {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(-10.0f, 10.0f);
+
+    VertexGeom::Pointer geom = VertexGeom::CreateGeometry(numVertices, "PointCloud");
+    float* coords = geom->getVertexPointer(0);
+    for(size_t i = 0; i < 3 * numVertices; i++)
+    {
+      coords[i] = distribution(generator);
+    }
+    for(size_t i = 1; i < std::min<size_t>(numVertices, 20); i++)
+    {
+      std::copy(coords, coords + 3, coords + 3 * i);
+    }
+    return geom;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCache()
+  {
+    VertexGeom::Pointer geom = createPointCloud(100);
+    DREAM3D_REQUIRE(geom->getKdTree().get() == nullptr)
+    DREAM3D_REQUIRE(geom->findKdTree() >= 0)
+
+    VertexKdTree::Pointer tree = geom->getKdTree();
+    DREAM3D_REQUIRE_VALID_POINTER(tree.get())
+    DREAM3D_REQUIRE_EQUAL(tree->getNumberOfVertices(), 100)
+
+    geom->deleteKdTree();
+    DREAM3D_REQUIRE(geom->getKdTree().get() == nullptr)
+
+    // Every vertex change made through the geometry drops the tree
+    DREAM3D_REQUIRE(geom->findKdTree() >= 0)
+    IGeometry::Pointer copy = geom->deepCopy();
+    DREAM3D_REQUIRE(std::dynamic_pointer_cast<VertexGeom>(copy)->getKdTree().get() == nullptr)
+
+    float coords[3] = {100.0f, 100.0f, 100.0f};
+    geom->setCoords(0, coords);
+    DREAM3D_REQUIRE(geom->getKdTree().get() == nullptr)
+
+    DREAM3D_REQUIRE(geom->findKdTree() >= 0)
+    geom->resizeVertexList(50);
+    DREAM3D_REQUIRE(geom->getKdTree().get() == nullptr)
+
+    DREAM3D_REQUIRE(geom->findKdTree() >= 0)
+    geom->setVertices(VertexGeom::CreateSharedVertexList(10));
+    DREAM3D_REQUIRE(geom->getKdTree().get() == nullptr)
+
+    DREAM3D_REQUIRE(VertexUniformGrid::New(0.0f).get() == nullptr)
+  }
+
+  // -----------------------------------------------------------------------------
+  // Compares every query of both indices against a brute force search
+  // -----------------------------------------------------------------------------
+  void TestQueries()
+  {
+    const size_t numVertices = 5000;
+    const size_t k = 6;
+    VertexGeom::Pointer geom = createPointCloud(numVertices);
+    const float* coords = geom->getVertexPointer(0);
+
+    VertexKdTree::Pointer tree = VertexKdTree::New(*geom);
+    VertexUniformGrid::Pointer grid = VertexUniformGrid::New(1.0f);
+    DREAM3D_REQUIRE_VALID_POINTER(grid.get())
+    // Insert in two blocks to exercise the incremental path
+    grid->insert(coords, numVertices / 2);
+    grid->insert(coords + 3 * (numVertices / 2), numVertices - numVertices / 2, numVertices / 2);
+    DREAM3D_REQUIRE_EQUAL(grid->getNumberOfVertices(), numVertices)
+
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<float> distribution(-12.0f, 12.0f);
+    const size_t numQueries = 40;
+    std::vector<float> queries(3 * numQueries);
+    for(auto& value : queries)
+    {
+      value = distribution(generator);
+    }
+    std::copy(coords, coords + 3, queries.begin());
+
+    const float radius = 1.5f;
+    std::vector<std::vector<size_t>> treeRadius = tree->findInRadius(queries.data(), numQueries, radius);
+    std::vector<std::vector<size_t>> gridRadius = grid->findInRadius(queries.data(), numQueries, radius);
+    std::vector<size_t> treeIds(k * numQueries);
+    std::vector<size_t> gridIds(k * numQueries);
+    std::vector<float> treeDistances(k * numQueries);
+    std::vector<float> gridDistances(k * numQueries);
+    tree->findNearest(queries.data(), numQueries, k, treeIds.data(), treeDistances.data());
+    grid->findNearest(queries.data(), numQueries, k, gridIds.data(), gridDistances.data());
+
+    for(size_t q = 0; q < numQueries; q++)
+    {
+      const float* p = queries.data() + 3 * q;
+      float lowerLeft[3] = {p[0] - 2.0f, p[1] - 3.0f, p[2] - 1.0f};
+      float upperRight[3] = {p[0] + 1.0f, p[1] + 2.0f, p[2] + 4.0f};
+
+      std::vector<size_t> expectedBox;
+      std::vector<size_t> expectedRadius;
+      std::vector<std::pair<float, size_t>> sorted;
+      for(size_t i = 0; i < numVertices; i++)
+      {
+        const float* v = coords + 3 * i;
+        if(v[0] >= lowerLeft[0] && v[0] <= upperRight[0] && v[1] >= lowerLeft[1] && v[1] <= upperRight[1] && v[2] >= lowerLeft[2] && v[2] <= upperRight[2])
+        {
+          expectedBox.push_back(i);
+        }
+        float dist2 = (v[0] - p[0]) * (v[0] - p[0]) + (v[1] - p[1]) * (v[1] - p[1]) + (v[2] - p[2]) * (v[2] - p[2]);
+        if(dist2 <= radius * radius)
+        {
+          expectedRadius.push_back(i);
+        }
+        sorted.emplace_back(dist2, i);
+      }
+      std::sort(sorted.begin(), sorted.end());
+
+      DREAM3D_REQUIRE(tree->findInBox(lowerLeft, upperRight) == expectedBox)
+      DREAM3D_REQUIRE(grid->findInBox(lowerLeft, upperRight) == expectedBox)
+      DREAM3D_REQUIRE(treeRadius[q] == expectedRadius)
+      DREAM3D_REQUIRE(gridRadius[q] == expectedRadius)
+      for(size_t n = 0; n < k; n++)
+      {
+        float expected = std::sqrt(sorted[n].first);
+        DREAM3D_REQUIRE(std::fabs(treeDistances[k * q + n] - expected) < 1.0E-5f)
+        DREAM3D_REQUIRE(std::fabs(gridDistances[k * q + n] - expected) < 1.0E-5f)
+      }
+    }
+
+    // Fewer vertices than requested neighbors
+    VertexGeom::Pointer small = createPointCloud(20);
+    VertexKdTree::Pointer smallTree = VertexKdTree::New(*small);
+    std::vector<size_t> ids(25);
+    size_t found = smallTree->findNearest(queries.data(), 25, ids.data(), nullptr);
+    DREAM3D_REQUIRE_EQUAL(found, 20)
+    DREAM3D_REQUIRE_EQUAL(ids[20], VertexKdTree::InvalidVertex)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### VertexSpatialIndexTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestCache());
+    DREAM3D_REGISTER_TEST(TestQueries());
+  }
+
+private:
+  VertexSpatialIndexTest(const VertexSpatialIndexTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const VertexSpatialIndexTest&) = delete;         // Move assignment Not Implemented
+};
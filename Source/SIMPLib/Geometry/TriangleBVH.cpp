@@ -0,0 +1,961 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "TriangleBVH.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numeric>
+
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+namespace
+{
+constexpr size_t k_NumBins = 16;
+constexpr uint32_t k_MaxLeafSize = 8;
+constexpr size_t k_MaxDepth = 60;
+constexpr size_t k_StackSize = k_MaxDepth + 4;
+constexpr double k_BarycentricTolerance = 1.0E-7;
+
+/**
+ * @brief Ray directions used for the containment test. The components are irrational ratios so
+ * the rays do not run parallel to the axis aligned faces and diagonals of voxelized surface meshes.
+ */
+constexpr std::array<std::array<double, 3>, 8> k_ContainmentDirections = {{{1.0, 1.41421356, 1.73205081},
+                                                                           {-2.23606798, 1.0, 0.64575131},
+                                                                           {0.31622777, -1.0, 2.44948974},
+                                                                           {-0.83666003, -1.30384048, -1.0},
+                                                                           {1.0, -0.57735027, -1.18321596},
+                                                                           {-1.0, 2.64575131, 0.47958315},
+                                                                           {0.38729833, 0.74161985, -1.0},
+                                                                           {-1.51657509, -0.28284271, 1.0}}};
+
+struct Bounds
+{
+  float lowerLeft[3] = {std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
+  float upperRight[3] = {std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()};
+
+  void grow(const float* p)
+  {
+    for(size_t i = 0; i < 3; i++)
+    {
+      lowerLeft[i] = std::min(lowerLeft[i], p[i]);
+      upperRight[i] = std::max(upperRight[i], p[i]);
+    }
+  }
+
+  void grow(const Bounds& other)
+  {
+    for(size_t i = 0; i < 3; i++)
+    {
+      lowerLeft[i] = std::min(lowerLeft[i], other.lowerLeft[i]);
+      upperRight[i] = std::max(upperRight[i], other.upperRight[i]);
+    }
+  }
+
+  float area() const
+  {
+    float dx = upperRight[0] - lowerLeft[0];
+    float dy = upperRight[1] - lowerLeft[1];
+    float dz = upperRight[2] - lowerLeft[2];
+    if(dx < 0.0f || dy < 0.0f || dz < 0.0f)
+    {
+      return 0.0f;
+    }
+    return 2.0f * (dx * dy + dy * dz + dz * dx);
+  }
+};
+
+struct StackEntry
+{
+  uint32_t node;
+  float key;
+};
+
+// -----------------------------------------------------------------------------
+// Slab test of a ray against a node box. Written without branches over the axes so the
+// compiler can keep the three slabs in one vector register; invDir never holds an infinity.
+// -----------------------------------------------------------------------------
+inline bool RayIntersectsNode(const TriangleBVH::Node& node, const float origin[3], const float invDir[3], float tMax, float& tEntry)
+{
+  float tNear[3];
+  float tFar[3];
+  for(size_t i = 0; i < 3; i++)
+  {
+    float t0 = (node.lowerLeft[i] - origin[i]) * invDir[i];
+    float t1 = (node.upperRight[i] - origin[i]) * invDir[i];
+    tNear[i] = std::min(t0, t1);
+    tFar[i] = std::max(t0, t1);
+  }
+  float tMin = std::max(std::max(tNear[0], tNear[1]), std::max(tNear[2], 0.0f));
+  float tMaxBox = std::min(std::min(tFar[0], tFar[1]), std::min(tFar[2], tMax));
+  tEntry = tMin;
+  return tMin <= tMaxBox;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+inline float SquaredDistanceToNode(const TriangleBVH::Node& node, const float p[3])
+{
+  float dist2 = 0.0f;
+  for(size_t i = 0; i < 3; i++)
+  {
+    float d = std::max(std::max(node.lowerLeft[i] - p[i], p[i] - node.upperRight[i]), 0.0f);
+    dist2 += d * d;
+  }
+  return dist2;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+inline void InverseDirection(const float direction[3], float invDir[3])
+{
+  for(size_t i = 0; i < 3; i++)
+  {
+    // A huge finite value keeps (bound - origin) * invDir from becoming NaN for axis parallel rays
+    float d = std::fabs(direction[i]) < 1.0E-30f ? std::copysign(1.0E-30f, direction[i]) : direction[i];
+    invDir[i] = 1.0f / d;
+  }
+}
+
+inline void Subtract(const double a[3], const double b[3], double out[3])
+{
+  out[0] = a[0] - b[0];
+  out[1] = a[1] - b[1];
+  out[2] = a[2] - b[2];
+}
+
+inline void Cross(const double a[3], const double b[3], double out[3])
+{
+  out[0] = a[1] * b[2] - a[2] * b[1];
+  out[1] = a[2] * b[0] - a[0] * b[2];
+  out[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+inline double Dot(const double a[3], const double b[3])
+{
+  return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+inline void LoadTriangle(const float* coords, double a[3], double b[3], double c[3])
+{
+  for(size_t i = 0; i < 3; i++)
+  {
+    a[i] = static_cast<double>(coords[i]);
+    b[i] = static_cast<double>(coords[3 + i]);
+    c[i] = static_cast<double>(coords[6 + i]);
+  }
+}
+
+enum class TriangleHit
+{
+  Miss,
+  Interior,
+  Degenerate
+};
+
+// -----------------------------------------------------------------------------
+// Moller-Trumbore ray/triangle test in double precision. Hits within k_BarycentricTolerance
+// of an edge, and rays lying in the plane of the triangle, are reported as Degenerate.
+// -----------------------------------------------------------------------------
+TriangleHit IntersectTriangle(const float* coords, const double origin[3], const double direction[3], double planeTolerance, double& t, double& u, double& v)
+{
+  double a[3], b[3], c[3];
+  LoadTriangle(coords, a, b, c);
+  double e1[3], e2[3], p[3], s[3], q[3];
+  Subtract(b, a, e1);
+  Subtract(c, a, e2);
+  Cross(direction, e2, p);
+  double det = Dot(e1, p);
+  Subtract(origin, a, s);
+
+  double scale = std::sqrt(Dot(e1, e1) * Dot(e2, e2) * Dot(direction, direction));
+  if(std::fabs(det) <= 1.0E-12 * scale)
+  {
+    if(scale == 0.0)
+    {
+      return TriangleHit::Miss;
+    }
+    // The ray is parallel to the triangle; it only matters if it runs inside its plane
+    double n[3];
+    Cross(e1, e2, n);
+    double nLength = std::sqrt(Dot(n, n));
+    if(nLength > 0.0 && std::fabs(Dot(s, n)) / nLength <= planeTolerance)
+    {
+      t = std::numeric_limits<double>::infinity();
+      return TriangleHit::Degenerate;
+    }
+    return TriangleHit::Miss;
+  }
+
+  double invDet = 1.0 / det;
+  u = Dot(s, p) * invDet;
+  if(u < -k_BarycentricTolerance || u > 1.0 + k_BarycentricTolerance)
+  {
+    return TriangleHit::Miss;
+  }
+  Cross(s, e1, q);
+  v = Dot(direction, q) * invDet;
+  if(v < -k_BarycentricTolerance || u + v > 1.0 + k_BarycentricTolerance)
+  {
+    return TriangleHit::Miss;
+  }
+  t = Dot(e2, q) * invDet;
+  if(u < k_BarycentricTolerance || v < k_BarycentricTolerance || u + v > 1.0 - k_BarycentricTolerance)
+  {
+    return TriangleHit::Degenerate;
+  }
+  return TriangleHit::Interior;
+}
+
+// -----------------------------------------------------------------------------
+// Closest point on a triangle, see Ericson, Real-Time Collision Detection, 5.1.5
+// -----------------------------------------------------------------------------
+void ClosestPointOnTriangle(const float* coords, const double p[3], double closest[3])
+{
+  double a[3], b[3], c[3];
+  LoadTriangle(coords, a, b, c);
+  double ab[3], ac[3], ap[3], bp[3], cp[3];
+  Subtract(b, a, ab);
+  Subtract(c, a, ac);
+  Subtract(p, a, ap);
+
+  double d1 = Dot(ab, ap);
+  double d2 = Dot(ac, ap);
+  if(d1 <= 0.0 && d2 <= 0.0)
+  {
+    std::copy(a, a + 3, closest);
+    return;
+  }
+
+  Subtract(p, b, bp);
+  double d3 = Dot(ab, bp);
+  double d4 = Dot(ac, bp);
+  if(d3 >= 0.0 && d4 <= d3)
+  {
+    std::copy(b, b + 3, closest);
+    return;
+  }
+
+  double vc = d1 * d4 - d3 * d2;
+  if(vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0)
+  {
+    double v = d1 / (d1 - d3);
+    for(size_t i = 0; i < 3; i++)
+    {
+      closest[i] = a[i] + v * ab[i];
+    }
+    return;
+  }
+
+  Subtract(p, c, cp);
+  double d5 = Dot(ab, cp);
+  double d6 = Dot(ac, cp);
+  if(d6 >= 0.0 && d5 <= d6)
+  {
+    std::copy(c, c + 3, closest);
+    return;
+  }
+
+  double vb = d5 * d2 - d1 * d6;
+  if(vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0)
+  {
+    double w = d2 / (d2 - d6);
+    for(size_t i = 0; i < 3; i++)
+    {
+      closest[i] = a[i] + w * ac[i];
+    }
+    return;
+  }
+
+  double va = d3 * d6 - d5 * d4;
+  if(va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0)
+  {
+    double w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+    for(size_t i = 0; i < 3; i++)
+    {
+      closest[i] = b[i] + w * (c[i] - b[i]);
+    }
+    return;
+  }
+
+  double denom = va + vb + vc;
+  if(denom == 0.0)
+  {
+    // Zero area triangle whose vertices all project inside; any vertex is as good as another
+    std::copy(a, a + 3, closest);
+    return;
+  }
+  denom = 1.0 / denom;
+  double v = vb * denom;
+  double w = vc * denom;
+  for(size_t i = 0; i < 3; i++)
+  {
+    closest[i] = a[i] + ab[i] * v + ac[i] * w;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double SquaredDistanceToSegment(const double p[3], const double a[3], const double b[3])
+{
+  double ab[3], ap[3];
+  Subtract(b, a, ab);
+  Subtract(p, a, ap);
+  double len2 = Dot(ab, ab);
+  double t = len2 > 0.0 ? std::min(std::max(Dot(ap, ab) / len2, 0.0), 1.0) : 0.0;
+  double d[3] = {ap[0] - t * ab[0], ap[1] - t * ab[1], ap[2] - t * ab[2]};
+  return Dot(d, d);
+}
+} // namespace
+
+/**
+ * @brief The TriangleBVHFirstHitImpl class implements a threaded algorithm that finds the first hit of each ray
+ */
+class TriangleBVHFirstHitImpl
+{
+public:
+  TriangleBVHFirstHitImpl(const TriangleBVH* bvh, const float* origins, const float* directions, TriangleBVH::RayHit* hits, float maxDistance)
+  : m_BVH(bvh)
+  , m_Origins(origins)
+  , m_Directions(directions)
+  , m_Hits(hits)
+  , m_MaxDistance(maxDistance)
+  {
+  }
+  virtual ~TriangleBVHFirstHitImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      m_Hits[i] = m_BVH->findFirstHit(m_Origins + 3 * i, m_Directions + 3 * i, m_MaxDistance);
+    }
+  }
+
+private:
+  const TriangleBVH* m_BVH;
+  const float* m_Origins;
+  const float* m_Directions;
+  TriangleBVH::RayHit* m_Hits;
+  float m_MaxDistance;
+};
+
+/**
+ * @brief The TriangleBVHClosestPointImpl class implements a threaded algorithm that finds the closest point on the surface to each point
+ */
+class TriangleBVHClosestPointImpl
+{
+public:
+  TriangleBVHClosestPointImpl(const TriangleBVH* bvh, const float* points, TriangleBVH::ClosestPoint* closestPoints)
+  : m_BVH(bvh)
+  , m_Points(points)
+  , m_ClosestPoints(closestPoints)
+  {
+  }
+  virtual ~TriangleBVHClosestPointImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      m_ClosestPoints[i] = m_BVH->findClosestPoint(m_Points + 3 * i);
+    }
+  }
+
+private:
+  const TriangleBVH* m_BVH;
+  const float* m_Points;
+  TriangleBVH::ClosestPoint* m_ClosestPoints;
+};
+
+/**
+ * @brief The TriangleBVHContainmentImpl class implements a threaded algorithm that classifies each point against the surface
+ */
+class TriangleBVHContainmentImpl
+{
+public:
+  TriangleBVHContainmentImpl(const TriangleBVH* bvh, const float* points, char* codes)
+  : m_BVH(bvh)
+  , m_Points(points)
+  , m_Codes(codes)
+  {
+  }
+  virtual ~TriangleBVHContainmentImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      m_Codes[i] = m_BVH->findContainment(m_Points + 3 * i);
+    }
+  }
+
+private:
+  const TriangleBVH* m_BVH;
+  const float* m_Points;
+  char* m_Codes;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::TriangleBVH() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::~TriangleBVH() = default;
+
+// -----------------------------------------------------------------------------
+TriangleBVH::Pointer TriangleBVH::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
+
+// -----------------------------------------------------------------------------
+TriangleBVH::Pointer TriangleBVH::New(const TriangleGeom& triangles)
+{
+  std::vector<size_t> triangleIds(triangles.getNumberOfTris());
+  std::iota(triangleIds.begin(), triangleIds.end(), 0);
+  Pointer sharedPtr(new(TriangleBVH));
+  sharedPtr->build(triangles, std::move(triangleIds));
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+TriangleBVH::Pointer TriangleBVH::New(const TriangleGeom& triangles, const size_t* triangleIds, size_t numTriangles)
+{
+  Pointer sharedPtr(new(TriangleBVH));
+  sharedPtr->build(triangles, std::vector<size_t>(triangleIds, triangleIds + numTriangles));
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+TriangleBVH::Pointer TriangleBVH::New(const TriangleGeom& triangles, const int32_t* triangleIds, size_t numTriangles)
+{
+  Pointer sharedPtr(new(TriangleBVH));
+  sharedPtr->build(triangles, std::vector<size_t>(triangleIds, triangleIds + numTriangles));
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+QString TriangleBVH::getNameOfClass() const
+{
+  return QString("TriangleBVH");
+}
+
+// -----------------------------------------------------------------------------
+QString TriangleBVH::ClassName()
+{
+  return QString("TriangleBVH");
+}
+
+// -----------------------------------------------------------------------------
+size_t TriangleBVH::getNumberOfTriangles() const
+{
+  return m_TriangleIds.size();
+}
+
+// -----------------------------------------------------------------------------
+const std::vector<TriangleBVH::Node>& TriangleBVH::getNodes() const
+{
+  return m_Nodes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TriangleBVH::getBounds(float lowerLeft[3], float upperRight[3]) const
+{
+  for(size_t i = 0; i < 3; i++)
+  {
+    lowerLeft[i] = m_Nodes.empty() ? 0.0f : m_Nodes[0].lowerLeft[i];
+    upperRight[i] = m_Nodes.empty() ? 0.0f : m_Nodes[0].upperRight[i];
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TriangleBVH::build(const TriangleGeom& triangles, std::vector<size_t> triangleIds)
+{
+  m_Nodes.clear();
+  m_Coords.clear();
+  m_TriangleIds.clear();
+
+  size_t numTris = triangleIds.size();
+  if(numTris == 0)
+  {
+    return;
+  }
+
+  std::vector<float> coords(9 * numTris);
+  std::vector<Bounds> triBounds(numTris);
+  std::vector<float> centroids(3 * numTris);
+  Bounds meshBounds;
+  for(size_t i = 0; i < numTris; i++)
+  {
+    float* tri = coords.data() + 9 * i;
+    triangles.getVertCoordsAtTri(triangleIds[i], tri, tri + 3, tri + 6);
+    for(size_t j = 0; j < 3; j++)
+    {
+      triBounds[i].grow(tri + 3 * j);
+      centroids[3 * i + j] = (tri[j] + tri[3 + j] + tri[6 + j]) / 3.0f;
+    }
+    meshBounds.grow(triBounds[i]);
+  }
+
+  // Boxes are padded by a small fraction of the mesh size so flat boxes and rounding in the
+  // float slab test never reject a triangle that the double precision triangle test would hit
+  float diagonal = 0.0f;
+  for(size_t j = 0; j < 3; j++)
+  {
+    float extent = meshBounds.upperRight[j] - meshBounds.lowerLeft[j];
+    diagonal += extent * extent;
+  }
+  diagonal = std::sqrt(diagonal);
+  m_Tolerance = diagonal > 0.0f ? 1.0E-5f * diagonal : 1.0E-6f;
+  for(auto& bounds : triBounds)
+  {
+    for(size_t j = 0; j < 3; j++)
+    {
+      bounds.lowerLeft[j] -= m_Tolerance;
+      bounds.upperRight[j] += m_Tolerance;
+    }
+  }
+
+  std::vector<uint32_t> order(numTris);
+  std::iota(order.begin(), order.end(), 0);
+
+  m_Nodes.reserve(2 * numTris);
+  m_Nodes.push_back(Node{{0.0f, 0.0f, 0.0f}, 0, {0.0f, 0.0f, 0.0f}, static_cast<uint32_t>(numTris)});
+
+  std::vector<std::pair<uint32_t, size_t>> buildStack = {{0, 0}};
+  while(!buildStack.empty())
+  {
+    uint32_t nodeIndex = buildStack.back().first;
+    size_t depth = buildStack.back().second;
+    buildStack.pop_back();
+
+    uint32_t first = m_Nodes[nodeIndex].offset;
+    uint32_t count = m_Nodes[nodeIndex].count;
+
+    Bounds nodeBounds;
+    Bounds centroidBounds;
+    for(uint32_t i = first; i < first + count; i++)
+    {
+      nodeBounds.grow(triBounds[order[i]]);
+      centroidBounds.grow(centroids.data() + 3 * order[i]);
+    }
+    std::copy(nodeBounds.lowerLeft, nodeBounds.lowerLeft + 3, m_Nodes[nodeIndex].lowerLeft);
+    std::copy(nodeBounds.upperRight, nodeBounds.upperRight + 3, m_Nodes[nodeIndex].upperRight);
+
+    if(count <= 2 || depth >= k_MaxDepth)
+    {
+      continue;
+    }
+
+    // Binned surface area heuristic over all three axes
+    float bestCost = std::numeric_limits<float>::max();
+    size_t bestAxis = 0;
+    size_t bestSplit = 0;
+    for(size_t axis = 0; axis < 3; axis++)
+    {
+      float cMin = centroidBounds.lowerLeft[axis];
+      float extent = centroidBounds.upperRight[axis] - cMin;
+      if(extent <= 0.0f)
+      {
+        continue;
+      }
+      float binScale = static_cast<float>(k_NumBins) / extent;
+
+      std::array<Bounds, k_NumBins> binBounds;
+      std::array<uint32_t, k_NumBins> binCounts = {};
+      for(uint32_t i = first; i < first + count; i++)
+      {
+        size_t bin = std::min(k_NumBins - 1, static_cast<size_t>((centroids[3 * order[i] + axis] - cMin) * binScale));
+        binCounts[bin]++;
+        binBounds[bin].grow(triBounds[order[i]]);
+      }
+
+      std::array<float, k_NumBins> rightCosts = {};
+      Bounds right;
+      uint32_t rightCount = 0;
+      for(size_t bin = k_NumBins - 1; bin > 0; bin--)
+      {
+        right.grow(binBounds[bin]);
+        rightCount += binCounts[bin];
+        rightCosts[bin] = right.area() * static_cast<float>(rightCount);
+      }
+
+      Bounds left;
+      uint32_t leftCount = 0;
+      for(size_t split = 1; split < k_NumBins; split++)
+      {
+        left.grow(binBounds[split - 1]);
+        leftCount += binCounts[split - 1];
+        if(leftCount == 0 || leftCount == count)
+        {
+          continue;
+        }
+        float cost = left.area() * static_cast<float>(leftCount) + rightCosts[split];
+        if(cost < bestCost)
+        {
+          bestCost = cost;
+          bestAxis = axis;
+          bestSplit = split;
+        }
+      }
+    }
+
+    // A leaf costs one triangle test per triangle, a split one extra box test
+    float leafCost = nodeBounds.area() * static_cast<float>(count);
+    if(bestSplit == 0 || (bestCost + nodeBounds.area() >= leafCost && count <= k_MaxLeafSize))
+    {
+      continue;
+    }
+
+    float cMin = centroidBounds.lowerLeft[bestAxis];
+    float binScale = static_cast<float>(k_NumBins) / (centroidBounds.upperRight[bestAxis] - cMin);
+    auto middle = std::partition(order.begin() + first, order.begin() + first + count, [&](uint32_t tri) {
+      return std::min(k_NumBins - 1, static_cast<size_t>((centroids[3 * tri + bestAxis] - cMin) * binScale)) < bestSplit;
+    });
+    uint32_t leftCount = static_cast<uint32_t>(middle - (order.begin() + first));
+    if(leftCount == 0 || leftCount == count)
+    {
+      continue;
+    }
+
+    uint32_t leftChild = static_cast<uint32_t>(m_Nodes.size());
+    m_Nodes.push_back(Node{{0.0f, 0.0f, 0.0f}, first, {0.0f, 0.0f, 0.0f}, leftCount});
+    m_Nodes.push_back(Node{{0.0f, 0.0f, 0.0f}, first + leftCount, {0.0f, 0.0f, 0.0f}, count - leftCount});
+    m_Nodes[nodeIndex].offset = leftChild;
+    m_Nodes[nodeIndex].count = 0;
+    buildStack.emplace_back(leftChild, depth + 1);
+    buildStack.emplace_back(leftChild + 1, depth + 1);
+  }
+  m_Nodes.shrink_to_fit();
+
+  // Store the triangles in leaf order so each leaf reads one contiguous block
+  m_Coords.resize(9 * numTris);
+  m_TriangleIds.resize(numTris);
+  for(size_t i = 0; i < numTris; i++)
+  {
+    std::copy(coords.begin() + 9 * order[i], coords.begin() + 9 * order[i] + 9, m_Coords.begin() + 9 * i);
+    m_TriangleIds[i] = triangleIds[order[i]];
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::RayHit TriangleBVH::findFirstHit(const float origin[3], const float direction[3], float maxDistance) const
+{
+  RayHit hit;
+  if(m_Nodes.empty())
+  {
+    return hit;
+  }
+
+  float invDir[3];
+  InverseDirection(direction, invDir);
+  double dOrigin[3] = {origin[0], origin[1], origin[2]};
+  double dDirection[3] = {direction[0], direction[1], direction[2]};
+  double bestT = static_cast<double>(maxDistance);
+
+  float tEntry = 0.0f;
+  if(!RayIntersectsNode(m_Nodes[0], origin, invDir, maxDistance, tEntry))
+  {
+    return hit;
+  }
+
+  StackEntry stack[k_StackSize];
+  size_t stackSize = 0;
+  stack[stackSize++] = {0, tEntry};
+  while(stackSize > 0)
+  {
+    const StackEntry entry = stack[--stackSize];
+    if(static_cast<double>(entry.key) > bestT)
+    {
+      continue;
+    }
+    const Node& node = m_Nodes[entry.node];
+    if(node.count > 0)
+    {
+      for(uint32_t i = node.offset; i < node.offset + node.count; i++)
+      {
+        double t = -1.0, u = 0.0, v = 0.0;
+        if(IntersectTriangle(m_Coords.data() + 9 * i, dOrigin, dDirection, 0.0, t, u, v) != TriangleHit::Miss && t >= 0.0 && t <= bestT)
+        {
+          bestT = t;
+          hit.triangleId = m_TriangleIds[i];
+          hit.distance = static_cast<float>(t);
+          hit.u = static_cast<float>(u);
+          hit.v = static_cast<float>(v);
+        }
+      }
+      continue;
+    }
+
+    float tMax = static_cast<float>(std::min(bestT, static_cast<double>(std::numeric_limits<float>::max())));
+    float tLeft = 0.0f;
+    float tRight = 0.0f;
+    bool hitLeft = RayIntersectsNode(m_Nodes[node.offset], origin, invDir, tMax, tLeft);
+    bool hitRight = RayIntersectsNode(m_Nodes[node.offset + 1], origin, invDir, tMax, tRight);
+    // Push the farther child first so the nearer one is visited first and can shrink bestT
+    if(hitLeft && hitRight)
+    {
+      bool leftFirst = tLeft <= tRight;
+      stack[stackSize++] = {leftFirst ? node.offset + 1 : node.offset, leftFirst ? tRight : tLeft};
+      stack[stackSize++] = {leftFirst ? node.offset : node.offset + 1, leftFirst ? tLeft : tRight};
+    }
+    else if(hitLeft)
+    {
+      stack[stackSize++] = {node.offset, tLeft};
+    }
+    else if(hitRight)
+    {
+      stack[stackSize++] = {node.offset + 1, tRight};
+    }
+  }
+  return hit;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TriangleBVH::findFirstHits(const float* origins, const float* directions, size_t numRays, RayHit* hits, float maxDistance) const
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numRays);
+  dataAlg.execute(TriangleBVHFirstHitImpl(this, origins, directions, hits, maxDistance));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::ClosestPoint TriangleBVH::findClosestPoint(const float point[3]) const
+{
+  size_t position = 0;
+  return findClosestPoint(point, position);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::ClosestPoint TriangleBVH::findClosestPoint(const float point[3], size_t& position) const
+{
+  ClosestPoint closest;
+  if(m_Nodes.empty())
+  {
+    return closest;
+  }
+
+  double p[3] = {point[0], point[1], point[2]};
+  double bestDist2 = std::numeric_limits<double>::max();
+  double bestPoint[3] = {0.0, 0.0, 0.0};
+
+  StackEntry stack[k_StackSize];
+  size_t stackSize = 0;
+  stack[stackSize++] = {0, SquaredDistanceToNode(m_Nodes[0], point)};
+  while(stackSize > 0)
+  {
+    const StackEntry entry = stack[--stackSize];
+    if(static_cast<double>(entry.key) > bestDist2)
+    {
+      continue;
+    }
+    const Node& node = m_Nodes[entry.node];
+    if(node.count > 0)
+    {
+      for(uint32_t i = node.offset; i < node.offset + node.count; i++)
+      {
+        double candidate[3];
+        ClosestPointOnTriangle(m_Coords.data() + 9 * i, p, candidate);
+        double d[3];
+        Subtract(candidate, p, d);
+        double dist2 = Dot(d, d);
+        if(dist2 < bestDist2)
+        {
+          bestDist2 = dist2;
+          std::copy(candidate, candidate + 3, bestPoint);
+          closest.triangleId = m_TriangleIds[i];
+          position = i;
+        }
+      }
+      continue;
+    }
+
+    float dLeft = SquaredDistanceToNode(m_Nodes[node.offset], point);
+    float dRight = SquaredDistanceToNode(m_Nodes[node.offset + 1], point);
+    bool leftFirst = dLeft <= dRight;
+    stack[stackSize++] = {leftFirst ? node.offset + 1 : node.offset, leftFirst ? dRight : dLeft};
+    stack[stackSize++] = {leftFirst ? node.offset : node.offset + 1, leftFirst ? dLeft : dRight};
+  }
+
+  for(size_t i = 0; i < 3; i++)
+  {
+    closest.point[i] = static_cast<float>(bestPoint[i]);
+  }
+  closest.distance = static_cast<float>(std::sqrt(bestDist2));
+  return closest;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TriangleBVH::findClosestPoints(const float* points, size_t numPoints, ClosestPoint* closestPoints) const
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numPoints);
+  dataAlg.execute(TriangleBVHClosestPointImpl(this, points, closestPoints));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool TriangleBVH::countCrossings(const double point[3], const double direction[3], size_t& crossings) const
+{
+  float origin[3] = {static_cast<float>(point[0]), static_cast<float>(point[1]), static_cast<float>(point[2])};
+  float fDirection[3] = {static_cast<float>(direction[0]), static_cast<float>(direction[1]), static_cast<float>(direction[2])};
+  float invDir[3];
+  InverseDirection(fDirection, invDir);
+  double tolerance = static_cast<double>(m_Tolerance);
+
+  crossings = 0;
+  StackEntry stack[k_StackSize];
+  size_t stackSize = 0;
+  stack[stackSize++] = {0, 0.0f};
+  while(stackSize > 0)
+  {
+    const Node& node = m_Nodes[stack[--stackSize].node];
+    float tEntry = 0.0f;
+    if(!RayIntersectsNode(node, origin, invDir, std::numeric_limits<float>::max(), tEntry))
+    {
+      continue;
+    }
+    if(node.count == 0)
+    {
+      stack[stackSize++] = {node.offset + 1, 0.0f};
+      stack[stackSize++] = {node.offset, 0.0f};
+      continue;
+    }
+    for(uint32_t i = node.offset; i < node.offset + node.count; i++)
+    {
+      double t = -1.0, u = 0.0, v = 0.0;
+      TriangleHit result = IntersectTriangle(m_Coords.data() + 9 * i, point, direction, tolerance, t, u, v);
+      if(result == TriangleHit::Miss || t <= 0.0)
+      {
+        continue;
+      }
+      if(result == TriangleHit::Degenerate)
+      {
+        return false;
+      }
+      crossings++;
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+char TriangleBVH::findContainment(const float point[3]) const
+{
+  if(m_Nodes.empty())
+  {
+    return 'o';
+  }
+  const Node& root = m_Nodes[0];
+  for(size_t i = 0; i < 3; i++)
+  {
+    if(point[i] < root.lowerLeft[i] || point[i] > root.upperRight[i])
+    {
+      return 'o';
+    }
+  }
+
+  // Points on the surface are reported by the feature they touch
+  size_t pos = 0;
+  ClosestPoint closest = findClosestPoint(point, pos);
+  if(closest.distance <= m_Tolerance)
+  {
+    double a[3], b[3], c[3];
+    LoadTriangle(m_Coords.data() + 9 * pos, a, b, c);
+    double p[3] = {point[0], point[1], point[2]};
+    double tol2 = static_cast<double>(m_Tolerance) * static_cast<double>(m_Tolerance);
+    double da[3], db[3], dc[3];
+    Subtract(p, a, da);
+    Subtract(p, b, db);
+    Subtract(p, c, dc);
+    if(Dot(da, da) <= tol2 || Dot(db, db) <= tol2 || Dot(dc, dc) <= tol2)
+    {
+      return 'V';
+    }
+    if(SquaredDistanceToSegment(p, a, b) <= tol2 || SquaredDistanceToSegment(p, b, c) <= tol2 || SquaredDistanceToSegment(p, c, a) <= tol2)
+    {
+      return 'E';
+    }
+    return 'F';
+  }
+
+  // Parity of the crossings along a ray that does not graze an edge, vertex or face plane
+  double p[3] = {point[0], point[1], point[2]};
+  size_t crossings = 0;
+  for(const auto& direction : k_ContainmentDirections)
+  {
+    if(countCrossings(p, direction.data(), crossings))
+    {
+      break;
+    }
+  }
+  return (crossings % 2) == 1 ? 'i' : 'o';
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TriangleBVH::findContainments(const float* points, size_t numPoints, char* codes) const
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numPoints);
+  dataAlg.execute(TriangleBVHContainmentImpl(this, points, codes));
+}
@@ -0,0 +1,238 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+
+class TriangleGeom;
+
+/**
+ * @class TriangleBVH TriangleBVH.h SIMPLib/Geometry/TriangleBVH.h
+ * @brief Bounding volume hierarchy over the triangles of a TriangleGeom.
+ *
+ * The hierarchy is built with a binned surface area heuristic and stored as a flat
+ * array of nodes; the children of an interior node are always adjacent. The triangle
+ * coordinates are copied into leaf order when the hierarchy is built, so queries do not
+ * touch the geometry afterwards and the hierarchy must be rebuilt if the vertices or
+ * triangles of the geometry change.
+ *
+ * All queries are const and may be called from several threads at once. The batch
+ * versions split the queries across threads with ParallelDataAlgorithm.
+ */
+class SIMPLib_EXPORT TriangleBVH
+{
+public:
+  using Self = TriangleBVH;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+  static Pointer NullPointer();
+
+  /**
+   * @brief New Builds the hierarchy over every triangle of the geometry
+   * @param triangles
+   * @return
+   */
+  static Pointer New(const TriangleGeom& triangles);
+
+  /**
+   * @brief New Builds the hierarchy over a subset of the triangles, e.g. the faces of one feature
+   * @param triangles
+   * @param triangleIds
+   * @param numTriangles
+   * @return
+   */
+  static Pointer New(const TriangleGeom& triangles, const size_t* triangleIds, size_t numTriangles);
+  static Pointer New(const TriangleGeom& triangles, const int32_t* triangleIds, size_t numTriangles);
+
+  /**
+   * @brief Returns the name of the class for TriangleBVH
+   */
+  QString getNameOfClass() const;
+  /**
+   * @brief Returns the name of the class for TriangleBVH
+   */
+  static QString ClassName();
+
+  virtual ~TriangleBVH();
+
+  static constexpr size_t InvalidTriangle = std::numeric_limits<size_t>::max();
+
+  /**
+   * @brief Node of the flattened hierarchy. Interior nodes have a count of 0 and store the
+   * index of their first child, the second child follows it directly. Leaves store the
+   * position of their first triangle in leaf order.
+   */
+  struct Node
+  {
+    float lowerLeft[3];
+    uint32_t offset;
+    float upperRight[3];
+    uint32_t count;
+  };
+
+  /**
+   * @brief Result of a ray query. triangleId is InvalidTriangle if nothing was hit.
+   */
+  struct RayHit
+  {
+    size_t triangleId = InvalidTriangle;
+    float distance = std::numeric_limits<float>::max();
+    float u = 0.0f;
+    float v = 0.0f;
+  };
+
+  /**
+   * @brief Result of a closest point query. triangleId is InvalidTriangle if the hierarchy is empty.
+   */
+  struct ClosestPoint
+  {
+    size_t triangleId = InvalidTriangle;
+    float point[3] = {0.0f, 0.0f, 0.0f};
+    float distance = std::numeric_limits<float>::max();
+  };
+
+  /**
+   * @brief getNumberOfTriangles
+   * @return
+   */
+  size_t getNumberOfTriangles() const;
+
+  /**
+   * @brief getNodes
+   * @return
+   */
+  const std::vector<Node>& getNodes() const;
+
+  /**
+   * @brief getBounds Returns the bounding box of every triangle in the hierarchy
+   * @param lowerLeft
+   * @param upperRight
+   */
+  void getBounds(float lowerLeft[3], float upperRight[3]) const;
+
+  /**
+   * @brief findFirstHit Finds the nearest triangle hit by the ray origin + t * direction with 0 <= t <= maxDistance.
+   * The direction does not need to be normalized; distance is reported in units of its length.
+   * @param origin
+   * @param direction
+   * @param maxDistance
+   * @return
+   */
+  RayHit findFirstHit(const float origin[3], const float direction[3], float maxDistance = std::numeric_limits<float>::max()) const;
+
+  /**
+   * @brief findFirstHits Batch version of findFirstHit for numRays rays stored as xyz triplets
+   * @param origins
+   * @param directions
+   * @param numRays
+   * @param hits Must hold numRays entries
+   * @param maxDistance
+   */
+  void findFirstHits(const float* origins, const float* directions, size_t numRays, RayHit* hits, float maxDistance = std::numeric_limits<float>::max()) const;
+
+  /**
+   * @brief findClosestPoint Finds the point on the triangles that is closest to the query point
+   * @param point
+   * @return
+   */
+  ClosestPoint findClosestPoint(const float point[3]) const;
+
+  /**
+   * @brief findClosestPoints Batch version of findClosestPoint for numPoints points stored as xyz triplets
+   * @param points
+   * @param numPoints
+   * @param closestPoints Must hold numPoints entries
+   */
+  void findClosestPoints(const float* points, size_t numPoints, ClosestPoint* closestPoints) const;
+
+  /**
+   * @brief findContainment Classifies a point against the closed surface formed by the triangles.
+   * The codes match GeometryMath::PointInPolyhedron: 'i' inside, 'o' outside, and 'V', 'E' or 'F'
+   * if the point lies on a vertex, edge or face of the surface.
+   * @param point
+   * @return
+   */
+  char findContainment(const float point[3]) const;
+
+  /**
+   * @brief findContainments Batch version of findContainment for numPoints points stored as xyz triplets
+   * @param points
+   * @param numPoints
+   * @param codes Must hold numPoints entries
+   */
+  void findContainments(const float* points, size_t numPoints, char* codes) const;
+
+protected:
+  TriangleBVH();
+
+  /**
+   * @brief build Copies the triangles out of the geometry and builds the hierarchy
+   * @param triangles
+   * @param triangleIds
+   */
+  void build(const TriangleGeom& triangles, std::vector<size_t> triangleIds);
+
+private:
+  /**
+   * @brief countCrossings Counts the triangles crossed by the ray point + t * direction, t > 0.
+   * @return false if the ray grazed an edge, a vertex or the plane of a triangle and the count cannot be trusted
+   */
+  bool countCrossings(const double point[3], const double direction[3], size_t& crossings) const;
+
+  /**
+   * @brief findClosestPoint Also returns the position of the closest triangle in leaf order
+   */
+  ClosestPoint findClosestPoint(const float point[3], size_t& position) const;
+
+  std::vector<Node> m_Nodes;
+  std::vector<float> m_Coords;
+  std::vector<size_t> m_TriangleIds;
+  float m_Tolerance = 0.0f;
+
+public:
+  TriangleBVH(const TriangleBVH&) = delete;            // Copy Constructor Not Implemented
+  TriangleBVH(TriangleBVH&&) = delete;                 // Move Constructor Not Implemented
+  TriangleBVH& operator=(const TriangleBVH&) = delete; // Copy Assignment Not Implemented
+  TriangleBVH& operator=(TriangleBVH&&) = delete;      // Move Assignment Not Implemented
+};
@@ -129,6 +129,7 @@ TriangleGeom::TriangleGeom()
   m_EdgeList = SharedEdgeList::NullPointer();
   m_UnsharedEdgeList = SharedEdgeList::NullPointer();
   m_TrianglesContainingVert = ElementDynamicList::NullPointer();
+  m_BoundingVolumeHierarchy = TriangleBVH::NullPointer();
   m_TriangleNeighbors = ElementDynamicList::NullPointer();
   m_TriangleCentroids = FloatArrayType::NullPointer();
   m_TriangleSizes = FloatArrayType::NullPointer();
@@ -375,6 +376,35 @@ void TriangleGeom::deleteElementCentroids()
   m_TriangleCentroids = FloatArrayType::NullPointer();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int TriangleGeom::findBoundingVolumeHierarchy()
+{
+  m_BoundingVolumeHierarchy = TriangleBVH::New(*this);
+  if(m_BoundingVolumeHierarchy.get() == nullptr)
+  {
+    return -1;
+  }
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::Pointer TriangleGeom::getBoundingVolumeHierarchy() const
+{
+  return m_BoundingVolumeHierarchy;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TriangleGeom::deleteBoundingVolumeHierarchy()
+{
+  m_BoundingVolumeHierarchy = TriangleBVH::NullPointer();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -750,6 +780,12 @@ IGeometry::Pointer TriangleGeom::deepCopy(bool forceNoAllocate) const
   copy->setElementCentroids(elementCentroids);
   copy->setElementSizes(elementSizes);
   copy->setSpatialDimensionality(getSpatialDimensionality());
+  // The hierarchy holds its own copy of the coordinates and is never modified, so the copy can share it. Either
+  // geometry drops its reference as soon as its vertices or triangles change through the geometry.
+  if(!forceNoAllocate)
+  {
+    copy->m_BoundingVolumeHierarchy = m_BoundingVolumeHierarchy;
+  }
 
   return copy;
 }
@@ -763,9 +799,15 @@ IGeometry::Pointer TriangleGeom::deepCopy(bool forceNoAllocate) const
 #undef GEOM_CLASS_NAME
 #endif
 #define GEOM_CLASS_NAME TriangleGeom
+// Replacing, resizing or editing the vertices or triangles through the geometry drops the bounding volume
+// hierarchy built from them
+#define GEOM_VERTICES_CHANGED() deleteBoundingVolumeHierarchy()
+#define GEOM_TRIANGLES_CHANGED() deleteBoundingVolumeHierarchy()
 #include "SIMPLib/Geometry/SharedEdgeOps.cpp"
 #include "SIMPLib/Geometry/SharedTriOps.cpp"
 #include "SIMPLib/Geometry/SharedVertexOps.cpp"
+#undef GEOM_TRIANGLES_CHANGED
+#undef GEOM_VERTICES_CHANGED
 
 // -----------------------------------------------------------------------------
 TriangleGeom::Pointer TriangleGeom::NullPointer()
@@ -42,6 +42,7 @@
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataContainers/AttributeMatrix.h"
 #include "SIMPLib/Geometry/IGeometry2D.h"
+#include "SIMPLib/Geometry/TriangleBVH.h"
 
 /**
  * @brief The TriangleGeom class represents a collection of triangles
@@ -274,6 +275,26 @@ public:
    */
   void deleteElementCentroids() override;
 
+  /**
+   * @brief findBoundingVolumeHierarchy Builds the bounding volume hierarchy used for ray,
+   * closest point and containment queries. setVertices(), resizeVertexList(), setCoords(),
+   * setTriangles(), resizeTriList() and setVertsAtTri() delete it; values written directly into
+   * the vertex or triangle arrays are not tracked and require a call to deleteBoundingVolumeHierarchy().
+   * @return
+   */
+  int findBoundingVolumeHierarchy();
+
+  /**
+   * @brief getBoundingVolumeHierarchy
+   * @return
+   */
+  TriangleBVH::Pointer getBoundingVolumeHierarchy() const;
+
+  /**
+   * @brief deleteBoundingVolumeHierarchy
+   */
+  void deleteBoundingVolumeHierarchy();
+
   /**
    * @brief getParametricCenter
    * @param pCoords
@@ -512,6 +533,7 @@ private:
   SharedEdgeList::Pointer m_UnsharedEdgeList;
   SharedTriList::Pointer m_TriList;
   ElementDynamicList::Pointer m_TrianglesContainingVert;
+  TriangleBVH::Pointer m_BoundingVolumeHierarchy;
   ElementDynamicList::Pointer m_TriangleNeighbors;
   FloatArrayType::Pointer m_TriangleCentroids;
   FloatArrayType::Pointer m_TriangleSizes;
@@ -59,6 +59,7 @@ VertexGeom::VertexGeom()
   m_SpatialDimensionality = 3;
   m_VertexList = VertexGeom::CreateSharedVertexList(0);
   m_VertexSizes = FloatArrayType::NullPointer();
+  m_KdTree = VertexKdTree::NullPointer();
   m_ProgressCounter = 0;
 }
 
@@ -104,6 +105,35 @@ VertexGeom::Pointer VertexGeom::CreateGeometry(const SharedVertexList::Pointer&
   return ptr;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VertexGeom::findKdTree()
+{
+  m_KdTree = VertexKdTree::New(*this);
+  if(m_KdTree.get() == nullptr)
+  {
+    return -1;
+  }
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VertexKdTree::Pointer VertexGeom::getKdTree() const
+{
+  return m_KdTree;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexGeom::deleteKdTree()
+{
+  m_KdTree = VertexKdTree::NullPointer();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -479,7 +509,10 @@ IGeometry::Pointer VertexGeom::deepCopy(bool forceNoAllocate) const
 #endif
 
 #define GEOM_CLASS_NAME VertexGeom
+// Replacing, resizing or editing the vertices through the geometry drops the k-d tree built from them
+#define GEOM_VERTICES_CHANGED() deleteKdTree()
 #include "SIMPLib/Geometry/SharedVertexOps.cpp"
+#undef GEOM_VERTICES_CHANGED
 
 // -----------------------------------------------------------------------------
 VertexGeom::Pointer VertexGeom::NullPointer()
@@ -44,6 +44,7 @@
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataContainers/AttributeMatrix.h"
 #include "SIMPLib/Geometry/IGeometry.h"
+#include "SIMPLib/Geometry/VertexKdTree.h"
 
 /**
  * @brief The VertexGeom class represents a point cloud
@@ -158,6 +159,26 @@ public:
    */
   size_t getNumberOfVertices() const;
 
+  /**
+   * @brief findKdTree Builds the k-d tree used for box, radius and nearest neighbor queries.
+   * setVertices(), resizeVertexList() and setCoords() delete the tree. Coordinates written
+   * through getVertexPointer() or the vertex list are not detected; callers that write them
+   * must call deleteKdTree() or rebuild the tree. deepCopy() does not copy the tree.
+   * @return
+   */
+  int findKdTree();
+
+  /**
+   * @brief getKdTree
+   * @return
+   */
+  VertexKdTree::Pointer getKdTree() const;
+
+  /**
+   * @brief deleteKdTree
+   */
+  void deleteKdTree();
+
   // -----------------------------------------------------------------------------
   // Inherited from IGeometry
   // -----------------------------------------------------------------------------
@@ -341,6 +362,7 @@ protected:
 private:
   SharedVertexList::Pointer m_VertexList;
   FloatArrayType::Pointer m_VertexSizes;
+  VertexKdTree::Pointer m_KdTree;
 
 public:
   VertexGeom(const VertexGeom&) = delete;            // Copy Constructor Not Implemented
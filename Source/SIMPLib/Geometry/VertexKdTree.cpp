@@ -0,0 +1,639 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "VertexKdTree.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "SIMPLib/Geometry/VertexGeom.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+namespace
+{
+constexpr size_t k_MaxLeafSize = 16;
+// The levels above this depth are split one level at a time with the nodes of a level in
+// parallel; the subtrees below it are then built independently, one task per subtree.
+// Box queries search the subtrees at this depth in parallel as well.
+constexpr size_t k_ParallelDepth = 6;
+
+struct TreePoint
+{
+  float coords[3];
+  size_t vertexId;
+};
+
+struct BuildRange
+{
+  size_t node;
+  size_t begin;
+  size_t end;
+  size_t depth;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+inline BuildRange LeftChild(const BuildRange& range)
+{
+  return {2 * range.node + 1, range.begin, range.begin + (range.end - range.begin) / 2, range.depth + 1};
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+inline BuildRange RightChild(const BuildRange& range)
+{
+  return {2 * range.node + 2, range.begin + (range.end - range.begin) / 2, range.end, range.depth + 1};
+}
+
+// -----------------------------------------------------------------------------
+// Splits the points of an interior node at their median along the axis of largest extent
+// -----------------------------------------------------------------------------
+void SplitNode(TreePoint* points, const BuildRange& range, float* splitValues, uint8_t* splitAxes)
+{
+  float lowerLeft[3] = {std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
+  float upperRight[3] = {std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()};
+  for(size_t i = range.begin; i < range.end; i++)
+  {
+    for(size_t d = 0; d < 3; d++)
+    {
+      lowerLeft[d] = std::min(lowerLeft[d], points[i].coords[d]);
+      upperRight[d] = std::max(upperRight[d], points[i].coords[d]);
+    }
+  }
+
+  uint8_t axis = 0;
+  for(uint8_t d = 1; d < 3; d++)
+  {
+    if(upperRight[d] - lowerLeft[d] > upperRight[axis] - lowerLeft[axis])
+    {
+      axis = d;
+    }
+  }
+
+  size_t middle = range.begin + (range.end - range.begin) / 2;
+  std::nth_element(points + range.begin, points + middle, points + range.end, [axis](const TreePoint& a, const TreePoint& b) { return a.coords[axis] < b.coords[axis]; });
+  splitValues[range.node] = points[middle].coords[axis];
+  splitAxes[range.node] = axis;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BuildSubtree(TreePoint* points, const BuildRange& range, size_t leafDepth, float* splitValues, uint8_t* splitAxes)
+{
+  if(range.depth >= leafDepth)
+  {
+    return;
+  }
+  SplitNode(points, range, splitValues, splitAxes);
+  BuildSubtree(points, LeftChild(range), leafDepth, splitValues, splitAxes);
+  BuildSubtree(points, RightChild(range), leafDepth, splitValues, splitAxes);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+inline float SquaredDistance(const float* a, const float* b)
+{
+  float dx = a[0] - b[0];
+  float dy = a[1] - b[1];
+  float dz = a[2] - b[2];
+  return dx * dx + dy * dy + dz * dz;
+}
+} // namespace
+
+/**
+ * @brief The VertexKdTreeBuildImpl class implements a threaded algorithm that either splits every node
+ * of one level of the tree or builds every subtree below that level
+ */
+class VertexKdTreeBuildImpl
+{
+public:
+  VertexKdTreeBuildImpl(TreePoint* points, const std::vector<BuildRange>& ranges, float* splitValues, uint8_t* splitAxes, size_t leafDepth, bool buildSubtrees)
+  : m_Points(points)
+  , m_Ranges(ranges)
+  , m_SplitValues(splitValues)
+  , m_SplitAxes(splitAxes)
+  , m_LeafDepth(leafDepth)
+  , m_BuildSubtrees(buildSubtrees)
+  {
+  }
+  virtual ~VertexKdTreeBuildImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      if(m_BuildSubtrees)
+      {
+        BuildSubtree(m_Points, m_Ranges[i], m_LeafDepth, m_SplitValues, m_SplitAxes);
+      }
+      else
+      {
+        SplitNode(m_Points, m_Ranges[i], m_SplitValues, m_SplitAxes);
+      }
+    }
+  }
+
+private:
+  TreePoint* m_Points;
+  const std::vector<BuildRange>& m_Ranges;
+  float* m_SplitValues;
+  uint8_t* m_SplitAxes;
+  size_t m_LeafDepth;
+  bool m_BuildSubtrees;
+};
+
+/**
+ * @brief The VertexKdTreeBoxImpl class implements a threaded algorithm that searches several subtrees for the vertices inside a box
+ */
+class VertexKdTreeBoxImpl
+{
+public:
+  VertexKdTreeBoxImpl(const VertexKdTree* tree, const std::vector<VertexKdTree::NodeRange>& subtrees, const float* lowerLeft, const float* upperRight, std::vector<std::vector<size_t>>& vertexIds)
+  : m_Tree(tree)
+  , m_Subtrees(subtrees)
+  , m_LowerLeft(lowerLeft)
+  , m_UpperRight(upperRight)
+  , m_VertexIds(vertexIds)
+  {
+  }
+  virtual ~VertexKdTreeBoxImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      m_Tree->findInBox(m_Subtrees[i], m_LowerLeft, m_UpperRight, m_VertexIds[i]);
+    }
+  }
+
+private:
+  const VertexKdTree* m_Tree;
+  const std::vector<VertexKdTree::NodeRange>& m_Subtrees;
+  const float* m_LowerLeft;
+  const float* m_UpperRight;
+  std::vector<std::vector<size_t>>& m_VertexIds;
+};
+
+/**
+ * @brief The VertexKdTreeRadiusImpl class implements a threaded algorithm that finds the vertices within a radius of each point
+ */
+class VertexKdTreeRadiusImpl
+{
+public:
+  VertexKdTreeRadiusImpl(const VertexKdTree* tree, const float* points, float radius, std::vector<std::vector<size_t>>& vertexIds)
+  : m_Tree(tree)
+  , m_Points(points)
+  , m_Radius(radius)
+  , m_VertexIds(vertexIds)
+  {
+  }
+  virtual ~VertexKdTreeRadiusImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      m_VertexIds[i] = m_Tree->findInRadius(m_Points + 3 * i, m_Radius);
+    }
+  }
+
+private:
+  const VertexKdTree* m_Tree;
+  const float* m_Points;
+  float m_Radius;
+  std::vector<std::vector<size_t>>& m_VertexIds;
+};
+
+/**
+ * @brief The VertexKdTreeNearestImpl class implements a threaded algorithm that finds the k nearest vertices to each point
+ */
+class VertexKdTreeNearestImpl
+{
+public:
+  VertexKdTreeNearestImpl(const VertexKdTree* tree, const float* points, size_t k, size_t* vertexIds, float* distances)
+  : m_Tree(tree)
+  , m_Points(points)
+  , m_K(k)
+  , m_VertexIds(vertexIds)
+  , m_Distances(distances)
+  {
+  }
+  virtual ~VertexKdTreeNearestImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      m_Tree->findNearest(m_Points + 3 * i, m_K, m_VertexIds + m_K * i, m_Distances != nullptr ? m_Distances + m_K * i : nullptr);
+    }
+  }
+
+private:
+  const VertexKdTree* m_Tree;
+  const float* m_Points;
+  size_t m_K;
+  size_t* m_VertexIds;
+  float* m_Distances;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VertexKdTree::VertexKdTree() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VertexKdTree::~VertexKdTree() = default;
+
+// -----------------------------------------------------------------------------
+VertexKdTree::Pointer VertexKdTree::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
+
+// -----------------------------------------------------------------------------
+VertexKdTree::Pointer VertexKdTree::New(const VertexGeom& vertices)
+{
+  Pointer sharedPtr(new(VertexKdTree));
+  size_t numVertices = vertices.getNumberOfVertices();
+  sharedPtr->build(numVertices > 0 ? vertices.getVertexPointer(0) : nullptr, numVertices);
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+VertexKdTree::Pointer VertexKdTree::New(const float* points, size_t numPoints)
+{
+  Pointer sharedPtr(new(VertexKdTree));
+  sharedPtr->build(points, numPoints);
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+QString VertexKdTree::getNameOfClass() const
+{
+  return QString("VertexKdTree");
+}
+
+// -----------------------------------------------------------------------------
+QString VertexKdTree::ClassName()
+{
+  return QString("VertexKdTree");
+}
+
+// -----------------------------------------------------------------------------
+size_t VertexKdTree::getNumberOfVertices() const
+{
+  return m_VertexIds.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexKdTree::getBounds(float lowerLeft[3], float upperRight[3]) const
+{
+  for(size_t i = 0; i < 3; i++)
+  {
+    lowerLeft[i] = m_LowerLeft[i];
+    upperRight[i] = m_UpperRight[i];
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexKdTree::build(const float* points, size_t numPoints)
+{
+  m_Coords.clear();
+  m_VertexIds.clear();
+  m_SplitValues.clear();
+  m_SplitAxes.clear();
+  m_LeafDepth = 0;
+  std::fill_n(m_LowerLeft, 3, 0.0f);
+  std::fill_n(m_UpperRight, 3, 0.0f);
+
+  if(points == nullptr || numPoints == 0)
+  {
+    return;
+  }
+
+  std::vector<TreePoint> treePoints(numPoints);
+  std::fill_n(m_LowerLeft, 3, std::numeric_limits<float>::max());
+  std::fill_n(m_UpperRight, 3, std::numeric_limits<float>::lowest());
+  for(size_t i = 0; i < numPoints; i++)
+  {
+    for(size_t d = 0; d < 3; d++)
+    {
+      float value = points[3 * i + d];
+      treePoints[i].coords[d] = value;
+      m_LowerLeft[d] = std::min(m_LowerLeft[d], value);
+      m_UpperRight[d] = std::max(m_UpperRight[d], value);
+    }
+    treePoints[i].vertexId = i;
+  }
+
+  // Every node at a given depth holds either floor or ceil of numPoints / 2^depth points,
+  // so all leaves sit at the same depth
+  while(((numPoints - 1) >> m_LeafDepth) + 1 > k_MaxLeafSize)
+  {
+    m_LeafDepth++;
+  }
+  size_t numInteriorNodes = (static_cast<size_t>(1) << m_LeafDepth) - 1;
+  m_SplitValues.resize(numInteriorNodes, 0.0f);
+  m_SplitAxes.resize(numInteriorNodes, 0);
+
+  std::vector<BuildRange> level = {{0, 0, numPoints, 0}};
+  ParallelDataAlgorithm dataAlg;
+  while(!level.empty() && level.front().depth < m_LeafDepth)
+  {
+    bool buildSubtrees = level.front().depth >= k_ParallelDepth;
+    dataAlg.setRange(0, level.size());
+    dataAlg.execute(VertexKdTreeBuildImpl(treePoints.data(), level, m_SplitValues.data(), m_SplitAxes.data(), m_LeafDepth, buildSubtrees));
+    if(buildSubtrees)
+    {
+      break;
+    }
+
+    std::vector<BuildRange> nextLevel;
+    nextLevel.reserve(2 * level.size());
+    for(const auto& range : level)
+    {
+      nextLevel.push_back(LeftChild(range));
+      nextLevel.push_back(RightChild(range));
+    }
+    level.swap(nextLevel);
+  }
+
+  m_Coords.resize(3 * numPoints);
+  m_VertexIds.resize(numPoints);
+  for(size_t i = 0; i < numPoints; i++)
+  {
+    std::copy_n(treePoints[i].coords, 3, m_Coords.data() + 3 * i);
+    m_VertexIds[i] = treePoints[i].vertexId;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<VertexKdTree::NodeRange> VertexKdTree::findSubtrees(const float lowerLeft[3], const float upperRight[3], size_t depth) const
+{
+  std::vector<NodeRange> subtrees;
+  if(m_VertexIds.empty())
+  {
+    return subtrees;
+  }
+
+  std::vector<NodeRange> stack = {{0, 0, m_VertexIds.size(), 0}};
+  while(!stack.empty())
+  {
+    NodeRange range = stack.back();
+    stack.pop_back();
+    if(range.depth >= depth || range.depth >= m_LeafDepth)
+    {
+      subtrees.push_back(range);
+      continue;
+    }
+
+    size_t middle = range.begin + (range.end - range.begin) / 2;
+    uint8_t axis = m_SplitAxes[range.node];
+    float split = m_SplitValues[range.node];
+    if(lowerLeft[axis] <= split)
+    {
+      stack.push_back({2 * range.node + 1, range.begin, middle, range.depth + 1});
+    }
+    if(upperRight[axis] >= split)
+    {
+      stack.push_back({2 * range.node + 2, middle, range.end, range.depth + 1});
+    }
+  }
+  return subtrees;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<size_t> VertexKdTree::findInBox(const float lowerLeft[3], const float upperRight[3]) const
+{
+  std::vector<size_t> vertexIds;
+  for(size_t d = 0; d < 3; d++)
+  {
+    if(m_VertexIds.empty() || lowerLeft[d] > m_UpperRight[d] || upperRight[d] < m_LowerLeft[d])
+    {
+      return vertexIds;
+    }
+  }
+
+  std::vector<NodeRange> subtrees = findSubtrees(lowerLeft, upperRight, k_ParallelDepth);
+  std::vector<std::vector<size_t>> subtreeIds(subtrees.size());
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, subtrees.size());
+  dataAlg.execute(VertexKdTreeBoxImpl(this, subtrees, lowerLeft, upperRight, subtreeIds));
+
+  size_t count = 0;
+  for(const auto& ids : subtreeIds)
+  {
+    count += ids.size();
+  }
+  vertexIds.reserve(count);
+  for(const auto& ids : subtreeIds)
+  {
+    vertexIds.insert(vertexIds.end(), ids.begin(), ids.end());
+  }
+  std::sort(vertexIds.begin(), vertexIds.end());
+  return vertexIds;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexKdTree::findInBox(const NodeRange& range, const float lowerLeft[3], const float upperRight[3], std::vector<size_t>& vertexIds) const
+{
+  if(range.depth >= m_LeafDepth)
+  {
+    for(size_t i = range.begin; i < range.end; i++)
+    {
+      const float* p = m_Coords.data() + 3 * i;
+      if(p[0] >= lowerLeft[0] && p[0] <= upperRight[0] && p[1] >= lowerLeft[1] && p[1] <= upperRight[1] && p[2] >= lowerLeft[2] && p[2] <= upperRight[2])
+      {
+        vertexIds.push_back(m_VertexIds[i]);
+      }
+    }
+    return;
+  }
+
+  size_t middle = range.begin + (range.end - range.begin) / 2;
+  uint8_t axis = m_SplitAxes[range.node];
+  float split = m_SplitValues[range.node];
+  if(lowerLeft[axis] <= split)
+  {
+    findInBox({2 * range.node + 1, range.begin, middle, range.depth + 1}, lowerLeft, upperRight, vertexIds);
+  }
+  if(upperRight[axis] >= split)
+  {
+    findInBox({2 * range.node + 2, middle, range.end, range.depth + 1}, lowerLeft, upperRight, vertexIds);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<size_t> VertexKdTree::findInRadius(const float point[3], float radius) const
+{
+  std::vector<size_t> vertexIds;
+  if(m_VertexIds.empty() || radius < 0.0f)
+  {
+    return vertexIds;
+  }
+  findInRadius({0, 0, m_VertexIds.size(), 0}, point, radius * radius, vertexIds);
+  std::sort(vertexIds.begin(), vertexIds.end());
+  return vertexIds;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexKdTree::findInRadius(const NodeRange& range, const float point[3], float radius2, std::vector<size_t>& vertexIds) const
+{
+  if(range.depth >= m_LeafDepth)
+  {
+    for(size_t i = range.begin; i < range.end; i++)
+    {
+      if(SquaredDistance(m_Coords.data() + 3 * i, point) <= radius2)
+      {
+        vertexIds.push_back(m_VertexIds[i]);
+      }
+    }
+    return;
+  }
+
+  size_t middle = range.begin + (range.end - range.begin) / 2;
+  float diff = point[m_SplitAxes[range.node]] - m_SplitValues[range.node];
+  NodeRange left = {2 * range.node + 1, range.begin, middle, range.depth + 1};
+  NodeRange right = {2 * range.node + 2, middle, range.end, range.depth + 1};
+  findInRadius(diff < 0.0f ? left : right, point, radius2, vertexIds);
+  if(diff * diff <= radius2)
+  {
+    findInRadius(diff < 0.0f ? right : left, point, radius2, vertexIds);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<std::vector<size_t>> VertexKdTree::findInRadius(const float* points, size_t numPoints, float radius) const
+{
+  std::vector<std::vector<size_t>> vertexIds(numPoints);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numPoints);
+  dataAlg.execute(VertexKdTreeRadiusImpl(this, points, radius, vertexIds));
+  return vertexIds;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VertexKdTree::findNearest(const float point[3], size_t k, size_t* vertexIds, float* distances) const
+{
+  // Max heap of (squared distance, vertex id) holding the best k candidates found so far
+  std::vector<std::pair<float, size_t>> heap;
+  if(k > 0 && !m_VertexIds.empty())
+  {
+    heap.reserve(k);
+    findNearest({0, 0, m_VertexIds.size(), 0}, point, k, heap);
+  }
+  std::sort_heap(heap.begin(), heap.end());
+
+  for(size_t i = 0; i < k; i++)
+  {
+    bool found = i < heap.size();
+    vertexIds[i] = found ? heap[i].second : InvalidVertex;
+    if(distances != nullptr)
+    {
+      distances[i] = found ? std::sqrt(heap[i].first) : std::numeric_limits<float>::max();
+    }
+  }
+  return heap.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexKdTree::findNearest(const NodeRange& range, const float point[3], size_t k, std::vector<std::pair<float, size_t>>& heap) const
+{
+  if(range.depth >= m_LeafDepth)
+  {
+    for(size_t i = range.begin; i < range.end; i++)
+    {
+      std::pair<float, size_t> candidate(SquaredDistance(m_Coords.data() + 3 * i, point), m_VertexIds[i]);
+      if(heap.size() < k)
+      {
+        heap.push_back(candidate);
+        std::push_heap(heap.begin(), heap.end());
+      }
+      else if(candidate < heap.front())
+      {
+        std::pop_heap(heap.begin(), heap.end());
+        heap.back() = candidate;
+        std::push_heap(heap.begin(), heap.end());
+      }
+    }
+    return;
+  }
+
+  size_t middle = range.begin + (range.end - range.begin) / 2;
+  float diff = point[m_SplitAxes[range.node]] - m_SplitValues[range.node];
+  NodeRange left = {2 * range.node + 1, range.begin, middle, range.depth + 1};
+  NodeRange right = {2 * range.node + 2, middle, range.end, range.depth + 1};
+  findNearest(diff < 0.0f ? left : right, point, k, heap);
+  if(heap.size() < k || diff * diff <= heap.front().first)
+  {
+    findNearest(diff < 0.0f ? right : left, point, k, heap);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexKdTree::findNearest(const float* points, size_t numPoints, size_t k, size_t* vertexIds, float* distances) const
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numPoints);
+  dataAlg.execute(VertexKdTreeNearestImpl(this, points, k, vertexIds, distances));
+}
@@ -0,0 +1,207 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+
+class VertexGeom;
+
+/**
+ * @class VertexKdTree VertexKdTree.h SIMPLib/Geometry/VertexKdTree.h
+ * @brief Static k-d tree over the vertices of a VertexGeom (or any list of xyz points).
+ *
+ * The tree is balanced: every interior node splits its points at the median along the
+ * axis of largest extent, so the node layout is implicit and only the split planes are
+ * stored. The coordinates are copied into tree order when the tree is built, so queries
+ * do not touch the geometry afterwards and the tree must be rebuilt if the vertices change.
+ * Use VertexUniformGrid instead when points are added over time.
+ *
+ * All queries are const and may be called from several threads at once. The box query
+ * searches independent subtrees in parallel and the batch versions of the radius and
+ * nearest neighbor queries split the query points across threads with ParallelDataAlgorithm.
+ */
+class SIMPLib_EXPORT VertexKdTree
+{
+public:
+  using Self = VertexKdTree;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+  static Pointer NullPointer();
+
+  /**
+   * @brief New Builds the tree over every vertex of the geometry
+   * @param vertices
+   * @return
+   */
+  static Pointer New(const VertexGeom& vertices);
+
+  /**
+   * @brief New Builds the tree over numPoints points stored as xyz triplets. The ids reported
+   * by the queries are the positions of the points in this list.
+   * @param points
+   * @param numPoints
+   * @return
+   */
+  static Pointer New(const float* points, size_t numPoints);
+
+  /**
+   * @brief Returns the name of the class for VertexKdTree
+   */
+  QString getNameOfClass() const;
+  /**
+   * @brief Returns the name of the class for VertexKdTree
+   */
+  static QString ClassName();
+
+  virtual ~VertexKdTree();
+
+  static constexpr size_t InvalidVertex = std::numeric_limits<size_t>::max();
+
+  /**
+   * @brief getNumberOfVertices
+   * @return
+   */
+  size_t getNumberOfVertices() const;
+
+  /**
+   * @brief getBounds Returns the bounding box of every vertex in the tree
+   * @param lowerLeft
+   * @param upperRight
+   */
+  void getBounds(float lowerLeft[3], float upperRight[3]) const;
+
+  /**
+   * @brief findInBox Finds the vertices with lowerLeft <= xyz <= upperRight
+   * @param lowerLeft
+   * @param upperRight
+   * @return The vertex ids in ascending order
+   */
+  std::vector<size_t> findInBox(const float lowerLeft[3], const float upperRight[3]) const;
+
+  /**
+   * @brief findInRadius Finds the vertices within radius of the point (inclusive)
+   * @param point
+   * @param radius
+   * @return The vertex ids in ascending order
+   */
+  std::vector<size_t> findInRadius(const float point[3], float radius) const;
+
+  /**
+   * @brief findInRadius Batch version of findInRadius for numPoints points stored as xyz triplets
+   * @param points
+   * @param numPoints
+   * @param radius
+   * @return One list of vertex ids per point
+   */
+  std::vector<std::vector<size_t>> findInRadius(const float* points, size_t numPoints, float radius) const;
+
+  /**
+   * @brief findNearest Finds the k vertices closest to the point, nearest first. If the tree
+   * holds fewer than k vertices the remaining entries are set to InvalidVertex and the
+   * largest float value.
+   * @param point
+   * @param k
+   * @param vertexIds Must hold k entries
+   * @param distances Must hold k entries, may be nullptr
+   * @return The number of vertices found
+   */
+  size_t findNearest(const float point[3], size_t k, size_t* vertexIds, float* distances) const;
+
+  /**
+   * @brief findNearest Batch version of findNearest for numPoints points stored as xyz triplets
+   * @param points
+   * @param numPoints
+   * @param k
+   * @param vertexIds Must hold k * numPoints entries
+   * @param distances Must hold k * numPoints entries, may be nullptr
+   */
+  void findNearest(const float* points, size_t numPoints, size_t k, size_t* vertexIds, float* distances) const;
+
+protected:
+  VertexKdTree();
+
+  /**
+   * @brief build Copies the points into tree order and computes the split planes
+   * @param points
+   * @param numPoints
+   */
+  void build(const float* points, size_t numPoints);
+
+private:
+  friend class VertexKdTreeBoxImpl;
+
+  /**
+   * @brief The range of tree ordered points below a node. Children split the range at its midpoint.
+   */
+  struct NodeRange
+  {
+    size_t node;
+    size_t begin;
+    size_t end;
+    size_t depth;
+  };
+
+  /**
+   * @brief findSubtrees Returns the nodes at the given depth whose region can intersect the box
+   */
+  std::vector<NodeRange> findSubtrees(const float lowerLeft[3], const float upperRight[3], size_t depth) const;
+
+  void findInBox(const NodeRange& range, const float lowerLeft[3], const float upperRight[3], std::vector<size_t>& vertexIds) const;
+  void findInRadius(const NodeRange& range, const float point[3], float radius2, std::vector<size_t>& vertexIds) const;
+  void findNearest(const NodeRange& range, const float point[3], size_t k, std::vector<std::pair<float, size_t>>& heap) const;
+
+  std::vector<float> m_Coords;
+  std::vector<size_t> m_VertexIds;
+  std::vector<float> m_SplitValues;
+  std::vector<uint8_t> m_SplitAxes;
+  size_t m_LeafDepth = 0;
+  float m_LowerLeft[3] = {0.0f, 0.0f, 0.0f};
+  float m_UpperRight[3] = {0.0f, 0.0f, 0.0f};
+
+public:
+  VertexKdTree(const VertexKdTree&) = delete;            // Copy Constructor Not Implemented
+  VertexKdTree(VertexKdTree&&) = delete;                 // Move Constructor Not Implemented
+  VertexKdTree& operator=(const VertexKdTree&) = delete; // Copy Assignment Not Implemented
+  VertexKdTree& operator=(VertexKdTree&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,512 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "VertexUniformGrid.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "SIMPLib/Geometry/VertexGeom.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+namespace
+{
+// Each bin coordinate is stored in 21 bits of the 64 bit cell key
+constexpr int64_t k_CellOffset = static_cast<int64_t>(1) << 20;
+constexpr int64_t k_MinCell = -k_CellOffset;
+constexpr int64_t k_MaxCell = k_CellOffset - 1;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+inline uint64_t CellKey(int64_t x, int64_t y, int64_t z)
+{
+  return (static_cast<uint64_t>(x + k_CellOffset) << 42) | (static_cast<uint64_t>(y + k_CellOffset) << 21) | static_cast<uint64_t>(z + k_CellOffset);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+inline float SquaredDistance(const float* a, const float* b)
+{
+  float dx = a[0] - b[0];
+  float dy = a[1] - b[1];
+  float dz = a[2] - b[2];
+  return dx * dx + dy * dy + dz * dz;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+inline bool InsideBox(const float* p, const float lowerLeft[3], const float upperRight[3])
+{
+  return p[0] >= lowerLeft[0] && p[0] <= upperRight[0] && p[1] >= lowerLeft[1] && p[1] <= upperRight[1] && p[2] >= lowerLeft[2] && p[2] <= upperRight[2];
+}
+} // namespace
+
+/**
+ * @brief The VertexUniformGridRadiusImpl class implements a threaded algorithm that finds the vertices within a radius of each point
+ */
+class VertexUniformGridRadiusImpl
+{
+public:
+  VertexUniformGridRadiusImpl(const VertexUniformGrid* grid, const float* points, float radius, std::vector<std::vector<size_t>>& vertexIds)
+  : m_Grid(grid)
+  , m_Points(points)
+  , m_Radius(radius)
+  , m_VertexIds(vertexIds)
+  {
+  }
+  virtual ~VertexUniformGridRadiusImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      m_VertexIds[i] = m_Grid->findInRadius(m_Points + 3 * i, m_Radius);
+    }
+  }
+
+private:
+  const VertexUniformGrid* m_Grid;
+  const float* m_Points;
+  float m_Radius;
+  std::vector<std::vector<size_t>>& m_VertexIds;
+};
+
+/**
+ * @brief The VertexUniformGridNearestImpl class implements a threaded algorithm that finds the k nearest vertices to each point
+ */
+class VertexUniformGridNearestImpl
+{
+public:
+  VertexUniformGridNearestImpl(const VertexUniformGrid* grid, const float* points, size_t k, size_t* vertexIds, float* distances)
+  : m_Grid(grid)
+  , m_Points(points)
+  , m_K(k)
+  , m_VertexIds(vertexIds)
+  , m_Distances(distances)
+  {
+  }
+  virtual ~VertexUniformGridNearestImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      m_Grid->findNearest(m_Points + 3 * i, m_K, m_VertexIds + m_K * i, m_Distances != nullptr ? m_Distances + m_K * i : nullptr);
+    }
+  }
+
+private:
+  const VertexUniformGrid* m_Grid;
+  const float* m_Points;
+  size_t m_K;
+  size_t* m_VertexIds;
+  float* m_Distances;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VertexUniformGrid::VertexUniformGrid(float cellSize)
+: m_CellSize(cellSize)
+, m_InvCellSize(1.0f / cellSize)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VertexUniformGrid::~VertexUniformGrid() = default;
+
+// -----------------------------------------------------------------------------
+VertexUniformGrid::Pointer VertexUniformGrid::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
+
+// -----------------------------------------------------------------------------
+VertexUniformGrid::Pointer VertexUniformGrid::New(float cellSize)
+{
+  if(!(cellSize > 0.0f))
+  {
+    return NullPointer();
+  }
+  Pointer sharedPtr(new VertexUniformGrid(cellSize));
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+VertexUniformGrid::Pointer VertexUniformGrid::New(const VertexGeom& vertices, float cellSize)
+{
+  Pointer sharedPtr = New(cellSize);
+  size_t numVertices = vertices.getNumberOfVertices();
+  if(sharedPtr.get() != nullptr && numVertices > 0)
+  {
+    sharedPtr->insert(vertices.getVertexPointer(0), numVertices);
+  }
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+QString VertexUniformGrid::getNameOfClass() const
+{
+  return QString("VertexUniformGrid");
+}
+
+// -----------------------------------------------------------------------------
+QString VertexUniformGrid::ClassName()
+{
+  return QString("VertexUniformGrid");
+}
+
+// -----------------------------------------------------------------------------
+float VertexUniformGrid::getCellSize() const
+{
+  return m_CellSize;
+}
+
+// -----------------------------------------------------------------------------
+size_t VertexUniformGrid::getNumberOfVertices() const
+{
+  return m_NumVertices;
+}
+
+// -----------------------------------------------------------------------------
+size_t VertexUniformGrid::getNumberOfCells() const
+{
+  return m_Cells.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexUniformGrid::findCell(const float point[3], int64_t cell[3]) const
+{
+  for(size_t d = 0; d < 3; d++)
+  {
+    float value = std::floor(point[d] * m_InvCellSize);
+    value = std::min(std::max(value, static_cast<float>(k_MinCell)), static_cast<float>(k_MaxCell));
+    cell[d] = static_cast<int64_t>(value);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<VertexUniformGrid::Entry>* VertexUniformGrid::getCell(int64_t x, int64_t y, int64_t z) const
+{
+  auto iter = m_Cells.find(CellKey(x, y, z));
+  return iter == m_Cells.end() ? nullptr : &(iter->second);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexUniformGrid::insert(size_t vertexId, const float point[3])
+{
+  int64_t cell[3] = {0, 0, 0};
+  findCell(point, cell);
+  for(size_t d = 0; d < 3; d++)
+  {
+    m_MinCell[d] = m_NumVertices == 0 ? cell[d] : std::min(m_MinCell[d], cell[d]);
+    m_MaxCell[d] = m_NumVertices == 0 ? cell[d] : std::max(m_MaxCell[d], cell[d]);
+  }
+  m_Cells[CellKey(cell[0], cell[1], cell[2])].push_back({{point[0], point[1], point[2]}, vertexId});
+  m_NumVertices++;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexUniformGrid::insert(const float* points, size_t numPoints, size_t firstVertexId)
+{
+  for(size_t i = 0; i < numPoints; i++)
+  {
+    insert(firstVertexId + i, points + 3 * i);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexUniformGrid::clear()
+{
+  m_Cells.clear();
+  m_NumVertices = 0;
+  std::fill_n(m_MinCell, 3, 0);
+  std::fill_n(m_MaxCell, 3, 0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<size_t> VertexUniformGrid::findInBox(const float lowerLeft[3], const float upperRight[3]) const
+{
+  std::vector<size_t> vertexIds;
+  if(m_NumVertices == 0)
+  {
+    return vertexIds;
+  }
+
+  int64_t lower[3] = {0, 0, 0};
+  int64_t upper[3] = {0, 0, 0};
+  findCell(lowerLeft, lower);
+  findCell(upperRight, upper);
+  double numBoxCells = 1.0;
+  for(size_t d = 0; d < 3; d++)
+  {
+    lower[d] = std::max(lower[d], m_MinCell[d]);
+    upper[d] = std::min(upper[d], m_MaxCell[d]);
+    if(lower[d] > upper[d])
+    {
+      return vertexIds;
+    }
+    numBoxCells *= static_cast<double>(upper[d] - lower[d] + 1);
+  }
+
+  if(numBoxCells > static_cast<double>(m_Cells.size()))
+  {
+    // The box covers more bins than are occupied; checking every point is cheaper
+    for(const auto& cell : m_Cells)
+    {
+      for(const auto& entry : cell.second)
+      {
+        if(InsideBox(entry.coords, lowerLeft, upperRight))
+        {
+          vertexIds.push_back(entry.vertexId);
+        }
+      }
+    }
+  }
+  else
+  {
+    for(int64_t z = lower[2]; z <= upper[2]; z++)
+    {
+      for(int64_t y = lower[1]; y <= upper[1]; y++)
+      {
+        for(int64_t x = lower[0]; x <= upper[0]; x++)
+        {
+          const std::vector<Entry>* entries = getCell(x, y, z);
+          if(entries == nullptr)
+          {
+            continue;
+          }
+          for(const auto& entry : *entries)
+          {
+            if(InsideBox(entry.coords, lowerLeft, upperRight))
+            {
+              vertexIds.push_back(entry.vertexId);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  std::sort(vertexIds.begin(), vertexIds.end());
+  return vertexIds;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<size_t> VertexUniformGrid::findInRadius(const float point[3], float radius) const
+{
+  std::vector<size_t> vertexIds;
+  if(m_NumVertices == 0 || radius < 0.0f)
+  {
+    return vertexIds;
+  }
+
+  int64_t lower[3] = {0, 0, 0};
+  int64_t upper[3] = {0, 0, 0};
+  float lowerLeft[3] = {point[0] - radius, point[1] - radius, point[2] - radius};
+  float upperRight[3] = {point[0] + radius, point[1] + radius, point[2] + radius};
+  findCell(lowerLeft, lower);
+  findCell(upperRight, upper);
+  for(size_t d = 0; d < 3; d++)
+  {
+    lower[d] = std::max(lower[d], m_MinCell[d]);
+    upper[d] = std::min(upper[d], m_MaxCell[d]);
+  }
+
+  float radius2 = radius * radius;
+  for(int64_t z = lower[2]; z <= upper[2]; z++)
+  {
+    for(int64_t y = lower[1]; y <= upper[1]; y++)
+    {
+      for(int64_t x = lower[0]; x <= upper[0]; x++)
+      {
+        const std::vector<Entry>* entries = getCell(x, y, z);
+        if(entries == nullptr)
+        {
+          continue;
+        }
+        for(const auto& entry : *entries)
+        {
+          if(SquaredDistance(entry.coords, point) <= radius2)
+          {
+            vertexIds.push_back(entry.vertexId);
+          }
+        }
+      }
+    }
+  }
+
+  std::sort(vertexIds.begin(), vertexIds.end());
+  return vertexIds;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<std::vector<size_t>> VertexUniformGrid::findInRadius(const float* points, size_t numPoints, float radius) const
+{
+  std::vector<std::vector<size_t>> vertexIds(numPoints);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numPoints);
+  dataAlg.execute(VertexUniformGridRadiusImpl(this, points, radius, vertexIds));
+  return vertexIds;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VertexUniformGrid::findNearest(const float point[3], size_t k, size_t* vertexIds, float* distances) const
+{
+  // Max heap of (squared distance, vertex id) holding the best k candidates found so far
+  std::vector<std::pair<float, size_t>> heap;
+  heap.reserve(k);
+
+  auto visitCell = [&](int64_t x, int64_t y, int64_t z) {
+    const std::vector<Entry>* entries = getCell(x, y, z);
+    if(entries == nullptr)
+    {
+      return;
+    }
+    for(const auto& entry : *entries)
+    {
+      std::pair<float, size_t> candidate(SquaredDistance(entry.coords, point), entry.vertexId);
+      if(heap.size() < k)
+      {
+        heap.push_back(candidate);
+        std::push_heap(heap.begin(), heap.end());
+      }
+      else if(candidate < heap.front())
+      {
+        std::pop_heap(heap.begin(), heap.end());
+        heap.back() = candidate;
+        std::push_heap(heap.begin(), heap.end());
+      }
+    }
+  };
+
+  if(k > 0 && m_NumVertices > 0)
+  {
+    int64_t center[3] = {0, 0, 0};
+    findCell(point, center);
+    int64_t maxRing = 0;
+    for(size_t d = 0; d < 3; d++)
+    {
+      maxRing = std::max(maxRing, std::max(center[d] - m_MinCell[d], m_MaxCell[d] - center[d]));
+    }
+
+    // Visit the shells of bins around the query bin. Every point beyond shell r is at least
+    // r cell sizes away, so the search stops once the k-th candidate is closer than that.
+    for(int64_t ring = 0; ring <= maxRing; ring++)
+    {
+      int64_t lower[3] = {0, 0, 0};
+      int64_t upper[3] = {0, 0, 0};
+      for(size_t d = 0; d < 3; d++)
+      {
+        lower[d] = std::max(center[d] - ring, m_MinCell[d]);
+        upper[d] = std::min(center[d] + ring, m_MaxCell[d]);
+      }
+      for(int64_t x = lower[0]; x <= upper[0]; x++)
+      {
+        for(int64_t y = lower[1]; y <= upper[1]; y++)
+        {
+          if(std::abs(x - center[0]) == ring || std::abs(y - center[1]) == ring)
+          {
+            for(int64_t z = lower[2]; z <= upper[2]; z++)
+            {
+              visitCell(x, y, z);
+            }
+          }
+          else
+          {
+            // Only the top and bottom of the shell are left in this column
+            for(int64_t z : {center[2] - ring, center[2] + ring})
+            {
+              if(z >= m_MinCell[2] && z <= m_MaxCell[2])
+              {
+                visitCell(x, y, z);
+              }
+            }
+          }
+        }
+      }
+
+      float reach = static_cast<float>(ring) * m_CellSize;
+      if(heap.size() == k && heap.front().first <= reach * reach)
+      {
+        break;
+      }
+    }
+  }
+  std::sort_heap(heap.begin(), heap.end());
+
+  for(size_t i = 0; i < k; i++)
+  {
+    bool found = i < heap.size();
+    vertexIds[i] = found ? heap[i].second : InvalidVertex;
+    if(distances != nullptr)
+    {
+      distances[i] = found ? std::sqrt(heap[i].first) : std::numeric_limits<float>::max();
+    }
+  }
+  return heap.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexUniformGrid::findNearest(const float* points, size_t numPoints, size_t k, size_t* vertexIds, float* distances) const
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numPoints);
+  dataAlg.execute(VertexUniformGridNearestImpl(this, points, k, vertexIds, distances));
+}
@@ -0,0 +1,217 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+
+class VertexGeom;
+
+/**
+ * @class VertexUniformGrid VertexUniformGrid.h SIMPLib/Geometry/VertexUniformGrid.h
+ * @brief Uniform grid of cubic bins over a growing set of points.
+ *
+ * Points can be inserted at any time, one at a time or in blocks, which makes the grid
+ * the index of choice while a point cloud is being generated. Only occupied bins are
+ * stored (in a hash map keyed by the bin coordinates) so the grid does not need to know
+ * the extent of the points up front. Each bin keeps its own copy of the coordinates.
+ *
+ * The cell size should be close to the typical query radius. Queries are const and may
+ * be called from several threads at once, but not while points are being inserted. The
+ * batch versions split the query points across threads with ParallelDataAlgorithm.
+ */
+class SIMPLib_EXPORT VertexUniformGrid
+{
+public:
+  using Self = VertexUniformGrid;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+  static Pointer NullPointer();
+
+  /**
+   * @brief New Creates an empty grid
+   * @param cellSize Edge length of the cubic bins; must be positive
+   * @return NullPointer if the cell size is not positive
+   */
+  static Pointer New(float cellSize);
+
+  /**
+   * @brief New Creates a grid holding every vertex of the geometry
+   * @param vertices
+   * @param cellSize Edge length of the cubic bins; must be positive
+   * @return NullPointer if the cell size is not positive
+   */
+  static Pointer New(const VertexGeom& vertices, float cellSize);
+
+  /**
+   * @brief Returns the name of the class for VertexUniformGrid
+   */
+  QString getNameOfClass() const;
+  /**
+   * @brief Returns the name of the class for VertexUniformGrid
+   */
+  static QString ClassName();
+
+  virtual ~VertexUniformGrid();
+
+  static constexpr size_t InvalidVertex = std::numeric_limits<size_t>::max();
+
+  /**
+   * @brief getCellSize
+   * @return
+   */
+  float getCellSize() const;
+
+  /**
+   * @brief getNumberOfVertices
+   * @return
+   */
+  size_t getNumberOfVertices() const;
+
+  /**
+   * @brief getNumberOfCells Returns the number of occupied bins
+   * @return
+   */
+  size_t getNumberOfCells() const;
+
+  /**
+   * @brief insert Adds one point
+   * @param vertexId Id reported for the point by the queries
+   * @param point
+   */
+  void insert(size_t vertexId, const float point[3]);
+
+  /**
+   * @brief insert Adds numPoints points stored as xyz triplets with the ids firstVertexId, firstVertexId + 1, ...
+   * @param points
+   * @param numPoints
+   * @param firstVertexId
+   */
+  void insert(const float* points, size_t numPoints, size_t firstVertexId = 0);
+
+  /**
+   * @brief clear Removes every point
+   */
+  void clear();
+
+  /**
+   * @brief findInBox Finds the vertices with lowerLeft <= xyz <= upperRight
+   * @param lowerLeft
+   * @param upperRight
+   * @return The vertex ids in ascending order
+   */
+  std::vector<size_t> findInBox(const float lowerLeft[3], const float upperRight[3]) const;
+
+  /**
+   * @brief findInRadius Finds the vertices within radius of the point (inclusive)
+   * @param point
+   * @param radius
+   * @return The vertex ids in ascending order
+   */
+  std::vector<size_t> findInRadius(const float point[3], float radius) const;
+
+  /**
+   * @brief findInRadius Batch version of findInRadius for numPoints points stored as xyz triplets
+   * @param points
+   * @param numPoints
+   * @param radius
+   * @return One list of vertex ids per point
+   */
+  std::vector<std::vector<size_t>> findInRadius(const float* points, size_t numPoints, float radius) const;
+
+  /**
+   * @brief findNearest Finds the k vertices closest to the point, nearest first. If the grid
+   * holds fewer than k vertices the remaining entries are set to InvalidVertex and the
+   * largest float value.
+   * @param point
+   * @param k
+   * @param vertexIds Must hold k entries
+   * @param distances Must hold k entries, may be nullptr
+   * @return The number of vertices found
+   */
+  size_t findNearest(const float point[3], size_t k, size_t* vertexIds, float* distances) const;
+
+  /**
+   * @brief findNearest Batch version of findNearest for numPoints points stored as xyz triplets
+   * @param points
+   * @param numPoints
+   * @param k
+   * @param vertexIds Must hold k * numPoints entries
+   * @param distances Must hold k * numPoints entries, may be nullptr
+   */
+  void findNearest(const float* points, size_t numPoints, size_t k, size_t* vertexIds, float* distances) const;
+
+protected:
+  explicit VertexUniformGrid(float cellSize);
+
+private:
+  struct Entry
+  {
+    float coords[3];
+    size_t vertexId;
+  };
+
+  /**
+   * @brief findCell Returns the bin coordinates of a point, clamped to the range the cell keys can hold
+   */
+  void findCell(const float point[3], int64_t cell[3]) const;
+
+  /**
+   * @brief getCell Returns the points in a bin, or nullptr if the bin is empty
+   */
+  const std::vector<Entry>* getCell(int64_t x, int64_t y, int64_t z) const;
+
+  float m_CellSize = 1.0f;
+  float m_InvCellSize = 1.0f;
+  size_t m_NumVertices = 0;
+  int64_t m_MinCell[3] = {0, 0, 0};
+  int64_t m_MaxCell[3] = {0, 0, 0};
+  std::unordered_map<uint64_t, std::vector<Entry>> m_Cells;
+
+public:
+  VertexUniformGrid(const VertexUniformGrid&) = delete;            // Copy Constructor Not Implemented
+  VertexUniformGrid(VertexUniformGrid&&) = delete;                 // Move Constructor Not Implemented
+  VertexUniformGrid& operator=(const VertexUniformGrid&) = delete; // Copy Assignment Not Implemented
+  VertexUniformGrid& operator=(VertexUniformGrid&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,145 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "H5AsyncWriteQueue.h"
+
+#include <hdf5.h>
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5AsyncWriteQueue::H5AsyncWriteQueue() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5AsyncWriteQueue::~H5AsyncWriteQueue()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Stop = true;
+  }
+  m_JobAvailable.notify_all();
+  // The thread finishes every queued job before it exits so no file is left half written
+  if(m_Thread.joinable())
+  {
+    m_Thread.join();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5AsyncWriteQueue& H5AsyncWriteQueue::Instance()
+{
+  static H5AsyncWriteQueue instance;
+  return instance;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool H5AsyncWriteQueue::IsSupported()
+{
+  hbool_t isThreadSafe = false;
+  if(H5is_library_threadsafe(&isThreadSafe) < 0)
+  {
+    return false;
+  }
+  return isThreadSafe > 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5AsyncWriteQueue::enqueue(JobType job)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Jobs.push_back(std::move(job));
+    if(!m_Thread.joinable())
+    {
+      m_Thread = std::thread(&H5AsyncWriteQueue::run, this);
+    }
+  }
+  m_JobAvailable.notify_one();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5AsyncWriteQueue::waitForIdle()
+{
+  std::unique_lock<std::mutex> lock(m_Mutex);
+  m_Idle.wait(lock, [this] { return m_Jobs.empty() && m_NumberOfRunningJobs == 0; });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t H5AsyncWriteQueue::getNumberOfPendingJobs() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_Jobs.size() + m_NumberOfRunningJobs;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5AsyncWriteQueue::run()
+{
+  std::unique_lock<std::mutex> lock(m_Mutex);
+  while(true)
+  {
+    m_JobAvailable.wait(lock, [this] { return m_Stop || !m_Jobs.empty(); });
+    if(m_Jobs.empty())
+    {
+      // Only reached once m_Stop is set and the queue is drained
+      break;
+    }
+    JobType job = std::move(m_Jobs.front());
+    m_Jobs.pop_front();
+    m_NumberOfRunningJobs++;
+    lock.unlock();
+
+    job();
+
+    lock.lock();
+    m_NumberOfRunningJobs--;
+    if(m_Jobs.empty() && m_NumberOfRunningJobs == 0)
+    {
+      m_Idle.notify_all();
+    }
+  }
+}
@@ -0,0 +1,108 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @class H5AsyncWriteQueue H5AsyncWriteQueue.h SIMPLib/HDF5/H5AsyncWriteQueue.h
+ * @brief Runs HDF5 write jobs on a single, process wide I/O thread.
+ *
+ * Jobs are executed one at a time in the order they were queued, so two jobs that
+ * write the same file never interleave. The thread is started with the first job and
+ * the queue is drained before the process exits.
+ *
+ * The HDF5 library is only safe to use from more than one thread when it was built
+ * with thread safety enabled; IsSupported() reports this and callers are expected to
+ * write synchronously when it returns false.
+ */
+class SIMPLib_EXPORT H5AsyncWriteQueue
+{
+public:
+  using JobType = std::function<void()>;
+
+  /**
+   * @brief Instance Returns the process wide queue
+   */
+  static H5AsyncWriteQueue& Instance();
+
+  /**
+   * @brief IsSupported Returns true if the linked HDF5 library can be used from the I/O thread
+   */
+  static bool IsSupported();
+
+  virtual ~H5AsyncWriteQueue();
+
+  /**
+   * @brief enqueue Appends a job to the queue. The job must own (or pin) every object it uses.
+   */
+  void enqueue(JobType job);
+
+  /**
+   * @brief waitForIdle Blocks until every queued job has finished
+   */
+  void waitForIdle();
+
+  /**
+   * @brief getNumberOfPendingJobs Returns the number of queued and running jobs
+   */
+  size_t getNumberOfPendingJobs() const;
+
+protected:
+  H5AsyncWriteQueue();
+
+private:
+  void run();
+
+  mutable std::mutex m_Mutex;
+  std::condition_variable m_JobAvailable;
+  std::condition_variable m_Idle;
+  std::deque<JobType> m_Jobs;
+  size_t m_NumberOfRunningJobs = 0;
+  bool m_Stop = false;
+  std::thread m_Thread;
+
+public:
+  H5AsyncWriteQueue(const H5AsyncWriteQueue&) = delete;            // Copy Constructor Not Implemented
+  H5AsyncWriteQueue(H5AsyncWriteQueue&&) = delete;                 // Move Constructor Not Implemented
+  H5AsyncWriteQueue& operator=(const H5AsyncWriteQueue&) = delete; // Copy Assignment Not Implemented
+  H5AsyncWriteQueue& operator=(H5AsyncWriteQueue&&) = delete;      // Move Assignment Not Implemented
+};
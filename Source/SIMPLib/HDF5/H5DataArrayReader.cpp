@@ -35,6 +35,8 @@
 
 #include "H5DataArrayReader.h"
 
+#include <functional>
+#include <numeric>
 #include <vector>
 
 #include "H5Support/QH5Lite.h"
@@ -42,6 +44,7 @@
 
 #include <QtCore/QDebug>
 
+#include "SIMPLib/DataArrays/BitArray.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataArrays/NeighborList.hpp"
 #include "SIMPLib/DataArrays/StringDataArray.h"
@@ -80,6 +83,28 @@ IDataArray::Pointer readH5Dataset(hid_t locId, const QString& datasetPath, const
   }
   return ptr;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+IDataArray::Pointer readH5DatasetSubset(hid_t locId, const QString& datasetPath, const std::vector<hsize_t>& offset, const std::vector<hsize_t>& count, const std::vector<size_t>& tDims,
+                                        const std::vector<size_t>& cDims, bool metaDataOnly)
+{
+  typename DataArray<T>::Pointer ptr = DataArray<T>::CreateArray(tDims, cDims, datasetPath, !metaDataOnly);
+  if(metaDataOnly)
+  {
+    return ptr;
+  }
+
+  herr_t err = H5DataArrayReader::ReadHyperslab(locId, datasetPath, H5DataArrayReader::NativeTypeForPrimitive<T>(), offset, count, ptr->data());
+  if(err < 0)
+  {
+    qDebug() << "readH5DatasetSubset read error: " << __FILE__ << "(" << __LINE__ << ")";
+    return IDataArray::NullPointer();
+  }
+  return ptr;
+}
 } // namespace Detail
 
 // -----------------------------------------------------------------------------
@@ -121,6 +146,35 @@ int H5DataArrayReader::ReadRequiredAttributes(hid_t gid, const QString& name, QS
   return retErr;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer H5DataArrayReader::ReadBitArray(hid_t gid, const QString& name, bool metaDataOnly)
+{
+  QString classType;
+  int version = 0;
+  std::vector<size_t> tDims;
+  std::vector<size_t> cDims;
+  int err = ReadRequiredAttributes(gid, name, classType, version, tDims, cDims);
+  if(err < 0 || classType.compare("BitArray") != 0)
+  {
+    return IDataArray::NullPointer();
+  }
+
+  size_t numTuples = std::accumulate(tDims.begin(), tDims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
+  BitArray::Pointer array = BitArray::CreateArray(numTuples, name, false);
+  if(!metaDataOnly)
+  {
+    err = array->readH5Data(gid);
+    if(err < 0)
+    {
+      qDebug() << "Error reading packed BitArray " << name;
+      return IDataArray::NullPointer();
+    }
+  }
+  return array;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -390,6 +444,139 @@ IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString&
   return ptr;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+herr_t H5DataArrayReader::ReadHyperslab(hid_t locId, const QString& name, hid_t memTypeId, const std::vector<hsize_t>& offset, const std::vector<hsize_t>& count, void* data)
+{
+  hid_t datasetId = H5Dopen(locId, name.toLatin1().data(), H5P_DEFAULT);
+  if(datasetId < 0)
+  {
+    return -1;
+  }
+
+  herr_t err = -1;
+  hid_t fileSpaceId = H5Dget_space(datasetId);
+  if(fileSpaceId >= 0)
+  {
+    int rank = H5Sget_simple_extent_ndims(fileSpaceId);
+    if(rank > 0 && rank == static_cast<int>(offset.size()) && rank == static_cast<int>(count.size()))
+    {
+      err = H5Sselect_hyperslab(fileSpaceId, H5S_SELECT_SET, offset.data(), nullptr, count.data(), nullptr);
+      // Reject blocks that extend past the end of the dataset instead of letting H5Dread fail later
+      if(err >= 0 && H5Sselect_valid(fileSpaceId) <= 0)
+      {
+        err = -1;
+      }
+      if(err >= 0)
+      {
+        hid_t memSpaceId = H5Screate_simple(rank, count.data(), nullptr);
+        err = H5Dread(datasetId, memTypeId, memSpaceId, fileSpaceId, H5P_DEFAULT, data);
+        H5Sclose(memSpaceId);
+      }
+    }
+    H5Sclose(fileSpaceId);
+  }
+  H5Dclose(datasetId);
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer H5DataArrayReader::ReadIDataArraySubset(hid_t gid, const QString& name, const std::vector<size_t>& tupleOffset, const std::vector<size_t>& tupleCount, bool metaDataOnly)
+{
+  IDataArray::Pointer ptr = IDataArray::NullPointer();
+
+  QString classType;
+  int version = 0;
+  std::vector<size_t> tDims;
+  std::vector<size_t> cDims;
+  herr_t err = ReadRequiredAttributes(gid, name, classType, version, tDims, cDims);
+  if(err < 0 || tupleOffset.size() != tDims.size() || tupleCount.size() != tDims.size())
+  {
+    return ptr;
+  }
+
+  QVector<hsize_t> dims;
+  H5T_class_t attr_type;
+  size_t attr_size;
+  err = QH5Lite::getDatasetInfo(gid, name, dims, attr_type, attr_size);
+  if(err < 0 || dims.size() != static_cast<int>(tDims.size() + cDims.size()))
+  {
+    return ptr;
+  }
+
+  // The dataset is stored with the tuple dimensions reversed (Z, Y, X) followed by the reversed component dimensions.
+  std::vector<hsize_t> offset;
+  std::vector<hsize_t> count;
+  for(size_t i = tDims.size(); i-- > 0;)
+  {
+    if(tupleCount[i] == 0 || tupleOffset[i] + tupleCount[i] > tDims[i])
+    {
+      return ptr;
+    }
+    offset.push_back(tupleOffset[i]);
+    count.push_back(tupleCount[i]);
+  }
+  for(size_t i = cDims.size(); i-- > 0;)
+  {
+    offset.push_back(0);
+    count.push_back(cDims[i]);
+  }
+
+  if(classType == "DataArray<bool>")
+  {
+    ptr = Detail::readH5DatasetSubset<bool>(gid, name, offset, count, tupleCount, cDims, metaDataOnly);
+  }
+  else if(classType == "DataArray<int8_t>")
+  {
+    ptr = Detail::readH5DatasetSubset<int8_t>(gid, name, offset, count, tupleCount, cDims, metaDataOnly);
+  }
+  else if(classType == "DataArray<uint8_t>")
+  {
+    ptr = Detail::readH5DatasetSubset<uint8_t>(gid, name, offset, count, tupleCount, cDims, metaDataOnly);
+  }
+  else if(classType == "DataArray<int16_t>")
+  {
+    ptr = Detail::readH5DatasetSubset<int16_t>(gid, name, offset, count, tupleCount, cDims, metaDataOnly);
+  }
+  else if(classType == "DataArray<uint16_t>")
+  {
+    ptr = Detail::readH5DatasetSubset<uint16_t>(gid, name, offset, count, tupleCount, cDims, metaDataOnly);
+  }
+  else if(classType == "DataArray<int32_t>")
+  {
+    ptr = Detail::readH5DatasetSubset<int32_t>(gid, name, offset, count, tupleCount, cDims, metaDataOnly);
+  }
+  else if(classType == "DataArray<uint32_t>")
+  {
+    ptr = Detail::readH5DatasetSubset<uint32_t>(gid, name, offset, count, tupleCount, cDims, metaDataOnly);
+  }
+  else if(classType == "DataArray<int64_t>")
+  {
+    ptr = Detail::readH5DatasetSubset<int64_t>(gid, name, offset, count, tupleCount, cDims, metaDataOnly);
+  }
+  else if(classType == "DataArray<uint64_t>")
+  {
+    ptr = Detail::readH5DatasetSubset<uint64_t>(gid, name, offset, count, tupleCount, cDims, metaDataOnly);
+  }
+  else if(classType == "DataArray<float>")
+  {
+    ptr = Detail::readH5DatasetSubset<float>(gid, name, offset, count, tupleCount, cDims, metaDataOnly);
+  }
+  else if(classType == "DataArray<double>")
+  {
+    ptr = Detail::readH5DatasetSubset<double>(gid, name, offset, count, tupleCount, cDims, metaDataOnly);
+  }
+  else
+  {
+    qDebug() << "ReadIDataArraySubset: Unsupported array type " << classType << " at " << name;
+  }
+
+  return ptr;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -38,6 +38,8 @@
 #include <hdf5.h>
 
 #include <memory>
+#include <type_traits>
+#include <vector>
 
 #include <QtCore/QString>
 
@@ -77,6 +79,82 @@ public:
    */
   static IDataArrayShPtrType ReadIDataArray(hid_t gid, const QString& name, bool metaDataOnly = false);
 
+  /**
+   * @brief ReadIDataArraySubset Reads a block of tuples of a DataArray<T> from the HDF5 file. Only the
+   * selected hyperslab is read from disk, so a small region can be pulled out of a very large array.
+   * @param gid The HDF5 Group to read the data array from
+   * @param name The name of the data set
+   * @param tupleOffset The first tuple index along each tuple dimension, in the same (X, Y, Z) order as the tuple dimensions
+   * @param tupleCount The number of tuples along each tuple dimension. This becomes the tuple dimensions of the returned array.
+   * @param metaDataOnly Read just the meta data about the DataArray or actually read all the data
+   * @return The array or a null pointer if the array is not a DataArray<T> or the block does not fit in the array
+   */
+  static IDataArrayShPtrType ReadIDataArraySubset(hid_t gid, const QString& name, const std::vector<size_t>& tupleOffset, const std::vector<size_t>& tupleCount, bool metaDataOnly = false);
+
+  /**
+   * @brief ReadHyperslab Reads a rectangular block of an HDF5 dataset into a caller supplied buffer.
+   * @param locId The HDF5 file or group that contains the dataset
+   * @param name The name of the data set
+   * @param memTypeId The native HDF5 type of the values in 'data'
+   * @param offset Start of the block for each dataset dimension, slowest to fastest (HDF5 order)
+   * @param count Size of the block for each dataset dimension, slowest to fastest (HDF5 order)
+   * @param data Buffer that holds at least the product of 'count' values
+   * @return Negative value on error
+   */
+  static herr_t ReadHyperslab(hid_t locId, const QString& name, hid_t memTypeId, const std::vector<hsize_t>& offset, const std::vector<hsize_t>& count, void* data);
+
+  /**
+   * @brief NativeTypeForPrimitive Returns the native HDF5 type used to read values of type T
+   */
+  template <typename T>
+  static hid_t NativeTypeForPrimitive()
+  {
+    if constexpr(std::is_same_v<T, int8_t>)
+    {
+      return H5T_NATIVE_INT8;
+    }
+    else if constexpr(std::is_same_v<T, uint8_t> || std::is_same_v<T, bool>)
+    {
+      return H5T_NATIVE_UINT8;
+    }
+    else if constexpr(std::is_same_v<T, int16_t>)
+    {
+      return H5T_NATIVE_INT16;
+    }
+    else if constexpr(std::is_same_v<T, uint16_t>)
+    {
+      return H5T_NATIVE_UINT16;
+    }
+    else if constexpr(std::is_same_v<T, int32_t>)
+    {
+      return H5T_NATIVE_INT32;
+    }
+    else if constexpr(std::is_same_v<T, uint32_t>)
+    {
+      return H5T_NATIVE_UINT32;
+    }
+    else if constexpr(std::is_same_v<T, int64_t>)
+    {
+      return H5T_NATIVE_INT64;
+    }
+    else if constexpr(std::is_same_v<T, uint64_t>)
+    {
+      return H5T_NATIVE_UINT64;
+    }
+    else if constexpr(std::is_same_v<T, float>)
+    {
+      return H5T_NATIVE_FLOAT;
+    }
+    else if constexpr(std::is_same_v<T, double>)
+    {
+      return H5T_NATIVE_DOUBLE;
+    }
+    else
+    {
+      return -1;
+    }
+  }
+
   /**
    * @brief ReadNeighborListData
    * @param gid The HDF5 Group to read the data array from
@@ -95,6 +173,15 @@ public:
    */
   static IDataArrayShPtrType ReadStringDataArray(hid_t gid, const QString& name, bool metaDataOnly = false);
 
+  /**
+   * @brief ReadBitArray Reads a BitArray written as packed bytes
+   * @param gid The HDF5 Group to read the data array from
+   * @param name The name of the data set
+   * @param metaDataOnly Read just the meta data about the DataArray or actually read all the data
+   * @return
+   */
+  static IDataArrayShPtrType ReadBitArray(hid_t gid, const QString& name, bool metaDataOnly = false);
+
 protected:
   H5DataArrayReader();
 
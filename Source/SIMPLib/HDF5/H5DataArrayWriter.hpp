@@ -169,7 +169,7 @@ public:
 #endif
     if(QH5Lite::datasetExists(gid, dataArray->getName()) == false)
     {
-      err = QH5Lite::writePointerDataset(gid, dataArray->getName(), h5Rank, h5Dims.data(), dataArray->getPointer(0));
+      err = QH5Lite::writePointerDataset(gid, dataArray->getName(), h5Rank, h5Dims.data(), dataArray->data());
       if(err < 0)
       {
         return err;
@@ -177,7 +177,7 @@ public:
     }
     else
     {
-      err = QH5Lite::replacePointerDataset(gid, dataArray->getName(), h5Rank, h5Dims.data(), dataArray->getPointer(0));
+      err = QH5Lite::replacePointerDataset(gid, dataArray->getName(), h5Rank, h5Dims.data(), dataArray->data());
       if(err < 0)
       {
         return err;
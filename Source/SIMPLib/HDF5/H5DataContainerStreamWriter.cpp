@@ -0,0 +1,768 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "H5DataContainerStreamWriter.h"
+
+#include <algorithm>
+
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QStringList>
+
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/QH5Lite.h"
+#include "H5Support/QH5Utilities.h"
+
+#include "SIMPLib/SIMPLibVersion.h"
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/FilterParameters/H5FilterParametersWriter.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/HDF5/H5DataArrayReader.h"
+#include "SIMPLib/HDF5/H5DataArrayWriter.hpp"
+#include "SIMPLib/HDF5/VTKH5Constants.h"
+
+namespace Detail
+{
+/**
+ * @brief Calls 'func' with the concrete DataArray<T> behind 'array'. Returns false for any other array type.
+ */
+template <typename Func>
+bool dispatchStreamArray(const IDataArray::Pointer& array, Func&& func)
+{
+  if(auto typed = std::dynamic_pointer_cast<Int8ArrayType>(array))
+  {
+    func(*typed);
+  }
+  else if(auto typed = std::dynamic_pointer_cast<UInt8ArrayType>(array))
+  {
+    func(*typed);
+  }
+  else if(auto typed = std::dynamic_pointer_cast<Int16ArrayType>(array))
+  {
+    func(*typed);
+  }
+  else if(auto typed = std::dynamic_pointer_cast<UInt16ArrayType>(array))
+  {
+    func(*typed);
+  }
+  else if(auto typed = std::dynamic_pointer_cast<Int32ArrayType>(array))
+  {
+    func(*typed);
+  }
+  else if(auto typed = std::dynamic_pointer_cast<UInt32ArrayType>(array))
+  {
+    func(*typed);
+  }
+  else if(auto typed = std::dynamic_pointer_cast<Int64ArrayType>(array))
+  {
+    func(*typed);
+  }
+  else if(auto typed = std::dynamic_pointer_cast<UInt64ArrayType>(array))
+  {
+    func(*typed);
+  }
+  else if(auto typed = std::dynamic_pointer_cast<FloatArrayType>(array))
+  {
+    func(*typed);
+  }
+  else if(auto typed = std::dynamic_pointer_cast<DoubleArrayType>(array))
+  {
+    func(*typed);
+  }
+  else if(auto typed = std::dynamic_pointer_cast<BoolArrayType>(array))
+  {
+    func(*typed);
+  }
+  else
+  {
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Writes 'array' as the Z slices [zOffset, zOffset + sliceDims[2]) of an extensible dataset, creating
+ * the dataset on the first call. The dataset is chunked one Z slice at a time so extending it never rewrites
+ * existing data.
+ */
+template <typename T>
+int32_t appendSlab(hid_t amGid, const DataArray<T>& array, size_t zOffset, const SizeVec3Type& sliceDims)
+{
+  const std::vector<size_t> cDims = array.getComponentDimensions();
+  std::vector<hsize_t> count = {sliceDims[2], sliceDims[1], sliceDims[0]};
+  for(auto iter = cDims.rbegin(); iter != cDims.rend(); ++iter)
+  {
+    count.push_back(*iter);
+  }
+  const int rank = static_cast<int>(count.size());
+  const hid_t typeId = H5DataArrayReader::NativeTypeForPrimitive<T>();
+  const QString name = array.getName();
+
+  hid_t datasetId = -1;
+  herr_t err = 0;
+  if(!QH5Lite::datasetExists(amGid, name))
+  {
+    if(zOffset != 0)
+    {
+      return -1;
+    }
+    std::vector<hsize_t> maxDims = count;
+    maxDims[0] = H5S_UNLIMITED;
+    std::vector<hsize_t> chunkDims = count;
+    chunkDims[0] = 1;
+
+    hid_t spaceId = H5Screate_simple(rank, count.data(), maxDims.data());
+    hid_t plistId = H5Pcreate(H5P_DATASET_CREATE);
+    H5Pset_chunk(plistId, rank, chunkDims.data());
+    datasetId = H5Dcreate(amGid, name.toLatin1().data(), typeId, spaceId, H5P_DEFAULT, plistId, H5P_DEFAULT);
+    H5Pclose(plistId);
+    H5Sclose(spaceId);
+    if(datasetId < 0)
+    {
+      return -1;
+    }
+    err = H5Dwrite(datasetId, typeId, H5S_ALL, H5S_ALL, H5P_DEFAULT, array.data());
+  }
+  else
+  {
+    datasetId = H5Dopen(amGid, name.toLatin1().data(), H5P_DEFAULT);
+    if(datasetId < 0)
+    {
+      return -1;
+    }
+    hid_t fileSpaceId = H5Dget_space(datasetId);
+    std::vector<hsize_t> dims(rank, 0);
+    if(H5Sget_simple_extent_ndims(fileSpaceId) != rank)
+    {
+      err = -1;
+    }
+    else
+    {
+      H5Sget_simple_extent_dims(fileSpaceId, dims.data(), nullptr);
+      // The slab must line up with the end of the dataset and match the fixed dimensions
+      if(dims[0] != zOffset || !std::equal(dims.begin() + 1, dims.end(), count.begin() + 1))
+      {
+        err = -1;
+      }
+    }
+    H5Sclose(fileSpaceId);
+
+    if(err >= 0)
+    {
+      std::vector<hsize_t> newDims = dims;
+      newDims[0] += count[0];
+      err = H5Dset_extent(datasetId, newDims.data());
+    }
+    if(err >= 0)
+    {
+      std::vector<hsize_t> start(rank, 0);
+      start[0] = zOffset;
+      fileSpaceId = H5Dget_space(datasetId);
+      hid_t memSpaceId = H5Screate_simple(rank, count.data(), nullptr);
+      err = H5Sselect_hyperslab(fileSpaceId, H5S_SELECT_SET, start.data(), nullptr, count.data(), nullptr);
+      if(err >= 0)
+      {
+        err = H5Dwrite(datasetId, typeId, memSpaceId, fileSpaceId, H5P_DEFAULT, array.data());
+      }
+      H5Sclose(memSpaceId);
+      H5Sclose(fileSpaceId);
+    }
+  }
+  H5Dclose(datasetId);
+  if(err < 0)
+  {
+    return err;
+  }
+
+  std::vector<size_t> tDims = {sliceDims[0], sliceDims[1], zOffset + sliceDims[2]};
+  return H5DataArrayWriter::writeDataArrayAttributes<DataArray<T>>(amGid, &array, tDims, cDims);
+}
+
+/**
+ * @brief Returns the Xdmf attribute type for the supported component counts or an empty string.
+ */
+inline QString xdmfAttributeType(size_t numComp)
+{
+  switch(numComp)
+  {
+  case 1:
+    return QString("Scalar");
+  case 3:
+    return QString("Vector");
+  case 9:
+    return QString("Tensor");
+  default:
+    break;
+  }
+  return QString();
+}
+} // namespace Detail
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5DataContainerStreamWriter::H5DataContainerStreamWriter() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5DataContainerStreamWriter::~H5DataContainerStreamWriter()
+{
+  close();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t H5DataContainerStreamWriter::open(const QString& filePath, bool writeXdmf, bool writeTimeSeries)
+{
+  close();
+  m_DataContainers.clear();
+  m_NumberOfSteps = 0;
+  m_ErrorMessage.clear();
+  m_FilePath = filePath;
+  m_WriteXdmf = writeXdmf;
+  m_WriteTimeSeries = writeTimeSeries;
+
+  QFileInfo fi(m_FilePath);
+  m_XdmfFilePath = fi.path() + "/" + fi.completeBaseName() + ".xdmf";
+
+  m_FileId = QH5Utilities::createFile(m_FilePath);
+  if(m_FileId < 0)
+  {
+    return setError(-11130, QObject::tr("The HDF5 file could not be created.\n The given filename was:\n\t[%1]").arg(m_FilePath));
+  }
+
+  QH5Lite::writeStringAttribute(m_FileId, "/", SIMPL::HDF5::FileVersionName, SIMPL::HDF5::FileVersion);
+  QH5Lite::writeStringAttribute(m_FileId, "/", SIMPL::HDF5::DREAM3DVersion, SIMPLib::Version::Complete());
+
+  // Create the same top level layout as DataContainerWriter so the file can be read back before it is closed
+  const QStringList groupNames = {SIMPL::StringConstants::DataContainerGroupName, SIMPL::StringConstants::DataContainerBundleGroupName, SIMPL::StringConstants::MontageGroupName};
+  for(const QString& groupName : groupNames)
+  {
+    if(QH5Utilities::createGroupsFromPath(groupName, m_FileId) < 0)
+    {
+      int32_t err = setError(-11131, QObject::tr("Error creating HDF5 Group '%1'").arg(groupName));
+      close();
+      return err;
+    }
+  }
+  H5Fflush(m_FileId, H5F_SCOPE_GLOBAL);
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool H5DataContainerStreamWriter::isOpen() const
+{
+  return m_FileId >= 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t H5DataContainerStreamWriter::writePipeline(const QString& pipelineName, const QString& pipelineJson)
+{
+  m_ErrorMessage.clear();
+  if(m_FileId < 0)
+  {
+    return setError(-11143, QObject::tr("The stream writer is not open"));
+  }
+  // The file is already open for writing, so the pipeline has to go through the same file id
+  if(QH5Lite::datasetExists(m_FileId, SIMPL::StringConstants::PipelineGroupName))
+  {
+    H5Ldelete(m_FileId, SIMPL::StringConstants::PipelineGroupName.toLatin1().data(), H5P_DEFAULT);
+  }
+  int32_t err = H5FilterParametersWriter::WritePipelineString(m_FileId, pipelineName, pipelineJson);
+  if(err < 0)
+  {
+    return setError(-11144, QObject::tr("The pipeline could not be written to '%1'").arg(m_FilePath));
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5DataContainerStreamWriter::close()
+{
+  if(m_FileId < 0)
+  {
+    return;
+  }
+  H5Fflush(m_FileId, H5F_SCOPE_GLOBAL);
+  QH5Utilities::closeFile(m_FileId);
+  m_FileId = -1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t H5DataContainerStreamWriter::append(const DataContainerArray::Pointer& dca)
+{
+  m_ErrorMessage.clear();
+  if(m_FileId < 0)
+  {
+    return setError(-11132, QObject::tr("The stream writer is not open"));
+  }
+  if(nullptr == dca)
+  {
+    return setError(-11133, QObject::tr("No DataContainerArray was given to append"));
+  }
+
+  // The first append defines which DataContainers, AttributeMatrices and arrays are streamed
+  if(m_NumberOfSteps == 0)
+  {
+    m_DataContainers.clear();
+    for(const auto& dc : dca->getDataContainers())
+    {
+      ImageGeom::Pointer image = dc->getGeometryAs<ImageGeom>();
+      if(nullptr == image)
+      {
+        continue;
+      }
+      StreamDataContainer stream;
+      stream.name = dc->getName();
+      stream.dims = image->getDimensions();
+      stream.dims[2] = 0;
+      stream.origin = image->getOrigin();
+      stream.spacing = image->getSpacing();
+      for(const auto& am : *dc)
+      {
+        if(am->getType() != AttributeMatrix::Type::Cell)
+        {
+          continue;
+        }
+        StreamAttributeMatrix streamAm;
+        streamAm.name = am->getName();
+        for(const auto& array : *am)
+        {
+          std::vector<size_t> cDims = array->getComponentDimensions();
+          if(Detail::dispatchStreamArray(array, [](const auto&) {}))
+          {
+            streamAm.arrays.push_back({array->createNewArray(0, cDims, array->getName(), false), cDims});
+          }
+        }
+        if(!streamAm.arrays.empty())
+        {
+          stream.attributeMatrices.push_back(streamAm);
+        }
+      }
+      m_DataContainers.push_back(stream);
+    }
+    if(m_DataContainers.empty())
+    {
+      return setError(-11134, QObject::tr("None of the DataContainers has an Image Geometry that can be streamed"));
+    }
+  }
+
+  // Validate everything before writing so a bad iteration never leaves a partially appended slab behind
+  for(const StreamDataContainer& stream : m_DataContainers)
+  {
+    DataContainer::Pointer dc = dca->getDataContainer(stream.name);
+    ImageGeom::Pointer image = (nullptr != dc) ? dc->getGeometryAs<ImageGeom>() : ImageGeom::NullPointer();
+    if(nullptr == image)
+    {
+      return setError(-11135, QObject::tr("The DataContainer '%1' with an Image Geometry is missing from this iteration").arg(stream.name));
+    }
+    SizeVec3Type dims = image->getDimensions();
+    if(dims[0] != stream.dims[0] || dims[1] != stream.dims[1] || dims[2] == 0)
+    {
+      return setError(-11136, QObject::tr("The Image Geometry of '%1' has dimensions %2 x %3 x %4 but slabs of %5 x %6 x N are being appended")
+                                  .arg(stream.name)
+                                  .arg(dims[0])
+                                  .arg(dims[1])
+                                  .arg(dims[2])
+                                  .arg(stream.dims[0])
+                                  .arg(stream.dims[1]));
+    }
+    const size_t numTuples = dims[0] * dims[1] * dims[2];
+    for(const StreamAttributeMatrix& streamAm : stream.attributeMatrices)
+    {
+      AttributeMatrix::Pointer am = dc->getAttributeMatrix(streamAm.name);
+      if(nullptr == am)
+      {
+        return setError(-11137, QObject::tr("The AttributeMatrix '%1/%2' is missing from this iteration").arg(stream.name, streamAm.name));
+      }
+      for(const StreamArray& streamArray : streamAm.arrays)
+      {
+        IDataArray::Pointer array = am->getAttributeArray(streamArray.prototype->getName());
+        if(nullptr == array || array->getTypeAsString() != streamArray.prototype->getTypeAsString() || array->getComponentDimensions() != streamArray.cDims)
+        {
+          return setError(-11138, QObject::tr("The array '%1/%2/%3' is missing or its type or component dimensions changed").arg(stream.name, streamAm.name, streamArray.prototype->getName()));
+        }
+        if(array->getNumberOfTuples() != numTuples)
+        {
+          return setError(-11139, QObject::tr("The array '%1/%2/%3' has %4 tuples but the Image Geometry has %5 cells")
+                                      .arg(stream.name, streamAm.name, streamArray.prototype->getName())
+                                      .arg(array->getNumberOfTuples())
+                                      .arg(numTuples));
+        }
+      }
+    }
+  }
+
+  hid_t dcaGid = H5Gopen(m_FileId, SIMPL::StringConstants::DataContainerGroupName.toLatin1().data(), H5P_DEFAULT);
+  if(dcaGid < 0)
+  {
+    return setError(-11131, QObject::tr("Error opening HDF5 Group '%1'").arg(SIMPL::StringConstants::DataContainerGroupName));
+  }
+  H5ScopedGroupSentinel dcaSentinel(dcaGid, false);
+
+  for(StreamDataContainer& stream : m_DataContainers)
+  {
+    int32_t err = appendDataContainer(dcaGid, dca->getDataContainer(stream.name), stream);
+    if(err < 0)
+    {
+      return err;
+    }
+  }
+  m_NumberOfSteps++;
+  H5Fflush(m_FileId, H5F_SCOPE_GLOBAL);
+
+  if(m_WriteXdmf)
+  {
+    return writeXdmf();
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t H5DataContainerStreamWriter::appendDataContainer(hid_t dcaGid, const DataContainer::Pointer& dc, StreamDataContainer& stream)
+{
+  ImageGeom::Pointer image = dc->getGeometryAs<ImageGeom>();
+  SizeVec3Type sliceDims = image->getDimensions();
+  const size_t zOffset = stream.dims[2];
+
+  if(QH5Utilities::createGroupsFromPath(stream.name, dcaGid) < 0)
+  {
+    return setError(-11131, QObject::tr("Error creating HDF5 Group '%1'").arg(stream.name));
+  }
+  hid_t dcGid = H5Gopen(dcaGid, stream.name.toLatin1().data(), H5P_DEFAULT);
+  H5ScopedGroupSentinel dcSentinel(dcGid, false);
+
+  std::vector<size_t> tDims = {sliceDims[0], sliceDims[1], zOffset + sliceDims[2]};
+  hsize_t tDimsSize = tDims.size();
+  for(const StreamAttributeMatrix& streamAm : stream.attributeMatrices)
+  {
+    AttributeMatrix::Pointer am = dc->getAttributeMatrix(streamAm.name);
+    if(QH5Utilities::createGroupsFromPath(streamAm.name, dcGid) < 0)
+    {
+      return setError(-11131, QObject::tr("Error creating HDF5 Group '%1'").arg(streamAm.name));
+    }
+    hid_t amGid = H5Gopen(dcGid, streamAm.name.toLatin1().data(), H5P_DEFAULT);
+    H5ScopedGroupSentinel amSentinel(amGid, false);
+
+    for(const StreamArray& streamArray : streamAm.arrays)
+    {
+      int32_t err = 0;
+      IDataArray::Pointer array = am->getAttributeArray(streamArray.prototype->getName());
+      Detail::dispatchStreamArray(array, [&](const auto& typed) { err = Detail::appendSlab(amGid, typed, zOffset, sliceDims); });
+      if(err < 0)
+      {
+        return setError(-11140, QObject::tr("Error appending slices %1 to %2 of array '%3/%4/%5'")
+                                    .arg(zOffset)
+                                    .arg(zOffset + sliceDims[2] - 1)
+                                    .arg(stream.name, streamAm.name, array->getName()));
+      }
+    }
+
+    AttributeMatrix::EnumType attrMatType = static_cast<AttributeMatrix::EnumType>(AttributeMatrix::Type::Cell);
+    int32_t err = QH5Lite::writeScalarAttribute(dcGid, streamAm.name, SIMPL::StringConstants::AttributeMatrixType, attrMatType);
+    if(err >= 0)
+    {
+      err = QH5Lite::writePointerAttribute(dcGid, streamAm.name, SIMPL::HDF5::TupleDimensions, 1, &tDimsSize, tDims.data());
+    }
+    if(err < 0)
+    {
+      return setError(-11140, QObject::tr("Error writing the tuple dimensions of '%1/%2'").arg(stream.name, streamAm.name));
+    }
+  }
+
+  StreamStep step;
+  step.zOffset = zOffset;
+  step.zCount = sliceDims[2];
+  step.origin = image->getOrigin();
+  stream.steps.push_back(step);
+  stream.dims[2] += sliceDims[2];
+
+  // The geometry is written once, afterwards only its Z dimension grows
+  int32_t err = 0;
+  if(stream.steps.size() == 1)
+  {
+    ImageGeom::Pointer geom = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    geom->setDimensions(stream.dims);
+    geom->setOrigin(stream.origin);
+    geom->setSpacing(stream.spacing);
+    DataContainer::Pointer shape = DataContainer::New(stream.name);
+    shape->setGeometry(geom);
+    err = shape->writeMeshToHDF5(dcGid, m_WriteXdmf);
+  }
+  else
+  {
+    hid_t geomGid = H5Gopen(dcGid, SIMPL::Geometry::Geometry.toLatin1().data(), H5P_DEFAULT);
+    H5ScopedGroupSentinel geomSentinel(geomGid, false);
+    int64_t volDims[3] = {static_cast<int64_t>(stream.dims[0]), static_cast<int64_t>(stream.dims[1]), static_cast<int64_t>(stream.dims[2])};
+    hsize_t dims[1] = {3};
+    err = QH5Lite::replacePointerDataset(geomGid, H5_DIMENSIONS, 1, dims, volDims);
+  }
+  if(err < 0)
+  {
+    return setError(-11141, QObject::tr("Error writing the Image Geometry of '%1'").arg(stream.name));
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t H5DataContainerStreamWriter::writeXdmf()
+{
+  // The whole description is small, so it is simply regenerated to match what is on disk now
+  QFile xdmfFile(m_XdmfFilePath);
+  if(!xdmfFile.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text))
+  {
+    return setError(-11142, QObject::tr("The Xdmf file could not be opened for writing.\n The given filename was:\n\t[%1]").arg(m_XdmfFilePath));
+  }
+  QTextStream out(&xdmfFile);
+  QString hdfFileName = QH5Utilities::fileNameFromFileId(m_FileId);
+
+  out << "<?xml version=\"1.0\"?>"
+      << "\n";
+  out << "<!DOCTYPE Xdmf SYSTEM \"Xdmf.dtd\"[]>"
+      << "\n";
+  out << "<Xdmf xmlns:xi=\"http://www.w3.org/2003/XInclude\" Version=\"2.2\">"
+      << "\n";
+  out << " <Domain>"
+      << "\n";
+  if(m_WriteTimeSeries)
+  {
+    out << "<Grid Name=\"CellTime\" GridType=\"Collection\" CollectionType=\"Temporal\">"
+        << "\n";
+  }
+
+  for(const StreamDataContainer& stream : m_DataContainers)
+  {
+    if(m_WriteTimeSeries)
+    {
+      for(size_t i = 0; i < stream.steps.size(); i++)
+      {
+        writeTimeStepXdmf(out, stream, i, hdfFileName);
+      }
+    }
+    else
+    {
+      writeVolumeXdmf(out, stream, hdfFileName);
+    }
+  }
+
+  if(m_WriteTimeSeries)
+  {
+    out << " </Grid>"
+        << "\n";
+  }
+  out << " </Domain>"
+      << "\n";
+  out << "</Xdmf>"
+      << "\n";
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5DataContainerStreamWriter::writeVolumeXdmf(QTextStream& out, const StreamDataContainer& stream, const QString& hdfFileName) const
+{
+  // Describe the appended volume with unallocated arrays so DataContainer::writeXdmf() produces the usual text
+  ImageGeom::Pointer geom = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+  geom->setDimensions(stream.dims);
+  geom->setOrigin(stream.origin);
+  geom->setSpacing(stream.spacing);
+  DataContainer::Pointer shape = DataContainer::New(stream.name);
+  shape->setGeometry(geom);
+
+  std::vector<size_t> tDims = {stream.dims[0], stream.dims[1], stream.dims[2]};
+  const size_t numTuples = tDims[0] * tDims[1] * tDims[2];
+  for(const StreamAttributeMatrix& streamAm : stream.attributeMatrices)
+  {
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, streamAm.name, AttributeMatrix::Type::Cell);
+    for(const StreamArray& streamArray : streamAm.arrays)
+    {
+      am->insertOrAssign(streamArray.prototype->createNewArray(numTuples, streamArray.cDims, streamArray.prototype->getName(), false));
+    }
+    shape->addOrReplaceAttributeMatrix(am);
+  }
+  shape->writeXdmf(out, hdfFileName);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5DataContainerStreamWriter::writeTimeStepXdmf(QTextStream& out, const StreamDataContainer& stream, size_t stepIndex, const QString& hdfFileName) const
+{
+  const StreamStep& step = stream.steps[stepIndex];
+
+  ImageGeom::Pointer geom = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+  geom->setDimensions(stream.dims[0], stream.dims[1], step.zCount);
+  geom->setOrigin(step.origin);
+  geom->setSpacing(stream.spacing);
+  geom->setEnableTimeSeries(true);
+  geom->setTimeValue(static_cast<float>(stepIndex));
+  geom->writeXdmf(out, stream.name, hdfFileName);
+
+  // Each time step reads its own Z range out of the extensible datasets
+  const QString stepDims = QString("%1 %2 %3").arg(step.zCount).arg(stream.dims[1]).arg(stream.dims[0]);
+  const QString totalDims = QString("%1 %2 %3").arg(stream.dims[2]).arg(stream.dims[1]).arg(stream.dims[0]);
+  for(const StreamAttributeMatrix& streamAm : stream.attributeMatrices)
+  {
+    for(const StreamArray& streamArray : streamAm.arrays)
+    {
+      const IDataArray::Pointer& array = streamArray.prototype;
+      QString xdmfTypeName;
+      int32_t precision = 0;
+      array->getXdmfTypeAndSize(xdmfTypeName, precision);
+      const size_t numComp = array->getNumberOfComponents();
+      const QString attrType = Detail::xdmfAttributeType(numComp);
+      if(0 == precision || attrType.isEmpty())
+      {
+        out << "<!-- " << array->getName() << " can not be described as a time step slab in XDMF -->"
+            << "\n";
+        continue;
+      }
+      out << "    <Attribute Name=\"" << array->getName() << "\" AttributeType=\"" << attrType << "\" Center=\"" << SIMPL::XdmfCenterType::Cell << "\">"
+          << "\n";
+      out << R"(      <DataItem ItemType="HyperSlab" Dimensions=")" << stepDims << " " << numComp << R"(" Type="HyperSlab">)"
+          << "\n";
+      out << R"(        <DataItem Dimensions="3 4" Format="XML">)" << step.zOffset << " 0 0 0 1 1 1 1 " << stepDims << " " << numComp << "</DataItem>"
+          << "\n";
+      out << R"(        <DataItem Format="HDF" Dimensions=")" << totalDims << " " << numComp << "\" "
+          << "NumberType=\"" << xdmfTypeName << "\" "
+          << "Precision=\"" << precision << "\" >"
+          << "\n";
+      out << "          " << hdfFileName << ":/DataContainers/" << stream.name << "/" << streamAm.name << "/" << array->getName() << "\n";
+      out << "        </DataItem>"
+          << "\n";
+      out << "      </DataItem>"
+          << "\n";
+      out << "    </Attribute>"
+          << "\n";
+    }
+  }
+
+  out << "  </Grid>"
+      << "\n";
+  out << "  <!-- *************** END OF " << stream.name << " *************** -->"
+      << "\n";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t H5DataContainerStreamWriter::setError(int32_t code, const QString& message)
+{
+  m_ErrorMessage = message;
+  return code;
+}
+
+// -----------------------------------------------------------------------------
+QString H5DataContainerStreamWriter::getFilePath() const
+{
+  return m_FilePath;
+}
+
+// -----------------------------------------------------------------------------
+bool H5DataContainerStreamWriter::getWriteXdmf() const
+{
+  return m_WriteXdmf;
+}
+
+// -----------------------------------------------------------------------------
+bool H5DataContainerStreamWriter::getWriteTimeSeries() const
+{
+  return m_WriteTimeSeries;
+}
+
+// -----------------------------------------------------------------------------
+size_t H5DataContainerStreamWriter::getNumberOfSteps() const
+{
+  return m_NumberOfSteps;
+}
+
+// -----------------------------------------------------------------------------
+size_t H5DataContainerStreamWriter::getNumberOfSlices(const QString& dcName) const
+{
+  for(const StreamDataContainer& stream : m_DataContainers)
+  {
+    if(stream.name == dcName)
+    {
+      return stream.dims[2];
+    }
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+QString H5DataContainerStreamWriter::getErrorMessage() const
+{
+  return m_ErrorMessage;
+}
+
+// -----------------------------------------------------------------------------
+H5DataContainerStreamWriter::Pointer H5DataContainerStreamWriter::NullPointer()
+{
+  return Pointer(static_cast<Self*>(nullptr));
+}
+
+// -----------------------------------------------------------------------------
+H5DataContainerStreamWriter::Pointer H5DataContainerStreamWriter::New()
+{
+  Pointer sharedPtr(new(H5DataContainerStreamWriter));
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+QString H5DataContainerStreamWriter::getNameOfClass() const
+{
+  return QString("H5DataContainerStreamWriter");
+}
+
+// -----------------------------------------------------------------------------
+QString H5DataContainerStreamWriter::ClassName()
+{
+  return QString("H5DataContainerStreamWriter");
+}
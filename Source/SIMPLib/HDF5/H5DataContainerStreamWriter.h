@@ -0,0 +1,212 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <hdf5.h>
+
+#include <QtCore/QString>
+#include <QtCore/QTextStream>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLArray.hpp"
+#include "SIMPLib/DataArrays/IDataArray.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+
+/**
+ * @class H5DataContainerStreamWriter H5DataContainerStreamWriter.h SIMPLib/HDF5/H5DataContainerStreamWriter.h
+ * @brief Appends Image Geometry cell data to a .dream3d file one slab at a time.
+ *
+ * The writer keeps the HDF5 file open between calls to append(). Every cell array
+ * of an Image Geometry DataContainer is stored as a chunked dataset whose slowest
+ * (Z) dimension is unlimited, so each append() only extends the datasets and writes
+ * the new slices. The incoming DataContainerArray is the only copy of the data that
+ * is held in memory.
+ *
+ * The first append() defines the layout: the X and Y dimensions of each Image Geometry
+ * and the name, type and component dimensions of each cell array. Later appends must
+ * match that layout but may carry any number of Z slices. Only DataArray<T> objects in
+ * Cell AttributeMatrices are streamed; all other data is ignored.
+ *
+ * When an Xdmf file is requested it is regenerated after every append() so that it
+ * always describes the data that is already on disk. In time series mode each append()
+ * becomes one time step of a Temporal collection that references its slab of the
+ * extensible datasets, otherwise the slabs are presented as one growing volume.
+ */
+class SIMPLib_EXPORT H5DataContainerStreamWriter
+{
+public:
+  using Self = H5DataContainerStreamWriter;
+  using Pointer = std::shared_ptr<Self>;
+  using ConstPointer = std::shared_ptr<const Self>;
+  using WeakPointer = std::weak_ptr<Self>;
+  using ConstWeakPointer = std::weak_ptr<const Self>;
+  static Pointer NullPointer();
+
+  static Pointer New();
+
+  /**
+   * @brief Returns the name of the class for H5DataContainerStreamWriter
+   */
+  virtual QString getNameOfClass() const;
+  /**
+   * @brief Returns the name of the class for H5DataContainerStreamWriter
+   */
+  static QString ClassName();
+
+  virtual ~H5DataContainerStreamWriter();
+
+  /**
+   * @brief open Creates (or truncates) the HDF5 file and writes the file level meta data.
+   * @param filePath Path to the .dream3d file
+   * @param writeXdmf Write a companion .xdmf file next to the HDF5 file
+   * @param writeTimeSeries Present each append() as a time step in the Xdmf file
+   * @return Negative value on error, see getErrorMessage()
+   */
+  int32_t open(const QString& filePath, bool writeXdmf, bool writeTimeSeries);
+
+  /**
+   * @brief isOpen Returns true between a successful open() and close()
+   */
+  bool isOpen() const;
+
+  /**
+   * @brief append Writes the cell data of every Image Geometry DataContainer in 'dca' as the next slab.
+   * @param dca The data produced by the current iteration
+   * @return Negative value on error, see getErrorMessage()
+   */
+  int32_t append(const DataContainerArray::Pointer& dca);
+
+  /**
+   * @brief writePipeline Writes the pipeline group into the open file, replacing an existing one.
+   * @param pipelineName Name of the pipeline dataset
+   * @param pipelineJson The pipeline as written by JsonFilterParametersWriter::writePipelineToString()
+   * @return Negative value on error, see getErrorMessage()
+   */
+  int32_t writePipeline(const QString& pipelineName, const QString& pipelineJson);
+
+  /**
+   * @brief close Flushes and closes the HDF5 file. The file stays readable as a regular .dream3d file.
+   */
+  void close();
+
+  /**
+   * @brief getFilePath Returns the path given to open()
+   */
+  QString getFilePath() const;
+
+  /**
+   * @brief getWriteXdmf Returns true if the Xdmf file is maintained
+   */
+  bool getWriteXdmf() const;
+
+  /**
+   * @brief getWriteTimeSeries Returns true if each append() is a time step
+   */
+  bool getWriteTimeSeries() const;
+
+  /**
+   * @brief getNumberOfSteps Returns the number of successful append() calls
+   */
+  size_t getNumberOfSteps() const;
+
+  /**
+   * @brief getNumberOfSlices Returns the number of Z slices written for the DataContainer 'dcName'
+   */
+  size_t getNumberOfSlices(const QString& dcName) const;
+
+  /**
+   * @brief getErrorMessage Returns a description of the last error
+   */
+  QString getErrorMessage() const;
+
+protected:
+  H5DataContainerStreamWriter();
+
+private:
+  struct StreamArray
+  {
+    IDataArray::Pointer prototype; // Unallocated array with the streamed type, name and component dimensions
+    std::vector<size_t> cDims;
+  };
+
+  struct StreamAttributeMatrix
+  {
+    QString name;
+    std::vector<StreamArray> arrays;
+  };
+
+  struct StreamStep
+  {
+    size_t zOffset = 0;
+    size_t zCount = 0;
+    FloatVec3Type origin;
+  };
+
+  struct StreamDataContainer
+  {
+    QString name;
+    SizeVec3Type dims; // X and Y are fixed, Z is the running total
+    FloatVec3Type origin;
+    FloatVec3Type spacing;
+    std::vector<StreamAttributeMatrix> attributeMatrices;
+    std::vector<StreamStep> steps;
+  };
+
+  int32_t initializeDataContainer(hid_t dcaGid, const DataContainer::Pointer& dc, StreamDataContainer& stream);
+  int32_t appendDataContainer(hid_t dcaGid, const DataContainer::Pointer& dc, StreamDataContainer& stream);
+  int32_t writeXdmf();
+  void writeVolumeXdmf(QTextStream& out, const StreamDataContainer& stream, const QString& hdfFileName) const;
+  void writeTimeStepXdmf(QTextStream& out, const StreamDataContainer& stream, size_t stepIndex, const QString& hdfFileName) const;
+  int32_t setError(int32_t code, const QString& message);
+
+  hid_t m_FileId = -1;
+  QString m_FilePath;
+  QString m_XdmfFilePath;
+  bool m_WriteXdmf = true;
+  bool m_WriteTimeSeries = false;
+  size_t m_NumberOfSteps = 0;
+  std::vector<StreamDataContainer> m_DataContainers;
+  QString m_ErrorMessage;
+
+public:
+  H5DataContainerStreamWriter(const H5DataContainerStreamWriter&) = delete;            // Copy Constructor Not Implemented
+  H5DataContainerStreamWriter(H5DataContainerStreamWriter&&) = delete;                 // Move Constructor Not Implemented
+  H5DataContainerStreamWriter& operator=(const H5DataContainerStreamWriter&) = delete; // Copy Assignment Not Implemented
+  H5DataContainerStreamWriter& operator=(H5DataContainerStreamWriter&&) = delete;      // Move Assignment Not Implemented
+};
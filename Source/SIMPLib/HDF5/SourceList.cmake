@@ -2,9 +2,11 @@
 set(SUBDIR_NAME HDF5)
 
 set(SIMPLib_${SUBDIR_NAME}_HDRS
+  ${SIMPLib_SOURCE_DIR}/HDF5/H5AsyncWriteQueue.h
   ${SIMPLib_SOURCE_DIR}/HDF5/H5BoundaryStatsDataDelegate.h
   ${SIMPLib_SOURCE_DIR}/HDF5/H5DataArrayReader.h
   ${SIMPLib_SOURCE_DIR}/HDF5/H5DataArrayWriter.hpp
+  ${SIMPLib_SOURCE_DIR}/HDF5/H5DataContainerStreamWriter.h
   ${SIMPLib_SOURCE_DIR}/HDF5/H5Macros.h
   ${SIMPLib_SOURCE_DIR}/HDF5/H5MatrixStatsDataDelegate.h
   ${SIMPLib_SOURCE_DIR}/HDF5/H5PrecipitateStatsDataDelegate.h
@@ -16,8 +18,10 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
 )
 
 set(SIMPLib_${SUBDIR_NAME}_SRCS
+  ${SIMPLib_SOURCE_DIR}/HDF5/H5AsyncWriteQueue.cpp
   ${SIMPLib_SOURCE_DIR}/HDF5/H5BoundaryStatsDataDelegate.cpp
   ${SIMPLib_SOURCE_DIR}/HDF5/H5DataArrayReader.cpp
+  ${SIMPLib_SOURCE_DIR}/HDF5/H5DataContainerStreamWriter.cpp
   ${SIMPLib_SOURCE_DIR}/HDF5/H5MatrixStatsDataDelegate.cpp
   ${SIMPLib_SOURCE_DIR}/HDF5/H5PrecipitateStatsDataDelegate.cpp
   ${SIMPLib_SOURCE_DIR}/HDF5/H5PrimaryStatsDataDelegate.cpp
@@ -0,0 +1,107 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "SIMPLib/HDF5/H5AsyncWriteQueue.h"
+
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class H5AsyncWriteQueueTest
+{
+
+public:
+  H5AsyncWriteQueueTest() = default;
+  virtual ~H5AsyncWriteQueueTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestJobsRunInOrder()
+  {
+    H5AsyncWriteQueue& queue = H5AsyncWriteQueue::Instance();
+    std::vector<int> order;
+    std::thread::id callerId = std::this_thread::get_id();
+    std::atomic<bool> ranOnCaller(false);
+    for(int i = 0; i < 50; i++)
+    {
+      queue.enqueue([&order, &ranOnCaller, callerId, i]() {
+        if(i % 10 == 0)
+        {
+          std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+        ranOnCaller = ranOnCaller || std::this_thread::get_id() == callerId;
+        order.push_back(i);
+      });
+    }
+    queue.waitForIdle();
+
+    DREAM3D_REQUIRE_EQUAL(queue.getNumberOfPendingJobs(), 0)
+    DREAM3D_REQUIRE_EQUAL(order.size(), 50)
+    for(int i = 0; i < 50; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(order[i], i)
+    }
+    DREAM3D_REQUIRE_EQUAL(ranOnCaller.load(), false)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestWaitForIdleWithoutJobs()
+  {
+    H5AsyncWriteQueue::Instance().waitForIdle();
+    DREAM3D_REQUIRE_EQUAL(H5AsyncWriteQueue::Instance().getNumberOfPendingJobs(), 0)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+    std::cout << "#### H5AsyncWriteQueueTest Starting ####" << std::endl;
+    DREAM3D_REGISTER_TEST(TestWaitForIdleWithoutJobs());
+    DREAM3D_REGISTER_TEST(TestJobsRunInOrder());
+  }
+
+private:
+  H5AsyncWriteQueueTest(const H5AsyncWriteQueueTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const H5AsyncWriteQueueTest&) = delete;         // Move assignment Not Implemented
+};
@@ -0,0 +1,228 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/QH5Lite.h"
+#include "H5Support/QH5Utilities.h"
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/HDF5/H5DataArrayReader.h"
+#include "SIMPLib/HDF5/H5DataContainerStreamWriter.h"
+#include "SIMPLib/HDF5/VTKH5Constants.h"
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class H5DataContainerStreamWriterTest
+{
+
+public:
+  H5DataContainerStreamWriterTest() = default;
+  virtual ~H5DataContainerStreamWriterTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+    QFile::remove(m_FilePath);
+    QFile::remove(m_XdmfFilePath);
+  }
+
+  // -----------------------------------------------------------------------------
+  // Builds one slab of 'numSlices' Z slices whose values encode their global slice index
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer createSlab(size_t firstSlice, size_t numSlices)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("ImageDataContainer");
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    image->setDimensions(k_XDim, k_YDim, numSlices);
+    image->setOrigin(0.0f, 0.0f, static_cast<float>(firstSlice));
+    dc->setGeometry(image);
+    dca->addOrReplaceDataContainer(dc);
+
+    std::vector<size_t> tDims = {k_XDim, k_YDim, numSlices};
+    AttributeMatrix::Pointer cellAm = AttributeMatrix::New(tDims, "CellData", AttributeMatrix::Type::Cell);
+    dc->addOrReplaceAttributeMatrix(cellAm);
+
+    size_t numTuples = k_XDim * k_YDim * numSlices;
+    Int32ArrayType::Pointer ids = Int32ArrayType::CreateArray(tDims, std::vector<size_t>(1, 1), "Ids", true);
+    FloatArrayType::Pointer vectors = FloatArrayType::CreateArray(tDims, std::vector<size_t>(1, 3), "Vectors", true);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      size_t slice = firstSlice + i / (k_XDim * k_YDim);
+      ids->setValue(i, static_cast<int32_t>(slice * 1000 + i % (k_XDim * k_YDim)));
+      for(size_t c = 0; c < 3; c++)
+      {
+        vectors->setComponent(i, c, static_cast<float>(slice) + 0.25f * static_cast<float>(c));
+      }
+    }
+    cellAm->insertOrAssign(ids);
+    cellAm->insertOrAssign(vectors);
+
+    // Feature data is not streamed and must not prevent the cell data from being appended
+    AttributeMatrix::Pointer featureAm = AttributeMatrix::New(std::vector<size_t>(1, 2), "FeatureData", AttributeMatrix::Type::CellFeature);
+    dc->addOrReplaceAttributeMatrix(featureAm);
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestAppendSlabs()
+  {
+    H5DataContainerStreamWriter::Pointer writer = H5DataContainerStreamWriter::New();
+    DREAM3D_REQUIRED(writer->open(m_FilePath, true, false), >=, 0)
+    // The pipeline goes through the open file instead of reopening it
+    const QString pipelineJson = QString("{\"PipelineBuilder\": {\"Number_Filters\": 0}}");
+    DREAM3D_REQUIRED(writer->writePipeline(SIMPL::StringConstants::PipelineGroupName, pipelineJson), >=, 0)
+
+    DREAM3D_REQUIRED(writer->append(createSlab(0, 1)), >=, 0)
+    DREAM3D_REQUIRED(writer->append(createSlab(1, 3)), >=, 0)
+    DREAM3D_REQUIRED(writer->append(createSlab(4, 2)), >=, 0)
+    DREAM3D_REQUIRE_EQUAL(writer->getNumberOfSteps(), 3)
+    DREAM3D_REQUIRE_EQUAL(writer->getNumberOfSlices("ImageDataContainer"), 6)
+
+    // A slab with different X/Y dimensions is rejected without touching the file
+    DataContainerArray::Pointer badSlab = createSlab(6, 1);
+    badSlab->getDataContainer("ImageDataContainer")->getGeometryAs<ImageGeom>()->setDimensions(k_XDim + 1, k_YDim, 1);
+    DREAM3D_REQUIRED(writer->append(badSlab), <, 0)
+    DREAM3D_REQUIRE_EQUAL(writer->getNumberOfSlices("ImageDataContainer"), 6)
+
+    writer->close();
+    DREAM3D_REQUIRE(QFileInfo::exists(m_XdmfFilePath))
+
+    hid_t fileId = QH5Utilities::openFile(m_FilePath, true);
+    DREAM3D_REQUIRED(fileId, >, 0)
+    H5ScopedFileSentinel sentinel(fileId, true);
+
+    hid_t pipelineGid = H5Gopen(fileId, SIMPL::StringConstants::PipelineGroupName.toLatin1().data(), H5P_DEFAULT);
+    DREAM3D_REQUIRED(pipelineGid, >, 0)
+    sentinel.addGroupId(pipelineGid);
+    QString readJson;
+    DREAM3D_REQUIRED(QH5Lite::readStringDataset(pipelineGid, SIMPL::StringConstants::PipelineGroupName, readJson), >=, 0)
+    DREAM3D_REQUIRE_EQUAL(readJson, pipelineJson)
+
+    QString amPath = SIMPL::StringConstants::DataContainerGroupName + "/ImageDataContainer/CellData";
+    hid_t amGid = H5Gopen(fileId, amPath.toLatin1().data(), H5P_DEFAULT);
+    DREAM3D_REQUIRED(amGid, >, 0)
+    sentinel.addGroupId(amGid);
+
+    Int32ArrayType::Pointer ids = std::dynamic_pointer_cast<Int32ArrayType>(H5DataArrayReader::ReadIDataArray(amGid, "Ids"));
+    DREAM3D_REQUIRE_VALID_POINTER(ids.get())
+    DREAM3D_REQUIRE_EQUAL(ids->getNumberOfTuples(), k_XDim * k_YDim * 6)
+    for(size_t i = 0; i < ids->getNumberOfTuples(); i++)
+    {
+      size_t slice = i / (k_XDim * k_YDim);
+      DREAM3D_REQUIRE_EQUAL(ids->getValue(i), static_cast<int32_t>(slice * 1000 + i % (k_XDim * k_YDim)))
+    }
+
+    FloatArrayType::Pointer vectors = std::dynamic_pointer_cast<FloatArrayType>(H5DataArrayReader::ReadIDataArray(amGid, "Vectors"));
+    DREAM3D_REQUIRE_VALID_POINTER(vectors.get())
+    DREAM3D_REQUIRE_EQUAL(vectors->getNumberOfComponents(), 3)
+    DREAM3D_REQUIRE_EQUAL(vectors->getComponent(k_XDim * k_YDim * 5, 2), 5.5f)
+
+    std::vector<size_t> tDims;
+    DREAM3D_REQUIRED(QH5Lite::readVectorAttribute(amGid, "Ids", SIMPL::HDF5::TupleDimensions, tDims), >=, 0)
+    DREAM3D_REQUIRE_EQUAL(tDims.size(), 3)
+    DREAM3D_REQUIRE_EQUAL(tDims[2], 6)
+
+    QString geomPath = SIMPL::StringConstants::DataContainerGroupName + "/ImageDataContainer/" + SIMPL::Geometry::Geometry;
+    hid_t geomGid = H5Gopen(fileId, geomPath.toLatin1().data(), H5P_DEFAULT);
+    DREAM3D_REQUIRED(geomGid, >, 0)
+    sentinel.addGroupId(geomGid);
+    std::vector<int64_t> volDims;
+    DREAM3D_REQUIRED(QH5Lite::readVectorDataset(geomGid, H5_DIMENSIONS, volDims), >=, 0)
+    DREAM3D_REQUIRE_EQUAL(volDims.size(), 3)
+    DREAM3D_REQUIRE_EQUAL(volDims[0], k_XDim)
+    DREAM3D_REQUIRE_EQUAL(volDims[1], k_YDim)
+    DREAM3D_REQUIRE_EQUAL(volDims[2], 6)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestTimeSeriesXdmf()
+  {
+    {
+      H5DataContainerStreamWriter::Pointer writer = H5DataContainerStreamWriter::New();
+      DREAM3D_REQUIRED(writer->open(m_FilePath, true, true), >=, 0)
+      DREAM3D_REQUIRED(writer->append(createSlab(0, 2)), >=, 0)
+      DREAM3D_REQUIRED(writer->append(createSlab(2, 2)), >=, 0)
+    }
+
+    QFile xdmfFile(m_XdmfFilePath);
+    DREAM3D_REQUIRE(xdmfFile.open(QIODevice::ReadOnly | QIODevice::Text))
+    QString xdmf = QString::fromLatin1(xdmfFile.readAll());
+    DREAM3D_REQUIRE(xdmf.contains("CollectionType=\"Temporal\""))
+    DREAM3D_REQUIRE_EQUAL(xdmf.count("<Time TimeType=\"Single\""), 2)
+    // The second step reads slices 2 and 3 out of the extensible dataset
+    DREAM3D_REQUIRE(xdmf.contains(QString("2 0 0 0 1 1 1 1 2 %1 %2 1").arg(k_YDim).arg(k_XDim)))
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+    std::cout << "#### H5DataContainerStreamWriterTest Starting ####" << std::endl;
+    DREAM3D_REGISTER_TEST(TestAppendSlabs());
+    DREAM3D_REGISTER_TEST(TestTimeSeriesXdmf());
+#if REMOVE_TEST_FILES
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+#endif
+  }
+
+private:
+  static constexpr size_t k_XDim = 5;
+  static constexpr size_t k_YDim = 4;
+
+  QString m_FilePath = UnitTest::TestTempDir + "/H5DataContainerStreamWriterTest.dream3d";
+  QString m_XdmfFilePath = UnitTest::TestTempDir + "/H5DataContainerStreamWriterTest.xdmf";
+
+  H5DataContainerStreamWriterTest(const H5DataContainerStreamWriterTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const H5DataContainerStreamWriterTest&) = delete;                   // Move assignment Not Implemented
+};
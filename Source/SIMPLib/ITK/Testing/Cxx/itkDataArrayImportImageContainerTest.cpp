@@ -0,0 +1,179 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/ITK/itkDataArrayImportImageContainer.h"
+
+#include "itkImage.h"
+#include "itkRGBPixel.h"
+#include "itkVectorImage.h"
+
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class itkDataArrayImportImageContainerTest
+{
+
+public:
+  itkDataArrayImportImageContainerTest() = default;
+  virtual ~itkDataArrayImportImageContainerTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestWrapScalarArray()
+  {
+    using ImageType = itk::Image<float, 3>;
+    using ContainerType = itk::DataArrayImportImageContainer<itk::SizeValueType, float>;
+
+    FloatArrayType::Pointer array = FloatArrayType::CreateArray(4 * 3 * 2, "Scalars", true);
+    array->initializeWithZeros();
+
+    ImageType::Pointer image = ImageType::New();
+    ImageType::SizeType size = {{4, 3, 2}};
+    image->SetRegions(size);
+    {
+      ContainerType::Pointer container = ContainerType::New();
+      DREAM3D_REQUIRE(container->SetDataArray(array))
+      image->SetPixelContainer(container);
+    }
+    DREAM3D_REQUIRE_EQUAL(image->GetBufferPointer(), array->data())
+
+    ImageType::IndexType index = {{1, 2, 1}};
+    image->SetPixel(index, 42.0f);
+    DREAM3D_REQUIRE_EQUAL(array->getValue(1 + 2 * 4 + 1 * 4 * 3), 42.0f)
+
+    // The image holds a reference, the array must survive the caller dropping its pointer.
+    FloatArrayType* rawArray = array.get();
+    array.reset();
+    DREAM3D_REQUIRE_EQUAL(image->GetBufferPointer(), rawArray->data())
+    image = nullptr;
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestWrapRGBArray()
+  {
+    using PixelType = itk::RGBPixel<uint8_t>;
+    using ContainerType = itk::DataArrayImportImageContainer<itk::SizeValueType, PixelType>;
+
+    UInt8ArrayType::Pointer array = UInt8ArrayType::CreateArray(10, std::vector<size_t>{3}, "RGB", true);
+    ContainerType::Pointer container = ContainerType::New();
+    DREAM3D_REQUIRE(container->SetDataArray(array))
+    DREAM3D_REQUIRE_EQUAL(container->Size(), 10)
+
+    // Wrong value type must be rejected rather than reinterpreted.
+    FloatArrayType::Pointer floats = FloatArrayType::CreateArray(30, "Floats", true);
+    DREAM3D_REQUIRE_EQUAL(container->SetDataArray(floats), false)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestAllocateIntoDataArray()
+  {
+    using ImageType = itk::Image<itk::RGBPixel<uint16_t>, 2>;
+    using ContainerType = itk::DataArrayImportImageContainer<itk::SizeValueType, ImageType::PixelType>;
+
+    ContainerType::Pointer container = ContainerType::New();
+    container->SetDataArrayName("Allocated");
+
+    ImageType::Pointer image = ImageType::New();
+    ImageType::SizeType size = {{8, 5}};
+    image->SetRegions(size);
+    image->SetPixelContainer(container);
+    image->Allocate();
+
+    IDataArray::Pointer allocated = container->GetDataArray();
+    DREAM3D_REQUIRE_VALID_POINTER(allocated.get())
+    DREAM3D_REQUIRE_EQUAL(allocated->getName(), QString("Allocated"))
+    DREAM3D_REQUIRE_EQUAL(allocated->getNumberOfTuples(), 40)
+    DREAM3D_REQUIRE_EQUAL(allocated->getNumberOfComponents(), 3)
+    DREAM3D_REQUIRE_EQUAL(allocated->getVoidPointer(0), static_cast<void*>(image->GetBufferPointer()))
+
+    // Releasing the image must not free memory still referenced by the DataArray.
+    image = nullptr;
+    UInt16ArrayType::Pointer typed = std::dynamic_pointer_cast<UInt16ArrayType>(allocated);
+    typed->setComponent(39, 2, 7);
+    DREAM3D_REQUIRE_EQUAL(typed->getComponent(39, 2), 7)
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestVectorImage()
+  {
+    using ImageType = itk::VectorImage<float, 2>;
+    using ContainerType = itk::DataArrayImportImageContainer<itk::SizeValueType, float>;
+
+    FloatArrayType::Pointer array = FloatArrayType::CreateArray(6 * 4, std::vector<size_t>{5}, "Vectors", true);
+    for(size_t i = 0; i < array->getSize(); i++)
+    {
+      array->setValue(i, static_cast<float>(i));
+    }
+
+    ContainerType::Pointer container = ContainerType::New();
+    DREAM3D_REQUIRE(container->SetDataArray(array))
+
+    ImageType::Pointer image = ImageType::New();
+    ImageType::SizeType size = {{6, 4}};
+    image->SetRegions(size);
+    image->SetVectorLength(5);
+    image->SetPixelContainer(container);
+
+    ImageType::IndexType index = {{2, 1}};
+    ImageType::PixelType pixel = image->GetPixel(index);
+    DREAM3D_REQUIRE_EQUAL(pixel[3], array->getComponent(2 + 1 * 6, 3))
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+    std::cout << "#### itkDataArrayImportImageContainerTest Starting ####" << std::endl;
+    DREAM3D_REGISTER_TEST(TestWrapScalarArray());
+    DREAM3D_REGISTER_TEST(TestWrapRGBArray());
+    DREAM3D_REGISTER_TEST(TestAllocateIntoDataArray());
+    DREAM3D_REGISTER_TEST(TestVectorImage());
+  }
+
+private:
+  itkDataArrayImportImageContainerTest(const itkDataArrayImportImageContainerTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const itkDataArrayImportImageContainerTest&) = delete;                       // Move assignment Not Implemented
+};
@@ -0,0 +1,141 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <vector>
+
+#include <itkImportImageContainer.h>
+#include <itkNumericTraits.h>
+#include <itkNumericTraitsRGBAPixel.h>
+#include <itkNumericTraitsRGBPixel.h>
+#include <itkNumericTraitsVectorPixel.h>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/ITK/itkSupportConstants.h"
+
+namespace itk
+{
+/** \class DataArrayImportImageContainer
+ *  \brief Pixel container whose memory is the buffer of a SIMPL DataArray.
+ *
+ * The container keeps a shared reference to the DataArray instead of taking
+ * ownership of its buffer, so neither side ever frees memory allocated by the
+ * other and the DataArray stays valid for as long as the ITK image uses it.
+ *
+ * It can be used in both directions:
+ *  - SetDataArray() exposes an existing DataArray to an ITK pipeline.
+ *  - When ITK allocates the container (e.g. a reader or filter output that had
+ *    this container installed with Image::SetPixelContainer()), the memory is
+ *    allocated as a new DataArray that GetDataArray() returns afterwards, so the
+ *    result can be inserted into an AttributeMatrix without a copy.
+ *
+ * TElement may be a scalar, a fixed size pixel (itk::RGBPixel, itk::RGBAPixel,
+ * itk::Vector, ...) or the internal scalar type of an itk::VectorImage. The
+ * DataArray always stores the underlying component ValueType.
+ */
+template <typename TElementIdentifier, typename TElement>
+class DataArrayImportImageContainer : public ImportImageContainer<TElementIdentifier, TElement>
+{
+public:
+  /** Standard class typedefs. */
+  using Self = DataArrayImportImageContainer;
+  using Superclass = ImportImageContainer<TElementIdentifier, TElement>;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  using ElementIdentifier = typename Superclass::ElementIdentifier;
+  using Element = typename Superclass::Element;
+  using ValueType = typename itk::NumericTraits<TElement>::ValueType;
+  using DataArrayValueType = ::DataArray<ValueType>;
+
+  /** Number of DataArray values stored per container element. */
+  static constexpr size_t ValuesPerElement = sizeof(TElement) / sizeof(ValueType);
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Standard part of every itk Object. */
+  itkTypeMacro(DataArrayImportImageContainer, ImportImageContainer);
+
+  /**
+   * Points the container at the buffer of 'dataArray' without taking ownership.
+   * Returns false if the array is not a DataArray<ValueType> or its size is not a
+   * whole number of elements.
+   */
+  bool SetDataArray(const IDataArray::Pointer& dataArray);
+
+  /** Returns the DataArray backing the container, or a null pointer if the memory is not owned by a DataArray. */
+  IDataArray::Pointer GetDataArray() const;
+
+  /** Name used for DataArrays that are allocated by the container. */
+  void SetDataArrayName(const QString& name);
+
+  /**
+   * Component dimensions used for DataArrays that are allocated by the container. Defaults to
+   * ValuesPerElement, which is correct for every pixel type except itk::VectorImage.
+   */
+  void SetComponentDimensions(const std::vector<size_t>& cDims);
+
+protected:
+  DataArrayImportImageContainer();
+  ~DataArrayImportImageContainer() override;
+
+  void PrintSelf(std::ostream& os, Indent indent) const override;
+
+  /**
+   * Allocates the memory as a new DataArray. The array only becomes the backing store once the
+   * superclass has installed the returned buffer, see SyncDataArray().
+   */
+  Element* AllocateElements(ElementIdentifier size, bool UseDefaultConstructor = false) const override;
+
+  void DeallocateManagedMemory() override;
+
+private:
+  void SyncDataArray() const;
+
+  mutable IDataArray::Pointer m_DataArray;
+  mutable IDataArray::Pointer m_PendingDataArray;
+  QString m_DataArrayName = QString("ImageData");
+  std::vector<size_t> m_ComponentDimensions = {ValuesPerElement};
+
+public:
+  DataArrayImportImageContainer(const Self&) = delete;
+  void operator=(const Self&) = delete;
+};
+} // end namespace itk
+
+#ifndef ITK_MANUAL_INSTANTIATION
+#include "itkDataArrayImportImageContainer.hxx"
+#endif
@@ -0,0 +1,148 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include "itkDataArrayImportImageContainer.h"
+
+namespace itk
+{
+
+template <typename TElementIdentifier, typename TElement>
+DataArrayImportImageContainer<TElementIdentifier, TElement>::DataArrayImportImageContainer() = default;
+
+template <typename TElementIdentifier, typename TElement>
+DataArrayImportImageContainer<TElementIdentifier, TElement>::~DataArrayImportImageContainer()
+{
+  // The superclass destructor would only see its own DeallocateManagedMemory() and delete[] the DataArray's buffer.
+  DeallocateManagedMemory();
+}
+
+template <typename TElementIdentifier, typename TElement>
+bool DataArrayImportImageContainer<TElementIdentifier, TElement>::SetDataArray(const IDataArray::Pointer& dataArray)
+{
+  typename DataArrayValueType::Pointer typedArray = std::dynamic_pointer_cast<DataArrayValueType>(dataArray);
+  if(nullptr == typedArray || typedArray->getSize() % ValuesPerElement != 0)
+  {
+    return false;
+  }
+
+  ElementIdentifier numElements = static_cast<ElementIdentifier>(typedArray->getSize() / ValuesPerElement);
+  // SetImportPointer() releases whatever the container held before, including a previous DataArray.
+  m_PendingDataArray.reset();
+  this->SetImportPointer(reinterpret_cast<Element*>(typedArray->data()), numElements, false);
+  m_DataArray = typedArray;
+  this->Modified();
+  return true;
+}
+
+template <typename TElementIdentifier, typename TElement>
+IDataArray::Pointer DataArrayImportImageContainer<TElementIdentifier, TElement>::GetDataArray() const
+{
+  SyncDataArray();
+  return m_DataArray;
+}
+
+template <typename TElementIdentifier, typename TElement>
+void DataArrayImportImageContainer<TElementIdentifier, TElement>::SyncDataArray() const
+{
+  // Reserve()/Squeeze() call AllocateElements() first and only install the returned buffer afterwards,
+  // so an allocated array becomes the backing store once the import pointer actually refers to it.
+  if(nullptr != m_PendingDataArray && m_PendingDataArray->getVoidPointer(0) == static_cast<void*>(this->GetImportPointer()))
+  {
+    m_DataArray = m_PendingDataArray;
+    m_PendingDataArray.reset();
+  }
+}
+
+template <typename TElementIdentifier, typename TElement>
+void DataArrayImportImageContainer<TElementIdentifier, TElement>::SetDataArrayName(const QString& name)
+{
+  m_DataArrayName = name;
+}
+
+template <typename TElementIdentifier, typename TElement>
+void DataArrayImportImageContainer<TElementIdentifier, TElement>::SetComponentDimensions(const std::vector<size_t>& cDims)
+{
+  m_ComponentDimensions = cDims;
+}
+
+template <typename TElementIdentifier, typename TElement>
+typename DataArrayImportImageContainer<TElementIdentifier, TElement>::Element* DataArrayImportImageContainer<TElementIdentifier, TElement>::AllocateElements(ElementIdentifier size,
+                                                                                                                                                           bool UseDefaultConstructor) const
+{
+  size_t numComps = 1;
+  for(const auto& cDim : m_ComponentDimensions)
+  {
+    numComps *= cDim;
+  }
+  size_t numValues = static_cast<size_t>(size) * ValuesPerElement;
+  if(numComps == 0 || numValues % numComps != 0)
+  {
+    throw MemoryAllocationError(__FILE__, __LINE__, "Component dimensions do not divide the requested image size.", ITK_LOCATION);
+  }
+
+  typename DataArrayValueType::Pointer data = DataArrayValueType::CreateArray(numValues / numComps, m_ComponentDimensions, m_DataArrayName, true);
+  if(nullptr == data || !data->isAllocated())
+  {
+    // We cannot construct an error string here because we may be out
+    // of memory.  Do not use the exception macro.
+    throw MemoryAllocationError(__FILE__, __LINE__, "Failed to allocate memory for image.", ITK_LOCATION);
+  }
+  // DataArray::allocate() value-initializes the buffer, which also satisfies UseDefaultConstructor for POD pixels.
+  (void)UseDefaultConstructor;
+  m_PendingDataArray = data; // Becomes m_DataArray in SyncDataArray() once the superclass installs the buffer
+  return reinterpret_cast<Element*>(data->data());
+}
+
+template <typename TElementIdentifier, typename TElement>
+void DataArrayImportImageContainer<TElementIdentifier, TElement>::DeallocateManagedMemory()
+{
+  SyncDataArray();
+  if(nullptr != m_DataArray)
+  {
+    // The buffer belongs to the DataArray; drop our reference and only let the superclass reset its bookkeeping.
+    m_DataArray.reset();
+    this->SetContainerManageMemory(false);
+  }
+  Superclass::DeallocateManagedMemory();
+}
+
+template <typename TElementIdentifier, typename TElement>
+void DataArrayImportImageContainer<TElementIdentifier, TElement>::PrintSelf(std::ostream& os, Indent indent) const
+{
+  Superclass::PrintSelf(os, indent);
+  os << indent << "DataArray: " << (nullptr != m_DataArray ? m_DataArray->getName().toStdString() : std::string("(none)")) << std::endl;
+}
+} // end namespace itk
@@ -10,6 +10,7 @@
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/ITK/itkDataArrayImportImageContainer.h"
 #include "SIMPLib/ITK/itkGetComponentsDimensions.h"
 #include "SIMPLib/ITK/itkInPlaceImageToDream3DDataFilter.h"
 
@@ -152,6 +153,13 @@ void ITK_IMAGE_READER_CLASS_NAME ::readImage(const DataArrayPath& dataArrayPath,
   }
   else
   {
+    // Let the reader decode straight into a DataArray so the result is handed to the attribute matrix without a copy.
+    using ContainerType = itk::DataArrayImportImageContainer<itk::SizeValueType, TPixel>;
+    typename ContainerType::Pointer pixelContainer = ContainerType::New();
+    pixelContainer->SetDataArrayName(dataArrayPath.getDataArrayName());
+    reader->GetOutput()->SetPixelContainer(pixelContainer);
+    reader->ReleaseDataBeforeUpdateFlagOff();
+
     typename ToDream3DType::Pointer toDream3DFilter = ToDream3DType::New();
     toDream3DFilter->SetInput(reader->GetOutput());
     toDream3DFilter->SetInPlace(true);
@@ -17,6 +17,7 @@
 #include <itkNumericTraitsVectorPixel.h>
 
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/ITK/itkDataArrayImportImageContainer.h"
 #include "SIMPLib/ITK/itkImportDream3DImageContainer.h"
 
 class DataContainer;
@@ -35,6 +36,7 @@ public:
 
   using ImageType = typename itk::Image<PixelType, VDimension>;
   using ImportImageContainerType = ImportDream3DImageContainer<itk::SizeValueType, PixelType>;
+  using DataArrayImportImageContainerType = DataArrayImportImageContainer<itk::SizeValueType, PixelType>;
   using ImagePointer = typename ImageType::Pointer;
   using ValueType = typename itk::NumericTraits<PixelType>::ValueType;
   using DataArrayPixelType = typename ::DataArray<ValueType>;
@@ -102,6 +102,21 @@ void InPlaceDream3DDataToImageFilter< PixelType, VDimension >::GenerateData()
   // Get data pointer
   AttributeMatrix::Pointer ma = m_DataContainer->getAttributeMatrix(m_AttributeMatrixArrayName.c_str());
   IDataArray::Pointer dataArray = ma->getAttributeArray(m_DataArrayName.c_str());
+  // get pointer to the output
+  ImagePointer outputPtr = this->GetOutput();
+  if(m_InPlace && !m_PixelContainerWillOwnTheBuffer)
+  {
+    // Share the DataArray with the image instead of copying it or handing over its buffer. The container
+    // keeps the DataArray alive for as long as the image needs it.
+    typename DataArrayImportImageContainerType::Pointer container = DataArrayImportImageContainerType::New();
+    if(!container->SetDataArray(dataArray))
+    {
+      itkExceptionMacro("Attribute array (" + m_DataArrayName + ") does not match the pixel type of the image");
+    }
+    outputPtr->SetBufferedRegion(outputPtr->GetLargestPossibleRegion());
+    outputPtr->SetPixelContainer(container);
+    return;
+  }
   size_t size = dataArray->getSize();
   PixelType *buffer;
   if(m_InPlace)
@@ -124,8 +139,6 @@ void InPlaceDream3DDataToImageFilter< PixelType, VDimension >::GenerateData()
     m_ImportImageContainer->SetImportPointer( buffer,
         size, m_PixelContainerWillOwnTheBuffer);
   }
-  // get pointer to the output
-  ImagePointer outputPtr = this->GetOutput();
   outputPtr->SetBufferedRegion( outputPtr->GetLargestPossibleRegion() );
   outputPtr->SetPixelContainer( m_ImportImageContainer );
  }
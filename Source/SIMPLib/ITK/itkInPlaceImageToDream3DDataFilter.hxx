@@ -1,6 +1,7 @@
 #pragma once
 
 #include "itkInPlaceImageToDream3DDataFilter.h"
+#include "itkDataArrayImportImageContainer.h"
 #include "itkGetComponentsDimensions.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include <QString>
@@ -143,7 +144,16 @@ void InPlaceImageToDream3DDataFilter<PixelType, VDimension>::GenerateData()
   }
   typename DataArrayPixelType::Pointer data;
   inputPtr->SetBufferedRegion(inputPtr->GetLargestPossibleRegion());
-  if(m_InPlace)
+  using DataArrayContainerType = DataArrayImportImageContainer<itk::SizeValueType, PixelType>;
+  auto* dataArrayContainer = dynamic_cast<DataArrayContainerType*>(inputPtr->GetPixelContainer());
+  if(m_InPlace && nullptr != dataArrayContainer && nullptr != dataArrayContainer->GetDataArray())
+  {
+    // The image memory already is a DataArray (e.g. a reader that was given a DataArrayImportImageContainer).
+    // Share it as is; there is no ownership to transfer and nothing to copy.
+    data = std::dynamic_pointer_cast<DataArrayPixelType>(dataArrayContainer->GetDataArray());
+    data->setName(m_DataArrayName.c_str());
+  }
+  else if(m_InPlace)
   {
     inputPtr->GetPixelContainer()->SetContainerManageMemory(false);
     data = DataArrayPixelType::WrapPointer(reinterpret_cast<ValueType*>(inputPtr->GetBufferPointer()), imageGeom->getNumberOfElements(), cDims, this->GetDataArrayName().c_str(), true);
@@ -153,7 +163,7 @@ void InPlaceImageToDream3DDataFilter<PixelType, VDimension>::GenerateData()
     data = DataArrayPixelType::CreateArray(imageGeom->getNumberOfElements(), cDims, m_DataArrayName.c_str(), true);
     if(nullptr != data.get())
     {
-      ::memcpy(data->getPointer(0), reinterpret_cast<ValueType*>(inputPtr->GetBufferPointer()), imageGeom->getNumberOfElements() * sizeof(ValueType));
+      ::memcpy(data->getPointer(0), reinterpret_cast<ValueType*>(inputPtr->GetBufferPointer()), data->getSize() * sizeof(ValueType));
     }
   }
   attrMat->addOrReplaceAttributeArray(data);
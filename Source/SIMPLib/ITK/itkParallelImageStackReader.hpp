@@ -0,0 +1,395 @@
+/* ============================================================================
+ * Copyright (c) 2019 BlueQuartz Software, LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the names of any of the BlueQuartz Software contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <QtCore/QObject>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+
+#include "itkImage.h"
+#include "itkImageFileReader.h"
+#include "itkNumericTraits.h"
+
+#include "SIMPLib/ITK/itkGetComponentsDimensions.h"
+
+/**
+ * @brief The ParallelImageStackReader class reads an ordered list of 2D image files (typically
+ * generated by FilePathGenerator::GenerateFileList) into consecutive Z slices of a single,
+ * pre-allocated DataArray. The ReadImageStack filter uses it to import image stacks.
+ *
+ * A bounded pool of decoder threads pulls slice indices from a shared counter. Each decoder hands
+ * ITK a non-owning pixel container that points at the slice's Z offset inside the destination
+ * array, so the file is decoded straight into its final location without an intermediate ITK image.
+ * Decoders are allowed to run at most ReadAhead slices past the lowest slice that has not finished
+ * yet, which keeps the completion order close to the file order even on high latency storage.
+ *
+ * Progress, the optional SliceReady callback, cancellation checks and error reporting all happen on
+ * the thread that called execute(), in ascending slice order. Decoder threads never touch the filter.
+ *
+ * The threads are plain std::threads rather than TBB tasks on purpose: the decoders spend most
+ * of their time blocked in file I/O and would otherwise starve the TBB arena used by compute filters.
+ */
+template <typename TPixel>
+class ParallelImageStackReader
+{
+public:
+  using ImageType = itk::Image<TPixel, 2>;
+  using ReaderType = itk::ImageFileReader<ImageType>;
+  using ValueType = typename itk::NumericTraits<TPixel>::ValueType;
+  using DataArrayType = DataArray<ValueType>;
+  using SliceReadyFunction = std::function<void(size_t)>;
+
+  ParallelImageStackReader() = default;
+  ~ParallelImageStackReader() = default;
+
+  ParallelImageStackReader(const ParallelImageStackReader&) = delete;            // Copy Constructor Not Implemented
+  ParallelImageStackReader(ParallelImageStackReader&&) = delete;                 // Move Constructor Not Implemented
+  ParallelImageStackReader& operator=(const ParallelImageStackReader&) = delete; // Copy Assignment Not Implemented
+  ParallelImageStackReader& operator=(ParallelImageStackReader&&) = delete;      // Move Assignment Not Implemented
+
+  /**
+   * @brief Sets the ordered list of files. Entry 'z' is decoded into Z slice 'z' of the destination.
+   * @param fileList
+   */
+  void setFileList(const QVector<QString>& fileList)
+  {
+    m_FileList = fileList;
+  }
+
+  /**
+   * @brief Sets the filter used for progress messages, cancellation and error reporting. May be nullptr.
+   * @param filter
+   */
+  void setFilter(AbstractFilter* filter)
+  {
+    m_Filter = filter;
+  }
+
+  /**
+   * @brief Sets the maximum number of files decoded concurrently. A value of 0 uses the hardware concurrency.
+   * @param maxReaders
+   */
+  void setMaxConcurrentReads(uint32_t maxReaders)
+  {
+    m_MaxConcurrentReads = maxReaders;
+  }
+
+  /**
+   * @brief Sets how many slices past the oldest unfinished slice a decoder may start on. A value of
+   * 0 uses twice the number of decoders.
+   * @param readAhead
+   */
+  void setReadAhead(size_t readAhead)
+  {
+    m_ReadAhead = readAhead;
+  }
+
+  /**
+   * @brief Sets a callback that is invoked on the calling thread, in ascending Z order, as soon as
+   * slice 'z' and every slice before it have been decoded.
+   * @param callback
+   */
+  void setSliceReadyCallback(const SliceReadyFunction& callback)
+  {
+    m_SliceReady = callback;
+  }
+
+  /**
+   * @brief Returns the error code of the first slice that failed, or 0.
+   * @return
+   */
+  int32_t getErrorCode() const
+  {
+    return m_ErrorCode;
+  }
+
+  /**
+   * @brief Returns the error message of the first slice that failed.
+   * @return
+   */
+  QString getErrorMessage() const
+  {
+    return m_ErrorMessage;
+  }
+
+  /**
+   * @brief Decodes every file into the destination array. The array must already hold
+   * sliceDims[0] * sliceDims[1] * fileCount tuples with the component count of TPixel.
+   * @param destination
+   * @param sliceDims The X and Y dimensions every file is expected to have.
+   * @return 0 on success, a negative error code on failure or 1 if the read was canceled.
+   */
+  int32_t execute(DataArrayType& destination, const std::array<size_t, 2>& sliceDims)
+  {
+    m_ErrorCode = 0;
+    m_ErrorMessage.clear();
+
+    const size_t numSlices = static_cast<size_t>(m_FileList.size());
+    const size_t numComps = ITKDream3DHelper::GetComponentsDimensions<TPixel>()[0];
+    const size_t slicePixels = sliceDims[0] * sliceDims[1];
+    if(numSlices == 0)
+    {
+      return 0;
+    }
+    if(destination.getNumberOfComponents() != static_cast<int32_t>(numComps) || destination.getNumberOfTuples() < slicePixels * numSlices)
+    {
+      setError(std::numeric_limits<size_t>::max(), -3001, QObject::tr("The destination array '%1' is too small to hold %2 slices of %3 x %4 pixels")
+                                                              .arg(destination.getName())
+                                                              .arg(numSlices)
+                                                              .arg(sliceDims[0])
+                                                              .arg(sliceDims[1]));
+      reportError();
+      return m_ErrorCode;
+    }
+
+    uint32_t numReaders = m_MaxConcurrentReads;
+    if(numReaders == 0)
+    {
+      numReaders = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+    numReaders = static_cast<uint32_t>(std::min(static_cast<size_t>(numReaders), numSlices));
+    size_t readAhead = m_ReadAhead == 0 ? 2 * static_cast<size_t>(numReaders) : m_ReadAhead;
+    readAhead = std::max(readAhead, static_cast<size_t>(numReaders));
+
+    m_Completed.assign(numSlices, 0);
+    m_NextSlice = 0;
+    m_OrderedFrontier = 0;
+    m_Stop = false;
+    m_ErrorSlice = std::numeric_limits<size_t>::max();
+
+    ValueType* basePtr = destination.getPointer(0);
+
+    std::vector<std::thread> readers;
+    readers.reserve(numReaders);
+    for(uint32_t i = 0; i < numReaders; i++)
+    {
+      readers.emplace_back([this, basePtr, slicePixels, numComps, sliceDims, readAhead, numSlices] {
+        while(true)
+        {
+          size_t z = 0;
+          {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_ReaderCondition.wait(lock, [this, readAhead, numSlices] { return m_Stop || m_NextSlice >= numSlices || m_NextSlice < m_OrderedFrontier + readAhead; });
+            if(m_Stop || m_NextSlice >= numSlices)
+            {
+              return;
+            }
+            z = m_NextSlice++;
+          }
+
+          readSlice(z, basePtr + z * slicePixels * numComps, slicePixels, sliceDims);
+
+          {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Completed[z] = 1;
+          }
+          m_ProgressCondition.notify_one();
+        }
+      });
+    }
+
+    // Report progress in slice order from the calling thread; the decoders only mark slices as complete.
+    size_t reported = 0;
+    bool canceled = false;
+    while(reported < numSlices)
+    {
+      size_t frontier = 0;
+      {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_ProgressCondition.wait_for(lock, std::chrono::milliseconds(100), [this, reported, numSlices] {
+          return m_Stop || (reported < numSlices && m_Completed[reported] != 0);
+        });
+        while(m_OrderedFrontier < numSlices && m_Completed[m_OrderedFrontier] != 0)
+        {
+          m_OrderedFrontier++;
+        }
+        frontier = m_OrderedFrontier;
+        if(m_ErrorSlice < frontier)
+        {
+          frontier = m_ErrorSlice;
+          m_Stop = true;
+        }
+      }
+      m_ReaderCondition.notify_all();
+
+      for(; reported < frontier; reported++)
+      {
+        if(m_SliceReady)
+        {
+          m_SliceReady(reported);
+        }
+      }
+      if(m_Filter != nullptr && frontier > 0)
+      {
+        m_Filter->notifyStatusMessage(QObject::tr("Read slice %1 of %2").arg(frontier).arg(numSlices));
+      }
+
+      if(m_Filter != nullptr && m_Filter->getCancel())
+      {
+        canceled = true;
+      }
+
+      std::lock_guard<std::mutex> lock(m_Mutex);
+      if(canceled)
+      {
+        m_Stop = true;
+      }
+      if(m_Stop)
+      {
+        break;
+      }
+    }
+    m_ReaderCondition.notify_all();
+
+    for(auto& reader : readers)
+    {
+      reader.join();
+    }
+
+    if(m_ErrorCode < 0)
+    {
+      reportError();
+      return m_ErrorCode;
+    }
+    return canceled ? 1 : 0;
+  }
+
+protected:
+  /**
+   * @brief Decodes a single file into the memory pointed to by 'slicePtr'. Runs on a decoder thread.
+   * @param z
+   * @param slicePtr
+   * @param slicePixels
+   * @param sliceDims
+   */
+  void readSlice(size_t z, ValueType* slicePtr, size_t slicePixels, const std::array<size_t, 2>& sliceDims)
+  {
+    const QString& filePath = m_FileList[static_cast<int>(z)];
+    try
+    {
+      typename ReaderType::Pointer reader = ReaderType::New();
+      reader->SetFileName(filePath.toStdString());
+      reader->UpdateOutputInformation();
+
+      typename ImageType::Pointer image = reader->GetOutput();
+      const typename ImageType::SizeType size = image->GetLargestPossibleRegion().GetSize();
+      if(size[0] != sliceDims[0] || size[1] != sliceDims[1])
+      {
+        setError(z, -3002, QObject::tr("The image '%1' has dimensions %2 x %3 but %4 x %5 was expected").arg(filePath).arg(size[0]).arg(size[1]).arg(sliceDims[0]).arg(sliceDims[1]));
+        return;
+      }
+
+      // Point the output's pixel container at the destination slice. The container does not own the
+      // memory and, because its capacity already matches the region, Allocate() will not replace it.
+      // The output must not be re-initialized before the update or the imported pointer is discarded.
+      reader->ReleaseDataBeforeUpdateFlagOff();
+      image->GetPixelContainer()->SetImportPointer(reinterpret_cast<TPixel*>(slicePtr), slicePixels, false);
+      reader->Update();
+
+      if(image->GetBufferPointer() != reinterpret_cast<TPixel*>(slicePtr))
+      {
+        // The reader swapped the buffer out from under us (e.g. a streaming ImageIO); fall back to a copy.
+        std::copy_n(reinterpret_cast<const ValueType*>(image->GetBufferPointer()), slicePixels * ITKDream3DHelper::GetComponentsDimensions<TPixel>()[0], slicePtr);
+      }
+    } catch(itk::ExceptionObject& err)
+    {
+      setError(z, -3003, QObject::tr("Failed to read image '%1': %2").arg(filePath).arg(err.GetDescription()));
+    } catch(std::exception& err)
+    {
+      // Anything else, e.g. std::bad_alloc, must not escape the decoder thread or the process terminates
+      setError(z, -3003, QObject::tr("Failed to read image '%1': %2").arg(filePath).arg(err.what()));
+    }
+  }
+
+  /**
+   * @brief Records the error for the lowest failing slice so that the reported error does not depend
+   * on thread scheduling.
+   * @param z
+   * @param code
+   * @param message
+   */
+  void setError(size_t z, int32_t code, const QString& message)
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if(m_ErrorCode == 0 || z < m_ErrorSlice)
+    {
+      m_ErrorSlice = z;
+      m_ErrorCode = code;
+      m_ErrorMessage = message;
+    }
+  }
+
+  void reportError()
+  {
+    if(m_Filter != nullptr)
+    {
+      m_Filter->setErrorCondition(m_ErrorCode, m_ErrorMessage);
+    }
+  }
+
+private:
+  QVector<QString> m_FileList;
+  AbstractFilter* m_Filter = nullptr;
+  uint32_t m_MaxConcurrentReads = 0;
+  size_t m_ReadAhead = 0;
+  SliceReadyFunction m_SliceReady;
+
+  int32_t m_ErrorCode = 0;
+  QString m_ErrorMessage;
+  size_t m_ErrorSlice = std::numeric_limits<size_t>::max();
+
+  std::mutex m_Mutex;
+  std::condition_variable m_ReaderCondition;
+  std::condition_variable m_ProgressCondition;
+  std::vector<uint8_t> m_Completed;
+  size_t m_NextSlice = 0;
+  size_t m_OrderedFrontier = 0;
+  bool m_Stop = false;
+};
@@ -38,6 +38,7 @@
 #include <chrono>
 #include <random>
 
+#include "SIMPLib/Geometry/TriangleBVH.h"
 #include "SIMPLib/Geometry/TriangleGeom.h"
 #include "SIMPLib/Geometry/VertexGeom.h"
 #include "SIMPLib/Math/MatrixMath.h"
@@ -1229,3 +1230,20 @@ char GeometryMath::PointInPolyhedron(TriangleGeom* faces, const Int32Int32Dynami
 
   return 'o';
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+char GeometryMath::PointInPolyhedron(const TriangleBVH& faces, const float* point)
+{
+  return faces.findContainment(point);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+char GeometryMath::PointInPolyhedron(const TriangleBVH& faces, const float* point, float& distToBoundary)
+{
+  distToBoundary = faces.findClosestPoint(point).distance;
+  return faces.findContainment(point);
+}
@@ -42,6 +42,7 @@
 
 class VertexGeom;
 class TriangleGeom;
+class TriangleBVH;
 
 /*
  * @class GeometryMath GeometryMath.h DREAM3DLib/Common/GeometryMath.h
@@ -200,6 +201,23 @@ SIMPLib_EXPORT char PointInPolyhedron(TriangleGeom* faces, const Int32Int32Dynam
 SIMPLib_EXPORT char PointInPolyhedron(TriangleGeom* faces, const Int32Int32DynamicListArray::ElementList& faceIds, VertexGeom* vertices, const float* point, const float* lowerLeft,
                                       const float* upperRight, float radius, float& distToBoundary);
 
+/**
+ * @brief Determines if a point is inside of a polyhedron whose faces are stored in a bounding volume hierarchy
+ * @param faces
+ * @param point
+ * @return
+ */
+SIMPLib_EXPORT char PointInPolyhedron(const TriangleBVH& faces, const float* point);
+
+/**
+ * @brief Determines if a point is inside of a polyhedron whose faces are stored in a bounding volume hierarchy
+ * @param faces
+ * @param point
+ * @param distToBoundary Exact distance from the point to the closest face
+ * @return
+ */
+SIMPLib_EXPORT char PointInPolyhedron(const TriangleBVH& faces, const float* point, float& distToBoundary);
+
 /**
  * @brief Determines if a point is inside of a triangle defined by 3 points
  * @param a
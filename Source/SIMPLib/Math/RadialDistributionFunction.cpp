@@ -35,9 +35,62 @@
 
 #include "RadialDistributionFunction.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include "SIMPLib/Math/SIMPLibRandom.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+/**
+ * @brief The RadialDistributionBinImpl class implements a threaded algorithm that histograms the
+ * distances between every pair of points. Each block of rows fills its own histogram.
+ */
+class RadialDistributionBinImpl
+{
+public:
+  RadialDistributionBinImpl(const float* points, size_t numPoints, float minDistance, float stepSize, std::vector<std::vector<size_t>>& blockCounts)
+  : m_Points(points)
+  , m_NumPoints(numPoints)
+  , m_MinDistance(minDistance)
+  , m_StepSize(stepSize)
+  , m_BlockCounts(blockCounts)
+  {
+  }
+  virtual ~RadialDistributionBinImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    const size_t numBlocks = m_BlockCounts.size();
+    for(size_t block = range.min(); block < range.max(); block++)
+    {
+      std::vector<size_t>& counts = m_BlockCounts[block];
+      const size_t maxBin = counts.size() - 1;
+      // Interleave the rows across the blocks; the first rows have the most pairs
+      for(size_t i = 1 + block; i < m_NumPoints; i += numBlocks)
+      {
+        const float* p = m_Points + 3 * i;
+        for(size_t j = i + 1; j < m_NumPoints; j++)
+        {
+          const float* q = m_Points + 3 * j;
+          float distance = sqrtf((p[0] - q[0]) * (p[0] - q[0]) + (p[1] - q[1]) * (p[1] - q[1]) + (p[2] - q[2]) * (p[2] - q[2]));
+          size_t bin = 0;
+          if(distance >= m_MinDistance)
+          {
+            bin = std::min(static_cast<size_t>((distance - m_MinDistance) / m_StepSize) + 1, maxBin);
+          }
+          counts[bin] += 2;
+        }
+      }
+    }
+  }
+
+private:
+  const float* m_Points;
+  size_t m_NumPoints;
+  float m_MinDistance;
+  float m_StepSize;
+  std::vector<std::vector<size_t>>& m_BlockCounts;
+};
 
 // -----------------------------------------------------------------------------
 //
@@ -56,7 +109,6 @@ std::vector<float> RadialDistributionFunction::GenerateRandomDistribution(float
 {
   std::vector<float> freq(numBins, 0);
   std::vector<float> randomCentroids;
-  std::vector<std::vector<float>> distancelist;
   size_t largeNumber = 1000;
   size_t numDistances = largeNumber * (largeNumber - 1);
 
@@ -68,10 +120,7 @@ std::vector<float> RadialDistributionFunction::GenerateRandomDistribution(float
 
   size_t totalpoints = xpoints * ypoints * zpoints;
 
-  float x, y, z;
-  float xn, yn, zn;
   float xc, yc, zc;
-  float r;
 
   size_t featureOwnerIdx = 0;
   size_t column, row, plane;
@@ -104,46 +153,21 @@ std::vector<float> RadialDistributionFunction::GenerateRandomDistribution(float
     randomCentroids[3 * i + 2] = zc;
   }
 
-  distancelist.resize(largeNumber);
-
-  // Calculating all of the distances and storing them in the distance list
-  for(size_t i = 1; i < largeNumber; i++)
-  {
+  // Bin the pair distances directly instead of storing all of them. Every pair is counted
+  // once from each end, as before, and the rows are split into fixed blocks with their own
+  // histogram so the totals do not depend on the number of threads.
+  const size_t numBlocks = std::min<size_t>(64, largeNumber);
+  std::vector<std::vector<size_t>> blockCounts(numBlocks, std::vector<size_t>(freq.size(), 0));
 
-    x = randomCentroids[3 * i];
-    y = randomCentroids[3 * i + 1];
-    z = randomCentroids[3 * i + 2];
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numBlocks);
+  dataAlg.execute(RadialDistributionBinImpl(randomCentroids.data(), largeNumber, minDistance, stepsize, blockCounts));
 
-    for(size_t j = i + 1; j < largeNumber; j++)
-    {
-
-      xn = randomCentroids[3 * j];
-      yn = randomCentroids[3 * j + 1];
-      zn = randomCentroids[3 * j + 2];
-
-      r = sqrtf((x - xn) * (x - xn) + (y - yn) * (y - yn) + (z - zn) * (z - zn));
-
-      distancelist[i].push_back(r);
-      distancelist[j].push_back(r);
-    }
-  }
-
-  // bin up the distance list
-  for(size_t i = 0; i < largeNumber; i++)
+  for(const auto& counts : blockCounts)
   {
-    for(size_t j = 0; j < distancelist[i].size(); j++)
+    for(size_t i = 0; i < counts.size(); i++)
     {
-      float distance = distancelist[i][j];
-      size_t bin = static_cast<size_t>((distance - minDistance) / stepsize);
-
-      if(distance < minDistance)
-      {
-        freq[0]++;
-      }
-      else
-      {
-        freq[bin + 1]++;
-      }
+      freq[i] += static_cast<float>(counts[i]);
     }
   }
 
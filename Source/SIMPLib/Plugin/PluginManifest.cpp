@@ -0,0 +1,238 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "PluginManifest.h"
+
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QSaveFile>
+#include <QtCore/QStandardPaths>
+
+#include "SIMPLib/SIMPLibVersion.h"
+#include "SIMPLib/Plugin/SIMPLPluginConstants.h"
+
+namespace
+{
+const QString k_FormatVersionKey("FormatVersion");
+const int k_FormatVersion = 1;
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PluginManifest::PluginManifest() = default;
+
+// -----------------------------------------------------------------------------
+PluginManifest::~PluginManifest() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PluginManifest::DefaultFilePath()
+{
+  QByteArray envPath = qgetenv("SIMPL_PLUGIN_MANIFEST");
+  if(!envPath.isEmpty())
+  {
+    return QString::fromLocal8Bit(envPath);
+  }
+  return QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation) + "/SIMPL/PluginManifest.json";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PluginManifest::readFile(const QString& filePath)
+{
+  m_Entries.clear();
+  m_Modified = false;
+
+  QFile file(filePath);
+  if(!file.open(QIODevice::ReadOnly))
+  {
+    return false;
+  }
+
+  QJsonParseError parseError;
+  QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &parseError);
+  if(parseError.error != QJsonParseError::NoError || !doc.isObject())
+  {
+    return false;
+  }
+
+  QJsonObject root = doc.object();
+  if(root[k_FormatVersionKey].toInt() != k_FormatVersion)
+  {
+    return false;
+  }
+
+  QJsonArray plugins = root[SIMPL::JSON::Plugins].toArray();
+  for(const auto& pluginValue : plugins)
+  {
+    QJsonObject pluginObj = pluginValue.toObject();
+    PluginEntry entry;
+    entry.path = pluginObj[SIMPL::JSON::Location].toString();
+    entry.lastModified = static_cast<qint64>(pluginObj[SIMPL::JSON::LastModified].toDouble());
+    entry.fileSize = static_cast<qint64>(pluginObj[SIMPL::JSON::FileSize].toDouble());
+    entry.version = pluginObj[SIMPL::JSON::Version].toString();
+    if(entry.path.isEmpty())
+    {
+      continue;
+    }
+
+    QJsonArray filters = pluginObj[SIMPL::JSON::Filters].toArray();
+    entry.filters.reserve(static_cast<size_t>(filters.size()));
+    for(const auto& filterValue : filters)
+    {
+      QJsonObject filterObj = filterValue.toObject();
+      FilterEntry filter;
+      filter.className = filterObj[SIMPL::JSON::ClassName].toString();
+      filter.uuid = QUuid(filterObj[SIMPL::JSON::Uuid].toString());
+      if(!filter.className.isEmpty() && !filter.uuid.isNull())
+      {
+        entry.filters.push_back(filter);
+      }
+    }
+    m_Entries[entry.path] = entry;
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PluginManifest::writeFile(const QString& filePath) const
+{
+  QJsonArray plugins;
+  for(const auto& entry : m_Entries)
+  {
+    if(!QFileInfo::exists(entry.path))
+    {
+      continue;
+    }
+
+    QJsonArray filters;
+    for(const auto& filter : entry.filters)
+    {
+      QJsonObject filterObj;
+      filterObj[SIMPL::JSON::ClassName] = filter.className;
+      filterObj[SIMPL::JSON::Uuid] = filter.uuid.toString();
+      filters.append(filterObj);
+    }
+
+    QJsonObject pluginObj;
+    pluginObj[SIMPL::JSON::Location] = entry.path;
+    pluginObj[SIMPL::JSON::LastModified] = static_cast<double>(entry.lastModified);
+    pluginObj[SIMPL::JSON::FileSize] = static_cast<double>(entry.fileSize);
+    pluginObj[SIMPL::JSON::Version] = entry.version;
+    pluginObj[SIMPL::JSON::Filters] = filters;
+    plugins.append(pluginObj);
+  }
+
+  QJsonObject root;
+  root[k_FormatVersionKey] = k_FormatVersion;
+  root[SIMPL::JSON::Plugins] = plugins;
+
+  QFileInfo fi(filePath);
+  if(!QDir().mkpath(fi.absolutePath()))
+  {
+    return false;
+  }
+
+  QSaveFile file(filePath);
+  if(!file.open(QIODevice::WriteOnly))
+  {
+    return false;
+  }
+  file.write(QJsonDocument(root).toJson());
+  return file.commit();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const PluginManifest::PluginEntry* PluginManifest::findCurrentEntry(const QFileInfo& pluginFile) const
+{
+  auto iter = m_Entries.find(pluginFile.absoluteFilePath());
+  if(iter == m_Entries.end())
+  {
+    return nullptr;
+  }
+
+  const PluginEntry& entry = iter.value();
+  PluginEntry current = CreateEntry(pluginFile);
+  if(entry.lastModified != current.lastModified || entry.fileSize != current.fileSize || entry.version != current.version)
+  {
+    return nullptr;
+  }
+  return &entry;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PluginManifest::PluginEntry PluginManifest::CreateEntry(const QFileInfo& pluginFile)
+{
+  PluginEntry entry;
+  entry.path = pluginFile.absoluteFilePath();
+  entry.lastModified = pluginFile.lastModified().toMSecsSinceEpoch();
+  entry.fileSize = pluginFile.size();
+  entry.version = SIMPLib::Version::Complete();
+  return entry;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PluginManifest::setEntry(const PluginEntry& entry)
+{
+  m_Entries[entry.path] = entry;
+  m_Modified = true;
+}
+
+// -----------------------------------------------------------------------------
+int PluginManifest::size() const
+{
+  return m_Entries.size();
+}
+
+// -----------------------------------------------------------------------------
+bool PluginManifest::isModified() const
+{
+  return m_Modified;
+}
@@ -0,0 +1,142 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <vector>
+
+#include <QtCore/QMap>
+#include <QtCore/QString>
+#include <QtCore/QUuid>
+
+#include "SIMPLib/SIMPLib.h"
+
+class QFileInfo;
+
+/**
+ * @brief The PluginManifest class is a persistent cache of the filters each plugin library provides. Every entry
+ * records the plugin's absolute path, modification time, file size and the SIMPLib version that loaded it, together
+ * with the UUID and class name of every filter the plugin registered. An entry is only used while all of these
+ * still match, so rebuilding or replacing a plugin invalidates it.
+ *
+ * The manifest is a JSON file. Several installations may share it; entries are keyed by absolute path and entries
+ * of plugins that no longer exist are dropped when the file is written.
+ */
+class SIMPLib_EXPORT PluginManifest
+{
+public:
+  struct FilterEntry
+  {
+    QString className;
+    QUuid uuid;
+  };
+
+  struct PluginEntry
+  {
+    QString path;
+    qint64 lastModified = 0;
+    qint64 fileSize = 0;
+    QString version;
+    std::vector<FilterEntry> filters;
+  };
+
+  PluginManifest();
+  virtual ~PluginManifest();
+
+  /**
+   * @brief Returns the location of the manifest: the SIMPL_PLUGIN_MANIFEST environment variable if it is set,
+   * otherwise PluginManifest.json in the user's generic cache directory.
+   * @return
+   */
+  static QString DefaultFilePath();
+
+  /**
+   * @brief Replaces the entries by the contents of 'filePath'. A missing or unreadable file leaves the manifest
+   * empty.
+   * @param filePath
+   * @return false if the file could not be read or parsed
+   */
+  bool readFile(const QString& filePath);
+
+  /**
+   * @brief Writes the entries to 'filePath', replacing the file atomically so concurrent readers never see a
+   * partial manifest. Entries of plugins that no longer exist are left out.
+   * @param filePath
+   * @return
+   */
+  bool writeFile(const QString& filePath) const;
+
+  /**
+   * @brief Returns the entry for 'pluginFile' if it still describes the file on disk, nullptr otherwise.
+   * @param pluginFile
+   * @return
+   */
+  const PluginEntry* findCurrentEntry(const QFileInfo& pluginFile) const;
+
+  /**
+   * @brief Creates an entry for 'pluginFile' that holds no filters yet, stamped with the file's current
+   * modification time and size.
+   * @param pluginFile
+   * @return
+   */
+  static PluginEntry CreateEntry(const QFileInfo& pluginFile);
+
+  /**
+   * @brief Adds or replaces the entry for entry.path
+   * @param entry
+   */
+  void setEntry(const PluginEntry& entry);
+
+  /**
+   * @brief Returns the number of entries
+   * @return
+   */
+  int size() const;
+
+  /**
+   * @brief Returns true if entries were added or replaced since the manifest was read
+   * @return
+   */
+  bool isModified() const;
+
+private:
+  QMap<QString, PluginEntry> m_Entries;
+  bool m_Modified = false;
+
+public:
+  PluginManifest(const PluginManifest&) = delete;            // Copy Constructor Not Implemented
+  PluginManifest(PluginManifest&&) = delete;                 // Move Constructor Not Implemented
+  PluginManifest& operator=(const PluginManifest&) = delete; // Copy Assignment Not Implemented
+  PluginManifest& operator=(PluginManifest&&) = delete;      // Move Assignment Not Implemented
+};
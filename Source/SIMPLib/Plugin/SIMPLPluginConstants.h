@@ -56,6 +56,8 @@ const QString Location("Location");
 const QString Description("Description");
 const QString Copyright("Copyright");
 const QString License("License");
+const QString LastModified("LastModified");
+const QString FileSize("FileSize");
 
 const QString Pipeline("Pipeline");
 const QString NumFilters("NumFilters");
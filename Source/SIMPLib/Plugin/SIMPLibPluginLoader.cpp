@@ -43,7 +43,9 @@
 #include <QtCore/QCoreApplication>
 #include <QtCore/QDebug>
 #include <QtCore/QDir>
+#include <QtCore/QFileInfo>
 #include <QtCore/QPluginLoader>
+#include <QtCore/QSet>
 #include <QtCore/QStringList>
 
 #include "SIMPLib/Filtering/FilterManager.h"
@@ -63,7 +65,7 @@ SIMPLibPluginLoader::~SIMPLibPluginLoader() = default;
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void SIMPLibPluginLoader::LoadPluginFilters(FilterManager* filterManager, bool quiet)
+QStringList SIMPLibPluginLoader::FindPluginFilePaths(bool quiet)
 {
   QStringList pluginDirs;
   pluginDirs << qApp->applicationDirPath();
@@ -233,42 +235,111 @@ void SIMPLibPluginLoader::LoadPluginFilters(FilterManager* filterManager, bool q
     }
   }
 
+  return pluginFilePaths;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLibPluginLoader::LoadPluginFilters(FilterManager* filterManager, bool quiet)
+{
+  QStringList pluginFilePaths = FindPluginFilePaths(quiet);
+
   FilterManager::RegisterKnownFilters(filterManager);
 
-  PluginManager* pluginManager = PluginManager::Instance();
   QStringList pluginFileNames;
-  QVector<ISIMPLibPlugin*> loadedPlugins;
 
   // Now that we have a sorted list of plugins, go ahead and load them all from the
   // file system and add each to the toolbar and menu
-  for(QString path : pluginFilePaths)
+  for(const QString& path : pluginFilePaths)
   {
-    if(!quiet)
+    QString fileName = QFileInfo(path).fileName();
+    if(pluginFileNames.contains(fileName, Qt::CaseSensitive))
     {
-      qDebug() << "Plugin Being Loaded:" << path;
+      continue;
     }
-    QPluginLoader loader(path);
+    if(LoadPlugin(path, filterManager, quiet) != nullptr)
+    {
+      pluginFileNames += fileName;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLibPluginLoader::LoadPluginManifest(FilterManager* filterManager, const QString& manifestFilePath, bool quiet)
+{
+  QString filePath = manifestFilePath.isEmpty() ? PluginManifest::DefaultFilePath() : manifestFilePath;
+  PluginManifest manifest;
+  if(!manifest.readFile(filePath) && !quiet)
+  {
+    qDebug() << "No usable plugin manifest at" << filePath << ". All plugins will be loaded.";
+  }
+
+  QStringList pluginFilePaths = FindPluginFilePaths(quiet);
+
+  FilterManager::RegisterKnownFilters(filterManager);
+
+  QStringList pluginFileNames;
+  int deferredCount = 0;
+  for(const QString& path : pluginFilePaths)
+  {
     QFileInfo fi(path);
-    QString fileName = fi.fileName();
-    QObject* plugin = loader.instance();
-    if(!quiet)
+    if(pluginFileNames.contains(fi.fileName(), Qt::CaseSensitive))
     {
-      qDebug() << "    Pointer: " << plugin << "\n";
+      continue;
     }
-    if((plugin != nullptr) && !pluginFileNames.contains(fileName, Qt::CaseSensitive))
+
+    // An up to date entry lets us register the filters without touching the library
+    const PluginManifest::PluginEntry* entry = manifest.findCurrentEntry(fi);
+    if(entry != nullptr)
     {
-      ISIMPLibPlugin* ipPlugin = qobject_cast<ISIMPLibPlugin*>(plugin);
-      if(ipPlugin != nullptr)
+      for(const auto& filter : entry->filters)
       {
-        loadedPlugins.push_back(ipPlugin);
-        ipPlugin->registerFilters(filterManager);
-        ipPlugin->setDidLoad(true);
-        ipPlugin->setLocation(path);
-        pluginManager->addPlugin(ipPlugin);
+        filterManager->addDeferredFilterFactory(filter.className, filter.uuid, entry->path);
       }
-      pluginFileNames += fileName;
+      pluginFileNames += fi.fileName();
+      deferredCount++;
+      continue;
     }
-    else if(!quiet)
+
+    PluginManifest::PluginEntry newEntry = PluginManifest::CreateEntry(fi);
+    if(LoadPlugin(newEntry.path, filterManager, quiet, &newEntry) != nullptr)
+    {
+      manifest.setEntry(newEntry);
+      pluginFileNames += fi.fileName();
+    }
+  }
+
+  if(manifest.isModified() && !manifest.writeFile(filePath) && !quiet)
+  {
+    qDebug() << "Could not write the plugin manifest" << filePath;
+  }
+  if(!quiet)
+  {
+    qDebug() << "Deferred loading of" << deferredCount << "of" << pluginFileNames.size() << "plugins";
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ISIMPLibPlugin* SIMPLibPluginLoader::LoadPlugin(const QString& path, FilterManager* filterManager, bool quiet, PluginManifest::PluginEntry* manifestEntry)
+{
+  if(!quiet)
+  {
+    qDebug() << "Plugin Being Loaded:" << path;
+  }
+  QPluginLoader loader(path);
+  QObject* plugin = loader.instance();
+  if(!quiet)
+  {
+    qDebug() << "    Pointer: " << plugin << "\n";
+  }
+  if(plugin == nullptr)
+  {
+    if(!quiet)
     {
       QString message("The plugin did not load with the following error\n");
       message.append(loader.errorString());
@@ -276,5 +347,37 @@ void SIMPLibPluginLoader::LoadPluginFilters(FilterManager* filterManager, bool q
       message.append("Possible causes include missing libraries that plugin depends on.");
       qDebug() << message;
     }
+    return nullptr;
+  }
+
+  ISIMPLibPlugin* ipPlugin = qobject_cast<ISIMPLibPlugin*>(plugin);
+  if(ipPlugin == nullptr)
+  {
+    return nullptr;
+  }
+
+  QSet<QUuid> previousUuids;
+  if(manifestEntry != nullptr)
+  {
+    for(const QUuid& uuid : filterManager->getRegisteredUuids())
+    {
+      previousUuids.insert(uuid);
+    }
+  }
+  ipPlugin->registerFilters(filterManager);
+  ipPlugin->setDidLoad(true);
+  ipPlugin->setLocation(path);
+  PluginManager::Instance()->addPlugin(ipPlugin);
+
+  if(manifestEntry != nullptr)
+  {
+    for(const QUuid& uuid : filterManager->getRegisteredUuids())
+    {
+      if(!previousUuids.contains(uuid))
+      {
+        manifestEntry->filters.push_back({filterManager->getFactoryFromUuid(uuid)->getFilterClassName(), uuid});
+      }
+    }
   }
+  return ipPlugin;
 }
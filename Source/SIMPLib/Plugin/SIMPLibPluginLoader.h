@@ -35,9 +35,13 @@
 
 #pragma once
 
+#include <QtCore/QStringList>
+
 #include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Plugin/PluginManifest.h"
 
 class FilterManager;
+class ISIMPLibPlugin;
 
 /**
  * @brief The SIMPLibPluginLoader class loads all the plugins that can be
@@ -56,6 +60,35 @@ public:
    */
   static void LoadPluginFilters(FilterManager* filterManager, bool quiet = false);
 
+  /**
+   * @brief LoadPluginManifest Registers the filters of every plugin without loading the plugins whose
+   * entry in the PluginManifest is still current. Their filters are registered with the FilterManager as
+   * deferred filters and a plugin is only loaded once one of its factories is requested. Plugins that are new
+   * or changed are loaded right away and their entries are written back to the manifest.
+   * @param filterManager The FilterManager object to register the filters with
+   * @param manifestFilePath The manifest file. An empty path uses PluginManifest::DefaultFilePath()
+   * @param quiet Dump progress to std::cout
+   */
+  static void LoadPluginManifest(FilterManager* filterManager, const QString& manifestFilePath = QString(), bool quiet = false);
+
+  /**
+   * @brief FindPluginFilePaths Returns the paths of all plugin files in the plugin directories, which are
+   * searched relative to the application and in SIMPL_PLUGIN_PATH
+   * @param quiet Dump progress to std::cout
+   * @return
+   */
+  static QStringList FindPluginFilePaths(bool quiet = false);
+
+  /**
+   * @brief LoadPlugin Loads the plugin library at 'path', registers its filters and adds it to the PluginManager
+   * @param path
+   * @param filterManager
+   * @param quiet Dump progress to std::cout
+   * @param manifestEntry If not nullptr, receives the filters the plugin registered
+   * @return The plugin or nullptr if the library could not be loaded
+   */
+  static ISIMPLibPlugin* LoadPlugin(const QString& path, FilterManager* filterManager, bool quiet = false, PluginManifest::PluginEntry* manifestEntry = nullptr);
+
 protected:
   SIMPLibPluginLoader();
 
@@ -52,6 +52,7 @@ set(SIMPLib_Plugin_HDRS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ISIMPLibPlugin.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLibPluginLoader.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PluginManager.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PluginManifest.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PluginProxy.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLPluginConstants.h
 
@@ -59,6 +60,7 @@ set(SIMPLib_Plugin_HDRS
 set(SIMPLib_Plugin_SRCS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLibPluginLoader.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PluginManager.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PluginManifest.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PluginProxy.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLibPlugin.cpp
 )
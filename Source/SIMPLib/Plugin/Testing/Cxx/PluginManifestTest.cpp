@@ -0,0 +1,198 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Plugin/PluginManifest.h"
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class PluginManifestTest
+{
+public:
+  PluginManifestTest() = default;
+  virtual ~PluginManifestTest() = default;
+
+  QString testDir()
+  {
+    return UnitTest::TestTempDir + "/PluginManifestTest";
+  }
+
+  QString pluginFilePath()
+  {
+    return testDir() + "/Fake.plugin";
+  }
+
+  QString manifestFilePath()
+  {
+    return testDir() + "/PluginManifest.json";
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QFile::remove(pluginFilePath());
+    QFile::remove(manifestFilePath());
+    QDir().rmdir(testDir());
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void writePluginFile(const QByteArray& contents)
+  {
+    QDir().mkpath(testDir());
+    QFile file(pluginFilePath());
+    DREAM3D_REQUIRE(file.open(QIODevice::WriteOnly))
+    file.write(contents);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRoundTrip()
+  {
+    writePluginFile("not really a library");
+    QUuid uuid0 = QUuid::createUuid();
+    QUuid uuid1 = QUuid::createUuid();
+
+    {
+      PluginManifest manifest;
+      DREAM3D_REQUIRE_EQUAL(manifest.readFile(testDir() + "/DoesNotExist.json"), false)
+      DREAM3D_REQUIRE_EQUAL(manifest.size(), 0)
+
+      PluginManifest::PluginEntry entry = PluginManifest::CreateEntry(QFileInfo(pluginFilePath()));
+      entry.filters.push_back({"FirstFilter", uuid0});
+      entry.filters.push_back({"SecondFilter", uuid1});
+      manifest.setEntry(entry);
+      DREAM3D_REQUIRE_EQUAL(manifest.isModified(), true)
+      DREAM3D_REQUIRE(manifest.findCurrentEntry(QFileInfo(pluginFilePath())) != nullptr)
+      DREAM3D_REQUIRE_EQUAL(manifest.writeFile(manifestFilePath()), true)
+    }
+
+    {
+      PluginManifest manifest;
+      DREAM3D_REQUIRE_EQUAL(manifest.readFile(manifestFilePath()), true)
+      DREAM3D_REQUIRE_EQUAL(manifest.isModified(), false)
+      DREAM3D_REQUIRE_EQUAL(manifest.size(), 1)
+      const PluginManifest::PluginEntry* entry = manifest.findCurrentEntry(QFileInfo(pluginFilePath()));
+      DREAM3D_REQUIRE(entry != nullptr)
+      DREAM3D_REQUIRE_EQUAL(entry->filters.size(), 2)
+      DREAM3D_REQUIRE(entry->filters[0].className == "FirstFilter")
+      DREAM3D_REQUIRE(entry->filters[0].uuid == uuid0)
+      DREAM3D_REQUIRE(entry->filters[1].className == "SecondFilter")
+      DREAM3D_REQUIRE(entry->filters[1].uuid == uuid1)
+    }
+
+    // A rebuilt plugin no longer matches its entry
+    writePluginFile("a rebuilt library that is larger");
+    {
+      PluginManifest manifest;
+      DREAM3D_REQUIRE_EQUAL(manifest.readFile(manifestFilePath()), true)
+      DREAM3D_REQUIRE(manifest.findCurrentEntry(QFileInfo(pluginFilePath())) == nullptr)
+    }
+
+    // Entries of plugins that are gone are not written back
+    QFile::remove(pluginFilePath());
+    {
+      PluginManifest manifest;
+      DREAM3D_REQUIRE_EQUAL(manifest.readFile(manifestFilePath()), true)
+      DREAM3D_REQUIRE_EQUAL(manifest.writeFile(manifestFilePath()), true)
+      DREAM3D_REQUIRE_EQUAL(manifest.readFile(manifestFilePath()), true)
+      DREAM3D_REQUIRE_EQUAL(manifest.size(), 0)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestDeferredFilters()
+  {
+    FilterManager* fm = FilterManager::Instance();
+    FilterManager::Collection factories = fm->getFactories();
+    DREAM3D_REQUIRE(!factories.isEmpty())
+
+    // Registered filters cannot be deferred a second time
+    IFilterFactory::Pointer registered = factories.first();
+    DREAM3D_REQUIRE_EQUAL(fm->addDeferredFilterFactory(factories.firstKey(), QUuid::createUuid(), pluginFilePath()), false)
+    DREAM3D_REQUIRE_EQUAL(fm->addDeferredFilterFactory("DeferredFilter", registered->getUuid(), pluginFilePath()), false)
+
+    QUuid uuid = QUuid::createUuid();
+    DREAM3D_REQUIRE_EQUAL(fm->addDeferredFilterFactory("DeferredFilter", uuid, pluginFilePath()), true)
+    DREAM3D_REQUIRE_EQUAL(fm->addDeferredFilterFactory("DeferredFilter", QUuid::createUuid(), pluginFilePath()), false)
+    DREAM3D_REQUIRE_EQUAL(fm->contains(uuid), true)
+    DREAM3D_REQUIRE_EQUAL(fm->isDeferred(uuid), true)
+    DREAM3D_REQUIRE_EQUAL(fm->getRegisteredUuids().contains(uuid), false)
+
+    // The plugin does not exist, so the lookup fails once and the filter is forgotten
+    DREAM3D_REQUIRE(nullptr == fm->getFactoryFromUuid(uuid))
+    DREAM3D_REQUIRE_EQUAL(fm->isDeferred(uuid), false)
+    DREAM3D_REQUIRE_EQUAL(fm->contains(uuid), false)
+    DREAM3D_REQUIRE(nullptr == fm->getFactoryFromClassName("DeferredFilter"))
+
+    // Removing a deferred filter never loads its plugin
+    uuid = QUuid::createUuid();
+    DREAM3D_REQUIRE_EQUAL(fm->addDeferredFilterFactory("DeferredFilter", uuid, pluginFilePath()), true)
+    DREAM3D_REQUIRE_EQUAL(fm->removeFilterFactory(uuid), true)
+    DREAM3D_REQUIRE_EQUAL(fm->contains(uuid), false)
+    DREAM3D_REQUIRE_EQUAL(fm->getFactories().size(), factories.size())
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### PluginManifestTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestRoundTrip());
+    DREAM3D_REGISTER_TEST(TestDeferredFilters());
+
+    DREAM3D_REGISTER_TEST(RemoveTestFiles());
+  }
+
+private:
+  PluginManifestTest(const PluginManifestTest&); // Copy Constructor Not Implemented
+  void operator=(const PluginManifestTest&);     // Move assignment Not Implemented
+};
@@ -0,0 +1,209 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <cstdint>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/MemoryResource.h"
+#include "SIMPLib/Utilities/ArrayKernels.hpp"
+
+#include "SIMPLBenchmark.h"
+
+/**
+ * Micro benchmarks of the DataArray<T> operations the filters lean on and of the ArrayKernels
+ * loops behind CombineAttributeArrays, SplitAttributeArray and ConvertData.
+ */
+
+namespace
+{
+// -----------------------------------------------------------------------------
+// Creates a zeroed array the way createNonPrereqArray() does, allocating from 'type'
+// -----------------------------------------------------------------------------
+void TimeCreate(SIMPLBenchmark::Context& context, MemoryResource::Type type)
+{
+  MemoryResource::ScopedCurrent scope(MemoryResource::Create(type));
+  size_t numTuples = context.getSize();
+  context.setItemsPerIteration(static_cast<double>(numTuples));
+  context.setBytesPerIteration(static_cast<double>(numTuples * sizeof(float)));
+  context.run([&] {
+    FloatArrayType::Pointer array = FloatArrayType::CreateArray(numTuples, QString("Array"), true);
+    array->initializeWithZeros();
+  });
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(DataArray, CreateAndZero)
+{
+  TimeCreate(context, MemoryResource::Type::Default);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(DataArray, CreateAndZeroUninitialized)
+{
+  TimeCreate(context, MemoryResource::Type::Uninitialized);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(DataArray, CreateAndZeroFirstTouch)
+{
+  TimeCreate(context, MemoryResource::Type::FirstTouch);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(DataArray, CreateAndZeroHugePages)
+{
+  TimeCreate(context, MemoryResource::Type::HugePages);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(DataArray, DeepCopy)
+{
+  size_t numTuples = context.getSize();
+  std::vector<size_t> cDims = {3};
+  FloatArrayType::Pointer array = FloatArrayType::CreateArray(numTuples, cDims, QString("Array"), true);
+  array->initializeWithValue(1.0f);
+  context.setItemsPerIteration(static_cast<double>(numTuples));
+  context.setBytesPerIteration(static_cast<double>(array->getSize() * sizeof(float)));
+  context.run([&] { IDataArray::Pointer copy = array->deepCopy(); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(DataArray, EraseTuples)
+{
+  size_t numTuples = context.getSize();
+  std::vector<size_t> idxs;
+  for(size_t i = 0; i < numTuples; i += 10)
+  {
+    idxs.push_back(i);
+  }
+  Int32ArrayType::Pointer array;
+  context.setItemsPerIteration(static_cast<double>(numTuples));
+  context.run([&] { array->eraseTuples(idxs); },
+              [&] {
+                array = Int32ArrayType::CreateArray(numTuples, QString("Array"), true);
+                array->initializeWithValue(1);
+              });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(DataArray, CopyFromArray)
+{
+  size_t numTuples = context.getSize();
+  std::vector<size_t> cDims = {3};
+  FloatArrayType::Pointer source = FloatArrayType::CreateArray(numTuples, cDims, QString("Source"), true);
+  source->initializeWithValue(1.0f);
+  FloatArrayType::Pointer destination = FloatArrayType::CreateArray(numTuples, cDims, QString("Destination"), true);
+  context.setItemsPerIteration(static_cast<double>(numTuples));
+  context.setBytesPerIteration(static_cast<double>(source->getSize() * sizeof(float)));
+  context.run([&] { destination->copyFromArray(0, source, 0, numTuples); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(DataArray, ResizeTuples)
+{
+  size_t numTuples = context.getSize();
+  FloatArrayType::Pointer array;
+  context.setItemsPerIteration(static_cast<double>(numTuples));
+  context.run([&] { array->resizeTuples(2 * numTuples); },
+              [&] {
+                array = FloatArrayType::CreateArray(numTuples, QString("Array"), true);
+                array->initializeWithValue(1.0f);
+              });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(ArrayKernels, Interleave)
+{
+  size_t numTuples = context.getSize();
+  std::vector<float> a(numTuples, 1.0f);
+  std::vector<float> b(3 * numTuples, 2.0f);
+  std::vector<float> output(4 * numTuples);
+  std::vector<const float*> inputs = {a.data(), b.data()};
+  std::vector<size_t> inputComponents = {1, 3};
+  context.setItemsPerIteration(static_cast<double>(numTuples));
+  context.setBytesPerIteration(static_cast<double>(2 * output.size() * sizeof(float)));
+  context.run([&] { ArrayKernels::Interleave(inputs, inputComponents, numTuples, output.data()); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(ArrayKernels, Deinterleave)
+{
+  size_t numTuples = context.getSize();
+  std::vector<float> input(3 * numTuples, 1.0f);
+  std::vector<std::vector<float>> components(3, std::vector<float>(numTuples));
+  std::vector<float*> outputs = {components[0].data(), components[1].data(), components[2].data()};
+  context.setItemsPerIteration(static_cast<double>(numTuples));
+  context.setBytesPerIteration(static_cast<double>(2 * input.size() * sizeof(float)));
+  context.run([&] { ArrayKernels::Deinterleave(input.data(), 3, numTuples, outputs); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(ArrayKernels, ConvertSaturate)
+{
+  size_t count = context.getSize();
+  std::vector<float> input(count);
+  for(size_t i = 0; i < count; i++)
+  {
+    input[i] = static_cast<float>(i % 512) - 128.0f;
+  }
+  std::vector<uint8_t> output(count);
+  context.setItemsPerIteration(static_cast<double>(count));
+  context.setBytesPerIteration(static_cast<double>(count * (sizeof(float) + sizeof(uint8_t))));
+  context.run([&] { ArrayKernels::Convert(input.data(), count, output.data(), ArrayKernels::ConversionMode::Saturate); });
+}
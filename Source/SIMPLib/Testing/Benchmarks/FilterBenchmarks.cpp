@@ -0,0 +1,274 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <functional>
+#include <stdexcept>
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/CoreFilters/ArrayCalculator.h"
+#include "SIMPLib/CoreFilters/ConvertData.h"
+#include "SIMPLib/CoreFilters/DataContainerReader.h"
+#include "SIMPLib/CoreFilters/DataContainerWriter.h"
+#include "SIMPLib/CoreFilters/MultiThresholdObjects.h"
+#include "SIMPLib/CoreFilters/RotateSampleRefFrame.h"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+
+#include "SIMPLBenchmark.h"
+#include "SyntheticDataGenerator.h"
+
+/**
+ * Times single filters on the synthetic image data set and a small pipeline end to end. The size is
+ * the number of cells.
+ */
+namespace
+{
+const DataArrayPath k_CellPath(SyntheticData::k_DataContainerName, SyntheticData::k_CellAttributeMatrixName, "");
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void RequireNoError(int err, const QString& what)
+{
+  if(err < 0)
+  {
+    throw std::runtime_error(QString("%1 failed with error %2").arg(what).arg(err).toStdString());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ArrayCalculator::Pointer CreateArrayCalculator()
+{
+  ArrayCalculator::Pointer calculator = ArrayCalculator::New();
+  calculator->setSelectedAttributeMatrix(k_CellPath);
+  calculator->setInfixEquation(QString("sqrt(%1) * 100 + cos(%1 * 3.14159)").arg(SyntheticData::k_ConfidenceArrayName));
+  DataArrayPath calculatedPath = k_CellPath;
+  calculatedPath.setDataArrayName("Calculated");
+  calculator->setCalculatedArray(calculatedPath);
+  calculator->setUnits(ArrayCalculator::Radians);
+  calculator->setScalarType(SIMPL::ScalarTypes::Type::Float);
+  return calculator;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ConvertData::Pointer CreateConvertData()
+{
+  ConvertData::Pointer convert = ConvertData::New();
+  DataArrayPath inputPath = k_CellPath;
+  inputPath.setDataArrayName("Calculated");
+  convert->setSelectedCellArrayPath(inputPath);
+  convert->setScalarType(SIMPL::NumericTypes::Type::UInt8);
+  convert->setConversionMode(1);
+  convert->setOutputArrayName("Converted");
+  return convert;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MultiThresholdObjects::Pointer CreateMultiThreshold()
+{
+  ComparisonInputs thresholds;
+  thresholds.addInput(SyntheticData::k_DataContainerName, SyntheticData::k_CellAttributeMatrixName, SyntheticData::k_ConfidenceArrayName, SIMPL::Comparison::Operator_GreaterThan, 0.1);
+  thresholds.addInput(SyntheticData::k_DataContainerName, SyntheticData::k_CellAttributeMatrixName, SyntheticData::k_PhasesArrayName, SIMPL::Comparison::Operator_Equal, 1.0);
+
+  MultiThresholdObjects::Pointer threshold = MultiThresholdObjects::New();
+  threshold->setSelectedThresholds(thresholds);
+  threshold->setDestinationArrayName("Mask");
+  return threshold;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+RotateSampleRefFrame::Pointer CreateRotateSampleRefFrame(float angle, bool interpolate)
+{
+  RotateSampleRefFrame::Pointer rotate = RotateSampleRefFrame::New();
+  rotate->setCellAttributeMatrixPath(k_CellPath);
+  rotate->setRotationRepresentation(RotateSampleRefFrame::RotationRepresentation::AxisAngle);
+  rotate->setRotationAxis(FloatVec3Type(0.0f, 0.0f, 1.0f));
+  rotate->setRotationAngle(angle);
+  rotate->setUseTrilinearInterpolation(interpolate);
+  return rotate;
+}
+
+// -----------------------------------------------------------------------------
+// A 90 degree turn about Z keeps the number of cells, so the same data is rotated over and over. An
+// oblique turn grows the volume, so every repetition starts again from a fresh data set.
+// -----------------------------------------------------------------------------
+void TimeRotateSampleRefFrame(SIMPLBenchmark::Context& context, float angle, bool interpolate)
+{
+  DataContainerArray::Pointer dca = SyntheticData::CreateImageDataContainerArray(context.getSize());
+  context.setItemsPerIteration(static_cast<double>(dca->getAttributeMatrix(k_CellPath)->getNumberOfTuples()));
+  std::function<void()> setup;
+  if(angle != 90.0f)
+  {
+    setup = [&] { dca = SyntheticData::CreateImageDataContainerArray(context.getSize()); };
+  }
+  context.run(
+      [&] {
+        RotateSampleRefFrame::Pointer rotate = CreateRotateSampleRefFrame(angle, interpolate);
+        rotate->setDataContainerArray(dca);
+        rotate->execute();
+        RequireNoError(rotate->getErrorCode(), rotate->getNameOfClass());
+      },
+      setup);
+}
+
+// -----------------------------------------------------------------------------
+// Reads 'filePath' and runs ArrayCalculator, ConvertData and MultiThresholdObjects on the cell data
+// -----------------------------------------------------------------------------
+FilterPipeline::Pointer CreatePipeline(const QString& filePath)
+{
+  DataContainerReader::Pointer reader = DataContainerReader::New();
+  reader->setInputFile(filePath);
+  reader->setInputFileDataContainerArrayProxy(reader->readDataContainerArrayStructure(filePath));
+
+  FilterPipeline::Pointer pipeline = FilterPipeline::New();
+  pipeline->pushBack(reader);
+  pipeline->pushBack(CreateArrayCalculator());
+  pipeline->pushBack(CreateConvertData());
+  pipeline->pushBack(CreateMultiThreshold());
+  return pipeline;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString WritePipelineInput(SIMPLBenchmark::Context& context, const QString& fileName)
+{
+  QString filePath = context.getWorkingDirectory() + QDir::separator() + fileName;
+  DataContainerWriter::Pointer writer = DataContainerWriter::New();
+  writer->setDataContainerArray(SyntheticData::CreateImageDataContainerArray(context.getSize()));
+  writer->setOutputFile(filePath);
+  writer->setWriteXdmfFile(false);
+  writer->execute();
+  RequireNoError(writer->getErrorCode(), writer->getNameOfClass());
+  return filePath;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(Filters, ArrayCalculator)
+{
+  DataContainerArray::Pointer dca = SyntheticData::CreateImageDataContainerArray(context.getSize());
+  AttributeMatrix::Pointer cellAttrMat = dca->getAttributeMatrix(k_CellPath);
+  context.setItemsPerIteration(static_cast<double>(cellAttrMat->getNumberOfTuples()));
+  context.run(
+      [&] {
+        ArrayCalculator::Pointer calculator = CreateArrayCalculator();
+        calculator->setDataContainerArray(dca);
+        calculator->execute();
+        RequireNoError(calculator->getErrorCode(), calculator->getNameOfClass());
+      },
+      [&] { cellAttrMat->removeAttributeArray("Calculated"); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(Filters, MultiThresholdObjects)
+{
+  DataContainerArray::Pointer dca = SyntheticData::CreateImageDataContainerArray(context.getSize());
+  AttributeMatrix::Pointer cellAttrMat = dca->getAttributeMatrix(k_CellPath);
+  context.setItemsPerIteration(static_cast<double>(cellAttrMat->getNumberOfTuples()));
+  context.run(
+      [&] {
+        MultiThresholdObjects::Pointer threshold = CreateMultiThreshold();
+        threshold->setDataContainerArray(dca);
+        threshold->execute();
+        RequireNoError(threshold->getErrorCode(), threshold->getNameOfClass());
+      },
+      [&] { cellAttrMat->removeAttributeArray("Mask"); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(Filters, RotateSampleRefFrameNearest)
+{
+  TimeRotateSampleRefFrame(context, 90.0f, false);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(Filters, RotateSampleRefFrameTrilinear)
+{
+  TimeRotateSampleRefFrame(context, 90.0f, true);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(Filters, RotateSampleRefFrameOblique)
+{
+  TimeRotateSampleRefFrame(context, 30.0f, true);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(Pipeline, Preflight)
+{
+  QString filePath = WritePipelineInput(context, "PipelinePreflight.dream3d");
+  FilterPipeline::Pointer pipeline = CreatePipeline(filePath);
+  context.run([&] { RequireNoError(pipeline->preflightPipeline(), "Preflight"); });
+  QFile::remove(filePath);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(Pipeline, Execute)
+{
+  QString filePath = WritePipelineInput(context, "PipelineExecute.dream3d");
+  FilterPipeline::Pointer pipeline = CreatePipeline(filePath);
+  context.setItemsPerIteration(static_cast<double>(context.getSize()));
+  context.run([&] {
+    pipeline->execute();
+    RequireNoError(pipeline->getErrorCode(), "Pipeline");
+  });
+  QFile::remove(filePath);
+}
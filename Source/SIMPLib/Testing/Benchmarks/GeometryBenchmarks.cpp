@@ -0,0 +1,465 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/ScratchArena.h"
+#include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Geometry/TetrahedralGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+
+#include "SIMPLBenchmark.h"
+#include "SyntheticDataGenerator.h"
+
+/**
+ * Times the topology builders of the unstructured geometries and the per-element kernels in
+ * GeometryHelpers::Topology and GeometryHelpers::Generic. The size is the number of elements; every
+ * repetition of a topology builder first deletes the structure so it is rebuilt from scratch.
+ */
+namespace
+{
+/**
+ * @brief Connectivity and vertices of a structured mesh, held in plain vectors so the kernels are timed
+ * without any geometry around them
+ */
+struct Mesh
+{
+  size_t numVertsPerElem = 0;
+  size_t numElems = 0;
+  std::vector<size_t> elems;
+  std::vector<float> vertices;
+};
+
+// -----------------------------------------------------------------------------
+// Returns the vertices of an nx * ny * nz grid of unit cells
+// -----------------------------------------------------------------------------
+std::vector<float> CreateGridVertices(size_t nx, size_t ny, size_t nz)
+{
+  std::vector<float> vertices(3 * (nx + 1) * (ny + 1) * (nz + 1));
+  size_t id = 0;
+  for(size_t k = 0; k <= nz; k++)
+  {
+    for(size_t j = 0; j <= ny; j++)
+    {
+      for(size_t i = 0; i <= nx; i++)
+      {
+        vertices[id++] = static_cast<float>(i);
+        vertices[id++] = static_cast<float>(j);
+        vertices[id++] = static_cast<float>(k);
+      }
+    }
+  }
+  return vertices;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+Mesh CreateSurfaceMesh(size_t numElems, bool triangles)
+{
+  Mesh mesh;
+  mesh.numVertsPerElem = triangles ? 3 : 4;
+  size_t numCells = triangles ? (numElems + 1) / 2 : numElems;
+  size_t nx = std::max<size_t>(1, static_cast<size_t>(std::sqrt(static_cast<double>(numCells))));
+  size_t ny = (numCells + nx - 1) / nx;
+  mesh.vertices = CreateGridVertices(nx, ny, 0);
+  mesh.numElems = numElems;
+  mesh.elems.resize(mesh.numVertsPerElem * numElems);
+  size_t* elem = mesh.elems.data();
+  for(size_t e = 0; e < numElems; e++)
+  {
+    size_t cell = triangles ? e / 2 : e;
+    size_t v0 = (cell % nx) + (nx + 1) * (cell / nx);
+    size_t quad[4] = {v0, v0 + 1, v0 + nx + 2, v0 + nx + 1};
+    if(!triangles)
+    {
+      std::copy(quad, quad + 4, elem + 4 * e);
+    }
+    else
+    {
+      size_t second = e % 2;
+      elem[3 * e + 0] = quad[0];
+      elem[3 * e + 1] = quad[1 + second];
+      elem[3 * e + 2] = quad[2 + second];
+    }
+  }
+  return mesh;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+Mesh CreateVolumeMesh(size_t numElems, bool tetrahedra)
+{
+  static const size_t k_SubTets[5][4] = {{0, 1, 3, 4}, {1, 4, 5, 6}, {1, 4, 6, 3}, {1, 3, 6, 2}, {3, 6, 7, 4}};
+
+  Mesh mesh;
+  mesh.numVertsPerElem = tetrahedra ? 4 : 8;
+  size_t numCells = tetrahedra ? (numElems + 4) / 5 : numElems;
+  size_t n = std::max<size_t>(1, static_cast<size_t>(std::cbrt(static_cast<double>(numCells))));
+  size_t nz = (numCells + n * n - 1) / (n * n);
+  mesh.vertices = CreateGridVertices(n, n, nz);
+  mesh.numElems = numElems;
+  mesh.elems.resize(mesh.numVertsPerElem * numElems);
+  size_t* elem = mesh.elems.data();
+  for(size_t e = 0; e < numElems; e++)
+  {
+    size_t cell = tetrahedra ? e / 5 : e;
+    size_t i = cell % n;
+    size_t j = (cell / n) % n;
+    size_t k = cell / (n * n);
+    size_t v0 = i + (n + 1) * (j + (n + 1) * k);
+    size_t layer = (n + 1) * (n + 1);
+    size_t hex[8] = {v0, v0 + 1, v0 + n + 2, v0 + n + 1, v0 + layer, v0 + layer + 1, v0 + layer + n + 2, v0 + layer + n + 1};
+    if(!tetrahedra)
+    {
+      std::copy(hex, hex + 8, elem + 8 * e);
+    }
+    else
+    {
+      for(size_t v = 0; v < 4; v++)
+      {
+        elem[4 * e + v] = hex[k_SubTets[e % 5][v]];
+      }
+    }
+  }
+  return mesh;
+}
+
+// -----------------------------------------------------------------------------
+// Times 'kernel' on 'mesh'; the kernel writes up to three floats per element into 'output'
+// -----------------------------------------------------------------------------
+void TimeKernel(SIMPLBenchmark::Context& context, const Mesh& mesh, const std::function<void(const size_t*, const float*, float*)>& kernel)
+{
+  std::vector<float> output(3 * mesh.numElems);
+  context.setItemsPerIteration(static_cast<double>(mesh.numElems));
+  context.run([&] { kernel(mesh.elems.data(), mesh.vertices.data(), output.data()); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TimeElementCentroids(SIMPLBenchmark::Context& context, const Mesh& mesh)
+{
+  TimeKernel(context, mesh, [&](const size_t* elems, const float* vertices, float* output) {
+    GeometryHelpers::Topology::FindElementCentroids<size_t>(elems, mesh.numElems, mesh.numVertsPerElem, vertices, output);
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TimeAverageVertexArrayValues(SIMPLBenchmark::Context& context, const Mesh& mesh)
+{
+  TimeKernel(context, mesh, [&](const size_t* elems, const float* vertices, float* output) {
+    GeometryHelpers::Generic::AverageVertexArrayValues<size_t, float>(elems, mesh.numElems, mesh.numVertsPerElem, vertices, 3, output);
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void Time2DElementAreas(SIMPLBenchmark::Context& context, const Mesh& mesh)
+{
+  TimeKernel(context, mesh, [&](const size_t* elems, const float* vertices, float* output) {
+    GeometryHelpers::Topology::Find2DElementAreas<size_t>(elems, mesh.numElems, mesh.numVertsPerElem, vertices, output);
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TimeTopology(SIMPLBenchmark::Context& context, size_t numElements, const std::function<int()>& find, const std::function<void()>& remove)
+{
+  context.setItemsPerIteration(static_cast<double>(numElements));
+  context.run(
+      [&] {
+        int err = find();
+        if(err < 0)
+        {
+          throw std::runtime_error("building the topology returned " + std::to_string(err));
+        }
+      },
+      remove);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TimeSmallTiles(SIMPLBenchmark::Context& context, const ScratchArena::Pointer& arena)
+{
+  // Many small meshes, like a batch run over small tiles, so the temporary buffers of the
+  // topology builders are a large part of the work
+  const size_t k_TileSize = 512;
+  size_t numTiles = std::max(context.getSize() / k_TileSize, static_cast<size_t>(1));
+  std::vector<TriangleGeom::Pointer> tiles;
+  for(size_t i = 0; i < numTiles; i++)
+  {
+    tiles.push_back(SyntheticData::CreateTriangleGeometry(k_TileSize));
+  }
+
+  ScratchArena::ScopedCurrent scratchArenaScope(arena);
+  context.setItemsPerIteration(static_cast<double>(numTiles * k_TileSize));
+  context.run(
+      [&] {
+        for(const auto& tile : tiles)
+        {
+          if(tile->findElementsContainingVert() < 0 || tile->findElementNeighbors() < 0)
+          {
+            throw std::runtime_error("building the topology of a tile failed");
+          }
+        }
+      },
+      [&] {
+        for(const auto& tile : tiles)
+        {
+          tile->deleteElementNeighbors();
+          tile->deleteElementsContainingVert();
+        }
+      });
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(TriangleGeom, ElementsContainingVert)
+{
+  TriangleGeom::Pointer geom = SyntheticData::CreateTriangleGeometry(context.getSize());
+  TimeTopology(context, geom->getNumberOfTris(), [&] { return geom->findElementsContainingVert(); }, [&] { geom->deleteElementsContainingVert(); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(TriangleGeom, ElementNeighbors)
+{
+  TriangleGeom::Pointer geom = SyntheticData::CreateTriangleGeometry(context.getSize());
+  geom->findElementsContainingVert();
+  TimeTopology(context, geom->getNumberOfTris(), [&] { return geom->findElementNeighbors(); }, [&] { geom->deleteElementNeighbors(); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(TriangleGeom, Edges)
+{
+  TriangleGeom::Pointer geom = SyntheticData::CreateTriangleGeometry(context.getSize());
+  TimeTopology(context, geom->getNumberOfTris(), [&] { return geom->findEdges(); }, [&] { geom->deleteEdges(); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(TriangleGeom, UnsharedEdges)
+{
+  TriangleGeom::Pointer geom = SyntheticData::CreateTriangleGeometry(context.getSize());
+  TimeTopology(context, geom->getNumberOfTris(), [&] { return geom->findUnsharedEdges(); }, [&] { geom->deleteUnsharedEdges(); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(TetrahedralGeom, ElementsContainingVert)
+{
+  TetrahedralGeom::Pointer geom = SyntheticData::CreateTetrahedralGeometry(context.getSize());
+  TimeTopology(context, geom->getNumberOfTets(), [&] { return geom->findElementsContainingVert(); }, [&] { geom->deleteElementsContainingVert(); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(TetrahedralGeom, ElementNeighbors)
+{
+  TetrahedralGeom::Pointer geom = SyntheticData::CreateTetrahedralGeometry(context.getSize());
+  geom->findElementsContainingVert();
+  TimeTopology(context, geom->getNumberOfTets(), [&] { return geom->findElementNeighbors(); }, [&] { geom->deleteElementNeighbors(); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(TetrahedralGeom, Faces)
+{
+  TetrahedralGeom::Pointer geom = SyntheticData::CreateTetrahedralGeometry(context.getSize());
+  TimeTopology(context, geom->getNumberOfTets(), [&] { return geom->findFaces(); }, [&] { geom->deleteFaces(); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(TetrahedralGeom, UnsharedFaces)
+{
+  TetrahedralGeom::Pointer geom = SyntheticData::CreateTetrahedralGeometry(context.getSize());
+  TimeTopology(context, geom->getNumberOfTets(), [&] { return geom->findUnsharedFaces(); }, [&] { geom->deleteUnsharedFaces(); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(TriangleGeom, SmallTileNeighbors)
+{
+  TimeSmallTiles(context, ScratchArena::NullPointer());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(TriangleGeom, SmallTileNeighborsPooled)
+{
+  TimeSmallTiles(context, ScratchArena::New());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(GeometryHelpers, TriangleElementCentroids)
+{
+  TimeElementCentroids(context, CreateSurfaceMesh(context.getSize(), true));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(GeometryHelpers, TriangleAverageVertexArrayValues)
+{
+  TimeAverageVertexArrayValues(context, CreateSurfaceMesh(context.getSize(), true));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(GeometryHelpers, Triangle2DElementAreas)
+{
+  Time2DElementAreas(context, CreateSurfaceMesh(context.getSize(), true));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(GeometryHelpers, QuadElementCentroids)
+{
+  TimeElementCentroids(context, CreateSurfaceMesh(context.getSize(), false));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(GeometryHelpers, QuadAverageVertexArrayValues)
+{
+  TimeAverageVertexArrayValues(context, CreateSurfaceMesh(context.getSize(), false));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(GeometryHelpers, Quad2DElementAreas)
+{
+  Time2DElementAreas(context, CreateSurfaceMesh(context.getSize(), false));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(GeometryHelpers, TetElementCentroids)
+{
+  TimeElementCentroids(context, CreateVolumeMesh(context.getSize(), true));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(GeometryHelpers, TetAverageVertexArrayValues)
+{
+  TimeAverageVertexArrayValues(context, CreateVolumeMesh(context.getSize(), true));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(GeometryHelpers, TetVolumes)
+{
+  Mesh mesh = CreateVolumeMesh(context.getSize(), true);
+  TimeKernel(context, mesh, [&](const size_t* elems, const float* vertices, float* output) { GeometryHelpers::Topology::FindTetVolumes<size_t>(elems, mesh.numElems, vertices, output); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(GeometryHelpers, TetJacobians)
+{
+  Mesh mesh = CreateVolumeMesh(context.getSize(), true);
+  TimeKernel(context, mesh, [&](const size_t* elems, const float* vertices, float* output) { GeometryHelpers::Topology::FindTetJacobians<size_t>(elems, mesh.numElems, vertices, output); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(GeometryHelpers, TetMinDihedralAngles)
+{
+  Mesh mesh = CreateVolumeMesh(context.getSize(), true);
+  TimeKernel(context, mesh,
+             [&](const size_t* elems, const float* vertices, float* output) { GeometryHelpers::Topology::FindTetMinDihedralAngles<size_t>(elems, mesh.numElems, vertices, output); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(GeometryHelpers, HexElementCentroids)
+{
+  TimeElementCentroids(context, CreateVolumeMesh(context.getSize(), false));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(GeometryHelpers, HexAverageVertexArrayValues)
+{
+  TimeAverageVertexArrayValues(context, CreateVolumeMesh(context.getSize(), false));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(GeometryHelpers, HexVolumes)
+{
+  Mesh mesh = CreateVolumeMesh(context.getSize(), false);
+  TimeKernel(context, mesh, [&](const size_t* elems, const float* vertices, float* output) { GeometryHelpers::Topology::FindHexVolumes<size_t>(elems, mesh.numElems, vertices, output); });
+}
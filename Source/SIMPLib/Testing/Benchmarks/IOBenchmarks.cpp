@@ -0,0 +1,205 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <stdexcept>
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QTextStream>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/CoreFilters/DataContainerReader.h"
+#include "SIMPLib/CoreFilters/DataContainerWriter.h"
+#include "SIMPLib/CoreFilters/ImportAsciDataArray.h"
+#include "SIMPLib/CoreFilters/WriteASCIIData.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+
+#include "SIMPLBenchmark.h"
+#include "SyntheticDataGenerator.h"
+
+/**
+ * Times the HDF5 (.dream3d) and ASCII readers and writers on the synthetic image data set. The size
+ * is the number of cells; the files are written to the working directory.
+ */
+namespace
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void RequireNoError(const AbstractFilter& filter)
+{
+  if(filter.getErrorCode() < 0)
+  {
+    throw std::runtime_error(QString("%1 failed with error %2").arg(filter.getNameOfClass()).arg(filter.getErrorCode()).toStdString());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ArrayBytes(const DataContainerArray::Pointer& dca)
+{
+  double bytes = 0.0;
+  for(const auto& dc : dca->getDataContainers())
+  {
+    for(const auto& am : dc->getAttributeMatrices())
+    {
+      for(const auto& array : *am)
+      {
+        bytes += static_cast<double>(array->getSize() * array->getTypeSize());
+      }
+    }
+  }
+  return bytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void WriteDream3dFile(const DataContainerArray::Pointer& dca, const QString& filePath)
+{
+  DataContainerWriter::Pointer writer = DataContainerWriter::New();
+  writer->setDataContainerArray(dca);
+  writer->setOutputFile(filePath);
+  writer->setWriteXdmfFile(false);
+  writer->execute();
+  RequireNoError(*writer);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(IO, WriteDream3d)
+{
+  DataContainerArray::Pointer dca = SyntheticData::CreateImageDataContainerArray(context.getSize());
+  QString filePath = context.getWorkingDirectory() + QDir::separator() + "WriteDream3d.dream3d";
+  context.setItemsPerIteration(static_cast<double>(context.getSize()));
+  context.setBytesPerIteration(ArrayBytes(dca));
+  context.run([&] { WriteDream3dFile(dca, filePath); });
+  QFile::remove(filePath);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(IO, ReadDream3d)
+{
+  DataContainerArray::Pointer source = SyntheticData::CreateImageDataContainerArray(context.getSize());
+  QString filePath = context.getWorkingDirectory() + QDir::separator() + "ReadDream3d.dream3d";
+  WriteDream3dFile(source, filePath);
+  context.setItemsPerIteration(static_cast<double>(context.getSize()));
+  context.setBytesPerIteration(ArrayBytes(source));
+  source.reset();
+
+  context.run([&] {
+    DataContainerReader::Pointer reader = DataContainerReader::New();
+    reader->setDataContainerArray(DataContainerArray::New());
+    reader->setInputFile(filePath);
+    reader->setInputFileDataContainerArrayProxy(reader->readDataContainerArrayStructure(filePath));
+    reader->execute();
+    RequireNoError(*reader);
+  });
+  QFile::remove(filePath);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(IO, WriteASCII)
+{
+  DataContainerArray::Pointer dca = SyntheticData::CreateImageDataContainerArray(context.getSize());
+  QString filePath = context.getWorkingDirectory() + QDir::separator() + "WriteASCII.csv";
+  std::vector<DataArrayPath> paths = {DataArrayPath(SyntheticData::k_DataContainerName, SyntheticData::k_CellAttributeMatrixName, SyntheticData::k_ConfidenceArrayName),
+                                      DataArrayPath(SyntheticData::k_DataContainerName, SyntheticData::k_CellAttributeMatrixName, SyntheticData::k_EulersArrayName)};
+  context.setItemsPerIteration(static_cast<double>(context.getSize()));
+  context.run([&] {
+    WriteASCIIData::Pointer writer = WriteASCIIData::New();
+    writer->setDataContainerArray(dca);
+    writer->setSelectedDataArrayPaths(paths);
+    writer->setOutputStyle(WriteASCIIData::SingleFile);
+    writer->setOutputFilePath(filePath);
+    writer->setDelimiter(WriteASCIIData::Comma);
+    writer->execute();
+    RequireNoError(*writer);
+  });
+  QFile::remove(filePath);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPL_REGISTER_BENCHMARK(IO, ImportASCII)
+{
+  DataContainerArray::Pointer dca = SyntheticData::CreateImageDataContainerArray(context.getSize());
+  DataArrayPath confidencePath(SyntheticData::k_DataContainerName, SyntheticData::k_CellAttributeMatrixName, SyntheticData::k_ConfidenceArrayName);
+  FloatArrayType::Pointer confidence = dca->getPrereqArrayFromPath<FloatArrayType>(nullptr, confidencePath, {1});
+  size_t numTuples = confidence->getNumberOfTuples();
+
+  QString filePath = context.getWorkingDirectory() + QDir::separator() + "ImportASCII.txt";
+  QFile file(filePath);
+  if(!file.open(QIODevice::WriteOnly | QIODevice::Text))
+  {
+    context.skip(QString("could not write '%1'").arg(filePath));
+    return;
+  }
+  QTextStream out(&file);
+  out << "Confidence\n";
+  for(size_t i = 0; i < numTuples; i++)
+  {
+    out << confidence->getValue(i) << "\n";
+  }
+  file.close();
+
+  DataArrayPath importedPath(SyntheticData::k_DataContainerName, SyntheticData::k_CellAttributeMatrixName, "ImportedConfidence");
+  context.setItemsPerIteration(static_cast<double>(numTuples));
+  context.setBytesPerIteration(static_cast<double>(file.size()));
+  context.run(
+      [&] {
+        ImportAsciDataArray::Pointer reader = ImportAsciDataArray::New();
+        reader->setDataContainerArray(dca);
+        reader->setInputFile(filePath);
+        reader->setCreatedAttributeArrayPath(importedPath);
+        reader->setScalarType(SIMPL::NumericTypes::Type::Float);
+        reader->setNumberOfComponents(1);
+        reader->setSkipHeaderLines(1);
+        reader->setDelimiter(ImportAsciDataArray::Comma);
+        reader->execute();
+        RequireNoError(*reader);
+      },
+      [&] { dca->getAttributeMatrix(importedPath)->removeAttributeArray(importedPath.getDataArrayName()); });
+  QFile::remove(filePath);
+}
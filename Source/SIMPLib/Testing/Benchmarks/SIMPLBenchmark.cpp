@@ -0,0 +1,360 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "SIMPLBenchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+#include <QtCore/QDateTime>
+#include <QtCore/QFile>
+#include <QtCore/QSysInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QRegularExpression>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/SIMPLibVersion.h"
+
+namespace
+{
+struct Entry
+{
+  QString group;
+  QString name;
+  SIMPLBenchmark::Function function;
+};
+
+// -----------------------------------------------------------------------------
+// Constructed on first use so registrars in other translation units can use it
+// -----------------------------------------------------------------------------
+std::vector<Entry>& Entries()
+{
+  static std::vector<Entry> entries;
+  return entries;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double Median(std::vector<double> values)
+{
+  if(values.empty())
+  {
+    return 0.0;
+  }
+  std::sort(values.begin(), values.end());
+  size_t middle = values.size() / 2;
+  return (values.size() % 2 == 1) ? values[middle] : 0.5 * (values[middle - 1] + values[middle]);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString RunName(const SIMPLBenchmark::Result& result)
+{
+  return QString("%1/%2/%3").arg(result.group, result.name).arg(result.size);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PrintResult(const SIMPLBenchmark::Result& result)
+{
+  std::cout << std::left << std::setw(48) << RunName(result).toStdString() << std::right;
+  if(!result.skipReason.isEmpty())
+  {
+    std::cout << "  skipped: " << result.skipReason.toStdString() << std::endl;
+    return;
+  }
+  std::cout << std::fixed << std::setprecision(3) << std::setw(12) << result.medianTime * 1.0E3 << std::setw(12) << result.minTime * 1.0E3 << std::setw(12) << result.maxTime * 1.0E3;
+  if(result.itemsPerIteration > 0.0 && result.medianTime > 0.0)
+  {
+    std::cout << std::setprecision(2) << std::setw(14) << result.itemsPerIteration / result.medianTime * 1.0E-6;
+  }
+  else
+  {
+    std::cout << std::setw(14) << "-";
+  }
+  if(result.bytesPerIteration > 0.0 && result.medianTime > 0.0)
+  {
+    std::cout << std::setprecision(1) << std::setw(12) << result.bytesPerIteration / result.medianTime / (1024.0 * 1024.0);
+  }
+  else
+  {
+    std::cout << std::setw(12) << "-";
+  }
+  std::cout << std::endl;
+}
+} // namespace
+
+namespace SIMPLBenchmark
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+Context::Context(const Options& options, const QString& group, const QString& name)
+: m_Options(options)
+{
+  m_Result.group = group;
+  m_Result.name = name;
+  m_Result.size = options.size;
+}
+
+// -----------------------------------------------------------------------------
+Context::~Context() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t Context::getSize() const
+{
+  return m_Options.size;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString Context::getWorkingDirectory() const
+{
+  return m_Options.workingDirectory;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void Context::setItemsPerIteration(double items)
+{
+  m_Result.itemsPerIteration = items;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void Context::setBytesPerIteration(double bytes)
+{
+  m_Result.bytesPerIteration = bytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void Context::skip(const QString& reason)
+{
+  m_Result.skipReason = reason;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void Context::run(const std::function<void()>& body, const std::function<void()>& setup)
+{
+  for(size_t r = 0; r <= m_Options.repetitions; r++)
+  {
+    if(setup)
+    {
+      setup();
+    }
+    std::clock_t cpuStart = std::clock();
+    auto start = std::chrono::steady_clock::now();
+    body();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    std::clock_t cpuEnd = std::clock();
+    // The first call only warms up caches and lazily built structures
+    if(r > 0)
+    {
+      m_Times.push_back(elapsed.count());
+      m_CpuTimes.push_back(static_cast<double>(cpuEnd - cpuStart) / CLOCKS_PER_SEC);
+    }
+  }
+  m_Result.iterations = m_Times.size();
+  if(m_Times.empty())
+  {
+    return;
+  }
+  m_Result.minTime = *std::min_element(m_Times.begin(), m_Times.end());
+  m_Result.maxTime = *std::max_element(m_Times.begin(), m_Times.end());
+  m_Result.medianTime = Median(m_Times);
+  m_Result.medianCpuTime = Median(m_CpuTimes);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+Result Context::getResult() const
+{
+  return m_Result;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+Registrar::Registrar(const char* group, const char* name, const Function& function)
+{
+  Entries().push_back({QString(group), QString(name), function});
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject ToJson(const Options& options, const std::vector<Result>& results)
+{
+  QJsonObject context;
+  context["date"] = QDateTime::currentDateTime().toString(Qt::ISODate);
+  context["host_name"] = QSysInfo::machineHostName();
+  context["num_cpus"] = static_cast<int>(std::thread::hardware_concurrency());
+  context["library_version"] = SIMPLib::Version::PackageComplete();
+#ifdef NDEBUG
+  context["library_build_type"] = QString("release");
+#else
+  context["library_build_type"] = QString("debug");
+#endif
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  context["parallel_algorithms"] = true;
+#else
+  context["parallel_algorithms"] = false;
+#endif
+  context["size"] = static_cast<double>(options.size);
+  context["repetitions"] = static_cast<double>(options.repetitions);
+
+  QJsonArray benchmarks;
+  for(const Result& result : results)
+  {
+    if(!result.skipReason.isEmpty())
+    {
+      continue;
+    }
+    QJsonObject benchmark;
+    benchmark["name"] = RunName(result);
+    benchmark["run_name"] = RunName(result);
+    benchmark["run_type"] = QString("iteration");
+    benchmark["group"] = result.group;
+    benchmark["size"] = static_cast<double>(result.size);
+    benchmark["iterations"] = static_cast<double>(result.iterations);
+    benchmark["real_time"] = result.medianTime * 1.0E3;
+    benchmark["cpu_time"] = result.medianCpuTime * 1.0E3;
+    benchmark["min_time"] = result.minTime * 1.0E3;
+    benchmark["max_time"] = result.maxTime * 1.0E3;
+    benchmark["time_unit"] = QString("ms");
+    if(result.itemsPerIteration > 0.0 && result.medianTime > 0.0)
+    {
+      benchmark["items_per_second"] = result.itemsPerIteration / result.medianTime;
+    }
+    if(result.bytesPerIteration > 0.0 && result.medianTime > 0.0)
+    {
+      benchmark["bytes_per_second"] = result.bytesPerIteration / result.medianTime;
+    }
+    benchmarks.append(benchmark);
+  }
+
+  QJsonObject root;
+  root["context"] = context;
+  root["benchmarks"] = benchmarks;
+  return root;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int RunBenchmarks(const Options& options)
+{
+  QRegularExpression filter(options.filter);
+  if(!filter.isValid())
+  {
+    std::cout << "Invalid benchmark filter '" << options.filter.toStdString() << "': " << filter.errorString().toStdString() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::vector<Entry> entries = Entries();
+  std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return (a.group == b.group) ? a.name < b.name : a.group < b.group; });
+
+  if(options.listOnly)
+  {
+    for(const Entry& entry : entries)
+    {
+      std::cout << entry.group.toStdString() << "/" << entry.name.toStdString() << std::endl;
+    }
+    return EXIT_SUCCESS;
+  }
+
+  std::cout << std::left << std::setw(48) << "Benchmark" << std::right << std::setw(12) << "Median ms" << std::setw(12) << "Min ms" << std::setw(12) << "Max ms" << std::setw(14) << "MItems/s"
+            << std::setw(12) << "MiB/s" << std::endl;
+
+  int err = EXIT_SUCCESS;
+  std::vector<Result> results;
+  for(const Entry& entry : entries)
+  {
+    if(!filter.match(entry.group + "/" + entry.name).hasMatch())
+    {
+      continue;
+    }
+
+    Context context(options, entry.group, entry.name);
+    try
+    {
+      entry.function(context);
+    } catch(const std::exception& e)
+    {
+      context.skip(QString("failed: %1").arg(e.what()));
+      err = EXIT_FAILURE;
+    }
+    Result result = context.getResult();
+    if(result.skipReason.isEmpty() && result.iterations == 0)
+    {
+      result.skipReason = QString("the benchmark did not call run()");
+    }
+    PrintResult(result);
+    results.push_back(result);
+  }
+
+  if(!options.jsonFile.isEmpty())
+  {
+    QFile file(options.jsonFile);
+    if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+      std::cout << "Could not open '" << options.jsonFile.toStdString() << "' for writing" << std::endl;
+      return EXIT_FAILURE;
+    }
+    file.write(QJsonDocument(ToJson(options, results)).toJson());
+  }
+  return err;
+}
+
+} // namespace SIMPLBenchmark
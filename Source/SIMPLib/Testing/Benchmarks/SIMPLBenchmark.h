@@ -0,0 +1,187 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include <QtCore/QJsonObject>
+#include <QtCore/QString>
+
+/**
+ * @brief The SIMPLBenchmark namespace is the small harness behind the SIMPLibBenchmarks program.
+ * Benchmarks register themselves with SIMPL_REGISTER_BENCHMARK(Group, Name) and receive a Context
+ * that holds the requested problem size. Each benchmark builds its input outside of the timed
+ * region and passes the code to measure to Context::run(), which runs it once to warm up and then
+ * once per repetition. The results are printed as a table and can be written as JSON in the layout
+ * used by Google Benchmark, so its comparison tools can diff two runs.
+ */
+namespace SIMPLBenchmark
+{
+
+/**
+ * @brief The Options struct holds the command line settings of one benchmark run
+ */
+struct Options
+{
+  size_t size = 1000000;
+  size_t repetitions = 5;
+  QString filter;
+  QString jsonFile;
+  QString workingDirectory;
+  bool listOnly = false;
+};
+
+/**
+ * @brief The Result struct holds the timings of one benchmark. Times are in seconds.
+ */
+struct Result
+{
+  QString group;
+  QString name;
+  size_t size = 0;
+  size_t iterations = 0;
+  double minTime = 0.0;
+  double medianTime = 0.0;
+  double maxTime = 0.0;
+  double medianCpuTime = 0.0;
+  double itemsPerIteration = 0.0;
+  double bytesPerIteration = 0.0;
+  QString skipReason;
+};
+
+/**
+ * @brief The Context class is handed to every benchmark function. It provides the problem size
+ * and collects the timings of the code passed to run().
+ */
+class Context
+{
+public:
+  Context(const Options& options, const QString& group, const QString& name);
+  virtual ~Context();
+
+  /**
+   * @brief Returns the requested problem size, usually the number of cells or elements
+   * @return
+   */
+  size_t getSize() const;
+
+  /**
+   * @brief Returns a directory the benchmark may write its files to
+   * @return
+   */
+  QString getWorkingDirectory() const;
+
+  /**
+   * @brief Sets how many items (cells, elements, values) one call of the body processes
+   * @param items
+   */
+  void setItemsPerIteration(double items);
+
+  /**
+   * @brief Sets how many bytes one call of the body reads or writes
+   * @param bytes
+   */
+  void setBytesPerIteration(double bytes);
+
+  /**
+   * @brief Marks the benchmark as skipped. Skipped benchmarks are reported but not timed.
+   * @param reason
+   */
+  void skip(const QString& reason);
+
+  /**
+   * @brief Calls body once to warm up and then once per repetition, timing only body. The optional
+   * setup function runs before every call of body and is not timed.
+   * @param body
+   * @param setup
+   */
+  void run(const std::function<void()>& body, const std::function<void()>& setup = std::function<void()>());
+
+  /**
+   * @brief Returns the collected result
+   * @return
+   */
+  Result getResult() const;
+
+private:
+  Options m_Options;
+  Result m_Result;
+  std::vector<double> m_Times;
+  std::vector<double> m_CpuTimes;
+
+public:
+  Context(const Context&) = delete;            // Copy Constructor Not Implemented
+  Context(Context&&) = delete;                 // Move Constructor Not Implemented
+  Context& operator=(const Context&) = delete; // Copy Assignment Not Implemented
+  Context& operator=(Context&&) = delete;      // Move Assignment Not Implemented
+};
+
+using Function = std::function<void(Context&)>;
+
+/**
+ * @brief The Registrar struct adds a benchmark to the list run by RunBenchmarks() when it is constructed
+ */
+struct Registrar
+{
+  Registrar(const char* group, const char* name, const Function& function);
+};
+
+/**
+ * @brief Runs every registered benchmark whose "Group/Name" matches options.filter, prints a table and
+ * writes options.jsonFile if it is set
+ * @param options
+ * @return EXIT_SUCCESS, or EXIT_FAILURE if a benchmark failed or the JSON file could not be written
+ */
+int RunBenchmarks(const Options& options);
+
+/**
+ * @brief Converts results into the Google Benchmark JSON layout
+ * @param options
+ * @param results
+ * @return
+ */
+QJsonObject ToJson(const Options& options, const std::vector<Result>& results);
+
+} // namespace SIMPLBenchmark
+
+/**
+ * @brief Defines and registers a benchmark function. The body that follows receives 'context'.
+ */
+#define SIMPL_REGISTER_BENCHMARK(Group, Name)                                                                                                                                                          \
+  static void Group##_##Name##_Benchmark(SIMPLBenchmark::Context& context);                                                                                                                            \
+  static const SIMPLBenchmark::Registrar Group##_##Name##_Registrar(#Group, #Name, Group##_##Name##_Benchmark);                                                                                        \
+  static void Group##_##Name##_Benchmark(SIMPLBenchmark::Context& context)
@@ -0,0 +1,145 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <cstdlib>
+#include <iostream>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDir>
+#include <QtCore/QStringList>
+
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLBenchmark.h"
+
+/**
+ * Runs the micro and macro benchmarks registered with SIMPL_REGISTER_BENCHMARK.
+ *
+ * Usage: SIMPLibBenchmarks [--size=N] [--repetitions=N] [--filter=REGEX] [--json=FILE] [--workdir=DIR] [--list]
+ *   --size         Problem size, usually the number of cells or elements (default 1000000)
+ *   --repetitions  Timed calls per benchmark after one warm up call (default 5)
+ *   --filter       Only run benchmarks whose "Group/Name" matches the regular expression
+ *   --json         Also write the results as Google Benchmark compatible JSON
+ *   --workdir      Directory for the files written by the IO and pipeline benchmarks
+ *   --list         Print the registered benchmarks and exit
+ */
+namespace
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PrintUsage()
+{
+  std::cout << "Usage: SIMPLibBenchmarks [--size=N] [--repetitions=N] [--filter=REGEX] [--json=FILE] [--workdir=DIR] [--list]" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ParseCount(const QString& argument, const QString& option, size_t& value)
+{
+  bool ok = false;
+  qulonglong count = argument.mid(option.size()).toULongLong(&ok);
+  if(!ok || count == 0)
+  {
+    std::cout << "Invalid value in '" << argument.toStdString() << "'" << std::endl;
+    return false;
+  }
+  value = static_cast<size_t>(count);
+  return true;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  QCoreApplication::setOrganizationName("BlueQuartz Software");
+  QCoreApplication::setOrganizationDomain("bluequartz.net");
+  QCoreApplication::setApplicationName("SIMPLibBenchmarks");
+  QCoreApplication app(argc, argv);
+
+  SIMPLBenchmark::Options options;
+  options.workingDirectory = QDir::tempPath() + QDir::separator() + "SIMPLibBenchmarks";
+
+  QStringList arguments = QCoreApplication::arguments();
+  for(int i = 1; i < arguments.size(); i++)
+  {
+    const QString& argument = arguments[i];
+    if(argument.startsWith("--size="))
+    {
+      if(!ParseCount(argument, "--size=", options.size))
+      {
+        return EXIT_FAILURE;
+      }
+    }
+    else if(argument.startsWith("--repetitions="))
+    {
+      if(!ParseCount(argument, "--repetitions=", options.repetitions))
+      {
+        return EXIT_FAILURE;
+      }
+    }
+    else if(argument.startsWith("--filter="))
+    {
+      options.filter = argument.mid(9);
+    }
+    else if(argument.startsWith("--json="))
+    {
+      options.jsonFile = argument.mid(7);
+    }
+    else if(argument.startsWith("--workdir="))
+    {
+      options.workingDirectory = argument.mid(10);
+    }
+    else if(argument == "--list")
+    {
+      options.listOnly = true;
+    }
+    else
+    {
+      PrintUsage();
+      return (argument == "--help" || argument == "-h") ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+  }
+
+  if(!options.listOnly && !QDir().mkpath(options.workingDirectory))
+  {
+    std::cout << "Could not create the working directory '" << options.workingDirectory.toStdString() << "'" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return SIMPLBenchmark::RunBenchmarks(options);
+}
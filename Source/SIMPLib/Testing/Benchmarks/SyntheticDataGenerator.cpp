@@ -0,0 +1,247 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "SyntheticDataGenerator.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Math/SIMPLibMath.h"
+
+namespace
+{
+// The fixed seed keeps every data set identical between runs
+const std::mt19937::result_type k_Seed = 5489u;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t CeilDiv(size_t value, size_t divisor)
+{
+  return (value + divisor - 1) / divisor;
+}
+
+// -----------------------------------------------------------------------------
+// Fills the x, y, z coordinates of an (nx + 1) * (ny + 1) * (nz + 1) grid of points
+// -----------------------------------------------------------------------------
+void FillGridVertices(SharedVertexList& vertices, size_t nx, size_t ny, size_t nz)
+{
+  float* coords = vertices.getPointer(0);
+  size_t v = 0;
+  for(size_t k = 0; k <= nz; k++)
+  {
+    for(size_t j = 0; j <= ny; j++)
+    {
+      for(size_t i = 0; i <= nx; i++)
+      {
+        coords[3 * v + 0] = static_cast<float>(i);
+        coords[3 * v + 1] = static_cast<float>(j);
+        coords[3 * v + 2] = static_cast<float>(k);
+        v++;
+      }
+    }
+  }
+}
+} // namespace
+
+namespace SyntheticData
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer CreateImageDataContainerArray(size_t numCells)
+{
+  size_t nx = std::max<size_t>(1, static_cast<size_t>(std::ceil(std::cbrt(static_cast<double>(numCells)))));
+  size_t ny = nx;
+  size_t nz = std::max<size_t>(1, CeilDiv(numCells, nx * ny));
+
+  size_t gx = CeilDiv(nx, k_GrainSize);
+  size_t gy = CeilDiv(ny, k_GrainSize);
+  size_t gz = CeilDiv(nz, k_GrainSize);
+  size_t numFeatures = gx * gy * gz + 1;
+
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  DataContainer::Pointer dc = DataContainer::New(k_DataContainerName);
+  ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+  image->setDimensions(nx, ny, nz);
+  dc->setGeometry(image);
+
+  std::mt19937 generator(k_Seed);
+  std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+  std::uniform_real_distribution<float> angle(0.0f, SIMPLib::Constants::k_2Pi<float>);
+
+  std::vector<size_t> featureDims = {numFeatures};
+  AttributeMatrix::Pointer featureAttrMat = AttributeMatrix::New(featureDims, k_FeatureAttributeMatrixName, AttributeMatrix::Type::CellFeature);
+  BoolArrayType::Pointer active = BoolArrayType::CreateArray(numFeatures, k_ActiveArrayName, true);
+  Int32ArrayType::Pointer featurePhases = Int32ArrayType::CreateArray(numFeatures, k_PhasesArrayName, true);
+  std::vector<std::array<float, 3>> featureEulers(numFeatures);
+  for(size_t f = 0; f < numFeatures; f++)
+  {
+    active->setValue(f, f > 0);
+    featurePhases->setValue(f, (f == 0) ? 0 : static_cast<int32_t>(f % 2 + 1));
+    featureEulers[f] = {angle(generator), 0.5f * angle(generator), angle(generator)};
+  }
+  featureAttrMat->insertOrAssign(active);
+  featureAttrMat->insertOrAssign(featurePhases);
+
+  std::vector<size_t> cellDims = {nx, ny, nz};
+  std::vector<size_t> cDims = {1};
+  AttributeMatrix::Pointer cellAttrMat = AttributeMatrix::New(cellDims, k_CellAttributeMatrixName, AttributeMatrix::Type::Cell);
+  Int32ArrayType::Pointer featureIdsPtr = Int32ArrayType::CreateArray(cellDims, cDims, k_FeatureIdsArrayName, true);
+  Int32ArrayType::Pointer phasesPtr = Int32ArrayType::CreateArray(cellDims, cDims, k_PhasesArrayName, true);
+  FloatArrayType::Pointer confidencePtr = FloatArrayType::CreateArray(cellDims, cDims, k_ConfidenceArrayName, true);
+  cDims[0] = 3;
+  FloatArrayType::Pointer eulersPtr = FloatArrayType::CreateArray(cellDims, cDims, k_EulersArrayName, true);
+
+  int32_t* featureIds = featureIdsPtr->getPointer(0);
+  int32_t* phases = phasesPtr->getPointer(0);
+  float* confidence = confidencePtr->getPointer(0);
+  float* eulers = eulersPtr->getPointer(0);
+  size_t cell = 0;
+  for(size_t k = 0; k < nz; k++)
+  {
+    for(size_t j = 0; j < ny; j++)
+    {
+      for(size_t i = 0; i < nx; i++)
+      {
+        size_t feature = 1 + (i / k_GrainSize) + gx * ((j / k_GrainSize) + gy * (k / k_GrainSize));
+        featureIds[cell] = static_cast<int32_t>(feature);
+        phases[cell] = featurePhases->getValue(feature);
+        confidence[cell] = unit(generator);
+        eulers[3 * cell + 0] = featureEulers[feature][0];
+        eulers[3 * cell + 1] = featureEulers[feature][1];
+        eulers[3 * cell + 2] = featureEulers[feature][2];
+        cell++;
+      }
+    }
+  }
+  cellAttrMat->insertOrAssign(featureIdsPtr);
+  cellAttrMat->insertOrAssign(phasesPtr);
+  cellAttrMat->insertOrAssign(confidencePtr);
+  cellAttrMat->insertOrAssign(eulersPtr);
+
+  dc->addOrReplaceAttributeMatrix(cellAttrMat);
+  dc->addOrReplaceAttributeMatrix(featureAttrMat);
+  dca->addOrReplaceDataContainer(dc);
+  return dca;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleGeom::Pointer CreateTriangleGeometry(size_t numTriangles)
+{
+  size_t nx = std::max<size_t>(1, static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(numTriangles) / 2.0))));
+  size_t ny = std::max<size_t>(1, CeilDiv(numTriangles, 2 * nx));
+
+  SharedVertexList::Pointer vertices = TriangleGeom::CreateSharedVertexList((nx + 1) * (ny + 1));
+  FillGridVertices(*vertices, nx, ny, 0);
+
+  TriangleGeom::Pointer triangleGeom = TriangleGeom::CreateGeometry(2 * nx * ny, vertices, SIMPL::Geometry::TriangleGeometry);
+  MeshIndexType* tris = triangleGeom->getTriangles()->getPointer(0);
+  size_t t = 0;
+  for(size_t j = 0; j < ny; j++)
+  {
+    for(size_t i = 0; i < nx; i++)
+    {
+      MeshIndexType v0 = j * (nx + 1) + i;
+      MeshIndexType v1 = v0 + 1;
+      MeshIndexType v2 = v0 + (nx + 1);
+      MeshIndexType v3 = v2 + 1;
+      tris[3 * t + 0] = v0;
+      tris[3 * t + 1] = v1;
+      tris[3 * t + 2] = v3;
+      t++;
+      tris[3 * t + 0] = v0;
+      tris[3 * t + 1] = v3;
+      tris[3 * t + 2] = v2;
+      t++;
+    }
+  }
+  return triangleGeom;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TetrahedralGeom::Pointer CreateTetrahedralGeometry(size_t numTets)
+{
+  size_t n = std::max<size_t>(1, static_cast<size_t>(std::ceil(std::cbrt(static_cast<double>(numTets) / 6.0))));
+  size_t nz = std::max<size_t>(1, CeilDiv(numTets, 6 * n * n));
+
+  SharedVertexList::Pointer vertices = TetrahedralGeom::CreateSharedVertexList((n + 1) * (n + 1) * (nz + 1));
+  FillGridVertices(*vertices, n, n, nz);
+
+  // Every cube is split along its main diagonal from corner 0 to corner 7; corner c sits at
+  // (c & 1, (c >> 1) & 1, (c >> 2) & 1)
+  const std::array<std::array<size_t, 4>, 6> k_CubeTets = {{{0, 1, 3, 7}, {0, 1, 5, 7}, {0, 2, 3, 7}, {0, 2, 6, 7}, {0, 4, 5, 7}, {0, 4, 6, 7}}};
+
+  TetrahedralGeom::Pointer tetGeom = TetrahedralGeom::CreateGeometry(6 * n * n * nz, vertices, SIMPL::Geometry::TetrahedralGeometry);
+  MeshIndexType* tets = tetGeom->getTetrahedra()->getPointer(0);
+  size_t rowStride = n + 1;
+  size_t sliceStride = (n + 1) * (n + 1);
+  size_t t = 0;
+  for(size_t k = 0; k < nz; k++)
+  {
+    for(size_t j = 0; j < n; j++)
+    {
+      for(size_t i = 0; i < n; i++)
+      {
+        std::array<MeshIndexType, 8> corners = {};
+        for(size_t c = 0; c < 8; c++)
+        {
+          corners[c] = (k + ((c >> 2) & 1)) * sliceStride + (j + ((c >> 1) & 1)) * rowStride + (i + (c & 1));
+        }
+        for(const std::array<size_t, 4>& tet : k_CubeTets)
+        {
+          for(size_t v = 0; v < 4; v++)
+          {
+            tets[4 * t + v] = corners[tet[v]];
+          }
+          t++;
+        }
+      }
+    }
+  }
+  return tetGeom;
+}
+
+} // namespace SyntheticData
@@ -0,0 +1,90 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <cstddef>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Geometry/TetrahedralGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+
+/**
+ * @brief The SyntheticData namespace builds the deterministic data sets the benchmarks run on, so that
+ * every run and every machine times the same input without shipping data files.
+ */
+namespace SyntheticData
+{
+inline const QString k_DataContainerName("ImageDataContainer");
+inline const QString k_CellAttributeMatrixName("CellData");
+inline const QString k_FeatureAttributeMatrixName("CellFeatureData");
+inline const QString k_FeatureIdsArrayName("FeatureIds");
+inline const QString k_PhasesArrayName("Phases");
+inline const QString k_ConfidenceArrayName("Confidence");
+inline const QString k_EulersArrayName("EulerAngles");
+inline const QString k_ActiveArrayName("Active");
+
+/**
+ * @brief Edge length, in cells, of the cubic grains written to FeatureIds
+ */
+inline const size_t k_GrainSize = 8;
+
+/**
+ * @brief Creates an image geometry of roughly numCells cells, as close to a cube as possible. The cell attribute
+ * matrix holds FeatureIds (int32, cubic grains), Phases (int32, 1 or 2), Confidence (float in [0, 1]) and
+ * EulerAngles (float, 3 components). The feature attribute matrix holds Active (bool) and Phases (int32)
+ * for every feature plus the unused feature 0.
+ * @param numCells
+ * @return
+ */
+DataContainerArray::Pointer CreateImageDataContainerArray(size_t numCells);
+
+/**
+ * @brief Creates a triangle geometry of roughly numTriangles triangles that splits a flat grid of quads
+ * @param numTriangles
+ * @return
+ */
+TriangleGeom::Pointer CreateTriangleGeometry(size_t numTriangles);
+
+/**
+ * @brief Creates a tetrahedral geometry of roughly numTets tetrahedra that splits a grid of cubes into six
+ * tetrahedra each, so neighboring cubes share their faces
+ * @param numTets
+ * @return
+ */
+TetrahedralGeom::Pointer CreateTetrahedralGeometry(size_t numTets);
+
+} // namespace SyntheticData
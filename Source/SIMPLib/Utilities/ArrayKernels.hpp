@@ -0,0 +1,558 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+/**
+ * @brief The ArrayKernels namespace holds the bulk copy kernels shared by the filters that
+ * reshape or retype whole arrays: interleaving several arrays into one multi-component array
+ * (array of structures), splitting a multi-component array into scalar arrays (structure of
+ * arrays), per-component value ranges and numeric type conversion. Every kernel runs through
+ * ParallelDataAlgorithm. The inner loops are written for the auto-vectorizer: they work on
+ * tiles of tuples that stay in the L1 cache, the common component counts of 1 to 4 are
+ * instantiated with a compile time stride and the conversion mode is resolved once per range.
+ */
+namespace ArrayKernels
+{
+
+/**
+ * @brief The ConversionMode enum selects how values that do not fit the output type are handled.
+ * Cast is a plain static_cast. Saturate clamps to the range of the output type and maps NaN to zero.
+ * Normalize maps the integer range onto [0, 1] (unsigned) or [-1, 1] (signed) and back, so a uint8_t
+ * of 255 becomes 1.0f and a float of 0.5f becomes 128 as a uint8_t. Floating point values are
+ * not rescaled among themselves and bool counts as an unsigned type with a maximum of 1.
+ */
+enum class ConversionMode : int32_t
+{
+  Cast = 0,
+  Saturate = 1,
+  Normalize = 2
+};
+
+/**
+ * @brief Number of tuples that are processed together by the interleave kernels
+ */
+static const size_t k_TileSize = 1024;
+
+/**
+ * @brief Smallest number of tuples that is worth an extra chunk in ComputeComponentRanges()
+ */
+static const size_t k_MinTuplesPerChunk = 65536;
+
+namespace Detail
+{
+template <typename T>
+struct IsInteger : std::integral_constant<bool, std::is_integral<T>::value && !std::is_same<T, bool>::value>
+{
+};
+
+/**
+ * @brief Converts value to OutT, clamping it to the range of OutT. NaN becomes zero.
+ * @param value
+ * @return
+ */
+template <typename OutT, typename InT>
+OutT SaturateCast(InT value)
+{
+  if constexpr(std::is_same<OutT, bool>::value || std::is_floating_point<OutT>::value || std::is_same<InT, bool>::value)
+  {
+    // Every value fits, floating point overflow already saturates to infinity
+    return static_cast<OutT>(value);
+  }
+  else if constexpr(std::is_floating_point<InT>::value)
+  {
+    // The limits of every integer type are exactly representable as a double, and a double
+    // below max() rounds to at most max() - 1 ulp, so these comparisons are exact
+    const double d = static_cast<double>(value);
+    if(std::isnan(d))
+    {
+      return OutT(0);
+    }
+    if(d <= static_cast<double>(std::numeric_limits<OutT>::lowest()))
+    {
+      return std::numeric_limits<OutT>::lowest();
+    }
+    if(d >= static_cast<double>(std::numeric_limits<OutT>::max()))
+    {
+      return std::numeric_limits<OutT>::max();
+    }
+    return static_cast<OutT>(value);
+  }
+  else
+  {
+    if constexpr(std::is_signed<InT>::value)
+    {
+      if(value < 0)
+      {
+        if constexpr(std::is_signed<OutT>::value)
+        {
+          return static_cast<intmax_t>(value) < static_cast<intmax_t>(std::numeric_limits<OutT>::lowest()) ? std::numeric_limits<OutT>::lowest() : static_cast<OutT>(value);
+        }
+        else
+        {
+          return OutT(0);
+        }
+      }
+    }
+    return static_cast<uintmax_t>(value) > static_cast<uintmax_t>(std::numeric_limits<OutT>::max()) ? std::numeric_limits<OutT>::max() : static_cast<OutT>(value);
+  }
+}
+
+/**
+ * @brief Maps value onto [0, 1] (unsigned integers) or [-1, 1] (signed integers). Floating point
+ * values are returned unchanged.
+ * @param value
+ * @return
+ */
+template <typename T>
+double ToUnit(T value)
+{
+  if constexpr(std::is_floating_point<T>::value)
+  {
+    return static_cast<double>(value);
+  }
+  else if constexpr(std::is_signed<T>::value)
+  {
+    return std::max(static_cast<double>(value) / static_cast<double>(std::numeric_limits<T>::max()), -1.0);
+  }
+  else
+  {
+    return static_cast<double>(value) / static_cast<double>(std::numeric_limits<T>::max());
+  }
+}
+
+/**
+ * @brief Inverse of ToUnit(). Integer results are rounded to the nearest value and values outside
+ * of the unit range saturate.
+ * @param value
+ * @return
+ */
+template <typename T>
+T FromUnit(double value)
+{
+  if constexpr(std::is_floating_point<T>::value)
+  {
+    return static_cast<T>(value);
+  }
+  else if constexpr(std::is_same<T, bool>::value)
+  {
+    return value >= 0.5;
+  }
+  else
+  {
+    return SaturateCast<T>(std::round(value * static_cast<double>(std::numeric_limits<T>::max())));
+  }
+}
+
+/**
+ * @brief Converts one value using the conversion mode
+ * @param value
+ * @return
+ */
+template <ConversionMode Mode, typename OutT, typename InT>
+OutT ConvertValue(InT value)
+{
+  if constexpr(Mode == ConversionMode::Saturate)
+  {
+    return SaturateCast<OutT>(value);
+  }
+  else if constexpr(Mode == ConversionMode::Normalize && !(std::is_floating_point<InT>::value && std::is_floating_point<OutT>::value))
+  {
+    return FromUnit<OutT>(ToUnit(value));
+  }
+  else
+  {
+    return static_cast<OutT>(value);
+  }
+}
+} // namespace Detail
+
+/**
+ * @brief The InterleaveImpl class writes the tuples of a range of several input arrays
+ * side by side into one multi-component output array. With Normalize each value is mapped
+ * onto (value - min) / (max - min) of its output component, or zero when min equals max.
+ */
+template <typename T, bool Normalize>
+class InterleaveImpl
+{
+public:
+  InterleaveImpl(const std::vector<const T*>& inputs, const std::vector<size_t>& inputComponents, const T* minValues, const T* maxValues, T* output)
+  : m_Inputs(inputs)
+  , m_InputComponents(inputComponents)
+  , m_MinValues(minValues)
+  , m_MaxValues(maxValues)
+  , m_Output(output)
+  {
+    m_Offsets.reserve(m_InputComponents.size());
+    for(size_t numComps : m_InputComponents)
+    {
+      m_Offsets.push_back(m_NumComponents);
+      m_NumComponents += numComps;
+    }
+  }
+  virtual ~InterleaveImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t begin = range.min(); begin < range.max(); begin += k_TileSize)
+    {
+      const size_t end = std::min(begin + k_TileSize, range.max());
+      for(size_t input = 0; input < m_Inputs.size(); input++)
+      {
+        switch(m_InputComponents[input])
+        {
+        case 1:
+          copyTile<1>(input, begin, end);
+          break;
+        case 2:
+          copyTile<2>(input, begin, end);
+          break;
+        case 3:
+          copyTile<3>(input, begin, end);
+          break;
+        case 4:
+          copyTile<4>(input, begin, end);
+          break;
+        default:
+          copyTile<0>(input, begin, end);
+          break;
+        }
+      }
+    }
+  }
+
+private:
+  std::vector<const T*> m_Inputs;
+  std::vector<size_t> m_InputComponents;
+  std::vector<size_t> m_Offsets;
+  size_t m_NumComponents = 0;
+  const T* m_MinValues = nullptr;
+  const T* m_MaxValues = nullptr;
+  T* m_Output = nullptr;
+
+  /**
+   * @brief Copies one input over a tile of tuples. N is the number of components of the input,
+   * or 0 if it is only known at run time.
+   */
+  template <size_t N>
+  void copyTile(size_t input, size_t begin, size_t end) const
+  {
+    const size_t numComps = (N > 0) ? N : m_InputComponents[input];
+    const size_t stride = m_NumComponents;
+    const size_t offset = m_Offsets[input];
+    const T* source = m_Inputs[input];
+    T* destination = m_Output + offset;
+    for(size_t i = begin; i < end; i++)
+    {
+      for(size_t k = 0; k < numComps; k++)
+      {
+        if constexpr(Normalize)
+        {
+          const T minValue = m_MinValues[offset + k];
+          const T maxValue = m_MaxValues[offset + k];
+          destination[i * stride + k] = (maxValue == minValue) ? static_cast<T>(0) : static_cast<T>((source[i * numComps + k] - minValue) / (maxValue - minValue));
+        }
+        else
+        {
+          destination[i * stride + k] = source[i * numComps + k];
+        }
+      }
+    }
+  }
+};
+
+/**
+ * @brief The DeinterleaveImpl class copies each component of a range of a multi-component
+ * array into its own scalar array
+ */
+template <typename T>
+class DeinterleaveImpl
+{
+public:
+  DeinterleaveImpl(const T* input, size_t numComponents, const std::vector<T*>& outputs)
+  : m_Input(input)
+  , m_NumComponents(numComponents)
+  , m_Outputs(outputs)
+  {
+  }
+  virtual ~DeinterleaveImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    switch(m_NumComponents)
+    {
+    case 2:
+      split<2>(range.min(), range.max());
+      break;
+    case 3:
+      split<3>(range.min(), range.max());
+      break;
+    case 4:
+      split<4>(range.min(), range.max());
+      break;
+    default:
+      for(size_t begin = range.min(); begin < range.max(); begin += k_TileSize)
+      {
+        const size_t end = std::min(begin + k_TileSize, range.max());
+        for(size_t k = 0; k < m_NumComponents; k++)
+        {
+          T* destination = m_Outputs[k];
+          for(size_t i = begin; i < end; i++)
+          {
+            destination[i] = m_Input[i * m_NumComponents + k];
+          }
+        }
+      }
+      break;
+    }
+  }
+
+private:
+  const T* m_Input = nullptr;
+  size_t m_NumComponents = 0;
+  std::vector<T*> m_Outputs;
+
+  template <size_t N>
+  void split(size_t begin, size_t end) const
+  {
+    T* destinations[N];
+    std::copy_n(m_Outputs.begin(), N, destinations);
+    for(size_t i = begin; i < end; i++)
+    {
+      for(size_t k = 0; k < N; k++)
+      {
+        destinations[k][i] = m_Input[i * N + k];
+      }
+    }
+  }
+};
+
+/**
+ * @brief The ComponentRangeImpl class computes the per-component minimum and maximum of
+ * whole chunks of tuples into the partial results of each chunk
+ */
+template <typename T>
+class ComponentRangeImpl
+{
+public:
+  ComponentRangeImpl(const T* input, size_t numComponents, size_t numTuples, size_t numChunks, T* minValues, T* maxValues)
+  : m_Input(input)
+  , m_NumComponents(numComponents)
+  , m_NumTuples(numTuples)
+  , m_NumChunks(numChunks)
+  , m_MinValues(minValues)
+  , m_MaxValues(maxValues)
+  {
+  }
+  virtual ~ComponentRangeImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t chunk = range.min(); chunk < range.max(); chunk++)
+    {
+      T* minValues = m_MinValues + chunk * m_NumComponents;
+      T* maxValues = m_MaxValues + chunk * m_NumComponents;
+      const size_t end = (chunk + 1) * m_NumTuples / m_NumChunks;
+      for(size_t i = chunk * m_NumTuples / m_NumChunks; i < end; i++)
+      {
+        const T* values = m_Input + i * m_NumComponents;
+        for(size_t k = 0; k < m_NumComponents; k++)
+        {
+          minValues[k] = (values[k] < minValues[k]) ? values[k] : minValues[k];
+          maxValues[k] = (values[k] > maxValues[k]) ? values[k] : maxValues[k];
+        }
+      }
+    }
+  }
+
+private:
+  const T* m_Input = nullptr;
+  size_t m_NumComponents = 0;
+  size_t m_NumTuples = 0;
+  size_t m_NumChunks = 1;
+  T* m_MinValues = nullptr;
+  T* m_MaxValues = nullptr;
+};
+
+/**
+ * @brief The ConvertImpl class converts a range of values to another type
+ */
+template <typename InT, typename OutT, ConversionMode Mode>
+class ConvertImpl
+{
+public:
+  ConvertImpl(const InT* input, OutT* output)
+  : m_Input(input)
+  , m_Output(output)
+  {
+  }
+  virtual ~ConvertImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      m_Output[i] = Detail::ConvertValue<Mode, OutT>(m_Input[i]);
+    }
+  }
+
+private:
+  const InT* m_Input = nullptr;
+  OutT* m_Output = nullptr;
+};
+
+/**
+ * @brief Writes the tuples of the inputs side by side into output, which must hold
+ * numTuples * sum(inputComponents) values. Input i holds numTuples * inputComponents[i] values.
+ * @param inputs
+ * @param inputComponents
+ * @param numTuples
+ * @param output
+ */
+template <typename T>
+void Interleave(const std::vector<const T*>& inputs, const std::vector<size_t>& inputComponents, size_t numTuples, T* output)
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numTuples);
+  dataAlg.execute(InterleaveImpl<T, false>(inputs, inputComponents, nullptr, nullptr, output));
+}
+
+/**
+ * @brief Same as Interleave() but every value is rescaled with the minimum and maximum of its output
+ * component to (value - min) / (max - min), computed in T. Components whose minimum equals their
+ * maximum are set to zero.
+ * @param inputs
+ * @param inputComponents
+ * @param numTuples
+ * @param minValues The minimum of each output component
+ * @param maxValues The maximum of each output component
+ * @param output
+ */
+template <typename T>
+void InterleaveNormalized(const std::vector<const T*>& inputs, const std::vector<size_t>& inputComponents, size_t numTuples, const std::vector<T>& minValues, const std::vector<T>& maxValues,
+                          T* output)
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numTuples);
+  dataAlg.execute(InterleaveImpl<T, true>(inputs, inputComponents, minValues.data(), maxValues.data(), output));
+}
+
+/**
+ * @brief Copies component k of input into outputs[k]. Each output holds numTuples values.
+ * @param input
+ * @param numComponents
+ * @param numTuples
+ * @param outputs One output per component
+ */
+template <typename T>
+void Deinterleave(const T* input, size_t numComponents, size_t numTuples, const std::vector<T*>& outputs)
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numTuples);
+  dataAlg.execute(DeinterleaveImpl<T>(input, numComponents, outputs));
+}
+
+/**
+ * @brief Computes the minimum and maximum of each component of input. NaN values are ignored.
+ * Components of an empty input keep the limits of T (max() as minimum, lowest() as maximum).
+ * @param input
+ * @param numComponents
+ * @param numTuples
+ * @param minValues Receives numComponents values
+ * @param maxValues Receives numComponents values
+ */
+template <typename T>
+void ComputeComponentRanges(const T* input, size_t numComponents, size_t numTuples, std::vector<T>& minValues, std::vector<T>& maxValues)
+{
+  size_t numChunks = 1;
+  ParallelDataAlgorithm dataAlg;
+  if(dataAlg.getParallelizationEnabled())
+  {
+    numChunks = std::max<size_t>(std::min<size_t>(std::thread::hardware_concurrency(), numTuples / k_MinTuplesPerChunk), 1);
+  }
+
+  std::vector<T> partialMins(numChunks * numComponents, std::numeric_limits<T>::max());
+  std::vector<T> partialMaxs(numChunks * numComponents, std::numeric_limits<T>::lowest());
+  dataAlg.setRange(0, numChunks);
+  dataAlg.execute(ComponentRangeImpl<T>(input, numComponents, numTuples, numChunks, partialMins.data(), partialMaxs.data()));
+
+  minValues.assign(partialMins.begin(), partialMins.begin() + numComponents);
+  maxValues.assign(partialMaxs.begin(), partialMaxs.begin() + numComponents);
+  for(size_t chunk = 1; chunk < numChunks; chunk++)
+  {
+    for(size_t k = 0; k < numComponents; k++)
+    {
+      minValues[k] = std::min(minValues[k], partialMins[chunk * numComponents + k]);
+      maxValues[k] = std::max(maxValues[k], partialMaxs[chunk * numComponents + k]);
+    }
+  }
+}
+
+/**
+ * @brief Converts count values from input into output
+ * @param input
+ * @param count
+ * @param output
+ * @param mode
+ */
+template <typename InT, typename OutT>
+void Convert(const InT* input, size_t count, OutT* output, ConversionMode mode = ConversionMode::Cast)
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, count);
+  switch(mode)
+  {
+  case ConversionMode::Saturate:
+    dataAlg.execute(ConvertImpl<InT, OutT, ConversionMode::Saturate>(input, output));
+    break;
+  case ConversionMode::Normalize:
+    dataAlg.execute(ConvertImpl<InT, OutT, ConversionMode::Normalize>(input, output));
+    break;
+  default:
+    dataAlg.execute(ConvertImpl<InT, OutT, ConversionMode::Cast>(input, output));
+    break;
+  }
+}
+
+} // namespace ArrayKernels
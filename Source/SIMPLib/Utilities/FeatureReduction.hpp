@@ -0,0 +1,685 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Utilities/ParallelDataAlgorithm.h"
+
+/**
+ * @brief The FeatureReduction namespace holds a dense-indexed engine that reduces Element
+ * (cell) level values into Feature level values using a Feature Ids array, as well as the
+ * inverse gather operation. Feature Ids are treated as direct indices into the Feature
+ * arrays so no map lookups are needed. The cells are split into contiguous chunks that
+ * each accumulate dense per-Feature partial results, which are then merged per Feature.
+ * Both passes run through ParallelDataAlgorithm.
+ */
+namespace FeatureReduction
+{
+
+/**
+ * @brief The Operation enum lists the supported per-Feature reductions. Features that
+ * do not own any cells always receive a value of zero.
+ */
+enum class Operation : int32_t
+{
+  First = 0,   //!< Value of the cell with the lowest index in the Feature
+  Last = 1,    //!< Value of the cell with the highest index in the Feature
+  Minimum = 2, //!< Smallest value per component
+  Maximum = 3, //!< Largest value per component
+  Sum = 4,     //!< Sum per component, accumulated in AccumulatorType
+  Mean = 5,    //!< Arithmetic mean per component
+  Mode = 6     //!< Most frequent value per component, ties resolve to the smallest value
+};
+
+/**
+ * @brief AccumulatorType is the type used to accumulate Sum and Mean results for a value type T
+ */
+template <typename T>
+using AccumulatorType = typename std::conditional<std::is_floating_point<T>::value, double, typename std::conditional<std::is_signed<T>::value, int64_t, uint64_t>::type>::type;
+
+static const size_t k_InvalidIndex = std::numeric_limits<size_t>::max();
+
+/**
+ * @brief Minimum number of cells a chunk must hold before another chunk is added
+ */
+static const size_t k_MinCellsPerChunk = 65536;
+
+/**
+ * @brief The FeatureReducerStepImpl class runs one pass of a FeatureReducer over a range of
+ * chunks or Features.
+ */
+template <typename ReducerType>
+class FeatureReducerStepImpl
+{
+public:
+  using StepFunction = void (ReducerType::*)(size_t, size_t);
+
+  FeatureReducerStepImpl(ReducerType* reducer, StepFunction step)
+  : m_Reducer(reducer)
+  , m_Step(step)
+  {
+  }
+  virtual ~FeatureReducerStepImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    (m_Reducer->*m_Step)(range.min(), range.max());
+  }
+
+private:
+  ReducerType* m_Reducer = nullptr;
+  StepFunction m_Step = nullptr;
+};
+
+/**
+ * @brief The FeatureReducer class reduces a cell array of type T into a Feature array of
+ * type OutT. The cell array holds numCells tuples of numComponents values, and featureIds
+ * holds one Feature Id per cell. Cells whose Feature Id lies outside [0, numFeatures) are
+ * skipped and counted.
+ *
+ * Memory use: every chunk keeps dense partials for all Features, so the number of chunks is
+ * limited such that the partials stay well below the size of the cell data. The Mode
+ * operation additionally needs one index per cell to group the cells by Feature.
+ */
+template <typename T, typename OutT = T>
+class FeatureReducer
+{
+public:
+  using Self = FeatureReducer<T, OutT>;
+  using AccumType = AccumulatorType<T>;
+
+  FeatureReducer(const T* cellValues, size_t numComponents, const int32_t* featureIds, size_t numCells, size_t numFeatures)
+  : m_CellValues(cellValues)
+  , m_NumComponents(numComponents)
+  , m_FeatureIds(featureIds)
+  , m_NumCells(numCells)
+  , m_NumFeatures(numFeatures)
+  {
+  }
+  virtual ~FeatureReducer() = default;
+
+  /**
+   * @brief Sets whether reduce() also checks that all cells of a Feature hold the same values.
+   * The result of the check is available through getFirstNonUniformFeature().
+   * @param value
+   */
+  void setCheckUniform(bool value)
+  {
+    m_CheckUniform = value;
+  }
+
+  /**
+   * @brief Returns whether reduce() checks that all cells of a Feature hold the same values.
+   * @return
+   */
+  bool getCheckUniform() const
+  {
+    return m_CheckUniform;
+  }
+
+  /**
+   * @brief Reduces the cell values into featureValues, which must hold numFeatures * numComponents values.
+   * @param operation The reduction to apply
+   * @param featureValues The output Feature values
+   */
+  void reduce(Operation operation, OutT* featureValues)
+  {
+    m_Operation = operation;
+    m_Output = featureValues;
+    m_FirstNonUniformFeature = -1;
+    m_NumSkippedCells = 0;
+    if(m_NumFeatures == 0)
+    {
+      return;
+    }
+
+    m_NumChunks = computeNumberOfChunks();
+    size_t numSlots = m_NumChunks * m_NumFeatures;
+    m_FirstIndex.reset(new size_t[numSlots]);
+    m_Counts.reset(new size_t[numSlots]);
+    m_LastIndex.reset(operation == Operation::Last ? new size_t[numSlots] : nullptr);
+    m_Extrema.reset(operation == Operation::Minimum || operation == Operation::Maximum ? new T[numSlots * m_NumComponents] : nullptr);
+    m_Sums.reset(operation == Operation::Sum || operation == Operation::Mean ? new AccumType[numSlots * m_NumComponents] : nullptr);
+    m_MismatchIndex.reset(m_CheckUniform ? new size_t[numSlots] : nullptr);
+    m_ChunkOffsets.reset(operation == Operation::Mode ? new size_t[numSlots] : nullptr);
+    m_ChunkSkipped.assign(m_NumChunks, 0);
+
+    runStep(m_NumChunks, &Self::accumulateChunks);
+    runStep(m_NumFeatures, &Self::mergeFeatures);
+
+    for(size_t skipped : m_ChunkSkipped)
+    {
+      m_NumSkippedCells += skipped;
+    }
+
+    if(m_CheckUniform)
+    {
+      size_t firstMismatch = *std::min_element(m_MismatchIndex.get(), m_MismatchIndex.get() + m_NumFeatures);
+      if(firstMismatch != k_InvalidIndex)
+      {
+        m_FirstNonUniformFeature = m_FeatureIds[firstMismatch];
+      }
+    }
+
+    if(operation == Operation::Mode)
+    {
+      // Group the cell indices by Feature, preserving cell order within each Feature
+      m_FeatureOffsets.resize(m_NumFeatures + 1);
+      m_FeatureOffsets[0] = 0;
+      for(size_t f = 0; f < m_NumFeatures; f++)
+      {
+        m_FeatureOffsets[f + 1] = m_FeatureOffsets[f] + m_Counts[f];
+      }
+      m_SortedCells.reset(new size_t[m_FeatureOffsets[m_NumFeatures]]);
+      runStep(m_NumChunks, &Self::groupChunks);
+      runStep(m_NumFeatures, &Self::modeFeatures);
+      m_SortedCells.reset();
+    }
+    else
+    {
+      runStep(m_NumFeatures, &Self::finalizeFeatures);
+    }
+
+    m_LastIndex.reset();
+    m_Extrema.reset();
+    m_Sums.reset();
+    m_ChunkOffsets.reset();
+  }
+
+  /**
+   * @brief Returns the number of cells owned by the Feature during the last call to reduce().
+   * @param featureId
+   * @return
+   */
+  size_t getNumberOfCells(size_t featureId) const
+  {
+    if(nullptr == m_Counts || featureId >= m_NumFeatures)
+    {
+      return 0;
+    }
+    return m_Counts[featureId];
+  }
+
+  /**
+   * @brief Returns the Feature owning the lowest indexed cell whose values differ from the
+   * first cell of its Feature, or -1 if all Features were uniform. Only valid when the
+   * uniform check was enabled for the last call to reduce().
+   * @return
+   */
+  int32_t getFirstNonUniformFeature() const
+  {
+    return m_FirstNonUniformFeature;
+  }
+
+  /**
+   * @brief Returns the number of cells that were skipped because their Feature Id was out of range.
+   * @return
+   */
+  size_t getNumberOfSkippedCells() const
+  {
+    return m_NumSkippedCells;
+  }
+
+private:
+  using StepFunction = typename FeatureReducerStepImpl<Self>::StepFunction;
+  using StorageType = typename std::conditional<std::is_same<T, bool>::value, uint8_t, T>::type;
+
+  friend class FeatureReducerStepImpl<Self>;
+
+  const T* m_CellValues = nullptr;
+  size_t m_NumComponents = 0;
+  const int32_t* m_FeatureIds = nullptr;
+  size_t m_NumCells = 0;
+  size_t m_NumFeatures = 0;
+  bool m_CheckUniform = false;
+
+  Operation m_Operation = Operation::Last;
+  OutT* m_Output = nullptr;
+  size_t m_NumChunks = 1;
+  int32_t m_FirstNonUniformFeature = -1;
+  size_t m_NumSkippedCells = 0;
+
+  std::unique_ptr<size_t[]> m_FirstIndex;
+  std::unique_ptr<size_t[]> m_Counts;
+  std::unique_ptr<size_t[]> m_LastIndex;
+  std::unique_ptr<T[]> m_Extrema;
+  std::unique_ptr<AccumType[]> m_Sums;
+  std::unique_ptr<size_t[]> m_MismatchIndex;
+  std::unique_ptr<size_t[]> m_ChunkOffsets;
+  std::unique_ptr<size_t[]> m_SortedCells;
+  std::vector<size_t> m_ChunkSkipped;
+  std::vector<size_t> m_FeatureOffsets;
+
+  /**
+   * @brief Picks one chunk per hardware thread as long as every chunk holds at least
+   * k_MinCellsPerChunk cells and the dense partials stay below a quarter of the cell count.
+   * @return
+   */
+  size_t computeNumberOfChunks() const
+  {
+    ParallelDataAlgorithm dataAlg;
+    if(!dataAlg.getParallelizationEnabled())
+    {
+      return 1;
+    }
+    size_t numChunks = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    numChunks = std::min(numChunks, m_NumCells / k_MinCellsPerChunk);
+    numChunks = std::min(numChunks, m_NumCells / (4 * m_NumFeatures));
+    return std::max<size_t>(numChunks, 1);
+  }
+
+  size_t chunkBegin(size_t chunk) const
+  {
+    return chunk * m_NumCells / m_NumChunks;
+  }
+
+  void runStep(size_t count, StepFunction step)
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, count);
+    dataAlg.execute(FeatureReducerStepImpl<Self>(this, step));
+  }
+
+  bool valuesDiffer(size_t cellA, size_t cellB) const
+  {
+    const T* valuesA = m_CellValues + cellA * m_NumComponents;
+    const T* valuesB = m_CellValues + cellB * m_NumComponents;
+    for(size_t j = 0; j < m_NumComponents; j++)
+    {
+      if(valuesA[j] != valuesB[j])
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Accumulates the dense per-Feature partials of each chunk in [begin, end)
+   */
+  void accumulateChunks(size_t begin, size_t end)
+  {
+    for(size_t chunk = begin; chunk < end; chunk++)
+    {
+      size_t slotOffset = chunk * m_NumFeatures;
+      size_t* firstIndex = m_FirstIndex.get() + slotOffset;
+      size_t* counts = m_Counts.get() + slotOffset;
+      size_t* lastIndex = (nullptr != m_LastIndex) ? m_LastIndex.get() + slotOffset : nullptr;
+      size_t* mismatchIndex = (nullptr != m_MismatchIndex) ? m_MismatchIndex.get() + slotOffset : nullptr;
+      T* extrema = (nullptr != m_Extrema) ? m_Extrema.get() + slotOffset * m_NumComponents : nullptr;
+      AccumType* sums = (nullptr != m_Sums) ? m_Sums.get() + slotOffset * m_NumComponents : nullptr;
+      bool isMinimum = (m_Operation == Operation::Minimum);
+
+      std::fill_n(firstIndex, m_NumFeatures, k_InvalidIndex);
+      std::fill_n(counts, m_NumFeatures, 0);
+      if(nullptr != mismatchIndex)
+      {
+        std::fill_n(mismatchIndex, m_NumFeatures, k_InvalidIndex);
+      }
+      if(nullptr != sums)
+      {
+        std::fill_n(sums, m_NumFeatures * m_NumComponents, AccumType(0));
+      }
+
+      size_t skipped = 0;
+      size_t cellEnd = chunkBegin(chunk + 1);
+      for(size_t i = chunkBegin(chunk); i < cellEnd; i++)
+      {
+        int32_t featureId = m_FeatureIds[i];
+        if(featureId < 0 || static_cast<size_t>(featureId) >= m_NumFeatures)
+        {
+          skipped++;
+          continue;
+        }
+        size_t f = static_cast<size_t>(featureId);
+        const T* values = m_CellValues + i * m_NumComponents;
+
+        if(counts[f] == 0)
+        {
+          firstIndex[f] = i;
+          if(nullptr != extrema)
+          {
+            std::copy_n(values, m_NumComponents, extrema + f * m_NumComponents);
+          }
+        }
+        else if(nullptr != extrema)
+        {
+          T* featureExtrema = extrema + f * m_NumComponents;
+          for(size_t j = 0; j < m_NumComponents; j++)
+          {
+            if(isMinimum ? (values[j] < featureExtrema[j]) : (featureExtrema[j] < values[j]))
+            {
+              featureExtrema[j] = values[j];
+            }
+          }
+        }
+        counts[f]++;
+
+        if(nullptr != lastIndex)
+        {
+          lastIndex[f] = i;
+        }
+        if(nullptr != sums)
+        {
+          AccumType* featureSums = sums + f * m_NumComponents;
+          for(size_t j = 0; j < m_NumComponents; j++)
+          {
+            featureSums[j] += static_cast<AccumType>(values[j]);
+          }
+        }
+        if(nullptr != mismatchIndex && mismatchIndex[f] == k_InvalidIndex && valuesDiffer(firstIndex[f], i))
+        {
+          mismatchIndex[f] = i;
+        }
+      }
+      m_ChunkSkipped[chunk] = skipped;
+    }
+  }
+
+  /**
+   * @brief Merges the chunk partials of each Feature in [begin, end) into the first chunk's slots
+   */
+  void mergeFeatures(size_t begin, size_t end)
+  {
+    bool isMinimum = (m_Operation == Operation::Minimum);
+    for(size_t f = begin; f < end; f++)
+    {
+      size_t firstIndex = k_InvalidIndex;
+      size_t lastIndex = k_InvalidIndex;
+      size_t mismatchIndex = k_InvalidIndex;
+      size_t count = 0;
+      T* featureExtrema = (nullptr != m_Extrema) ? m_Extrema.get() + f * m_NumComponents : nullptr;
+      AccumType* featureSums = (nullptr != m_Sums) ? m_Sums.get() + f * m_NumComponents : nullptr;
+
+      for(size_t chunk = 0; chunk < m_NumChunks; chunk++)
+      {
+        size_t slot = chunk * m_NumFeatures + f;
+        size_t chunkCount = m_Counts[slot];
+        if(nullptr != m_ChunkOffsets)
+        {
+          m_ChunkOffsets[slot] = count;
+        }
+        if(chunkCount == 0)
+        {
+          continue;
+        }
+
+        if(chunk > 0)
+        {
+          if(nullptr != featureExtrema)
+          {
+            const T* chunkExtrema = m_Extrema.get() + slot * m_NumComponents;
+            for(size_t j = 0; j < m_NumComponents; j++)
+            {
+              if(count == 0 || (isMinimum ? (chunkExtrema[j] < featureExtrema[j]) : (featureExtrema[j] < chunkExtrema[j])))
+              {
+                featureExtrema[j] = chunkExtrema[j];
+              }
+            }
+          }
+          if(nullptr != featureSums)
+          {
+            const AccumType* chunkSums = m_Sums.get() + slot * m_NumComponents;
+            for(size_t j = 0; j < m_NumComponents; j++)
+            {
+              featureSums[j] += chunkSums[j];
+            }
+          }
+        }
+
+        if(firstIndex == k_InvalidIndex)
+        {
+          firstIndex = m_FirstIndex[slot];
+        }
+        if(nullptr != m_MismatchIndex && mismatchIndex == k_InvalidIndex)
+        {
+          // A chunk whose first cell differs from the Feature's first cell mismatches at that cell,
+          // otherwise the chunk-local mismatch is also the Feature-wide one
+          size_t chunkFirst = m_FirstIndex[slot];
+          mismatchIndex = (chunkFirst != firstIndex && valuesDiffer(firstIndex, chunkFirst)) ? chunkFirst : m_MismatchIndex[slot];
+        }
+        if(nullptr != m_LastIndex)
+        {
+          lastIndex = m_LastIndex[slot];
+        }
+        count += chunkCount;
+      }
+
+      m_FirstIndex[f] = firstIndex;
+      m_Counts[f] = count;
+      if(nullptr != m_LastIndex)
+      {
+        m_LastIndex[f] = lastIndex;
+      }
+      if(nullptr != m_MismatchIndex)
+      {
+        m_MismatchIndex[f] = mismatchIndex;
+      }
+    }
+  }
+
+  /**
+   * @brief Writes the merged results of each Feature in [begin, end) to the output
+   */
+  void finalizeFeatures(size_t begin, size_t end)
+  {
+    for(size_t f = begin; f < end; f++)
+    {
+      OutT* output = m_Output + f * m_NumComponents;
+      size_t count = m_Counts[f];
+      if(count == 0)
+      {
+        std::fill_n(output, m_NumComponents, OutT(0));
+        continue;
+      }
+
+      for(size_t j = 0; j < m_NumComponents; j++)
+      {
+        size_t index = f * m_NumComponents + j;
+        switch(m_Operation)
+        {
+        case Operation::First:
+          output[j] = static_cast<OutT>(m_CellValues[m_FirstIndex[f] * m_NumComponents + j]);
+          break;
+        case Operation::Last:
+          output[j] = static_cast<OutT>(m_CellValues[m_LastIndex[f] * m_NumComponents + j]);
+          break;
+        case Operation::Minimum:
+        case Operation::Maximum:
+          output[j] = static_cast<OutT>(m_Extrema[index]);
+          break;
+        case Operation::Sum:
+          output[j] = static_cast<OutT>(m_Sums[index]);
+          break;
+        case Operation::Mean:
+          output[j] = static_cast<OutT>(static_cast<double>(m_Sums[index]) / static_cast<double>(count));
+          break;
+        case Operation::Mode:
+          break;
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Scatters the cell indices of each chunk in [begin, end) into their Feature's segment
+   */
+  void groupChunks(size_t begin, size_t end)
+  {
+    for(size_t chunk = begin; chunk < end; chunk++)
+    {
+      size_t* chunkOffsets = m_ChunkOffsets.get() + chunk * m_NumFeatures;
+      size_t cellEnd = chunkBegin(chunk + 1);
+      for(size_t i = chunkBegin(chunk); i < cellEnd; i++)
+      {
+        int32_t featureId = m_FeatureIds[i];
+        if(featureId < 0 || static_cast<size_t>(featureId) >= m_NumFeatures)
+        {
+          continue;
+        }
+        m_SortedCells[m_FeatureOffsets[featureId] + chunkOffsets[featureId]++] = i;
+      }
+    }
+  }
+
+  /**
+   * @brief Computes the most frequent value per component of each Feature in [begin, end).
+   * NaN values are ignored unless a Feature holds nothing else.
+   */
+  void modeFeatures(size_t begin, size_t end)
+  {
+    std::vector<StorageType> buffer;
+    for(size_t f = begin; f < end; f++)
+    {
+      OutT* output = m_Output + f * m_NumComponents;
+      size_t segmentBegin = m_FeatureOffsets[f];
+      size_t segmentEnd = m_FeatureOffsets[f + 1];
+      if(segmentBegin == segmentEnd)
+      {
+        std::fill_n(output, m_NumComponents, OutT(0));
+        continue;
+      }
+
+      for(size_t j = 0; j < m_NumComponents; j++)
+      {
+        buffer.clear();
+        for(size_t k = segmentBegin; k < segmentEnd; k++)
+        {
+          StorageType value = static_cast<StorageType>(m_CellValues[m_SortedCells[k] * m_NumComponents + j]);
+          if(value == value)
+          {
+            buffer.push_back(value);
+          }
+        }
+        if(buffer.empty())
+        {
+          output[j] = static_cast<OutT>(m_CellValues[m_SortedCells[segmentBegin] * m_NumComponents + j]);
+          continue;
+        }
+
+        std::sort(buffer.begin(), buffer.end());
+        StorageType mode = buffer[0];
+        size_t modeCount = 0;
+        size_t runStart = 0;
+        for(size_t k = 1; k <= buffer.size(); k++)
+        {
+          if(k == buffer.size() || buffer[k] != buffer[runStart])
+          {
+            if(k - runStart > modeCount)
+            {
+              mode = buffer[runStart];
+              modeCount = k - runStart;
+            }
+            runStart = k;
+          }
+        }
+        output[j] = static_cast<OutT>(mode);
+      }
+    }
+  }
+
+public:
+  FeatureReducer(const FeatureReducer&) = delete;            // Copy Constructor Not Implemented
+  FeatureReducer(FeatureReducer&&) = delete;                 // Move Constructor Not Implemented
+  FeatureReducer& operator=(const FeatureReducer&) = delete; // Copy Assignment Not Implemented
+  FeatureReducer& operator=(FeatureReducer&&) = delete;      // Move Assignment Not Implemented
+};
+
+/**
+ * @brief The FeatureGatherImpl class copies Feature values back onto the cells of a range
+ */
+template <typename T>
+class FeatureGatherImpl
+{
+public:
+  FeatureGatherImpl(const T* featureValues, size_t numComponents, const int32_t* featureIds, size_t numFeatures, T* cellValues)
+  : m_FeatureValues(featureValues)
+  , m_NumComponents(numComponents)
+  , m_FeatureIds(featureIds)
+  , m_NumFeatures(numFeatures)
+  , m_CellValues(cellValues)
+  {
+  }
+  virtual ~FeatureGatherImpl() = default;
+
+  void operator()(const SIMPLRange& range) const
+  {
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      int32_t featureId = m_FeatureIds[i];
+      T* destination = m_CellValues + i * m_NumComponents;
+      if(featureId < 0 || static_cast<size_t>(featureId) >= m_NumFeatures)
+      {
+        std::fill_n(destination, m_NumComponents, T(0));
+        continue;
+      }
+      std::copy_n(m_FeatureValues + static_cast<size_t>(featureId) * m_NumComponents, m_NumComponents, destination);
+    }
+  }
+
+private:
+  const T* m_FeatureValues = nullptr;
+  size_t m_NumComponents = 0;
+  const int32_t* m_FeatureIds = nullptr;
+  size_t m_NumFeatures = 0;
+  T* m_CellValues = nullptr;
+};
+
+/**
+ * @brief Copies the values of each cell's Feature into cellValues, which must hold
+ * numCells * numComponents values. Cells with an out of range Feature Id are set to zero.
+ * @param featureValues The Feature values, numFeatures * numComponents values
+ * @param numComponents Number of components per tuple
+ * @param featureIds The Feature Id of each cell
+ * @param numCells Number of cells
+ * @param numFeatures Number of Features
+ * @param cellValues The output cell values
+ */
+template <typename T>
+void Gather(const T* featureValues, size_t numComponents, const int32_t* featureIds, size_t numCells, size_t numFeatures, T* cellValues)
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numCells);
+  dataAlg.execute(FeatureGatherImpl<T>(featureValues, numComponents, featureIds, numFeatures, cellValues));
+}
+
+} // namespace FeatureReduction
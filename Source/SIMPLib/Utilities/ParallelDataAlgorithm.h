@@ -38,6 +38,8 @@
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/SIMPLRange.h"
+#include "SIMPLib/DataArrays/MemoryResource.h"
+#include "SIMPLib/DataArrays/ScratchArena.h"
 
 // SIMPLib.h MUST be included before this or the guard will block the include but not its uses below.
 // This is consistent with previous behavior, only earlier parallelization split the includes between
@@ -114,7 +116,18 @@ public:
     if(doParallel)
     {
       tbb::blocked_range<size_t> tbbRange(m_Range[0], m_Range[1]);
-      tbb::parallel_for(tbbRange, body, m_Partitioner);
+      // Arrays created by the workers allocate from the memory resource of the calling thread, and temporary
+      // buffers are borrowed from its scratch arena
+      MemoryResource::Pointer resource = MemoryResource::GetCurrent();
+      ScratchArena::Pointer arena = ScratchArena::GetCurrent();
+      tbb::parallel_for(
+          tbbRange,
+          [&body, &resource, &arena](const tbb::blocked_range<size_t>& r) {
+            MemoryResource::ScopedCurrent resourceScope(resource);
+            ScratchArena::ScopedCurrent arenaScope(arena);
+            body(r);
+          },
+          m_Partitioner);
     }
 #endif
 
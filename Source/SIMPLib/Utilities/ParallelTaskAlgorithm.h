@@ -37,6 +37,8 @@
 #include <memory>
 
 #include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/MemoryResource.h"
+#include "SIMPLib/DataArrays/ScratchArena.h"
 
 // SIMPLib.h MUST be included before this or the guard will block the include but not its uses below.
 // This is consistent with previous behavior, only earlier parallelization split the includes between
@@ -97,7 +99,15 @@ public:
     doParallel = m_Parallelization;
     if(doParallel)
     {
-      m_TaskGroup->run(body);
+      // Arrays created by the task allocate from the memory resource of the calling thread, and temporary
+      // buffers are borrowed from its scratch arena
+      MemoryResource::Pointer resource = MemoryResource::GetCurrent();
+      ScratchArena::Pointer arena = ScratchArena::GetCurrent();
+      m_TaskGroup->run([body, resource, arena]() {
+        MemoryResource::ScopedCurrent resourceScope(resource);
+        ScratchArena::ScopedCurrent arenaScope(arena);
+        body();
+      });
       m_CurThreads++;
       if(m_CurThreads >= m_MaxThreads)
       {
@@ -16,9 +16,11 @@ set_source_files_properties( ${SIMPLib_${SUBDIR_NAME}_Generated_MOC_SRCS} PROPER
 
 
 set(SIMPLib_Utilities_HDRS
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ArrayKernels.hpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ColorTable.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ColorUtilities.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FilePathGenerator.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FeatureReduction.hpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FileSystemPathHelper.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FloatSummation.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/GenericDataParser.hpp
@@ -0,0 +1,248 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+#include "SIMPLib/Utilities/ArrayKernels.hpp"
+
+class ArrayKernelsTest
+{
+public:
+  ArrayKernelsTest() = default;
+  virtual ~ArrayKernelsTest() = default;
+
+  // Enough tuples to span several tiles and chunks
+  const size_t k_NumTuples = 150001;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T>
+  std::vector<T> GenerateValues(size_t count, std::mt19937& generator)
+  {
+    std::uniform_int_distribution<int32_t> distribution(-100, 100);
+    std::vector<T> values(count);
+    for(size_t i = 0; i < count; i++)
+    {
+      values[i] = static_cast<T>(distribution(generator));
+    }
+    return values;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestInterleave()
+  {
+    std::mt19937 generator(5489u);
+    const std::vector<size_t> inputComponents = {1, 3, 2, 6, 4};
+    std::vector<std::vector<float>> inputs;
+    std::vector<const float*> inputPointers;
+    size_t numComponents = 0;
+    for(size_t numComps : inputComponents)
+    {
+      inputs.push_back(GenerateValues<float>(k_NumTuples * numComps, generator));
+      inputPointers.push_back(inputs.back().data());
+      numComponents += numComps;
+    }
+
+    std::vector<float> output(k_NumTuples * numComponents, -1.0f);
+    ArrayKernels::Interleave(inputPointers, inputComponents, k_NumTuples, output.data());
+
+    std::vector<float> minValues;
+    std::vector<float> maxValues;
+    for(size_t input = 0; input < inputs.size(); input++)
+    {
+      std::vector<float> mins;
+      std::vector<float> maxs;
+      ArrayKernels::ComputeComponentRanges(inputPointers[input], inputComponents[input], k_NumTuples, mins, maxs);
+      minValues.insert(minValues.end(), mins.begin(), mins.end());
+      maxValues.insert(maxValues.end(), maxs.begin(), maxs.end());
+    }
+    std::vector<float> normalized(k_NumTuples * numComponents, -1.0f);
+    ArrayKernels::InterleaveNormalized(inputPointers, inputComponents, k_NumTuples, minValues, maxValues, normalized.data());
+
+    size_t offset = 0;
+    for(size_t input = 0; input < inputs.size(); input++)
+    {
+      const size_t numComps = inputComponents[input];
+      for(size_t k = 0; k < numComps; k++)
+      {
+        float minValue = std::numeric_limits<float>::max();
+        float maxValue = std::numeric_limits<float>::lowest();
+        for(size_t i = 0; i < k_NumTuples; i++)
+        {
+          minValue = std::min(minValue, inputs[input][i * numComps + k]);
+          maxValue = std::max(maxValue, inputs[input][i * numComps + k]);
+        }
+        DREAM3D_REQUIRE_EQUAL(minValues[offset + k], minValue)
+        DREAM3D_REQUIRE_EQUAL(maxValues[offset + k], maxValue)
+
+        for(size_t i = 0; i < k_NumTuples; i++)
+        {
+          const float value = inputs[input][i * numComps + k];
+          DREAM3D_REQUIRE_EQUAL(output[i * numComponents + offset + k], value)
+          DREAM3D_REQUIRE_EQUAL(normalized[i * numComponents + offset + k], (value - minValue) / (maxValue - minValue))
+        }
+      }
+      offset += numComps;
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T>
+  int TestDeinterleave(size_t numComponents)
+  {
+    std::mt19937 generator(5489u);
+    std::vector<T> input = GenerateValues<T>(k_NumTuples * numComponents, generator);
+    std::vector<std::vector<T>> outputs(numComponents, std::vector<T>(k_NumTuples));
+    std::vector<T*> outputPointers;
+    for(auto& output : outputs)
+    {
+      outputPointers.push_back(output.data());
+    }
+
+    ArrayKernels::Deinterleave(input.data(), numComponents, k_NumTuples, outputPointers);
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      for(size_t k = 0; k < numComponents; k++)
+      {
+        DREAM3D_REQUIRE_EQUAL(outputs[k][i], input[i * numComponents + k])
+      }
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename InT, typename OutT>
+  std::vector<OutT> Convert(const std::vector<InT>& input, ArrayKernels::ConversionMode mode)
+  {
+    std::vector<OutT> output(input.size());
+    ArrayKernels::Convert(input.data(), input.size(), output.data(), mode);
+    return output;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestConvert()
+  {
+    using ArrayKernels::ConversionMode;
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+
+    std::vector<uint8_t> u8 = Convert<float, uint8_t>({-5.0f, 300.0f, nan, 12.7f, 255.0f}, ConversionMode::Saturate);
+    DREAM3D_REQUIRE(u8 == std::vector<uint8_t>({0, 255, 0, 12, 255}))
+
+    std::vector<int8_t> i8 = Convert<int32_t, int8_t>({-1000, 1000, -128, 127, -3}, ConversionMode::Saturate);
+    DREAM3D_REQUIRE(i8 == std::vector<int8_t>({-128, 127, -128, 127, -3}))
+
+    std::vector<int64_t> i64 = Convert<uint64_t, int64_t>({std::numeric_limits<uint64_t>::max(), 42}, ConversionMode::Saturate);
+    DREAM3D_REQUIRE(i64 == std::vector<int64_t>({std::numeric_limits<int64_t>::max(), 42}))
+
+    std::vector<uint32_t> u32 = Convert<int64_t, uint32_t>({-1, 5000000000LL, 7}, ConversionMode::Saturate);
+    DREAM3D_REQUIRE(u32 == std::vector<uint32_t>({0, std::numeric_limits<uint32_t>::max(), 7}))
+
+    i64 = Convert<double, int64_t>({1.0e20, -1.0e20, -2.5}, ConversionMode::Saturate);
+    DREAM3D_REQUIRE(i64 == std::vector<int64_t>({std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::lowest(), -2}))
+
+    std::vector<float> f = Convert<uint8_t, float>({0, 255, 51}, ConversionMode::Normalize);
+    DREAM3D_REQUIRE(f == std::vector<float>({0.0f, 1.0f, 0.2f}))
+
+    f = Convert<int16_t, float>({-32768, -32767, 32767}, ConversionMode::Normalize);
+    DREAM3D_REQUIRE(f == std::vector<float>({-1.0f, -1.0f, 1.0f}))
+
+    u8 = Convert<float, uint8_t>({0.5f, 1.5f, -0.5f, 1.0f}, ConversionMode::Normalize);
+    DREAM3D_REQUIRE(u8 == std::vector<uint8_t>({128, 255, 0, 255}))
+
+    std::vector<int16_t> i16 = Convert<float, int16_t>({-1.0f, 0.0f}, ConversionMode::Normalize);
+    DREAM3D_REQUIRE(i16 == std::vector<int16_t>({-32767, 0}))
+
+    std::vector<uint16_t> u16 = Convert<uint8_t, uint16_t>({255, 1}, ConversionMode::Normalize);
+    DREAM3D_REQUIRE(u16 == std::vector<uint16_t>({65535, 257}))
+
+    std::vector<double> d = Convert<float, double>({2.5f, -300.0f}, ConversionMode::Normalize);
+    DREAM3D_REQUIRE(d == std::vector<double>({2.5, -300.0}))
+
+    std::vector<int32_t> i32 = Convert<float, int32_t>({3.9f, -3.9f}, ConversionMode::Cast);
+    DREAM3D_REQUIRE(i32 == std::vector<int32_t>({3, -3}))
+
+    const float floats[3] = {0.0f, 0.25f, nan};
+    bool bools[3] = {true, false, false};
+    ArrayKernels::Convert(floats, 3, bools, ConversionMode::Cast);
+    DREAM3D_REQUIRE(!bools[0] && bools[1] && bools[2])
+    ArrayKernels::Convert(floats, 3, bools, ConversionMode::Normalize);
+    DREAM3D_REQUIRE(!bools[0] && !bools[1])
+
+    std::vector<float> large(k_NumTuples);
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      large[i] = static_cast<float>(i) - 1000.0f;
+    }
+    std::vector<uint16_t> saturated = Convert<float, uint16_t>(large, ConversionMode::Saturate);
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(saturated[i], static_cast<uint16_t>(std::min(std::max(large[i], 0.0f), 65535.0f)))
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+    std::cout << "#### ArrayKernelsTest Starting ####" << std::endl;
+    DREAM3D_REGISTER_TEST(TestInterleave())
+    DREAM3D_REGISTER_TEST(TestDeinterleave<uint8_t>(2))
+    DREAM3D_REGISTER_TEST(TestDeinterleave<int16_t>(3))
+    DREAM3D_REGISTER_TEST(TestDeinterleave<float>(4))
+    DREAM3D_REGISTER_TEST(TestDeinterleave<double>(7))
+    DREAM3D_REGISTER_TEST(TestConvert())
+  }
+
+private:
+  ArrayKernelsTest(const ArrayKernelsTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const ArrayKernelsTest&) = delete;   // Move assignment Not Implemented
+};
@@ -0,0 +1,299 @@
+/* ============================================================================
+ * Copyright (c) 2009-2019 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the following contracts:
+ *    United States Air Force Prime Contract FA8650-15-D-5231
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <cmath>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+#include "SIMPLib/Utilities/FeatureReduction.hpp"
+
+class FeatureReductionTest
+{
+public:
+  FeatureReductionTest() = default;
+  virtual ~FeatureReductionTest() = default;
+
+  // Enough cells to split the reduction into several chunks
+  const size_t k_NumCells = 600000;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  std::vector<int32_t> GenerateFeatureIds(size_t numFeatures, std::mt19937& generator)
+  {
+    // Feature 0 stays empty and a few cells carry out of range ids
+    std::uniform_int_distribution<int32_t> distribution(1, static_cast<int32_t>(numFeatures) - 1);
+    std::vector<int32_t> featureIds(k_NumCells);
+    for(size_t i = 0; i < k_NumCells; i++)
+    {
+      featureIds[i] = distribution(generator);
+    }
+    featureIds[17] = -1;
+    featureIds[k_NumCells / 2] = static_cast<int32_t>(numFeatures);
+    return featureIds;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T>
+  std::vector<T> ComputeReference(FeatureReduction::Operation operation, const std::vector<T>& cellValues, size_t numComponents, const std::vector<int32_t>& featureIds, size_t numFeatures)
+  {
+    using AccumType = FeatureReduction::AccumulatorType<T>;
+    std::vector<T> result(numFeatures * numComponents, T(0));
+    std::vector<size_t> counts(numFeatures, 0);
+    std::vector<AccumType> sums(numFeatures * numComponents, AccumType(0));
+    std::vector<std::map<T, size_t>> histograms(numFeatures * numComponents);
+
+    for(size_t i = 0; i < featureIds.size(); i++)
+    {
+      int32_t featureId = featureIds[i];
+      if(featureId < 0 || featureId >= static_cast<int32_t>(numFeatures))
+      {
+        continue;
+      }
+      for(size_t j = 0; j < numComponents; j++)
+      {
+        size_t index = featureId * numComponents + j;
+        T value = cellValues[i * numComponents + j];
+        if(counts[featureId] == 0 || operation == FeatureReduction::Operation::Last || (operation == FeatureReduction::Operation::Minimum && value < result[index]) ||
+           (operation == FeatureReduction::Operation::Maximum && value > result[index]))
+        {
+          result[index] = value;
+        }
+        sums[index] += static_cast<AccumType>(value);
+        histograms[index][value]++;
+      }
+      counts[featureId]++;
+    }
+
+    for(size_t f = 0; f < numFeatures; f++)
+    {
+      for(size_t j = 0; j < numComponents && counts[f] > 0; j++)
+      {
+        size_t index = f * numComponents + j;
+        if(operation == FeatureReduction::Operation::Sum)
+        {
+          result[index] = static_cast<T>(sums[index]);
+        }
+        else if(operation == FeatureReduction::Operation::Mean)
+        {
+          result[index] = static_cast<T>(static_cast<double>(sums[index]) / static_cast<double>(counts[f]));
+        }
+        else if(operation == FeatureReduction::Operation::Mode)
+        {
+          size_t modeCount = 0;
+          for(const auto& entry : histograms[index])
+          {
+            if(entry.second > modeCount)
+            {
+              result[index] = entry.first;
+              modeCount = entry.second;
+            }
+          }
+        }
+      }
+    }
+    return result;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T>
+  void CompareOperations(const std::vector<T>& cellValues, size_t numComponents, const std::vector<int32_t>& featureIds, size_t numFeatures)
+  {
+    std::vector<FeatureReduction::Operation> operations = {FeatureReduction::Operation::First,   FeatureReduction::Operation::Last, FeatureReduction::Operation::Minimum,
+                                                           FeatureReduction::Operation::Maximum, FeatureReduction::Operation::Sum,  FeatureReduction::Operation::Mean,
+                                                           FeatureReduction::Operation::Mode};
+
+    FeatureReduction::FeatureReducer<T> reducer(cellValues.data(), numComponents, featureIds.data(), featureIds.size(), numFeatures);
+    for(FeatureReduction::Operation operation : operations)
+    {
+      std::vector<T> reference = ComputeReference(operation, cellValues, numComponents, featureIds, numFeatures);
+      std::vector<T> result(numFeatures * numComponents, T(1));
+      reducer.reduce(operation, result.data());
+
+      DREAM3D_REQUIRE_EQUAL(reducer.getNumberOfSkippedCells(), 2)
+      DREAM3D_REQUIRE_EQUAL(reducer.getNumberOfCells(0), 0)
+      for(size_t index = 0; index < result.size(); index++)
+      {
+        if(std::is_floating_point<T>::value && (operation == FeatureReduction::Operation::Sum || operation == FeatureReduction::Operation::Mean))
+        {
+          DREAM3D_REQUIRE(std::abs(static_cast<double>(result[index]) - static_cast<double>(reference[index])) <= 1.0E-4 * std::abs(static_cast<double>(reference[index])))
+        }
+        else
+        {
+          DREAM3D_REQUIRE_EQUAL(result[index], reference[index])
+        }
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestOperations()
+  {
+    std::mt19937 generator(5489u);
+    {
+      size_t numFeatures = 1000;
+      std::vector<int32_t> featureIds = GenerateFeatureIds(numFeatures, generator);
+      std::uniform_int_distribution<int32_t> distribution(-50, 50);
+      std::vector<int32_t> cellValues(k_NumCells * 3);
+      for(int32_t& value : cellValues)
+      {
+        value = distribution(generator);
+      }
+      CompareOperations<int32_t>(cellValues, 3, featureIds, numFeatures);
+    }
+    {
+      size_t numFeatures = 50;
+      std::vector<int32_t> featureIds = GenerateFeatureIds(numFeatures, generator);
+      std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+      std::vector<float> cellValues(k_NumCells);
+      for(float& value : cellValues)
+      {
+        value = std::floor(distribution(generator) * 20.0f) * 0.25f;
+      }
+      CompareOperations<float>(cellValues, 1, featureIds, numFeatures);
+    }
+    {
+      size_t numFeatures = 7;
+      std::vector<int32_t> featureIds = GenerateFeatureIds(numFeatures, generator);
+      std::bernoulli_distribution distribution(0.3);
+      std::vector<uint8_t> cellValues(k_NumCells * 2);
+      for(uint8_t& value : cellValues)
+      {
+        value = distribution(generator) ? 1 : 0;
+      }
+      CompareOperations<uint8_t>(cellValues, 2, featureIds, numFeatures);
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestUniformCheck()
+  {
+    size_t numFeatures = 64;
+    std::vector<int32_t> featureIds(k_NumCells);
+    std::vector<float> cellValues(k_NumCells);
+    for(size_t i = 0; i < k_NumCells; i++)
+    {
+      featureIds[i] = static_cast<int32_t>(i % numFeatures);
+      cellValues[i] = static_cast<float>(featureIds[i]) * 0.5f;
+    }
+
+    FeatureReduction::FeatureReducer<float> reducer(cellValues.data(), 1, featureIds.data(), k_NumCells, numFeatures);
+    reducer.setCheckUniform(true);
+    std::vector<float> featureValues(numFeatures);
+    reducer.reduce(FeatureReduction::Operation::Last, featureValues.data());
+    DREAM3D_REQUIRE_EQUAL(reducer.getFirstNonUniformFeature(), -1)
+    for(size_t f = 0; f < numFeatures; f++)
+    {
+      DREAM3D_REQUIRE_EQUAL(featureValues[f], static_cast<float>(f) * 0.5f)
+    }
+
+    // The reported Feature owns the lowest indexed cell that differs from its Feature's first cell
+    cellValues[k_NumCells - 3] = -1.0f;
+    cellValues[k_NumCells / 2 + 5] = -1.0f;
+    reducer.reduce(FeatureReduction::Operation::Last, featureValues.data());
+    DREAM3D_REQUIRE_EQUAL(reducer.getFirstNonUniformFeature(), featureIds[k_NumCells / 2 + 5])
+
+    // A whole chunk holding a different value is detected through its first cell
+    for(size_t i = k_NumCells / 4; i < k_NumCells; i++)
+    {
+      if(featureIds[i] == 9)
+      {
+        cellValues[i] = 100.0f;
+      }
+    }
+    reducer.reduce(FeatureReduction::Operation::Last, featureValues.data());
+    DREAM3D_REQUIRE_EQUAL(reducer.getFirstNonUniformFeature(), 9)
+    DREAM3D_REQUIRE_EQUAL(featureValues[9], 100.0f)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestGather()
+  {
+    size_t numFeatures = 100;
+    size_t numComponents = 2;
+    std::vector<double> featureValues(numFeatures * numComponents);
+    for(size_t i = 0; i < featureValues.size(); i++)
+    {
+      featureValues[i] = static_cast<double>(i) + 0.5;
+    }
+    std::vector<int32_t> featureIds(k_NumCells);
+    for(size_t i = 0; i < k_NumCells; i++)
+    {
+      featureIds[i] = static_cast<int32_t>((i * 7) % numFeatures);
+    }
+    featureIds[3] = -4;
+
+    std::vector<double> cellValues(k_NumCells * numComponents, -1.0);
+    FeatureReduction::Gather(featureValues.data(), numComponents, featureIds.data(), k_NumCells, numFeatures, cellValues.data());
+    for(size_t i = 0; i < k_NumCells; i++)
+    {
+      for(size_t j = 0; j < numComponents; j++)
+      {
+        double expected = (featureIds[i] < 0) ? 0.0 : featureValues[featureIds[i] * numComponents + j];
+        DREAM3D_REQUIRE_EQUAL(cellValues[i * numComponents + j], expected)
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### FeatureReductionTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestOperations());
+    DREAM3D_REGISTER_TEST(TestUniformCheck());
+    DREAM3D_REGISTER_TEST(TestGather());
+  }
+
+private:
+  FeatureReductionTest(const FeatureReductionTest&); // Copy Constructor Not Implemented
+  void operator=(const FeatureReductionTest&);       // Move assignment Not Implemented
+};
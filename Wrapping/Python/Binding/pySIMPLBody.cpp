@@ -203,6 +203,45 @@ registerDataContainer(instanceDataContainer);
 registerAttributeMatrix(instanceAttributeMatrix);
 registerDataArrayPath(instanceDataArrayPath);
 
+mod.def(
+    "exportSharedMemory",
+    [](const DataContainerArray::Pointer& dca, const QString& name) {
+      QString errorMessage;
+      if(SharedMemoryDataExchange::Export(dca, name, &errorMessage) < 0)
+      {
+        throw std::runtime_error(errorMessage.toStdString());
+      }
+    },
+    "dca"_a, "name"_a);
+
+mod.def(
+    "importSharedMemory",
+    [](const QString& name) {
+      QString errorMessage;
+      DataContainerArray::Pointer dca = SharedMemoryDataExchange::Import(name, &errorMessage);
+      if(nullptr == dca)
+      {
+        throw std::runtime_error(errorMessage.toStdString());
+      }
+      return dca;
+    },
+    "name"_a);
+
+mod.def(
+    "sharedMemoryDescriptor",
+    [](const QString& name) {
+      QString errorMessage;
+      QJsonObject descriptor = SharedMemoryDataExchange::ReadDescriptor(name, &errorMessage);
+      if(descriptor.isEmpty())
+      {
+        throw std::runtime_error(errorMessage.toStdString());
+      }
+      return QString(QJsonDocument(descriptor).toJson(QJsonDocument::Compact));
+    },
+    "name"_a);
+
+mod.def("unlinkSharedMemory", &SharedMemoryDataExchange::Unlink, "name"_a);
+
 #ifdef SIMPL_EMBED_PYTHON
 py::class_<PythonSupport::FilterDelegate>(mod, "FilterDelegateCpp")
     .def("notifyStatusMessage", &PythonSupport::FilterDelegate::notifyStatusMessage)
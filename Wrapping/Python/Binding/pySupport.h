@@ -2,6 +2,8 @@
 
 #include <stdexcept>
 
+#include <QtCore/QJsonDocument>
+
 #include <pybind11/pybind11.h>
 
 #include <pybind11/numpy.h>
@@ -12,6 +14,7 @@
 #include "SIMPLib/DataContainers/AttributeMatrix.h"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/DataContainers/SharedMemoryDataExchange.h"
 
 #ifdef SIMPL_EMBED_PYTHON
 #include "SIMPLib/Python/FilterPyObject.h"